@@ -14,6 +14,11 @@ namespace ipu {
 
 class AccBootOverrideHandler {
 public:
+    /*!
+     * @brief Compiles the schema of the boot override configuration once, before the files are read.
+     * */
+    static void register_schema();
+
     /*!
      * @brief Reads the boot override configuration and sets the view.
      * Intended to be called on ipu::Service startup, hence the name.
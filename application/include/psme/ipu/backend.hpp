@@ -0,0 +1,88 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "agent-framework/module/enum/common.hpp"
+#include "json-wrapper/json-wrapper.hpp"
+#include "psme/ipu/cpchnl_channel.hpp"
+#include "psme/ipu/ipu_update_handler.hpp"
+
+#include <memory>
+#include <string>
+
+namespace psme {
+namespace ipu {
+
+/*!
+ * @brief Backend performing the operations of the service on the IPU.
+ *
+ * The device backend talks to the hardware, the simulator backend allows to
+ * run and load test the service on any Linux host, see SimulatorBackend.
+ */
+class Backend {
+public:
+    virtual ~Backend();
+
+    /*!
+     * @brief Get the configured backend
+     * @return Backend, the device backend if none was configured
+     */
+    static Backend& get_instance();
+
+    /*!
+     * @brief Select the backend from the "backend" section of the configuration
+     * @param[in] config Configuration of the service
+     * @throw std::runtime_error if the backend could not be started
+     */
+    static void configure(const json::Json& config);
+
+    /*!
+     * @brief Create transport of CPChannel commands
+     * @return Transport
+     */
+    virtual std::unique_ptr<CpchnlTransport> create_cpchnl_transport() = 0;
+
+    /*!
+     * @brief Query versions of the firmware components
+     * @return Versions
+     * @throw std::exception if the versions could not be queried
+     */
+    virtual InventoryVersion get_component_info() = 0;
+
+    /*!
+     * @brief Flash an update package
+     * @param[in] package_path Path of the PLDM package
+     * @return Reset type required to apply the update
+     * @throw std::exception if the update failed
+     */
+    virtual std::string run_update(const std::string& package_path) = 0;
+
+    /*!
+     * @brief Get build of the IMC firmware
+     * @return Firmware build
+     */
+    virtual std::string get_firmware_build() = 0;
+
+    /*!
+     * @brief Reset the IMC, the service itself runs on
+     * @param[in] reset_type Requested reset type
+     * @throw std::exception if the reset failed
+     */
+    virtual void reset_imc(const agent_framework::model::enums::ResetType& reset_type) = 0;
+};
+
+/*!
+ * @brief Backend talking to the IPU the service runs on
+ */
+class DeviceBackend : public Backend {
+public:
+    std::unique_ptr<CpchnlTransport> create_cpchnl_transport() override;
+    InventoryVersion get_component_info() override;
+    std::string run_update(const std::string& package_path) override;
+    std::string get_firmware_build() override;
+    void reset_imc(const agent_framework::model::enums::ResetType& reset_type) override;
+};
+
+} // namespace ipu
+} // namespace psme
@@ -7,6 +7,9 @@
 #include "agent-framework/module/enum/compute.hpp"
 #include "agent-framework/module/utils/optional_field.hpp"
 
+#include <cstdint>
+#include <string>
+
 namespace psme {
 namespace ipu {
 
@@ -15,21 +18,49 @@ namespace ipu {
  */
 class BaseService {
 public:
-    virtual void trigger_acc_reset(const agent_framework::model::enums::ResetType& reset_type) = 0;
+    /*!
+     * @brief Request reset of the ACC, the device is not waited for
+     * @param[in] reset_type Requested reset type
+     * @param[out] task_uuid UUID of the task completing once the device acknowledged the request
+     * */
+    virtual void trigger_acc_reset(const agent_framework::model::enums::ResetType& reset_type,
+                                   std::string& task_uuid) = 0;
 
     virtual void trigger_imc_reset(const agent_framework::model::enums::ResetType& reset_type) = 0;
 
     virtual void trigger_ipu_update(const std::string& img,
                                     const OptionalField<std::string>& username,
                                     const OptionalField<std::string>& password,
+                                    const OptionalField<std::string>& image_sha256,
                                     std::string& task_uuid) = 0;
 
+    /*!
+     * @brief Reserve the update staging area for a package pushed by the client
+     * @param[in,out] package_size Size announced by the client, 0 if unknown.
+     * Set to the maximum size of the package.
+     * @return Path the package is to be written to
+     * @throw ServerException if another update is in progress or there is not enough space
+     * */
+    virtual std::string reserve_ipu_update(std::uint64_t& package_size) = 0;
+
+    /*!
+     * @brief Start update from the package written to the reserved staging area
+     * @param[out] task_uuid UUID of the update task
+     * */
+    virtual void trigger_ipu_push_update(std::string& task_uuid) = 0;
+
+    /*!
+     * @brief Release the reserved staging area, the partial package is removed
+     * */
+    virtual void release_ipu_update() = 0;
+
     virtual void set_acc_boot_override(OptionalField<agent_framework::model::enums::BootOverride>,
                                        OptionalField<agent_framework::model::enums::BootOverrideTarget>) = 0;
 
     virtual void insert_virtual_media(const std::string& img, const agent_framework::model::enums::TransferMethod& transfer_method,
                                       const OptionalField<std::string>& username,
                                       const OptionalField<std::string>& password,
+                                      const OptionalField<std::string>& image_sha256,
                                       std::string& task_uuid) = 0;
 
     virtual void eject_virtual_media() = 0;
@@ -0,0 +1,139 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+namespace psme {
+namespace ipu {
+
+/*! @brief Command sent over the CPChannel */
+struct CpchnlCommand {
+    /*! @brief Opcode of the command */
+    std::uint32_t opcode{0};
+    /*! @brief First parameter of the command */
+    std::uint32_t param_0{0};
+    /*! @brief Time the response is waited for */
+    std::chrono::milliseconds timeout{1000};
+};
+
+/*!
+ * @brief Transport carrying tagged CPChannel commands to the device.
+ *
+ * All functions are called from the I/O thread of the channel only.
+ */
+class CpchnlTransport {
+public:
+    /*! @brief Tag matching a completion to its command */
+    using Tag = std::uint64_t;
+
+    /*! @brief Completion of a command */
+    struct Completion {
+        /*! @brief Tag of the completed command */
+        Tag tag{0};
+        /*! @brief Description of the failure, empty if the command succeeded */
+        std::string error{};
+    };
+
+    virtual ~CpchnlTransport();
+
+    /*!
+     * @brief Get number of commands the protocol allows to be outstanding at once
+     * @return Number of commands, at least 1
+     */
+    virtual std::size_t get_max_outstanding() const = 0;
+
+    /*!
+     * @brief Send a command
+     * @param[in] tag Tag of the command
+     * @param[in] command Command to send
+     * @throw std::exception if the command could not be sent
+     */
+    virtual void send(Tag tag, const CpchnlCommand& command) = 0;
+
+    /*!
+     * @brief Wait for completion of any outstanding command
+     * @param[in] timeout Time to wait at most
+     * @return Completion, empty if none arrived in time
+     */
+    virtual std::optional<Completion> receive(std::chrono::milliseconds timeout) = 0;
+};
+
+/*!
+ * @brief Asynchronous CPChannel command channel.
+ *
+ * Commands are tagged and queued to a single I/O thread which keeps as many
+ * of them outstanding as the transport allows and completes each one through
+ * its future, so callers don't block for the round trip to the device.
+ */
+class CpchnlChannel {
+public:
+    /*! @brief Longest time the I/O thread waits for completions before sending queued commands */
+    static constexpr std::chrono::milliseconds POLL_INTERVAL{10};
+
+    /*!
+     * @brief Constructor, starts the I/O thread
+     * @param[in] transport Transport of the commands
+     */
+    explicit CpchnlChannel(std::unique_ptr<CpchnlTransport> transport);
+
+    CpchnlChannel(const CpchnlChannel&) = delete;
+    CpchnlChannel& operator=(const CpchnlChannel&) = delete;
+
+    /*!
+     * @brief Destructor, stops the I/O thread and fails commands not completed yet
+     */
+    ~CpchnlChannel();
+
+    /*!
+     * @brief Queue a command
+     * @param[in] command Command to send
+     * @return Future becoming ready once the command completes, holding
+     * std::runtime_error if it failed, timed out, its completion could not
+     * be received or the channel was stopped
+     */
+    std::future<void> submit(const CpchnlCommand& command);
+
+private:
+    struct Request {
+        CpchnlTransport::Tag tag;
+        CpchnlCommand command;
+        std::promise<void> promise;
+    };
+
+    struct Outstanding {
+        std::promise<void> promise;
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    void run();
+    void send(Request& request);
+    void complete(const CpchnlTransport::Completion& completion);
+    void fail_outstanding(const std::string& error);
+    void expire();
+
+    std::unique_ptr<CpchnlTransport> m_transport;
+    std::mutex m_mutex{};
+    std::condition_variable m_queued{};
+    std::deque<Request> m_queue{};
+    CpchnlTransport::Tag m_next_tag{1};
+    bool m_stopping{false};
+    // Touched by the I/O thread only
+    std::map<CpchnlTransport::Tag, Outstanding> m_outstanding{};
+    std::thread m_thread{};
+};
+
+} // namespace ipu
+} // namespace psme
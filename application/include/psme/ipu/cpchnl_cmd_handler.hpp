@@ -4,12 +4,10 @@
 #pragma once
 
 #include "agent-framework/module/enum/common.hpp"
+#include "psme/ipu/cpchnl_channel.hpp"
 
-#ifdef INTEL_IPU
-namespace dcqlxx {
-class Dcqlxx;
-}
-#endif
+#include <future>
+#include <memory>
 
 namespace psme {
 namespace ipu {
@@ -19,13 +17,33 @@ namespace ipu {
  */
 class CpchnlCmdHandler {
 public:
+    /*! @brief Constructor, commands are sent through the configured backend */
     CpchnlCmdHandler();
+
+    /*!
+     * @brief Constructor
+     * @param[in] transport Transport of the commands
+     */
+    explicit CpchnlCmdHandler(std::unique_ptr<CpchnlTransport> transport);
+
     ~CpchnlCmdHandler() = default;
-    void trigger_acc_reset(agent_framework::model::enums::ResetType);
-#ifdef INTEL_IPU
+
+    /*!
+     * @brief Request reset of the ACC
+     * @param[in] reset_type GracefulShutdown or GracefulRestart
+     * @return Future becoming ready once the device acknowledged the request
+     * @throw std::runtime_error if the reset type is not supported
+     */
+    std::future<void> trigger_acc_reset(agent_framework::model::enums::ResetType reset_type);
+
+    /*!
+     * @brief Create transport to the device of the build
+     * @return Transport
+     */
+    static std::unique_ptr<CpchnlTransport> create_device_transport();
+
 private:
-    dcqlxx::Dcqlxx& m_dcqlxx;
-#endif
+    CpchnlChannel m_channel;
 };
 
 } // namespace ipu
@@ -6,56 +6,189 @@
 #include "agent-framework/module/enum/common.hpp"
 #include "agent-framework/module/utils/optional_field.hpp"
 #include "curl/curl.h"
+#include "ipu/download_checkpoints.hpp"
+#include "ipu/file_writer.hpp"
+#include "ipu/image_cache.hpp"
+#include "ipu/lazy_image.hpp"
+#include "ipu/stream_decoder.hpp"
 #include "logger/logger.hpp"
-#include <cstdio>
+#include "utils/crypt_utils.hpp"
+#include <chrono>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 
 namespace psme {
 namespace ipu {
 
-/*!
- * @brief Structure to keep download state
- */
-struct CurlFile {
-    std::unique_ptr<FILE, std::function<int(FILE*)>> handle; // file we are writing to
-    curl_off_t size = 0;                                     // its size
-    size_t chunks = 0;                                       // number of chunks the file is broken into (calculated as `size / CHUNK_SIZE`)
-    size_t current_chunk = 0;                                // chunk we are currently processing
-    size_t extra_bytes = 0;                                  // calculated as `size % CHUNK_SIZE` - non-zero for files that have sizes not multiple of CHUNK_SIZE
-    size_t downloaded = 0;                                   // bytes downloaded so far
-    CurlFile() : handle(nullptr, [](FILE* file) { if(file) fclose(file); return 0; }) {}
-};
-
 /*!
  * @brief Curl Handler declaration
+ *
+ * An interrupted transfer is resumed with a Range request, provided the
+ * server identified the file with an ETag or Last-Modified validator.
+ * Progress is checkpointed in DownloadCheckpoints, so a download of the
+ * same URL to the same file also resumes after a service restart.
+ *
+ * Large files may be downloaded in segments, see set_segments().
+ *
+ * An expected SHA-256 digest is verified while the file is written, so the
+ * file is not read again after the download. Segments received ahead are
+ * hashed as soon as the data before them is.
+ *
+ * Images compressed with gzip or zstd, as told by the Content-Type or
+ * the extension in the URL, are decompressed while they are received. The
+ * maximum file size applies to the decompressed image. Such downloads are
+ * neither resumed nor segmented.
+ *
+ * With an image cache, an image with the expected digest is taken from the
+ * cache without any request. Otherwise a cached image of the URL is
+ * revalidated with If-None-Match or If-Modified-Since and downloaded only if
+ * it changed. Downloaded images are added to the cache.
  */
 class CurlHandler {
 public:
+    /*! @brief Called with the bytes downloaded and the size of the file, 0 if unknown */
+    using ProgressCallback = std::function<void(std::uint64_t, std::uint64_t)>;
+
+    /*! @brief Number of times an interrupted transfer is resumed */
+    static constexpr unsigned RETRY_ATTEMPTS = 5;
+
+    /*! @brief Delay before the first resume, doubled for each next one */
+    static constexpr std::chrono::milliseconds RETRY_INTERVAL{1000};
+
+    /*! @brief Longest delay between resumes */
+    static constexpr std::chrono::milliseconds MAX_RETRY_INTERVAL{30000};
+
+    /*! @brief A transfer not receiving any data for this long is interrupted */
+    static constexpr std::chrono::seconds STALL_TIMEOUT{60};
+
+    /*! @brief Files are not split into segments smaller than this */
+    static constexpr std::uint64_t MIN_SEGMENT_SIZE = 8 * 1024 * 1024;
+
     CurlHandler();
     ~CurlHandler();
+    CurlHandler(const CurlHandler&) = delete;
+    CurlHandler& operator=(const CurlHandler&) = delete;
     CurlHandler& set_url(const std::string& url);
     CurlHandler& set_file_name(const std::string& file);
     CurlHandler& set_max_file_size(uint64_t file_size);
     CurlHandler& set_progress_report();
+
+    /*!
+     * @brief Set callback receiving progress of the download
+     * @param[in] on_progress Called from the downloading thread whenever data is received
+     */
+    CurlHandler& set_progress_callback(ProgressCallback on_progress);
     CurlHandler& set_credentials(const OptionalField<std::string>& username,
                                  const OptionalField<std::string>& password);
+
+    /*!
+     * @brief Set allowed protocols, only HTTPS is allowed by default
+     * @param[in] protocols Bitmask of CURLPROTO_* values
+     */
+    CurlHandler& set_protocols(long protocols);
+
+    /*!
+     * @brief Set how interrupted transfers are resumed
+     * @param[in] attempts Number of times an interrupted transfer is resumed
+     * @param[in] interval Delay before the first resume
+     */
+    CurlHandler& set_retry_policy(unsigned attempts, std::chrono::milliseconds interval);
+
+    /*!
+     * @brief Download the file in concurrent Range requests
+     *
+     * Used only if the server supports ranges and identifies the file with a
+     * validator, and the download is not resumed from a checkpoint. Otherwise
+     * the file is downloaded in a single request.
+     *
+     * @param[in] segments Largest number of concurrent requests
+     */
+    CurlHandler& set_segments(unsigned segments);
+
+    /*!
+     * @brief Set SHA-256 digest the downloaded file must have
+     * @param[in] sha256 Hexadecimal digest, no verification if not set
+     */
+    CurlHandler& set_expected_digest(const OptionalField<std::string>& sha256);
+
+    /*!
+     * @brief Reuse images downloaded before
+     * @param[in] cache Cache images are taken from and stored in, not used if nullptr
+     */
+    CurlHandler& set_image_cache(ImageCache* cache);
+
     void run_request();
+
+    /*!
+     * @brief Open the file as an image fetched while it is read, instead of downloading it
+     * @return Image with the blocks fetched before, if any
+     * @throw std::runtime_error if the server does not support ranges or does not identify the file
+     */
+    std::unique_ptr<LazyImage> open_lazy();
+
+    /*!
+     * @brief Check if a failed transfer may succeed when retried
+     * @param[in] handle Handle of the transfer
+     * @param[in] code Result of the transfer
+     * @return true for network errors and server errors
+     */
+    static bool is_retryable(CURL* handle, CURLcode code);
 private:
-    void get_file_size();
-    void perform_curl_request();
+    void check_free_space();
+    void enable_progress();
+    void report_progress(std::uint64_t done, std::uint64_t total);
+    std::uint64_t probe_size();
+    void run_segmented_request(std::uint64_t size, unsigned segments);
+    void start_transfer();
+    void start_decoding();
+    void write_decoded(const char* data, std::size_t size);
+    void prepare_digest();
+    void verify_digest() const;
+    bool restore_cached();
+    CURLcode perform_curl_request();
+    bool is_resumable(const DownloadCheckpoints::Checkpoint& checkpoint) const;
+    void save_checkpoint(std::uint64_t offset);
 
     template <typename ParamT>
     void try_curl_setopt(CURLoption opt, ParamT param);
     static size_t progress_callback(void* clientp, curl_off_t dltotal, curl_off_t dlnow,
                                     curl_off_t ultotal, curl_off_t ulnow);
-    static size_t write_data_callback(void* data, size_t size, size_t nmemb, CurlFile* curl_file);
+    static size_t write_data_callback(char* data, size_t size, size_t nmemb, void* userdata);
+    static size_t probe_callback(char* data, size_t size, size_t nmemb, void* userdata);
+    static size_t header_callback(char* data, size_t size, size_t nmemb, void* userdata);
     static int log_callback(CURL* handle, curl_infotype type, char* data, size_t size, void* clientp);
 
     std::unique_ptr<CURL, void (*)(CURL*)> m_curl_handle;
     size_t m_progress;
-    CurlFile m_curl_file;
-    bool m_chunk_mode = false;
+    bool m_progress_report{false};
+    ProgressCallback m_on_progress{};
+    std::uint64_t m_max_file_size{0};
+    std::string m_url{};
+    std::string m_file_name{};
+    std::unique_ptr<FileWriter> m_file_writer{};
+    std::string m_write_error{};
+    std::unique_ptr<curl_slist, void (*)(curl_slist*)> m_request_headers{nullptr, curl_slist_free_all};
+    // Synced by the writer thread, guarded by m_checkpoint_mutex while a transfer runs
+    DownloadCheckpoints::Checkpoint m_checkpoint{};
+    std::mutex m_checkpoint_mutex{};
+    // Offset the current transfer started from
+    std::uint64_t m_resume_offset{0};
+    std::string m_response_validator{};
+    std::string m_response_content_type{};
+    std::unique_ptr<StreamDecoder> m_decoder{};
+    std::uint64_t m_response_total_size{0};
+    bool m_response_started{false};
+    unsigned m_retry_attempts{RETRY_ATTEMPTS};
+    std::chrono::milliseconds m_retry_interval{RETRY_INTERVAL};
+    unsigned m_segments{1};
+    std::string m_expected_digest{};
+    std::unique_ptr<utils::Sha256> m_digest{};
+    std::uint64_t m_digest_size{0};
+    ImageCache* m_image_cache{nullptr};
+    ImageCache::Entry m_cached{};
 };
 
 template <typename ParamT>
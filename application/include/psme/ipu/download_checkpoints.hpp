@@ -0,0 +1,73 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "agent-framework/generic/singleton.hpp"
+#include "database/database.hpp"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace psme {
+namespace ipu {
+
+/*!
+ * @brief Keeps progress of interrupted downloads.
+ *
+ * A checkpoint is stored in the database under the path of the downloaded
+ * file, so a download of the same URL continues from the checkpoint also
+ * after the service is restarted.
+ */
+class DownloadCheckpoints : public agent_framework::generic::Singleton<DownloadCheckpoints> {
+public:
+    /*! @brief Progress of a download */
+    struct Checkpoint {
+        /*! @brief URL the file is downloaded from */
+        std::string url{};
+        /*! @brief Number of bytes synced to the file */
+        std::uint64_t offset{};
+        /*! @brief ETag or Last-Modified of the downloaded resource */
+        std::string validator{};
+    };
+
+    /*!
+     * @brief Constructor, opens the database.
+     * @param[in] database_name Name of the database checkpoints are stored in.
+     */
+    explicit DownloadCheckpoints(const std::string& database_name = "downloads");
+
+    /*!
+     * @brief Destructor, releases the database name.
+     */
+    virtual ~DownloadCheckpoints();
+
+    /*!
+     * @brief Get checkpoint of a file
+     * @param[in] file_name Path of the downloaded file
+     * @param[out] checkpoint Stored checkpoint
+     * @return true if there is a valid checkpoint
+     */
+    bool get(const std::string& file_name, Checkpoint& checkpoint) const;
+
+    /*!
+     * @brief Store checkpoint of a file
+     * @param[in] file_name Path of the downloaded file
+     * @param[in] checkpoint Checkpoint to store
+     */
+    void put(const std::string& file_name, const Checkpoint& checkpoint);
+
+    /*!
+     * @brief Remove checkpoint of a file
+     * @param[in] file_name Path of the downloaded file
+     */
+    void del(const std::string& file_name);
+
+private:
+    mutable std::mutex m_mutex{};
+    database::Database::SPtr m_database;
+};
+
+} // namespace ipu
+} // namespace psme
@@ -0,0 +1,56 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "json-wrapper/json-wrapper.hpp"
+
+#include <chrono>
+#include <string>
+
+namespace psme {
+namespace ipu {
+
+/*!
+ * @brief Latency and error distribution of a simulated operation.
+ *
+ * Latency is uniformly distributed within the jitter around its mean, each
+ * operation fails independently with the error rate.
+ */
+struct FaultProfile {
+    /*! @brief Mean latency */
+    std::chrono::milliseconds latency{0};
+    /*! @brief Largest deviation of the latency from its mean */
+    std::chrono::milliseconds jitter{0};
+    /*! @brief Probability of an operation failing, from 0 to 1 */
+    double error_rate{0.0};
+
+    /*!
+     * @brief Read profile from the configuration
+     * @param[in] json Object with "latency-ms", "jitter-ms" and "error-rate", missing keys are 0
+     * @return Profile
+     */
+    static FaultProfile from_json(const json::Json& json);
+
+    /*!
+     * @brief Draw latency of an operation
+     * @return Latency, not negative
+     */
+    std::chrono::milliseconds sample_latency() const;
+
+    /*!
+     * @brief Draw whether an operation fails
+     * @return True if the operation fails
+     */
+    bool sample_error() const;
+
+    /*!
+     * @brief Simulate an operation, waits for a drawn latency
+     * @param[in] operation Name of the operation reported on failure
+     * @throw std::runtime_error if the operation is drawn to fail
+     */
+    void apply(const std::string& operation) const;
+};
+
+} // namespace ipu
+} // namespace psme
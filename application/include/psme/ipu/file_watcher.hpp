@@ -0,0 +1,78 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace psme {
+namespace ipu {
+
+/*!
+ * @brief Waits for changes of files with inotify.
+ *
+ * The directories of the files are watched, so files which are created,
+ * replaced by a rename or removed are noticed as well. A burst of changes,
+ * e.g. a file written in several steps, is reported once after the files
+ * stay unchanged for the debounce period. Directories which cannot be
+ * watched are retried on each wait, until then the wait only times out.
+ */
+class FileWatcher {
+public:
+    /*! @brief Changes are reported once the files stay unchanged for this period */
+    static constexpr std::chrono::milliseconds DEBOUNCE{50};
+
+    /*! @brief Longest time changes are delayed by a burst of further changes */
+    static constexpr std::chrono::milliseconds MAX_DEBOUNCE{1000};
+
+    /*!
+     * @brief Constructor
+     * @param[in] files Paths of the watched files
+     */
+    explicit FileWatcher(const std::vector<std::string>& files);
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    /*!
+     * @brief Destructor, closes the watches
+     */
+    ~FileWatcher();
+
+    /*!
+     * @brief Wait until one of the files changes
+     * @param[in] timeout Longest time to wait
+     * @return true if a file changed, false on timeout or once interrupted
+     */
+    bool wait(std::chrono::milliseconds timeout);
+
+    /*!
+     * @brief End the current and all further waits
+     */
+    void interrupt();
+
+    /*!
+     * @brief Check if the watcher was interrupted
+     * @return true after interrupt() was called
+     */
+    bool is_interrupted() const;
+
+private:
+    struct Directory {
+        std::string path{};
+        std::vector<std::string> names{};
+        int watch{-1};
+    };
+
+    void add_watches();
+    bool read_events();
+
+    std::vector<Directory> m_directories{};
+    int m_inotify_fd{-1};
+    int m_event_fd{-1};
+};
+
+} // namespace ipu
+} // namespace psme
@@ -0,0 +1,116 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace psme {
+namespace ipu {
+
+/*!
+ * @brief Double-buffered writer of downloaded files.
+ *
+ * The producer fills one buffer while a writer thread writes the other one to
+ * the file, so receiving data and writing it to flash overlap. Buffers are
+ * page aligned and written whole, and written data is periodically synced and
+ * dropped from the page cache, so memory use is bounded by the two buffers.
+ */
+class FileWriter {
+public:
+    /*! @brief Called with the size of the file each time the file is synced */
+    using SyncCallback = std::function<void(std::uint64_t)>;
+
+    /*! @brief Called with each piece of data once it is written to the file, in file order */
+    using DataCallback = std::function<void(const char*, std::size_t)>;
+
+    /*! @brief Size of each of the two buffers */
+    static constexpr std::size_t BUFFER_SIZE = 8 * 1024 * 1024;
+
+    /*! @brief Alignment of the buffers */
+    static constexpr std::size_t ALIGNMENT = 4096;
+
+    /*! @brief Written data is synced to the file every this many bytes */
+    static constexpr std::uint64_t SYNC_INTERVAL = 256 * 1024 * 1024;
+
+    /*!
+     * @brief Open the file and start the writer thread
+     * @param[in] path Path of the file
+     * @param[in] offset The file is truncated to this size and appended to
+     * @param[in] on_sync Called from the writer thread after the file is synced
+     * @param[in] on_data Called from the writer thread with the written data
+     * @throw std::runtime_error if the file cannot be opened
+     */
+    explicit FileWriter(const std::string& path, std::uint64_t offset = 0, SyncCallback on_sync = {},
+                        DataCallback on_data = {});
+
+    /*!
+     * @brief Stop the writer thread and close the file, pending data is discarded
+     */
+    ~FileWriter();
+
+    FileWriter(const FileWriter&) = delete;
+    FileWriter(FileWriter&&) = delete;
+    FileWriter& operator=(const FileWriter&) = delete;
+    FileWriter& operator=(FileWriter&&) = delete;
+
+    /*!
+     * @brief Append data to the file, blocks while both buffers are full
+     * @param[in] data Data to write
+     * @param[in] size Size of the data
+     * @throw std::runtime_error if writing the file failed
+     */
+    void write(const char* data, std::size_t size);
+
+    /*!
+     * @brief Write the pending data, sync and close the file
+     * @throw std::runtime_error if writing the file failed
+     */
+    void close();
+
+    /*!
+     * @brief Get size of the file including data not written yet
+     * @return Number of bytes
+     */
+    std::uint64_t get_size() const {
+        return m_size;
+    }
+
+private:
+    using Buffer = std::unique_ptr<char, decltype(&std::free)>;
+
+    static Buffer allocate_buffer();
+    void submit(std::unique_lock<std::mutex>& lock);
+    void run();
+    void write_file(const char* data, std::size_t size);
+    void stop();
+
+    std::string m_path;
+    SyncCallback m_on_sync;
+    DataCallback m_on_data;
+    int m_fd{-1};
+    Buffer m_fill;
+    std::size_t m_fill_size{0};
+    Buffer m_drain;
+    std::size_t m_drain_size{0};
+    bool m_pending{false};
+    bool m_running{true};
+    std::string m_error{};
+    std::uint64_t m_size{0};
+    std::uint64_t m_written{0};
+    std::uint64_t m_synced{0};
+    std::mutex m_mutex{};
+    std::condition_variable m_cv{};
+    std::thread m_thread{};
+};
+
+} // namespace ipu
+} // namespace psme
@@ -0,0 +1,161 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "agent-framework/generic/singleton.hpp"
+#include "database/database.hpp"
+#include "ipu/ipu_constants.hpp"
+#include "json-wrapper/json-wrapper.hpp"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace psme {
+namespace ipu {
+
+/*!
+ * @brief Local cache of downloaded images.
+ *
+ * Images are stored once under their SHA-256 digest, so the same image
+ * downloaded from several URLs takes space once. The database maps a URL to
+ * the digest and to the ETag or Last-Modified validator the server sent,
+ * which is used to revalidate the image instead of downloading it again.
+ *
+ * Images are stored as hard links or reflinks of the downloaded file. An
+ * image on a file system allowing neither is copied if it is not larger than
+ * the copy limit, and not cached otherwise. Cached images are handed out the
+ * same way, and copied if the destination does not allow it.
+ * The least recently used images are evicted to keep the cache within its
+ * capacity.
+ */
+class ImageCache : public agent_framework::generic::Singleton<ImageCache> {
+public:
+    /*! @brief Cached image of a URL */
+    struct Entry {
+        /*! @brief URL the image was downloaded from */
+        std::string url{};
+        /*! @brief ETag or Last-Modified of the downloaded resource, may be empty */
+        std::string validator{};
+        /*! @brief Hexadecimal SHA-256 digest of the image */
+        std::string sha256{};
+        /*! @brief Size of the image */
+        std::uint64_t size{};
+        /*! @brief Modification time of the stored image, it is verified again if changed */
+        std::int64_t modified{};
+        /*! @brief Nanoseconds since the epoch the image was last used */
+        std::int64_t last_used{};
+    };
+
+    /*! @brief Location, capacity and copy limit of the cache */
+    struct Settings {
+        /*! @brief Directory the images are stored in */
+        std::string directory{constants::IMAGE_CACHE_DIRECTORY};
+        /*! @brief Largest total size of the stored images, 0 disables the cache */
+        std::uint64_t capacity{constants::IMAGE_CACHE_CAPACITY};
+        /*! @brief Largest image copied into the cache if it cannot be linked, 0 disables copying */
+        std::uint64_t copy_limit{constants::IMAGE_CACHE_COPY_LIMIT};
+    };
+
+    /*!
+     * @brief Read settings from the "image-cache" section of the configuration
+     * @param[in] config Configuration
+     * @return Settings, the defaults if the section is missing
+     */
+    static Settings load_settings(const json::Json& config);
+
+    /*!
+     * @brief Constructor, opens the database.
+     * @param[in] directory Directory the images are stored in.
+     * @param[in] capacity Largest total size of the stored images, 0 disables the cache.
+     * @param[in] copy_limit Largest image copied if it cannot be linked, 0 disables copying.
+     * @param[in] database_name Name of the database entries are stored in.
+     */
+    explicit ImageCache(const std::string& directory = constants::IMAGE_CACHE_DIRECTORY,
+                        std::uint64_t capacity = constants::IMAGE_CACHE_CAPACITY,
+                        std::uint64_t copy_limit = constants::IMAGE_CACHE_COPY_LIMIT,
+                        const std::string& database_name = "image-cache");
+
+    /*!
+     * @brief Destructor, releases the database name.
+     */
+    virtual ~ImageCache();
+
+    /*!
+     * @brief Get cached image of a URL
+     * @param[in] url URL of the image
+     * @param[out] entry Cached image
+     * @return true if the image is cached
+     */
+    bool find(const std::string& url, Entry& entry) const;
+
+    /*!
+     * @brief Check if an image with the given digest is cached
+     * @param[in] sha256 Hexadecimal SHA-256 digest
+     * @return true if the image is cached
+     */
+    bool contains(const std::string& sha256) const;
+
+    /*!
+     * @brief Place a cached image at the destination
+     * @param[in] sha256 Hexadecimal SHA-256 digest of the image
+     * @param[in] destination Path of the file, replaced if it exists
+     * @return true if the image was placed, false if it is not cached
+     */
+    bool restore(const std::string& sha256, const std::string& destination);
+
+    /*!
+     * @brief Add a downloaded image to the cache
+     *
+     * Least recently used images are evicted to make room for the image.
+     * Errors are logged only, the download does not fail because of the cache.
+     *
+     * @param[in] url URL the image was downloaded from
+     * @param[in] validator ETag or Last-Modified of the image, may be empty
+     * @param[in] sha256 Hexadecimal SHA-256 digest, computed from the file if empty
+     * @param[in] file Path of the downloaded image
+     */
+    void store(const std::string& url, const std::string& validator, const std::string& sha256, const std::string& file);
+
+    /*!
+     * @brief Remove cached image of a URL
+     *
+     * The image is deleted once evicted, it may still be used by other URLs.
+     *
+     * @param[in] url URL of the image
+     */
+    void remove(const std::string& url);
+
+    /*!
+     * @brief Compute digest of a file
+     * @param[in] file Path of the file
+     * @return Hexadecimal SHA-256 digest
+     * @throw std::runtime_error if the file cannot be read
+     */
+    static std::string get_digest(const std::string& file);
+
+    /*!
+     * @brief Get total size of the stored images
+     * @return Size in bytes
+     */
+    std::uint64_t get_size() const;
+
+private:
+    std::string get_blob(const std::string& sha256) const;
+    std::uint64_t get_used_size() const;
+    std::vector<Entry> load() const;
+    void put_entry(const Entry& entry);
+    void erase(const std::string& sha256);
+    void evict(std::uint64_t size);
+
+    mutable std::mutex m_mutex{};
+    std::string m_directory;
+    std::uint64_t m_capacity;
+    std::uint64_t m_copy_limit;
+    database::Database::SPtr m_database;
+};
+
+} // namespace ipu
+} // namespace psme
@@ -0,0 +1,69 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "psme/ipu/fault_profile.hpp"
+#include "psme/ipu/loopback_server.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+namespace psme {
+namespace ipu {
+
+/*!
+ * @brief Loopback HTTP server of the files in a directory.
+ *
+ * Serves GET and HEAD requests of the files with Range and If-None-Match
+ * support, so images can be updated from and inserted as virtual media
+ * without an external server. Each request is delayed and failed with
+ * 503 Service Unavailable according to the fault profile.
+ */
+class ImageServer {
+public:
+    /*! @brief Number of connections served at once */
+    static constexpr std::size_t WORKERS = 4;
+
+    /*!
+     * @brief Constructor, starts serving
+     * @param[in] directory Directory of the served files
+     * @param[in] port Port listened on, 0 for any free port
+     * @param[in] profile Latency and error distribution of the requests
+     * @throw std::runtime_error if the port could not be listened on
+     */
+    ImageServer(std::filesystem::path directory, std::uint16_t port, const FaultProfile& profile);
+
+    ImageServer(const ImageServer&) = delete;
+    ImageServer& operator=(const ImageServer&) = delete;
+
+    /*! @brief Destructor, stops serving */
+    ~ImageServer();
+
+    /*!
+     * @brief Get port the server listens on
+     * @return Port
+     */
+    std::uint16_t get_port() const {
+        return m_server.get_port();
+    }
+
+    /*!
+     * @brief Get URI of a served file
+     * @param[in] name Name of the file in the directory
+     * @return URI
+     */
+    std::string get_uri(const std::string& name) const;
+
+private:
+    void serve(const LoopbackServer::Request& request, LoopbackServer::Connection& connection);
+
+    std::filesystem::path m_directory;
+    FaultProfile m_profile;
+    // Last, so it is stopped before the members its handler uses are destroyed
+    LoopbackServer m_server;
+};
+
+} // namespace ipu
+} // namespace psme
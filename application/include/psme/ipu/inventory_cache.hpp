@@ -0,0 +1,115 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "agent-framework/generic/singleton.hpp"
+#include "database/database.hpp"
+#include "ipu/ipu_update_handler.hpp"
+#include "json-wrapper/json-wrapper.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace psme {
+namespace ipu {
+
+/*! @brief Firmware inventory of the IPU */
+struct Inventory {
+    /*! @brief Versions of the firmware components */
+    InventoryVersion versions{};
+    /*! @brief Build of the IMC firmware */
+    std::string firmware_build{"Unknown"};
+    /*! @brief Seconds since the epoch the inventory was queried, 0 if never */
+    std::int64_t refreshed{0};
+};
+
+/*!
+ * @brief Firmware inventory kept up to date in the background.
+ *
+ * Querying the inventory from the device is slow, so the last known
+ * inventory is stored in the database and served right away, also after a
+ * restart, while a background thread queries the device at start, again
+ * once the inventory is older than its time to live, and on request, e.g.
+ * after an update.
+ */
+class InventoryCache : public agent_framework::generic::Singleton<InventoryCache> {
+public:
+    /*! @brief Queries the inventory, throws on failure */
+    using Fetcher = std::function<Inventory()>;
+
+    /*! @brief Called from the refresh thread with each queried inventory */
+    using Listener = std::function<void(const Inventory&)>;
+
+    /*! @brief Time to live of the inventory if not configured */
+    static constexpr std::chrono::seconds DEFAULT_TTL{3600};
+
+    /*! @brief Delay of a retry after the inventory could not be queried */
+    static constexpr std::chrono::seconds RETRY_INTERVAL{60};
+
+    /*!
+     * @brief Read time to live of the inventory from the configuration
+     * @param[in] config Configuration of the service
+     * @return Time to live, 0 if the inventory is refreshed only at start and on request
+     */
+    static std::chrono::seconds load_ttl(const json::Json& config);
+
+    /*!
+     * @brief Constructor, loads the last known inventory.
+     * @param[in] database_name Name of the database the inventory is stored in.
+     */
+    explicit InventoryCache(const std::string& database_name = "inventory");
+
+    /*!
+     * @brief Destructor, stops the refresh thread and releases the database name.
+     */
+    virtual ~InventoryCache();
+
+    /*!
+     * @brief Get the last known inventory
+     * @return Inventory, its refreshed time is 0 if it was never queried
+     */
+    Inventory get() const;
+
+    /*!
+     * @brief Start refreshing the inventory, it is queried at once
+     * @param[in] ttl Time to live of the inventory, 0 if refreshed only at start and on request
+     * @param[in] fetch Queries the inventory
+     * @param[in] on_refresh Called with each queried inventory
+     */
+    void start(std::chrono::seconds ttl, Fetcher fetch, Listener on_refresh);
+
+    /*!
+     * @brief Query the inventory again without waiting for it to become stale
+     */
+    void refresh();
+
+    /*!
+     * @brief Stop the refresh thread
+     */
+    void stop();
+
+private:
+    void run();
+    void load();
+    void store(const Inventory& inventory);
+
+    database::Database::SPtr m_database;
+    mutable std::mutex m_mutex{};
+    std::condition_variable m_changed{};
+    Inventory m_inventory{};
+    std::chrono::seconds m_ttl{DEFAULT_TTL};
+    Fetcher m_fetch{};
+    Listener m_on_refresh{};
+    bool m_refresh_requested{false};
+    bool m_stopping{false};
+    std::thread m_thread{};
+};
+
+} // namespace ipu
+} // namespace psme
@@ -25,23 +25,23 @@ extern const char* NONE;
 extern const char* ACTIVE_BOOT_OPTION;
 extern const char* CURRENT_BOOT_OPTION;
 extern const char* DESTINATION_PLDM_FILEPATH;
-extern const char* PLDM_FILE_FOLDER;
 extern const char* DOWNLOADED_IMAGE_NAME;
 extern const char* ACC_BOOT_OVERRIDE_FILEPATH;
 extern const char* ACC_BOOT_OPTION_FILEPATH;
 extern const char* RESERVED_MEMORY_DIRECTORY;
 extern const char* RESERVED_MEMORY_FILEPATH;
-extern const char* IMAGE_FOLDER;
-extern const char* IMAGE_TEMP_FOLDER;
 extern const char* IMAGE_PATH;
-extern const char* IMAGE_TEMP_PATH;
 extern const char* IMAGE_SYMLINK_DIRECTORY;
 extern const char* IMAGE_SYMLINK;
 extern const char VIRTUAL_MEDIA_ENTITY_NAME[];
 extern const char* FIRMWARE_VERSION_FILEPATH;
 extern const uint64_t MAX_IMAGE_SIZE;
 extern const uint64_t MAX_PLDM_IMAGE_SIZE;
-extern const uint64_t CHUNK_SIZE;
+extern const unsigned VIRTUAL_MEDIA_DOWNLOAD_SEGMENTS;
+extern const char* IMAGE_CACHE_DIRECTORY;
+extern const uint64_t IMAGE_CACHE_CAPACITY;
+extern const uint64_t IMAGE_CACHE_COPY_LIMIT;
+extern const char* NBD_DEVICE;
 
 } // namespace constants
 } // namespace ipu
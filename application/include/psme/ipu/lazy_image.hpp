@@ -0,0 +1,174 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "curl/curl.h"
+#include "utils/crypt_utils.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace psme {
+namespace ipu {
+
+/*!
+ * @brief Image fetched block by block while it is read.
+ *
+ * The image is a sparse file of its full size. A read of blocks not fetched
+ * yet waits for a Range request of them and of the next few blocks, while a
+ * background fill fetches the remaining blocks in order. Fetched blocks are
+ * recorded in a block map next to the file, so blocks of the same version
+ * of the image are not fetched again when it is opened later. The block map
+ * is removed once the image is complete. The background fill hashes the
+ * image in order as its blocks arrive, so a complete image is verified
+ * without reading it again.
+ */
+class LazyImage {
+public:
+    /*! @brief Called from the fill thread with an empty string once all blocks are fetched, or with the error */
+    using CompletionCallback = std::function<void(const std::string&)>;
+
+    /*! @brief Images are fetched in blocks of this size */
+    static constexpr std::uint64_t BLOCK_SIZE = 1024 * 1024;
+
+    /*! @brief Number of blocks fetched ahead of a read */
+    static constexpr unsigned READAHEAD_BLOCKS = 4;
+
+    /*! @brief Largest number of blocks fetched in a request of the background fill */
+    static constexpr unsigned FILL_BLOCKS = 8;
+
+    /*!
+     * @brief Constructor, opens the file and the block map.
+     * @param[in] prototype Handle with the URL and options of the transfers, duplicated for each of them
+     * @param[in] file_name Path of the file
+     * @param[in] size Size of the image
+     * @param[in] validator ETag or Last-Modified of the image, all blocks must match it
+     */
+    LazyImage(CURL* prototype, const std::string& file_name, std::uint64_t size, const std::string& validator);
+
+    LazyImage(const LazyImage&) = delete;
+    LazyImage& operator=(const LazyImage&) = delete;
+
+    /*!
+     * @brief Destructor, stops the background fill and closes the file
+     */
+    ~LazyImage();
+
+    /*!
+     * @brief Get size of the image
+     * @return Size in bytes
+     */
+    std::uint64_t get_size() const {
+        return m_size;
+    }
+
+    /*!
+     * @brief Get validator of the image
+     * @return ETag or Last-Modified of the image
+     */
+    const std::string& get_validator() const {
+        return m_validator;
+    }
+
+    /*!
+     * @brief Get number of bytes fetched so far
+     * @return Size in bytes
+     */
+    std::uint64_t get_fetched() const;
+
+    /*!
+     * @brief Check if all blocks are fetched
+     * @return true if the file is complete
+     */
+    bool is_complete() const;
+
+    /*!
+     * @brief Get SHA-256 digest of the image
+     * @return Lowercase hexadecimal digest, valid once the fill completed without an error
+     */
+    std::string get_digest() const;
+
+    /*!
+     * @brief Read data of the image, missing blocks are fetched first
+     * @param[in] offset Offset of the data
+     * @param[out] data Buffer of the data
+     * @param[in] size Size of the data
+     * @throw std::runtime_error if the blocks cannot be fetched or read
+     */
+    void read(std::uint64_t offset, char* data, std::size_t size);
+
+    /*!
+     * @brief Fetch the remaining blocks in a background thread
+     * @param[in] on_complete Called once the fill ends
+     */
+    void start_fill(CompletionCallback on_complete);
+
+    /*!
+     * @brief Stop the background fill and fail reads waiting for blocks
+     */
+    void stop();
+
+    /*!
+     * @brief Get path of the block map of a file
+     * @param[in] file_name Path of the image
+     * @return Path of the block map
+     */
+    static std::string get_map_file(const std::string& file_name);
+
+private:
+    enum class Block : std::uint8_t {
+        MISSING,
+        PRESENT,
+        FETCHING
+    };
+
+    struct Transfer {
+        LazyImage* image{nullptr};
+        CURL* handle{nullptr};
+        bool background{false};
+        std::uint64_t position{};
+        std::uint64_t end{};
+        std::string error{};
+    };
+
+    void open_map(const std::string& identity);
+    std::uint64_t claim(std::uint64_t first, std::uint64_t limit);
+    void release(std::uint64_t first, std::uint64_t count, bool fetched);
+    void fetch(CURL* handle, bool background, std::uint64_t first, std::uint64_t count);
+    void fill();
+    void hash_present();
+    std::unique_ptr<CURL, void (*)(CURL*)> make_handle(bool background) const;
+    static size_t write_callback(char* data, size_t size, size_t nmemb, void* userdata);
+    static int abort_callback(void* clientp, curl_off_t dltotal, curl_off_t dlnow, curl_off_t ultotal, curl_off_t ulnow);
+
+    std::unique_ptr<CURL, void (*)(CURL*)> m_prototype;
+    std::string m_file_name;
+    std::uint64_t m_size;
+    std::string m_validator;
+    int m_fd{-1};
+    int m_map_fd{-1};
+    std::unique_ptr<curl_slist, void (*)(curl_slist*)> m_request_headers{nullptr, curl_slist_free_all};
+    mutable std::mutex m_mutex{};
+    std::condition_variable m_changed{};
+    std::vector<Block> m_blocks{};
+    std::uint64_t m_present{0};
+    std::mutex m_read_mutex{};
+    std::unique_ptr<CURL, void (*)(CURL*)> m_read_handle{nullptr, curl_easy_cleanup};
+    std::atomic<bool> m_stopping{false};
+    // Digest of the first m_hashed bytes, used by the fill thread only
+    utils::Sha256 m_digest{};
+    std::uint64_t m_hashed{0};
+    CompletionCallback m_on_complete{};
+    std::thread m_thread{};
+};
+
+} // namespace ipu
+} // namespace psme
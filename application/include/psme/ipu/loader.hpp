@@ -6,12 +6,20 @@
 namespace psme {
 namespace ipu {
 
+struct Inventory;
+
 /*!
  * @brief IPU Loader declaration
  */
 class Loader {
 public:
     void load();
+
+    /*!
+     * @brief Update the firmware versions of the IMC and ACC resources
+     * @param[in] inventory Queried firmware inventory
+     */
+    static void update_inventory(const Inventory& inventory);
 };
 
 } // namespace ipu
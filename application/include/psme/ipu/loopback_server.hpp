@@ -0,0 +1,130 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace psme {
+namespace ipu {
+
+/*!
+ * @brief Minimal HTTP/1.1 server listening on the loopback interface.
+ *
+ * Each connection carries one request, which is passed to the handler
+ * together with the connection to respond on, and is closed once the
+ * handler returns. It serves the simulator's images and the peers of the
+ * HTTP clients in tests, it is not meant for external clients.
+ */
+class LoopbackServer {
+public:
+    /*! @brief Received request */
+    struct Request {
+        /*! @brief Method, e.g. GET */
+        std::string method{};
+        /*! @brief Request target, e.g. /image.iso */
+        std::string target{};
+        /*! @brief Request line and headers */
+        std::string head{};
+        /*! @brief Body of Content-Length bytes */
+        std::string body{};
+
+        /*!
+         * @brief Get value of a header
+         * @param[in] name Lowercase name of the header
+         * @return Value, empty if the header is missing
+         */
+        std::string get_header(const std::string& name) const;
+    };
+
+    /*! @brief Connection a request is answered on */
+    class Connection {
+    public:
+        explicit Connection(int socket) : m_socket{socket} {}
+
+        /*!
+         * @brief Send data
+         * @param[in] data Data
+         * @param[in] size Size of the data
+         * @return false if the client is gone
+         */
+        bool send(const char* data, std::size_t size);
+
+        /*!
+         * @brief Send data
+         * @param[in] data Data
+         * @return false if the client is gone
+         */
+        bool send(const std::string& data) {
+            return send(data.data(), data.size());
+        }
+
+        /*!
+         * @brief Send a response without a body
+         * @param[in] status Status code and reason, e.g. "404 Not Found"
+         */
+        void respond(const std::string& status);
+
+    private:
+        int m_socket;
+    };
+
+    /*! @brief Called from a worker thread for each request */
+    using Handler = std::function<void(const Request&, Connection&)>;
+
+    /*!
+     * @brief Constructor, starts serving
+     * @param[in] port Port listened on, 0 for any free port
+     * @param[in] workers Number of connections served at once
+     * @param[in] handler Answers the requests
+     * @throw std::runtime_error if the port could not be listened on
+     */
+    LoopbackServer(std::uint16_t port, std::size_t workers, Handler handler);
+
+    LoopbackServer(const LoopbackServer&) = delete;
+    LoopbackServer& operator=(const LoopbackServer&) = delete;
+
+    /*! @brief Destructor, stops serving */
+    ~LoopbackServer();
+
+    /*!
+     * @brief Get port the server listens on
+     * @return Port
+     */
+    std::uint16_t get_port() const {
+        return m_port;
+    }
+
+    /*!
+     * @brief Get URI of a path on the server
+     * @param[in] path Path without the leading slash
+     * @return URI
+     */
+    std::string get_uri(const std::string& path) const;
+
+    /*!
+     * @brief Check if the server is serving, handlers sending long bodies stop once it is not
+     * @return false once the server is being stopped
+     */
+    bool is_running() const {
+        return m_running;
+    }
+
+private:
+    void run();
+    void serve(int connection);
+
+    Handler m_handler;
+    int m_socket{-1};
+    std::uint16_t m_port{0};
+    std::atomic<bool> m_running{true};
+    std::vector<std::thread> m_workers{};
+};
+
+} // namespace ipu
+} // namespace psme
@@ -0,0 +1,75 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+
+namespace psme {
+namespace ipu {
+
+/*!
+ * @brief Read-only block device served by the process.
+ *
+ * The device is attached to one end of a socket pair with the ioctl interface
+ * of the Linux NBD driver, and requests of the kernel are served on the other
+ * end. Reads of the device call the read callback, so data may be fetched
+ * while the device is already in use.
+ */
+class NbdExport {
+public:
+    /*! @brief Fills the buffer with data at the offset, throws on failure */
+    using ReadCallback = std::function<void(std::uint64_t, char*, std::size_t)>;
+
+    /*! @brief Block size of the device */
+    static constexpr std::uint64_t BLOCK_SIZE = 4096;
+
+    /*!
+     * @brief Constructor
+     * @param[in] size Size of the device
+     * @param[in] on_read Called for each read of the device
+     */
+    NbdExport(std::uint64_t size, ReadCallback on_read);
+
+    NbdExport(const NbdExport&) = delete;
+    NbdExport& operator=(const NbdExport&) = delete;
+
+    /*!
+     * @brief Destructor, detaches the device
+     */
+    ~NbdExport();
+
+    /*!
+     * @brief Attach the device
+     * @param[in] device Path of the NBD device, e.g. /dev/nbd0
+     * @throw std::runtime_error if the device cannot be set up
+     */
+    void start(const std::string& device);
+
+    /*!
+     * @brief Detach the device, its pending requests fail
+     */
+    void stop();
+
+    /*!
+     * @brief Serve requests until the kernel disconnects or the socket is closed
+     * @param[in] socket Socket the requests are received on
+     */
+    void serve(int socket);
+
+private:
+    std::uint64_t m_size;
+    ReadCallback m_on_read;
+    std::string m_device{};
+    int m_device_fd{-1};
+    int m_sockets[2]{-1, -1};
+    std::thread m_device_thread{};
+    std::thread m_serve_thread{};
+};
+
+} // namespace ipu
+} // namespace psme
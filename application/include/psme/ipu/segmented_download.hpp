@@ -0,0 +1,127 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "curl/curl.h"
+#include "utils/crypt_utils.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace psme {
+namespace ipu {
+
+/*!
+ * @brief Download of a file in several Range requests run concurrently.
+ *
+ * Each segment is transferred on its own connection of a curl multi handle
+ * and written at its offset into the preallocated file, so a long-latency
+ * link is not limited by the congestion window of a single connection.
+ * Interrupted segments are resumed independently. The file can be hashed
+ * while it is written: data continuing the hashed part is hashed as it
+ * arrives, and segments received ahead are read back once it reaches them.
+ */
+class SegmentedDownload {
+public:
+    /*! @brief Called with the bytes written and the size of the file */
+    using ProgressCallback = std::function<void(std::uint64_t, std::uint64_t)>;
+
+    /*! @brief Data of a segment is written in pieces of this size */
+    static constexpr std::size_t BUFFER_SIZE = 1024 * 1024;
+
+    /*!
+     * @brief Constructor
+     * @param[in] prototype Handle with the options of the transfer, duplicated for each segment
+     * @param[in] file_name Path of the file
+     * @param[in] size Size of the file
+     * @param[in] validator ETag or Last-Modified of the file, segments must match it
+     */
+    SegmentedDownload(CURL* prototype, const std::string& file_name, std::uint64_t size, const std::string& validator);
+
+    SegmentedDownload(const SegmentedDownload&) = delete;
+    SegmentedDownload& operator=(const SegmentedDownload&) = delete;
+
+    /*!
+     * @brief Destructor, closes the file
+     */
+    ~SegmentedDownload();
+
+    /*!
+     * @brief Set how interrupted segments are resumed
+     * @param[in] attempts Number of times each segment is resumed
+     * @param[in] interval Delay before the first resume of a segment
+     * @param[in] max_interval Longest delay between resumes
+     */
+    void set_retry_policy(unsigned attempts, std::chrono::milliseconds interval, std::chrono::milliseconds max_interval);
+
+    /*!
+     * @brief Log progress of the download every 10 %
+     */
+    void set_progress_report();
+
+    /*!
+     * @brief Set callback receiving progress of the download
+     * @param[in] on_progress Called each time a piece of data is written
+     */
+    void set_progress_callback(ProgressCallback on_progress);
+
+    /*!
+     * @brief Hash the file while it is written
+     * @param[in] digest Digest the file is added to, complete once the download is
+     */
+    void set_digest(utils::Sha256* digest);
+
+    /*!
+     * @brief Download the file
+     * @param[in] segments Number of segments
+     * @throw std::runtime_error if a segment failed or the file cannot be written
+     */
+    void run(unsigned segments);
+
+private:
+    struct Segment {
+        SegmentedDownload* download{nullptr};
+        std::unique_ptr<CURL, void (*)(CURL*)> handle{nullptr, curl_easy_cleanup};
+        std::uint64_t begin{};
+        std::uint64_t end{};
+        std::uint64_t written{};
+        std::vector<char> buffer{};
+        unsigned failures{};
+        std::chrono::milliseconds backoff{};
+        std::chrono::steady_clock::time_point next_attempt{};
+        bool active{false};
+        std::string error{};
+    };
+
+    void start(CURLM* multi, Segment& segment);
+    void complete(Segment& segment, CURLcode result);
+    void flush(Segment& segment);
+    void hash(std::uint64_t position, const std::vector<char>& data);
+    void report_progress();
+    static size_t write_callback(char* data, size_t size, size_t nmemb, void* userdata);
+
+    CURL* m_prototype;
+    std::string m_file_name;
+    std::uint64_t m_size;
+    std::string m_validator;
+    int m_fd{-1};
+    std::unique_ptr<curl_slist, void (*)(curl_slist*)> m_request_headers{nullptr, curl_slist_free_all};
+    std::vector<Segment> m_segments{};
+    unsigned m_retry_attempts{};
+    std::chrono::milliseconds m_retry_interval{};
+    std::chrono::milliseconds m_max_retry_interval{};
+    bool m_progress_report{false};
+    ProgressCallback m_on_progress{};
+    utils::Sha256* m_digest{nullptr};
+    std::uint64_t m_hashed{0};
+    std::uint64_t m_written{0};
+    std::uint64_t m_progress{0};
+};
+
+} // namespace ipu
+} // namespace psme
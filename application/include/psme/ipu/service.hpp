@@ -6,11 +6,12 @@
 #include "agent-framework/threading/thread.hpp"
 #include "psme/ipu/base_service.hpp"
 #include "psme/ipu/cpchnl_cmd_handler.hpp"
+#include "psme/ipu/file_watcher.hpp"
+#include "psme/ipu/ipu_constants.hpp"
 #include "psme/ipu/simple_update_handler.hpp"
 #include "psme/ipu/virtual_media_insert_handler.hpp"
 
 #include <chrono>
-#include <condition_variable>
 #include <mutex>
 
 namespace psme {
@@ -27,15 +28,23 @@ public:
     /*! @brief Destructor */
     ~Service();
 
-    void trigger_acc_reset(const agent_framework::model::enums::ResetType& reset_type) override;
+    void trigger_acc_reset(const agent_framework::model::enums::ResetType& reset_type,
+                           std::string& task_uuid) override;
 
     void trigger_imc_reset(const agent_framework::model::enums::ResetType& reset_type) override;
 
     void trigger_ipu_update(const std::string& img,
                             const OptionalField<std::string>& username,
                             const OptionalField<std::string>& password,
+                            const OptionalField<std::string>& image_sha256,
                             std::string& task_uuid) override;
 
+    std::string reserve_ipu_update(std::uint64_t& package_size) override;
+
+    void trigger_ipu_push_update(std::string& task_uuid) override;
+
+    void release_ipu_update() override;
+
     /*!
      * @brief Set the boot override settings requested by the user
      * @param[in] New boot override setting, or an empty optional if none was provided
@@ -47,13 +56,15 @@ public:
     void insert_virtual_media(const std::string& img, const agent_framework::model::enums::TransferMethod& transfer_method,
                               const OptionalField<std::string>& username,
                               const OptionalField<std::string>& password,
+                              const OptionalField<std::string>& image_sha256,
                               std::string& task_uuid) override;
 
     void eject_virtual_media() override;
 private:
     /*!
      * @brief This function is run in the thread owned by this class.
-     * It's used to check for update of the IPU's state.
+     * It's used to check for update of the IPU's state once the boot override
+     * files change, and every m_interval in case a change was missed.
      * */
     void execute() override;
 
@@ -61,8 +72,7 @@ private:
     SimpleUpdateHandler m_simple_update_handler{};
     VirtualMediaInsertHandler m_virtual_media_insert_handler{};
     std::mutex m_acc_boot_override_mutex{};
-    std::condition_variable m_break_loop_condition{};
-    std::mutex m_loop_mutex{};
+    FileWatcher m_boot_override_watcher{{constants::ACC_BOOT_OVERRIDE_FILEPATH, constants::ACC_BOOT_OPTION_FILEPATH}};
     const std::chrono::seconds m_interval{120};
 };
 
@@ -6,6 +6,7 @@
 #include "agent-framework/module/model/task.hpp"
 
 #include <atomic>
+#include <cstdint>
 #include <string>
 
 namespace psme {
@@ -23,11 +24,31 @@ public:
     SimpleUpdateHandler& operator=(const SimpleUpdateHandler& handler) = delete;
     SimpleUpdateHandler& operator=(SimpleUpdateHandler&& handler) = delete;
     void invoke_update(std::string& task_uuid);
+
+    /*!
+     * @brief Start update from the package pushed by the client
+     * @param[out] task_uuid UUID of the update task
+     */
+    void invoke_push_update(std::string& task_uuid);
+
+    /*!
+     * @brief Check space for a package pushed by the client
+     * @param[in,out] package_size Announced size, 0 if unknown. Set to the maximum package size.
+     * @return Path the package is to be written to
+     */
+    std::string reserve_package(std::uint64_t& package_size);
+
+    /*!
+     * @brief Remove the package and allow another update
+     */
+    void release();
     void update_info(const std::string& img,
                      const OptionalField<std::string>& username,
-                     const OptionalField<std::string>& password);
+                     const OptionalField<std::string>& password,
+                     const OptionalField<std::string>& image_sha256);
     void try_lock();
 private:
+    void start_task(std::string& task_uuid, bool download);
     void download_package();
     void update_ipu();
     void remove_package();
@@ -39,8 +60,10 @@ private:
     std::string m_img{};
     OptionalField<std::string> m_username{};
     OptionalField<std::string> m_password{};
+    OptionalField<std::string> m_image_sha256{};
     std::atomic_flag m_lock{ATOMIC_FLAG_INIT};
     std::string m_reset_type{};
+    std::string m_task_uuid{};
 };
 
 } // namespace ipu
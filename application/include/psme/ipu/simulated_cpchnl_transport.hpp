@@ -0,0 +1,77 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "psme/ipu/cpchnl_channel.hpp"
+#include "psme/ipu/fault_profile.hpp"
+
+#include <chrono>
+#include <map>
+#include <optional>
+#include <string>
+
+namespace psme {
+namespace ipu {
+
+/*!
+ * @brief Transport completing CPChannel commands after a latency drawn from a profile.
+ *
+ * It simulates the device for the simulator backend, and tests override
+ * the answer to give commands a chosen latency and result.
+ */
+class SimulatedCpchnlTransport : public CpchnlTransport {
+public:
+    /*!
+     * @brief Constructor
+     * @param[in] profile Latency and errors of the commands
+     * @param[in] max_outstanding Number of commands outstanding at once
+     */
+    SimulatedCpchnlTransport(const FaultProfile& profile, std::size_t max_outstanding)
+        : m_profile{profile}, m_max_outstanding{max_outstanding} {}
+
+    std::size_t get_max_outstanding() const override {
+        return m_max_outstanding;
+    }
+
+    void send(Tag tag, const CpchnlCommand& command) override;
+
+    std::optional<Completion> receive(std::chrono::milliseconds timeout) override;
+
+protected:
+    /*! @brief Simulated answer to a command */
+    struct Answer {
+        /*! @brief Time until the completion arrives */
+        std::chrono::milliseconds latency{0};
+        /*! @brief Description of the failure, empty if the command succeeds */
+        std::string error{};
+    };
+
+    /*!
+     * @brief Decide the answer to a command, drawn from the profile by default
+     * @param[in] command Sent command
+     * @return Answer, empty if the command is never answered
+     */
+    virtual std::optional<Answer> answer(const CpchnlCommand& command);
+
+    /*!
+     * @brief Get number of sent commands not completed yet, including the unanswered ones
+     * @return Number of commands
+     */
+    std::size_t get_outstanding() const {
+        return m_pending.size();
+    }
+
+private:
+    struct Pending {
+        std::chrono::steady_clock::time_point due;
+        std::string error;
+    };
+
+    FaultProfile m_profile;
+    std::size_t m_max_outstanding;
+    std::map<Tag, Pending> m_pending{};
+};
+
+} // namespace ipu
+} // namespace psme
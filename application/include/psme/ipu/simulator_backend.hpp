@@ -0,0 +1,102 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "psme/ipu/backend.hpp"
+#include "psme/ipu/fault_profile.hpp"
+#include "psme/ipu/image_server.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace psme {
+namespace ipu {
+
+/*!
+ * @brief Backend simulating the IPU, for development and load testing on any Linux host.
+ *
+ * The firmware inventory and CPChannel responses are simulated, update
+ * packages are flashed into a directory, preferably on tmpfs, and the
+ * images directory next to it is served by a loopback HTTP server to update
+ * from and insert as virtual media. IMC resets are only logged. Each part
+ * has its own latency and error distribution.
+ */
+class SimulatorBackend : public Backend {
+public:
+    /*! @brief Configuration of the simulator */
+    struct Settings {
+        /*! @brief Directory holding the flash target and the served images */
+        std::filesystem::path root{"/dev/shm/ipu-simulator"};
+        /*! @brief Port of the image server, 0 for any free port */
+        std::uint16_t image_server_port{8090};
+        /*! @brief Number of CPChannel commands outstanding at once */
+        std::size_t cpchnl_max_outstanding{4};
+        /*! @brief Reported build of the IMC firmware */
+        std::string firmware_build{"simulator"};
+        /*! @brief Latency and errors of CPChannel commands */
+        FaultProfile cpchnl{};
+        /*! @brief Latency and errors of inventory queries */
+        FaultProfile inventory{};
+        /*! @brief Latency and errors of flashing an update */
+        FaultProfile update{};
+        /*! @brief Latency and errors of image server requests */
+        FaultProfile image_server{};
+        /*! @brief Latency and errors of IMC resets */
+        FaultProfile imc_reset{};
+
+        /*!
+         * @brief Read settings from the "simulator" object of the "backend" section
+         * @param[in] json Simulator configuration, missing keys keep their defaults
+         * @return Settings
+         */
+        static Settings from_json(const json::Json& json);
+    };
+
+    /*! @brief Version of the firmware components before the first update */
+    static constexpr const char INITIAL_VERSION[] = "1.0.0.0";
+
+    /*!
+     * @brief Constructor, creates the directories and starts the image server
+     * @param[in] settings Configuration of the simulator
+     * @throw std::runtime_error if the image server could not be started
+     */
+    explicit SimulatorBackend(const Settings& settings);
+
+    std::unique_ptr<CpchnlTransport> create_cpchnl_transport() override;
+    InventoryVersion get_component_info() override;
+    std::string run_update(const std::string& package_path) override;
+    std::string get_firmware_build() override;
+    void reset_imc(const agent_framework::model::enums::ResetType& reset_type) override;
+
+    /*!
+     * @brief Get directory of the images served by the image server
+     * @return Directory
+     */
+    std::filesystem::path get_images_directory() const;
+
+    /*!
+     * @brief Get path the last update package was flashed to
+     * @return Path
+     */
+    std::filesystem::path get_flash_path() const;
+
+    /*!
+     * @brief Get URI of an image served by the image server
+     * @param[in] name Name of the file in the images directory
+     * @return URI
+     */
+    std::string get_image_uri(const std::string& name) const;
+
+private:
+    Settings m_settings;
+    mutable std::mutex m_mutex{};
+    unsigned m_updates{0};
+    std::unique_ptr<ImageServer> m_image_server{};
+};
+
+} // namespace ipu
+} // namespace psme
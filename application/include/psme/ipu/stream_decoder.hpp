@@ -0,0 +1,79 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace psme {
+namespace ipu {
+
+/*!
+ * @brief Decompresses a downloaded image while it is received.
+ *
+ * Data is decoded piece by piece into a fixed buffer, so neither the
+ * compressed nor the decompressed image is held in memory or in a
+ * temporary file.
+ */
+class StreamDecoder {
+public:
+    /*! @brief Compression format of a download */
+    enum class Format {
+        NONE,
+        GZIP,
+        ZSTD
+    };
+
+    /*! @brief Receives decoded data */
+    using Sink = std::function<void(const char*, std::size_t)>;
+
+    /*! @brief Size of the buffer data is decoded into */
+    static constexpr std::size_t BUFFER_SIZE = 256 * 1024;
+
+    /*!
+     * @brief Detect compression of a download
+     * @param[in] url URL of the file, its extension is used if the content type tells nothing
+     * @param[in] content_type Content-Type of the response, may be empty
+     * @return Compression format
+     */
+    static Format detect(const std::string& url, const std::string& content_type);
+
+    /*!
+     * @brief Get name of a format
+     * @param[in] format Compression format
+     * @return Name for logs and errors
+     */
+    static const char* to_string(Format format);
+
+    /*!
+     * @brief Create decoder of a format
+     * @param[in] format Compression format
+     * @return Decoder, nullptr for NONE
+     * @throw std::runtime_error if the format is not supported by this build
+     */
+    static std::unique_ptr<StreamDecoder> create(Format format);
+
+    virtual ~StreamDecoder();
+
+    /*!
+     * @brief Decode next piece of compressed data
+     * @param[in] data Compressed data
+     * @param[in] size Size of the data
+     * @param[in] sink Receives the decoded data, may be called several times
+     * @throw std::runtime_error if the data is corrupted
+     */
+    virtual void decode(const char* data, std::size_t size, const Sink& sink) = 0;
+
+    /*!
+     * @brief Finish decoding after all data was passed to decode()
+     * @param[in] sink Receives the rest of the decoded data
+     * @throw std::runtime_error if the compressed stream is incomplete
+     */
+    virtual void finish(const Sink& sink) = 0;
+};
+
+} // namespace ipu
+} // namespace psme
@@ -0,0 +1,63 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace psme {
+namespace ipu {
+
+/*!
+ * @brief Publishes progress of a stage of a task into the Task model.
+ *
+ * The stage covers a range of the task's PercentComplete. Progress is
+ * published when the percentage grows or once per UPDATE_INTERVAL, so
+ * frequent transfer callbacks do not keep rewriting the task.
+ */
+class TaskProgress {
+public:
+    /*! @brief Longest time progress is not published while it changes */
+    static constexpr std::chrono::seconds UPDATE_INTERVAL{1};
+
+    /*!
+     * @brief Constructor
+     * @param[in] task_uuid UUID of the task, progress is not published if empty
+     * @param[in] first_percent PercentComplete at the start of the stage
+     * @param[in] last_percent PercentComplete at the end of the stage
+     */
+    TaskProgress(const std::string& task_uuid, std::uint32_t first_percent, std::uint32_t last_percent);
+
+    /*!
+     * @brief Report progress of the stage's data transfer
+     * @param[in] done Bytes transferred
+     * @param[in] total Total bytes, 0 if unknown
+     */
+    void update(std::uint64_t done, std::uint64_t total);
+
+    /*!
+     * @brief Publish PercentComplete of a task at once, transfer progress is cleared
+     * @param[in] task_uuid UUID of the task, nothing is published if empty
+     * @param[in] percent PercentComplete
+     */
+    static void set_percent(const std::string& task_uuid, std::uint32_t percent);
+
+private:
+    void publish(std::uint64_t done, std::uint64_t total, std::uint32_t percent,
+                 std::chrono::steady_clock::time_point now);
+
+    std::string m_task_uuid;
+    std::uint32_t m_first_percent;
+    std::uint32_t m_last_percent;
+    std::chrono::steady_clock::time_point m_start{};
+    std::uint64_t m_start_bytes{0};
+    bool m_started{false};
+    std::chrono::steady_clock::time_point m_published{};
+    std::uint32_t m_percent{0};
+    std::uint64_t m_done{0};
+};
+
+} // namespace ipu
+} // namespace psme
@@ -0,0 +1,182 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "agent-framework/generic/singleton.hpp"
+#include "json-wrapper/json-wrapper.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace psme {
+namespace ipu {
+
+/*! @brief Limits of background transfers, read from the "transfer-limits" configuration section */
+struct TransferLimits {
+    /*! @brief Largest download rate in bytes per second, 0 if unlimited */
+    std::uint64_t max_download_rate{0};
+    /*! @brief Largest rate of writing downloaded data in bytes per second, 0 if unlimited */
+    std::uint64_t max_write_rate{0};
+    /*! @brief Whether the write rate is lowered while REST requests are slow */
+    bool adaptive{false};
+    /*! @brief 99th percentile of REST read latency above which transfers back off */
+    std::chrono::milliseconds latency_target{200};
+    /*! @brief Whether transfers run at lower CPU and I/O priority */
+    bool low_priority{false};
+};
+
+/*!
+ * @brief Token bucket limiting a rate of bytes.
+ *
+ * Bytes are taken up front and the caller waits for the returned delay, so a
+ * large piece is allowed and paid for by the next ones. Credit saved while
+ * idle is capped at BURST worth of the rate.
+ */
+class TokenBucket {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /*! @brief Longest time worth of credit saved while idle */
+    static constexpr std::chrono::milliseconds BURST{100};
+
+    /*!
+     * @brief Constructor
+     * @param[in] rate Bytes per second, 0 if unlimited
+     */
+    explicit TokenBucket(std::uint64_t rate = 0) : m_rate{rate} {}
+
+    /*!
+     * @brief Change the rate, debt and credit are dropped
+     * @param[in] rate Bytes per second, 0 if unlimited
+     * @param[in] now Current time
+     */
+    void set_rate(std::uint64_t rate, Clock::time_point now);
+
+    /*!
+     * @brief Get the rate
+     * @return Bytes per second, 0 if unlimited
+     */
+    std::uint64_t get_rate() const {
+        return m_rate;
+    }
+
+    /*!
+     * @brief Take bytes from the bucket
+     * @param[in] bytes Number of bytes
+     * @param[in] now Current time
+     * @return Time to wait before the bytes are used
+     */
+    Clock::duration take(std::uint64_t bytes, Clock::time_point now);
+
+private:
+    std::uint64_t m_rate;
+    Clock::time_point m_ready{};
+};
+
+/*!
+ * @brief Throttles downloads so they do not starve the REST server.
+ *
+ * The download rate is capped by libcurl, and writing of downloaded data by
+ * a token bucket shared by all transfers. A writer waiting for the bucket
+ * stops draining its buffers, which in turn stops libcurl from reading the
+ * socket, so TLS decryption is throttled too.
+ *
+ * In adaptive mode the write rate is halved each ADJUST_INTERVAL the 99th
+ * percentile of REST read latency is above the target, and raised by a
+ * quarter while it is below half of the target.
+ */
+class TransferThrottle : public agent_framework::generic::Singleton<TransferThrottle> {
+public:
+    using Clock = TokenBucket::Clock;
+
+    /*! @brief Shortest time between changes of the adaptive write rate */
+    static constexpr std::chrono::seconds ADJUST_INTERVAL{1};
+
+    /*! @brief Adaptive mode does not lower the write rate below this, bytes per second */
+    static constexpr std::uint64_t MIN_ADAPTIVE_RATE = 1024 * 1024;
+
+    /*!
+     * @brief Read limits from the configuration
+     * @param[in] config Service configuration
+     * @return Limits, no limits if the "transfer-limits" section is missing
+     */
+    static TransferLimits load_limits(const json::Json& config);
+
+    /*!
+     * @brief Destructor
+     */
+    virtual ~TransferThrottle();
+
+    /*!
+     * @brief Set limits of transfers started later, the write rate changes at once
+     * @param[in] limits Limits
+     */
+    void set_limits(const TransferLimits& limits);
+
+    /*!
+     * @brief Get limits
+     * @return Configured limits
+     */
+    TransferLimits get_limits() const;
+
+    /*!
+     * @brief Get current write rate
+     * @return Bytes per second, 0 if unlimited
+     */
+    std::uint64_t get_write_rate() const;
+
+    /*!
+     * @brief Wait until the given number of bytes may be written
+     * @param[in] bytes Number of bytes about to be written
+     */
+    void throttle_write(std::uint64_t bytes);
+
+    /*!
+     * @brief Account bytes about to be written without waiting
+     * @param[in] bytes Number of bytes
+     * @param[in] now Current time
+     * @return Time to wait before writing the bytes
+     */
+    Clock::duration reserve_write(std::uint64_t bytes, Clock::time_point now);
+
+private:
+    void adjust(Clock::time_point now);
+
+    mutable std::mutex m_mutex{};
+    TransferLimits m_limits{};
+    TokenBucket m_bucket{};
+    Clock::time_point m_adjusted{};
+    std::uint64_t m_written{0};
+};
+
+/*!
+ * @brief Lowers CPU and I/O priority of the calling thread while in scope,
+ * if transfers are configured to run at low priority.
+ *
+ * Threads started meanwhile, e.g. by FileWriter, inherit the priority.
+ */
+class TransferPriority {
+public:
+    /*! @brief Nice value of transfer threads */
+    static constexpr int NICE = 10;
+
+    /*! @brief Best-effort I/O priority level of transfer threads, 7 is the lowest */
+    static constexpr int IO_PRIORITY_LEVEL = 7;
+
+    TransferPriority();
+    ~TransferPriority();
+
+    TransferPriority(const TransferPriority&) = delete;
+    TransferPriority& operator=(const TransferPriority&) = delete;
+
+private:
+    long m_thread_id{0};
+    int m_nice{0};
+    int m_io_priority{-1};
+    bool m_nice_lowered{false};
+};
+
+} // namespace ipu
+} // namespace psme
@@ -21,11 +21,13 @@ public:
     void run(std::string& uuid);
     void update_info(const std::string& img, const agent_framework::model::enums::TransferMethod& transfer_method,
                      const OptionalField<std::string>& username,
-                     const OptionalField<std::string>& password);
+                     const OptionalField<std::string>& password,
+                     const OptionalField<std::string>& image_sha256);
     void try_lock();
 private:
     void eject_previous_media();
     void download_image();
+    void stream_image();
     void create_symlink();
     void update_virtual_media();
     void completion_callback(const std::string& task_uuid);
@@ -35,7 +37,9 @@ private:
     agent_framework::model::enums::TransferMethod m_transfer_method{agent_framework::model::enums::TransferMethod::Upload};
     OptionalField<std::string> m_username{};
     OptionalField<std::string> m_password{};
+    OptionalField<std::string> m_image_sha256{};
     std::atomic_flag m_lock{ATOMIC_FLAG_INIT};
+    std::string m_task_uuid{};
 };
 
 } // namespace ipu
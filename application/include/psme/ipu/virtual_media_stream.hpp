@@ -0,0 +1,88 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "agent-framework/generic/singleton.hpp"
+#include "ipu/ipu_constants.hpp"
+#include "ipu/lazy_image.hpp"
+#include "ipu/nbd_export.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace psme {
+namespace ipu {
+
+/*!
+ * @brief Virtual media image streamed while it is in use.
+ *
+ * The image is served on an NBD device, which the ACC boots from while the
+ * blocks it reads are fetched on demand. Once the background fill completes
+ * the image, it is verified and cached like a downloaded image, and the
+ * image symlink is switched from the device to the file. An image not
+ * matching its expected digest is ejected and the virtual media is
+ * reported Critical.
+ */
+class VirtualMediaStream : public agent_framework::generic::Singleton<VirtualMediaStream> {
+public:
+    /*!
+     * @brief Constructor
+     * @param[in] device Path of the NBD device the image is served on
+     */
+    explicit VirtualMediaStream(const std::string& device = constants::NBD_DEVICE);
+
+    /*!
+     * @brief Destructor, stops streaming
+     */
+    virtual ~VirtualMediaStream();
+
+    /*!
+     * @brief Serve an image, a previously streamed image is stopped
+     * @param[in] image Image to serve
+     * @param[in] url URL of the image, used to cache it once complete
+     * @param[in] sha256 Expected hexadecimal SHA-256 digest of the image, empty if unknown
+     * @throw std::runtime_error if the device cannot be set up
+     */
+    void start(std::unique_ptr<LazyImage> image, const std::string& url, const std::string& sha256);
+
+    /*!
+     * @brief Stop serving the image, fetched blocks are kept
+     */
+    void stop();
+
+    /*!
+     * @brief Stop serving the image and remove its block map
+     */
+    void eject();
+
+    /*!
+     * @brief Check if an image is served
+     * @return true while an image is streamed
+     */
+    bool is_streaming() const;
+
+    /*!
+     * @brief Get path the virtual media image is read from
+     * @return The device while the image is incomplete, otherwise the image file
+     */
+    std::string get_media_path() const;
+
+private:
+    void complete(std::uint64_t generation, const std::string& error);
+    void reject(std::uint64_t generation);
+
+    std::string m_device;
+    mutable std::mutex m_mutex{};
+    std::unique_ptr<LazyImage> m_image{};
+    std::unique_ptr<NbdExport> m_export{};
+    std::string m_url{};
+    std::string m_sha256{};
+    std::uint64_t m_generation{0};
+    bool m_complete{false};
+};
+
+} // namespace ipu
+} // namespace psme
@@ -58,6 +58,7 @@ extern const char* SESSION_ID;
 extern const char* ACCOUNT_ID;
 extern const char* ROLE_ID;
 extern const char* VIRTUAL_MEDIA_ID;
+extern const char* SUBSCRIPTION_ID;
 
 extern const char PATH_SEP;
 extern const char VARIABLE_BEGIN;
@@ -157,6 +158,7 @@ extern const char* BOARD_ID;
 namespace Collection {
 extern const char* ODATA_COUNT;
 extern const char* MEMBERS;
+extern const char* NEXT_LINK;
 } // namespace Collection
 
 /*!
@@ -171,10 +173,27 @@ extern const char* MANAGERS;
 extern const char* REGISTRIES;
 extern const char* MESSAGE_REGISTRY;
 extern const char* UPDATE_SERVICE;
+extern const char* EVENT_SERVICE;
 extern const char* SERVICE;
 extern const char* ACCOUNT_SERVICE;
+extern const char* PROTOCOL_FEATURES_SUPPORTED;
 } // namespace Root
 
+/*!
+ * @brief Constant literals for ProtocolFeaturesSupported property of the service root.
+ */
+namespace ProtocolFeatures {
+extern const char* EXPAND_QUERY;
+extern const char* EXPAND_ALL;
+extern const char* LEVELS;
+extern const char* LINKS;
+extern const char* NO_LINKS;
+extern const char* MAX_LEVELS;
+extern const char* SELECT_QUERY;
+extern const char* TOP_SKIP_QUERY;
+extern const char* FILTER_QUERY;
+} // namespace ProtocolFeatures
+
 /*!
  * @brief Constant literals for Redfish endpoint.
  */
@@ -222,6 +241,10 @@ extern const char* ALLOWABLE_VALUES;
  */
 namespace UpdateService {
 extern const char* HTTP_PUSH_URI;
+extern const char* MULTIPART_HTTP_PUSH_URI;
+extern const char* UPLOAD;
+extern const char* UPDATE_PARAMETERS;
+extern const char* UPDATE_FILE;
 extern const char* HASH_UPDATE_SERVICE_SIMPLE_UPDATE;
 extern const char* UPDATE_SERVICE_SIMPLE_UPDATE;
 extern const char* SIMPLE_UPDATE_ACTION_INFO;
@@ -230,6 +253,7 @@ extern const char* TRANSFER_PROTOCOL;
 extern const char* TARGETS;
 extern const char* USER_NAME;
 extern const char* PASSWORD;
+extern const char* IMAGE_SHA256;
 } // namespace UpdateService
 
 /*!
@@ -252,12 +276,63 @@ extern const char* START_TIME;
 extern const char* END_TIME;
 extern const char* TASK_STATUS;
 extern const char* MESSAGES;
+extern const char* PERCENT_COMPLETE;
+extern const char* BYTES_TRANSFERRED;
+extern const char* TOTAL_BYTES;
+extern const char* ESTIMATED_REMAINING_SECONDS;
 } // namespace Task
 
 namespace Monitor {
 extern const char* TASK_MONITORS;
 } // namespace Monitor
 
+/*!
+ * @brief Constant literals for EventService endpoint.
+ * */
+namespace EventService {
+extern const char* SSE;
+extern const char* SERVER_SENT_EVENT_URI;
+extern const char* SSE_FILTER_PROPERTIES_SUPPORTED;
+extern const char* REGISTRY_PREFIXES;
+extern const char* RESOURCE_TYPES;
+extern const char* EVENT_FORMAT_TYPES;
+extern const char* SUBSCRIPTIONS;
+extern const char* DELIVERY_RETRY_ATTEMPTS;
+extern const char* DELIVERY_RETRY_INTERVAL_SECONDS;
+} // namespace EventService
+
+/*!
+ * @brief Constant literals for EventDestination endpoint.
+ * */
+namespace EventDestination {
+extern const char* DESTINATION;
+extern const char* PROTOCOL;
+extern const char* CONTEXT;
+extern const char* SUBSCRIPTION_TYPE;
+extern const char* EVENT_FORMAT_TYPE;
+extern const char* REGISTRY_PREFIXES;
+extern const char* RESOURCE_TYPES;
+extern const char* ORIGIN_RESOURCES;
+extern const char* DELIVERED_EVENTS;
+extern const char* DROPPED_EVENTS;
+extern const char* PENDING_EVENTS;
+} // namespace EventDestination
+
+/*!
+ * @brief Constant literals for Event payload and its SSE filter properties.
+ * */
+namespace Event {
+extern const char* EVENTS;
+extern const char* EVENT_TYPE;
+extern const char* EVENT_ID;
+extern const char* EVENT_TIMESTAMP;
+extern const char* ORIGIN_OF_CONDITION;
+extern const char* ORIGIN_RESOURCE;
+extern const char* RESOURCE_TYPE;
+extern const char* REGISTRY_PREFIX;
+extern const char* MESSAGE_SEVERITY;
+} // namespace Event
+
 /*!
  * @brief Constant literals for MessageRegistryFile endpoint
  * */
@@ -353,6 +428,7 @@ extern const char* IMAGE;
 extern const char* TRANSFER_METHOD;
 extern const char* USER_NAME;
 extern const char* PASSWORD;
+extern const char* IMAGE_SHA256;
 } // namespace VirtualMediaInsert
 
 } // namespace constants
@@ -42,6 +42,7 @@ public:
     static const std::string UPDATE_PATH;
     static const std::string SIMPLE_UPDATE_PATH;
     static const std::string SIMPLE_UPDATE_ACTION_INFO_PATH;
+    static const std::string MULTIPART_PUSH_UPDATE_PATH;
     static const std::string SESSION_SERVICE_PATH;
     static const std::string SESSION_COLLECTION_PATH;
     static const std::string SESSION_PATH;
@@ -52,6 +53,10 @@ public:
     static const std::string MESSAGE_REGISTRY_FILE_PATH;
     static const std::string MESSAGE_REGISTRY_PATH;
     static const std::string MONITOR_PATH;
+    static const std::string EVENT_SERVICE_PATH;
+    static const std::string SSE_PATH;
+    static const std::string SUBSCRIPTION_COLLECTION_PATH;
+    static const std::string SUBSCRIPTION_PATH;
 
     static const std::string MANAGER_COLLECTION_PATH;
     static const std::string MANAGER_RESET_PATH;
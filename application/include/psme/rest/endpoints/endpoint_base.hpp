@@ -26,6 +26,7 @@
 #include "psme/rest/endpoints/utils.hpp"
 #include "psme/rest/model/find.hpp"
 #include "psme/rest/model/try_find.hpp"
+#include "psme/rest/server/methods.hpp"
 #include "psme/rest/server/methods_handler.hpp"
 #include "psme/rest/server/request.hpp"
 #include "psme/rest/server/response.hpp"
@@ -38,6 +39,8 @@
 #include <cstring>
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 namespace psme {
 namespace rest {
@@ -96,10 +99,63 @@ protected:
     void set_response(server::Response& response, const json::Json& json) {
         response << json.dump();
     }
+
+    /*!
+     * @brief the method fills a Response with json data, applying OData query options of the request
+     *
+     * Properties not requested with $select are removed and links are expanded according to $expand.
+     *
+     * @param request server::Request the Request with parsed query options
+     * @param response server::Response the Response to be filled with json content
+     * @param json json::Json the json content
+     */
+    void set_response(const server::Request& request, server::Response& response, json::Json json);
+
+    /*!
+     * @brief the method fills a Response with a document pre-rendered into the StaticResourceStore
+     *
+     * Requests with $select or $expand are not served from the store, as they alter the representation.
+     *
+     * @param request server::Request the Request whose URL identifies the document
+     * @param response server::Response the Response to be filled
+     * @return true if the response was filled, false if it has to be rendered
+     */
+    bool set_static_response(const server::Request& request, server::Response& response);
 private:
     std::string m_modified_time{};
 };
 
+/*!
+ * @brief Get HTTP methods implemented by an endpoint class.
+ *
+ * A method is implemented if the endpoint (or one of its bases other than EndpointBase)
+ * overrides the handler rejecting it by default. Resolved at compile time.
+ *
+ * @tparam T Endpoint class
+ * @return Implemented methods
+ */
+template <typename T>
+std::vector<server::Method> get_implemented_methods() {
+    using DefaultHandler = void (EndpointBase::*)(const Request&, Response&);
+    std::vector<server::Method> methods{};
+    if (!std::is_same<decltype(&T::get), DefaultHandler>::value) {
+        methods.emplace_back(server::Method::GET);
+    }
+    if (!std::is_same<decltype(&T::post), DefaultHandler>::value) {
+        methods.emplace_back(server::Method::POST);
+    }
+    if (!std::is_same<decltype(&T::patch), DefaultHandler>::value) {
+        methods.emplace_back(server::Method::PATCH);
+    }
+    if (!std::is_same<decltype(&T::put), DefaultHandler>::value) {
+        methods.emplace_back(server::Method::PUT);
+    }
+    if (!std::is_same<decltype(&T::del), DefaultHandler>::value) {
+        methods.emplace_back(server::Method::DELETE);
+    }
+    return methods;
+}
+
 } // namespace endpoint
 } // namespace rest
 } // namespace psme
@@ -28,7 +28,12 @@
 #include "message_registry_file_collection.hpp"
 #include "metadata.hpp"
 #include "metadata_root.hpp"
+#include "multipart_push_update.hpp"
 #include "odata_service_document.hpp"
+#include "psme/rest/endpoints/event_service/event_service.hpp"
+#include "psme/rest/endpoints/event_service/server_sent_events.hpp"
+#include "psme/rest/endpoints/event_service/subscription.hpp"
+#include "psme/rest/endpoints/event_service/subscription_collection.hpp"
 #include "psme/rest/endpoints/manager/manager.hpp"
 #include "psme/rest/endpoints/manager/manager_collection.hpp"
 #include "psme/rest/endpoints/manager/manager_reset.hpp"
@@ -0,0 +1,32 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "psme/rest/endpoints/endpoint_base.hpp"
+
+namespace psme {
+namespace rest {
+namespace endpoint {
+
+/*!
+ * A class representing the rest api endpoint for EventService
+ */
+class EventService : public EndpointBase {
+public:
+    /*!
+     * @brief The constructor for EventService class
+     */
+    explicit EventService(const std::string& path);
+
+    /*!
+     * @brief EventService class destructor
+     */
+    virtual ~EventService();
+
+    void get(const server::Request& request, server::Response& response) override;
+};
+
+} // namespace endpoint
+} // namespace rest
+} // namespace psme
@@ -0,0 +1,34 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "psme/rest/endpoints/endpoint_base.hpp"
+
+namespace psme {
+namespace rest {
+namespace endpoint {
+
+/*!
+ * A class representing the rest api endpoint for the EventService Server-Sent Events stream.
+ *
+ * The response is a text/event-stream kept open until the client disconnects.
+ */
+class ServerSentEvents : public EndpointBase {
+public:
+    /*!
+     * @brief The constructor for ServerSentEvents class
+     */
+    explicit ServerSentEvents(const std::string& path);
+
+    /*!
+     * @brief ServerSentEvents class destructor
+     */
+    virtual ~ServerSentEvents();
+
+    void get(const server::Request& request, server::Response& response) override;
+};
+
+} // namespace endpoint
+} // namespace rest
+} // namespace psme
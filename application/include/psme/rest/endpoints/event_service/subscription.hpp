@@ -0,0 +1,40 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "psme/rest/endpoints/endpoint_base.hpp"
+
+namespace psme {
+namespace rest {
+namespace endpoint {
+
+/*!
+ * A class representing the rest api endpoint for EventDestination subscription
+ */
+class Subscription : public EndpointBase {
+public:
+    /*!
+     * @brief The constructor for Subscription class
+     */
+    explicit Subscription(const std::string& path);
+
+    /*!
+     * @brief Subscription class destructor
+     */
+    virtual ~Subscription();
+
+    /*!
+     * Create prototype of EventDestination json representation
+     * @return EventDestination json representation
+     */
+    static json::Json make_prototype();
+
+    void get(const server::Request& request, server::Response& response) override;
+
+    void del(const server::Request& request, server::Response& response) override;
+};
+
+} // namespace endpoint
+} // namespace rest
+} // namespace psme
@@ -0,0 +1,34 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "psme/rest/endpoints/endpoint_base.hpp"
+
+namespace psme {
+namespace rest {
+namespace endpoint {
+
+/*!
+ * A class representing the rest api endpoint for EventService subscription collection
+ */
+class SubscriptionCollection : public EndpointBase {
+public:
+    /*!
+     * @brief The constructor for SubscriptionCollection class
+     */
+    explicit SubscriptionCollection(const std::string& path);
+
+    /*!
+     * @brief SubscriptionCollection class destructor
+     */
+    virtual ~SubscriptionCollection();
+
+    void get(const server::Request& request, server::Response& response) override;
+
+    void post(const server::Request& request, server::Response& response) override;
+};
+
+} // namespace endpoint
+} // namespace rest
+} // namespace psme
@@ -0,0 +1,38 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "psme/rest/endpoints/endpoint_base.hpp"
+
+namespace psme {
+namespace rest {
+namespace endpoint {
+
+/*!
+ * @brief A class representing the REST API multipart HTTP push update endpoint.
+ *
+ * The update package is received as the UpdateFile part of a
+ * multipart/form-data body and written to the update staging area while it
+ * is being received, so the package is never held in memory.
+ */
+class MultipartPushUpdate : public EndpointBase {
+public:
+    /*!
+     * @brief The constructor for MultipartPushUpdate class
+     */
+    explicit MultipartPushUpdate(const std::string& path);
+
+    /*!
+     * @brief MultipartPushUpdate class destructor
+     */
+    virtual ~MultipartPushUpdate();
+
+    std::shared_ptr<server::UploadStream> open_upload(const server::Request& request) override;
+
+    void post(const server::Request& request, server::Response& response) override;
+};
+
+} // namespace endpoint
+} // namespace rest
+} // namespace psme
@@ -24,6 +24,8 @@
 #pragma once
 #include "psme/rest/endpoints/endpoint_base.hpp"
 
+#include <chrono>
+
 namespace psme {
 namespace rest {
 namespace endpoint {
@@ -33,6 +35,9 @@ namespace endpoint {
  */
 class Monitor : public EndpointBase {
 public:
+    /*! @brief Upper limit of the wait preference of long-polling clients */
+    static constexpr std::chrono::seconds MAX_WAIT{30};
+
     /*!
      * @brief Constructor
      */
@@ -24,6 +24,7 @@
 #pragma once
 
 #include "path_builder.hpp"
+#include "psme/rest/server/filter.hpp"
 #include "psme/rest/server/parameters.hpp"
 #include "psme/rest/server/request.hpp"
 #include "psme/rest/server/response.hpp"
@@ -37,6 +38,9 @@
 #include "agent-framework/module/model/manager.hpp"
 #include "agent-framework/module/model/resource.hpp"
 
+#include <functional>
+#include <map>
+#include <string>
 #include <vector>
 
 namespace psme {
@@ -99,6 +103,132 @@ std::string get_task_monitor_url(const std::string& uuid);
  */
 void set_location_header(const server::Request& req, server::Response& res, const std::string& path);
 
+/*!
+ * @brief Fills collection Members with links to one page of its members
+ *
+ * @param req Request - its URL and query options ($top, $skip) determine the page
+ *
+ * @param json collection json - Members and Members@odata.nextLink are filled, unless $select leaves Members out
+ *
+ * @param ids ids of members in ascending order, fetched for one member more than the page size;
+ * the id following the page becomes the first id of the next page
+ */
+void fill_collection_page(const server::Request& req, json::Json& json, std::vector<std::uint64_t> ids);
+
+/*!
+ * @brief Fills collection Members with links to one page of members identified by name
+ *
+ * Named members have no numeric id, their position in the collection delimits the pages instead.
+ *
+ * @param req Request - its URL and query options ($skiptoken, $skip, $top) determine the page
+ *
+ * @param json collection json - Members and Members@odata.nextLink are filled, unless $select leaves Members out
+ *
+ * @param names names of all members, in a stable order
+ */
+void fill_collection_page(const server::Request& req, json::Json& json, const std::vector<std::string>& names);
+
+/*!
+ * @brief Selects one page of already filtered collection member ids
+ *
+ * @param req Request - its query options ($skiptoken, $skip, $top) determine the page
+ *
+ * @param ids ids of all matching members in ascending order
+ *
+ * @return ids to be passed to fill_collection_page()
+ */
+std::vector<std::uint64_t> get_page_ids(const server::Request& req, const std::vector<std::uint64_t>& ids);
+
+/*!
+ * @brief Checks that $filter references only properties supported by the collection
+ *
+ * @param filter parsed $filter
+ *
+ * @param supported names of the filterable properties
+ */
+void validate_filter_properties(const server::Filter& filter, const std::vector<std::string>& supported);
+
+/*!
+ * @brief Property of collection members which may be used in $filter
+ * @tparam T Type of collection members
+ */
+template <typename T>
+struct FilterProperty {
+    /*! @brief Returns property value of a member */
+    std::function<json::Json(const T&)> getter{};
+    /*! @brief Property is looked up in a GenericManager index of the same name (for string values) */
+    bool indexed{false};
+};
+
+template <typename T>
+using FilterProperties = std::map<std::string, FilterProperty<T>>;
+
+/*!
+ * @brief Registers GenericManager indexes of the indexed filter properties
+ * @param manager manager of collection members
+ * @param properties filterable properties
+ */
+template <typename T>
+void add_filter_indexes(agent_framework::module::GenericManager<T>& manager, const FilterProperties<T>& properties) {
+    for (const auto& property : properties) {
+        if (property.second.indexed && !manager.has_index(property.first)) {
+            const auto getter = property.second.getter;
+            manager.add_index(property.first, [getter](const T& entry) { return getter(entry).dump(); });
+        }
+    }
+}
+
+/*!
+ * @brief Finds ids of collection members matching $filter
+ *
+ * An equality on an indexed property joined with 'and' at the top level of the
+ * expression narrows down the candidates via the index, otherwise all members
+ * are evaluated.
+ *
+ * @param filter parsed $filter
+ * @param manager manager of collection members
+ * @param properties filterable properties
+ * @return ids of the matching members in ascending order
+ */
+template <typename T>
+std::vector<std::uint64_t> get_filtered_ids(const server::Filter& filter,
+                                            agent_framework::module::GenericManager<T>& manager,
+                                            const FilterProperties<T>& properties) {
+    std::vector<std::string> supported{};
+    for (const auto& property : properties) {
+        supported.push_back(property.first);
+    }
+    validate_filter_properties(filter, supported);
+
+    const auto matches = [&filter, &properties](const T& entry) {
+        return filter.evaluate([&entry, &properties](const std::string& name) {
+            return properties.at(name).getter(entry);
+        });
+    };
+
+    typename agent_framework::module::GenericManager<T>::ManagerDataVec entries{};
+    const auto equalities = filter.get_required_equalities();
+    const auto indexed = std::find_if(equalities.cbegin(), equalities.cend(),
+                                      [&properties, &manager](const server::Filter::Equality& equality) {
+                                          return properties.at(equality.first).indexed &&
+                                                 manager.has_index(equality.first);
+                                      });
+    if (equalities.cend() != indexed) {
+        entries = manager.get_entries_by_index(indexed->first, indexed->second.dump());
+    }
+    else {
+        entries = manager.get_entries(matches);
+    }
+
+    std::vector<std::uint64_t> ids{};
+    for (const auto& entry : entries) {
+        if (equalities.cend() == indexed || matches(entry)) {
+            ids.push_back(entry.get_id());
+        }
+    }
+    return ids;
+}
+
 /*!
  * @brief Adds value to json if a value is present
  * @tparam T Type of value
@@ -0,0 +1,86 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "psme/rest/server/filter.hpp"
+
+#include "json-wrapper/json-wrapper.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace psme {
+namespace rest {
+namespace eventing {
+
+/*!
+ * @brief Redfish event delivered to Server-Sent Events clients and subscribers.
+ *
+ * The payload is rendered into an SSE frame once and shared by all streams.
+ * The record is kept for subscriptions, which batch several records into one payload.
+ * */
+class Event {
+public:
+    /*!
+     * @brief Render the event.
+     * @param[in] id Sequence number, sent as SSE id and EventId.
+     * @param[in] record Event record without EventId.
+     * @param[in] resource_type Schema name of the origin resource (e.g. ComputerSystem).
+     * */
+    Event(std::uint64_t id, json::Json record, const std::string& resource_type);
+
+    /*!
+     * @brief Get sequence number of the event.
+     * @return Event id.
+     * */
+    std::uint64_t get_id() const {
+        return m_id;
+    }
+
+    /*!
+     * @brief Get the event rendered as SSE frame.
+     * @return Frame with id and data fields.
+     * */
+    const std::shared_ptr<const std::string>& get_frame() const {
+        return m_frame;
+    }
+
+    /*!
+     * @brief Get the event record.
+     * @return Record with EventId, as put into Events of the payload.
+     * */
+    const json::Json& get_record() const {
+        return m_record;
+    }
+
+    /*!
+     * @brief Get value of a property the event may be selected by.
+     * @param[in] name EventType, MessageId, OriginResource, RegistryPrefix or ResourceType.
+     * @return Property value, null if not known.
+     * */
+    json::Json get_property(const std::string& name) const {
+        return m_properties.value(name, json::Json{});
+    }
+
+    /*!
+     * @brief Check if the event passes SSE $filter.
+     *
+     * Supported properties are EventType, MessageId, OriginResource,
+     * RegistryPrefix and ResourceType.
+     *
+     * @param[in] filter Filter given by the client.
+     * @return true if the event is to be sent to the client.
+     * */
+    bool matches(const server::Filter& filter) const;
+private:
+    std::uint64_t m_id{};
+    json::Json m_record{};
+    json::Json m_properties{};
+    std::shared_ptr<const std::string> m_frame{};
+};
+
+} // namespace eventing
+} // namespace rest
+} // namespace psme
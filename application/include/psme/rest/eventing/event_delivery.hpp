@@ -0,0 +1,146 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "psme/rest/eventing/event.hpp"
+
+#include "agent-framework/generic/singleton.hpp"
+
+#include <curl/curl.h>
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace psme {
+namespace rest {
+namespace eventing {
+
+/*!
+ * @brief POSTs events to EventDestination subscriptions.
+ *
+ * All destinations are served by a single thread driving libcurl's multi
+ * interface, so a slow or dead listener never blocks event producers.
+ * Records queued for a destination are sent in batches, one request in flight
+ * per destination. A failed batch is retried with exponential backoff and
+ * dropped once retry attempts are exhausted; a full queue drops its oldest
+ * records. Both kinds of drops are counted per destination.
+ * */
+class EventDelivery : public agent_framework::generic::Singleton<EventDelivery> {
+public:
+    /*! @brief Maximum number of records queued for a destination */
+    static constexpr std::size_t MAX_QUEUE_SIZE = 256;
+
+    /*! @brief Maximum number of records sent in one request */
+    static constexpr std::size_t MAX_BATCH_SIZE = 32;
+
+    /*! @brief Number of retries of a failed batch */
+    static constexpr unsigned RETRY_ATTEMPTS = 3;
+
+    /*! @brief Delay before the first retry, doubled on each failure */
+    static constexpr std::chrono::seconds RETRY_INTERVAL{5};
+
+    /*! @brief Upper limit of the delay between retries */
+    static constexpr std::chrono::seconds MAX_RETRY_INTERVAL{60};
+
+    /*! @brief Timeout of a single request */
+    static constexpr std::chrono::seconds REQUEST_TIMEOUT{10};
+
+    /*! @brief Delivery counters of a destination */
+    struct Statistics {
+        std::uint64_t delivered{};
+        std::uint64_t dropped{};
+        std::size_t pending{};
+    };
+
+    /*!
+     * @brief Constructor.
+     * */
+    EventDelivery();
+
+    EventDelivery(const EventDelivery&) = delete;
+    EventDelivery& operator=(const EventDelivery&) = delete;
+
+    /*!
+     * @brief Destructor.
+     * */
+    virtual ~EventDelivery();
+
+    /*!
+     * @brief Start the delivery thread.
+     * */
+    void start();
+
+    /*!
+     * @brief Stop the delivery thread, undelivered records are discarded.
+     * */
+    void stop();
+
+    /*!
+     * @brief Change retry policy of failed batches.
+     * @param[in] attempts Number of retries before a batch is dropped.
+     * @param[in] interval Delay before the first retry.
+     * */
+    void set_retry_policy(unsigned attempts, std::chrono::milliseconds interval);
+
+    /*!
+     * @brief Queue the event for all subscriptions it matches.
+     *
+     * Queues of removed subscriptions are discarded.
+     *
+     * @param[in] event Event to be delivered.
+     * */
+    void push(const Event& event);
+
+    /*!
+     * @brief Get delivery counters of a subscription.
+     * @param[in] subscription_id Subscription id.
+     * @return Counters, all zero if nothing was queued for the subscription.
+     * */
+    Statistics get_statistics(std::uint64_t subscription_id) const;
+private:
+    /*! @brief Per subscription queue and its request state */
+    struct Destination {
+        std::uint64_t id{};
+        std::string uri{};
+        std::string context{};
+        bool removed{false};
+        std::deque<json::Json> queue{};
+        std::string body{};
+        std::size_t batch_size{};
+        unsigned failures{};
+        std::chrono::milliseconds backoff{};
+        std::chrono::steady_clock::time_point next_attempt{};
+        CURL* handle{nullptr};
+        bool in_flight{false};
+        Statistics statistics{};
+    };
+
+    void run();
+
+    std::chrono::milliseconds start_requests(CURLM* multi);
+
+    void complete_request(CURLM* multi, CURL* handle, CURLcode result);
+
+    void prepare_batch(Destination& destination);
+
+    void release(CURLM* multi, Destination& destination);
+
+    mutable std::mutex m_mutex{};
+    bool m_running{false};
+    std::thread m_thread{};
+    CURLM* m_multi{nullptr};
+    curl_slist* m_headers{nullptr};
+    unsigned m_retry_attempts{RETRY_ATTEMPTS};
+    std::chrono::milliseconds m_retry_interval{RETRY_INTERVAL};
+    std::map<std::uint64_t, Destination> m_destinations{};
+};
+
+} // namespace eventing
+} // namespace rest
+} // namespace psme
@@ -0,0 +1,122 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "psme/rest/eventing/event.hpp"
+#include "psme/rest/eventing/event_stream.hpp"
+#include "psme/rest/eventing/resource_watch.hpp"
+
+#include "agent-framework/eventing/event_bus.hpp"
+#include "agent-framework/generic/singleton.hpp"
+#include "agent-framework/module/enum/common.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace psme {
+namespace rest {
+namespace eventing {
+
+/*!
+ * @brief Turns model changes published on the agent framework EventBus into
+ * Redfish events and fans them out to Server-Sent Events streams and to
+ * EventDestination subscriptions.
+ *
+ * Model changes are only queued by the bus subscriber, events are rendered
+ * and delivered by the dispatcher thread. Recent events are kept so that
+ * reconnecting clients may resume from Last-Event-ID. The same thread
+ * notifies watches of changed objects and of elapsed deadlines.
+ * */
+class EventDispatcher : public agent_framework::generic::Singleton<EventDispatcher> {
+public:
+    /*! @brief Number of recent events kept for Last-Event-ID */
+    static constexpr std::size_t HISTORY_SIZE = 64;
+
+    /*! @brief Maximum size of data queued for a single client */
+    static constexpr std::size_t MAX_PENDING_SIZE = 1024 * 1024;
+
+    /*! @brief Interval of keep-alive comments on idle streams */
+    static constexpr std::chrono::seconds KEEP_ALIVE_INTERVAL{30};
+
+    /*!
+     * @brief Destructor.
+     * */
+    virtual ~EventDispatcher();
+
+    /*!
+     * @brief Subscribe to model changes and start delivering events.
+     * */
+    void start();
+
+    /*!
+     * @brief Stop delivering events, close all streams and notify all watches.
+     *
+     * Must be called before the connector is stopped, so that parked
+     * connections are resumed.
+     * */
+    void stop();
+
+    /*!
+     * @brief Open a stream for a new SSE client.
+     * @param[in] filter SSE $filter given by the client.
+     * @param[in] last_event_id Value of Last-Event-ID header, recent events after it are replayed.
+     * @return Stream to be attached to the response, closed if the dispatcher is not running.
+     * */
+    std::shared_ptr<EventStream> open_stream(const server::Filter& filter, const std::string& last_event_id);
+
+    /*!
+     * @brief Watch a model object, e.g. for a client long-polling a task monitor.
+     * @param[in] uuid UUID of the watched object.
+     * @param[in] timeout Time after which the watch becomes ready if the object does not change.
+     * @param[in] renderer Builder of the response.
+     * @return Watch to be set as deferred response, ready at once if the dispatcher is not running.
+     * */
+    std::shared_ptr<ResourceWatch> watch(const std::string& uuid, std::chrono::milliseconds timeout,
+                                         ResourceWatch::Renderer renderer);
+
+    /*!
+     * @brief Queue a model change for delivery.
+     * @param[in] data Model change.
+     * */
+    void publish(const agent_framework::eventing::EventData& data);
+private:
+    void run();
+
+    void deliver(const std::shared_ptr<const Event>& event);
+
+    void keep_alive();
+
+    std::chrono::steady_clock::time_point get_next_deadline();
+
+    std::vector<std::shared_ptr<ResourceWatch>> take_ready_watches(const std::deque<agent_framework::eventing::EventData>& batch);
+
+    std::shared_ptr<const Event> make_event(const agent_framework::eventing::EventData& data);
+
+    std::mutex m_queue_mutex{};
+    std::condition_variable m_queue_condition{};
+    std::deque<agent_framework::eventing::EventData> m_queue{};
+    bool m_running{false};
+    std::thread m_thread{};
+    agent_framework::eventing::EventBus::SubscriberId m_subscriber_id{};
+    std::vector<std::weak_ptr<ResourceWatch>> m_watches{};
+    bool m_watches_changed{false};
+
+    std::mutex m_streams_mutex{};
+    std::vector<std::shared_ptr<EventStream>> m_streams{};
+    std::deque<std::shared_ptr<const Event>> m_history{};
+
+    std::uint64_t m_next_event_id{1};
+    std::map<std::string, agent_framework::model::enums::TaskState> m_task_states{};
+};
+
+} // namespace eventing
+} // namespace rest
+} // namespace psme
@@ -0,0 +1,81 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "psme/rest/eventing/event.hpp"
+#include "psme/rest/server/filter.hpp"
+#include "psme/rest/server/response_stream.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace psme {
+namespace rest {
+namespace eventing {
+
+/*!
+ * @brief Server-Sent Events stream of a single client.
+ *
+ * Queues frames of the events passing the client's $filter until the connector
+ * pulls them. A client which does not keep up is disconnected once the queued
+ * data exceeds the limit; it may reconnect with Last-Event-ID.
+ * */
+class EventStream : public server::ResponseStream {
+public:
+    /*!
+     * @brief Constructor.
+     * @param[in] filter SSE $filter given by the client.
+     * @param[in] max_pending Maximum size of queued data in bytes.
+     * */
+    EventStream(const server::Filter& filter, std::size_t max_pending);
+
+    /*!
+     * @brief Destructor.
+     * */
+    virtual ~EventStream();
+
+    /*!
+     * @brief Queue an event if it passes the filter.
+     * @param[in] event Event to be sent.
+     * @return false if the stream is closed and may be dropped.
+     * */
+    bool push(const Event& event);
+
+    /*!
+     * @brief Queue a comment keeping the connection alive.
+     * @return false if the stream is closed and may be dropped.
+     * */
+    bool push_keep_alive();
+
+    std::size_t read(char* buffer, std::size_t size) override;
+
+    bool is_closed() const override;
+
+    bool wait(ResumeCallback resume) override;
+
+    void wait_for(std::chrono::milliseconds timeout) override;
+
+    void close() override;
+private:
+    bool enqueue(const std::shared_ptr<const std::string>& frame);
+
+    ResumeCallback take_resume();
+
+    server::Filter m_filter;
+    const std::size_t m_max_pending;
+    mutable std::mutex m_mutex{};
+    std::condition_variable m_condition{};
+    std::deque<std::shared_ptr<const std::string>> m_frames{};
+    std::size_t m_offset{0};
+    std::size_t m_pending{0};
+    bool m_closed{false};
+    ResumeCallback m_resume{};
+};
+
+} // namespace eventing
+} // namespace rest
+} // namespace psme
@@ -0,0 +1,82 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "psme/rest/server/deferred_response.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+
+namespace psme {
+namespace rest {
+namespace eventing {
+
+/*!
+ * @brief Deferred response which becomes ready when a model object changes.
+ *
+ * Watches are notified by the EventDispatcher on a change of the watched
+ * object or once their deadline passes, whichever comes first.
+ * */
+class ResourceWatch : public server::DeferredResponse {
+public:
+    /*! @brief Builds the response once the watch is ready */
+    using Renderer = std::function<void(server::Response&)>;
+
+    /*!
+     * @brief Constructor.
+     * @param[in] uuid UUID of the watched object.
+     * @param[in] deadline Time the watch becomes ready at if nothing changes.
+     * @param[in] renderer Builder of the response.
+     * */
+    ResourceWatch(const std::string& uuid, std::chrono::steady_clock::time_point deadline, Renderer renderer);
+
+    /*!
+     * @brief Destructor.
+     * */
+    virtual ~ResourceWatch();
+
+    /*!
+     * @brief Get UUID of the watched object.
+     * @return UUID.
+     * */
+    const std::string& get_uuid() const {
+        return m_uuid;
+    }
+
+    /*!
+     * @brief Get time the watch becomes ready at if nothing changes.
+     * @return Deadline.
+     * */
+    std::chrono::steady_clock::time_point get_deadline() const {
+        return m_deadline;
+    }
+
+    /*!
+     * @brief Mark the watch ready and resume the parked connection.
+     * */
+    void notify();
+
+    bool is_ready() const override;
+
+    bool wait(ResumeCallback resume) override;
+
+    bool wait_for(std::chrono::milliseconds timeout) override;
+
+    void complete(server::Response& response) override;
+private:
+    const std::string m_uuid;
+    const std::chrono::steady_clock::time_point m_deadline;
+    Renderer m_renderer;
+    mutable std::mutex m_mutex{};
+    std::condition_variable m_condition{};
+    bool m_ready{false};
+    ResumeCallback m_resume{};
+};
+
+} // namespace eventing
+} // namespace rest
+} // namespace psme
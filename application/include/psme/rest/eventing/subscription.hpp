@@ -0,0 +1,93 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "psme/rest/eventing/event.hpp"
+
+#include "json-wrapper/json-wrapper.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace psme {
+namespace rest {
+namespace eventing {
+
+/*!
+ * @brief EventDestination subscription, events are POSTed to its destination.
+ *
+ * Empty RegistryPrefixes, ResourceTypes or OriginResources select all events.
+ * */
+class Subscription final {
+public:
+    /*!
+     * @brief Set subscription id
+     * @param id Subscription id
+     */
+    void set_id(std::uint64_t id) {
+        m_id = id;
+    }
+
+    /*!
+     * @brief Get subscription id
+     * @return Subscription id
+     */
+    std::uint64_t get_id() const {
+        return m_id;
+    }
+
+    /*!
+     * @brief Get URI events are POSTed to
+     * @return Destination URI
+     */
+    const std::string& get_destination() const {
+        return m_destination;
+    }
+
+    /*!
+     * @brief Get client-supplied string sent back with each event
+     * @return Context
+     */
+    const std::string& get_context() const {
+        return m_context;
+    }
+
+    /*!
+     * @brief Check if the event is selected by the subscription
+     * @param[in] event Event to be checked
+     * @return true if the event is to be delivered to the destination
+     */
+    bool matches(const Event& event) const;
+
+    /*!
+     * @brief Creates json representation of subscription, as stored and presented
+     * @return JSON representation of subscription
+     */
+    json::Json to_json() const;
+
+    /*!
+     * @brief Fills json with representation of subscription
+     * @param json JSON to be filled with representation of subscription
+     */
+    void fill_json(json::Json& json) const;
+
+    /*!
+     * @brief Creates model representation from EventDestination JSON
+     * @param json Validated POST request body or stored representation
+     * @return Model representation of subscription
+     */
+    static Subscription from_json(const json::Json& json);
+private:
+    std::uint64_t m_id{};
+    std::string m_destination{};
+    std::string m_context{};
+    std::vector<std::string> m_registry_prefixes{};
+    std::vector<std::string> m_resource_types{};
+    std::vector<std::string> m_origin_resources{};
+};
+
+} // namespace eventing
+} // namespace rest
+} // namespace psme
@@ -0,0 +1,107 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "psme/rest/eventing/subscription.hpp"
+
+#include "agent-framework/generic/singleton.hpp"
+#include "database/database.hpp"
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace psme {
+namespace rest {
+namespace eventing {
+
+/*!
+ * @brief Keeps EventDestination subscriptions.
+ *
+ * Subscriptions survive service restarts, each one is stored in the
+ * database under its id.
+ * */
+class SubscriptionManager : public agent_framework::generic::Singleton<SubscriptionManager> {
+public:
+    /*! @brief Callback prototype for for_each() */
+    using SubscriptionCallback = std::function<void(const Subscription&)>;
+
+    /*! @brief Maximum number of subscriptions */
+    static constexpr std::size_t MAX_SUBSCRIPTIONS = 32;
+
+    /*!
+     * @brief Constructor, opens the database.
+     * @param[in] database_name Name of the database subscriptions are stored in.
+     * */
+    explicit SubscriptionManager(const std::string& database_name = "subscriptions");
+
+    /*!
+     * @brief Destructor, releases the database name.
+     * */
+    virtual ~SubscriptionManager();
+
+    /*!
+     * @brief Read stored subscriptions.
+     * */
+    void load();
+
+    /*!
+     * @brief Visit all subscriptions
+     * @param handle Callback to be called on each subscription
+     * @warning Not allowed to use any SubscriptionManager methods.
+     * */
+    void for_each(const SubscriptionCallback& handle) const;
+
+    /*!
+     * @brief Get one page of subscription ids in ascending order
+     *
+     * @param first_id Lowest subscription id to be returned
+     * @param skip Number of ids (not lower than first_id) to be skipped
+     * @param count Maximum number of ids to be returned
+     * @return Subscription ids
+     * */
+    std::vector<std::uint64_t> get_ids(std::uint64_t first_id, std::size_t skip, std::size_t count) const;
+
+    /*!
+     * @brief Get number of subscriptions
+     * @return Number of subscriptions
+     * */
+    std::size_t get_count() const;
+
+    /*!
+     * @brief Get subscription by id
+     * @param subscription_id Subscription id
+     * @return Copy of the subscription
+     * @throw NotFound if there is no such subscription
+     * */
+    Subscription get(std::uint64_t subscription_id) const;
+
+    /*!
+     * @brief Add and store subscription
+     * @param subscription Subscription, its id is assigned
+     * @return Id of the subscription
+     * @throw InvalidValue if the number of subscriptions is exceeded
+     * */
+    std::uint64_t add(Subscription subscription);
+
+    /*!
+     * @brief Remove subscription by id
+     * @param subscription_id Subscription id
+     * @throw NotFound if there is no such subscription
+     * */
+    void del(std::uint64_t subscription_id);
+private:
+    std::map<std::uint64_t, Subscription> m_subscriptions{};
+    mutable std::mutex m_mutex{};
+    database::Database::SPtr m_database;
+
+    /*! @brief Last assigned ID */
+    std::uint64_t m_id{};
+};
+
+} // namespace eventing
+} // namespace rest
+} // namespace psme
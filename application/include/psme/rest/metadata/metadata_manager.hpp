@@ -28,6 +28,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace psme {
 namespace rest {
@@ -48,6 +49,13 @@ public:
      * @return the xml string
      */
     static const std::string& get_xml(const std::string& key);
+
+    /*!
+     * @brief get names of all metadata files
+     *
+     * @return the metadata file names
+     */
+    static std::vector<std::string> get_files();
 };
 
 } // namespace metadata
@@ -43,7 +43,8 @@ namespace server {
  *
  * Depending on the configuration server may open several ports on which
  * it listens for connections. Each port is managed by separate Connector.
- * Default configuration for MEV-TS creates a single Connector for HTTPS on port 8443.
+ * Default configuration for MEV-TS creates a single Connector for HTTPS on port 8443,
+ * on-box clients may additionally be served on a Unix domain socket.
  * */
 class RestServer final {
 public:
@@ -71,7 +72,9 @@ public:
     /*! @brief Stops REST server connectors. */
     void stop();
 private:
-    ConnectorUPtr m_connector{};
+    void add_connector(const ConnectorOptions& options);
+
+    std::vector<ConnectorUPtr> m_connectors{};
 };
 
 } // namespace server
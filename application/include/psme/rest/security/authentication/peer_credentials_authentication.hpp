@@ -0,0 +1,63 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "authentication.hpp"
+#include "psme/rest/server/connector/connector_options.hpp"
+
+#include <sys/types.h>
+
+#include <map>
+#include <string>
+
+/*! forward declarations */
+struct MHD_Connection;
+
+namespace psme {
+namespace rest {
+namespace security {
+namespace authentication {
+
+/*!
+ * @brief Authenticates on-box clients of a Unix domain socket connector.
+ *
+ * The caller's user is taken from the SO_PEERCRED credentials of the socket,
+ * so no password is sent. Only users mapped to a role with the Login
+ * privilege are let in.
+ */
+class PeerCredentialsAuthentication : public Authentication {
+public:
+    /*!
+     * @brief Constructor, resolves user names of the mapping.
+     * @param peer_roles Role ids by user name.
+     */
+    explicit PeerCredentialsAuthentication(const server::ConnectorOptions::PeerRoles& peer_roles);
+
+    /*!
+     * @brief Checks the role of the user connected to the socket.
+     *
+     * @param connection MHD_Connections struct type from microhttpd library returned by every connection callbacks for
+     * each connection.
+     * @param url Url of the resource requested by client.
+     * @param response Response object to set and send if authentication fails.
+     * @return AuthStatus indicating authentication result - FAIL if authentication failed, SUCCESS if succeeded.
+     */
+    AuthStatus perform(MHD_Connection* connection, const std::string& url, server::Response& response) override;
+
+    /*!
+     * @brief Checks the role of the user connected to a socket.
+     * @param socket_fd Connected Unix domain socket.
+     * @return true if the peer's user is mapped to a role with the Login privilege.
+     */
+    bool is_peer_allowed(int socket_fd) const;
+private:
+    bool role_valid(uid_t uid) const;
+
+    std::map<uid_t, std::string> m_roles{};
+};
+
+} // namespace authentication
+} // namespace security
+} // namespace rest
+} // namespace psme
@@ -31,6 +31,7 @@
 #include "psme/rest/security/session/session.hpp"
 #include <map>
 #include <mutex>
+#include <vector>
 
 namespace psme {
 namespace rest {
@@ -66,6 +67,22 @@ public:
      */
     void for_each(const SessionCallback& handle) const;
 
+    /*!
+     * @brief Get one page of session ids in ascending order
+     *
+     * @param first_id Lowest session id to be returned
+     * @param skip Number of ids (not lower than first_id) to be skipped
+     * @param count Maximum number of ids to be returned
+     * @return Session ids
+     */
+    std::vector<std::uint64_t> get_ids(std::uint64_t first_id, std::size_t skip, std::size_t count) const;
+
+    /*!
+     * @brief Get number of sessions kept by the manager
+     * @return Number of sessions
+     */
+    std::size_t get_count() const;
+
     /*!
      * @brief Get session by session id
      *
@@ -60,6 +60,9 @@ public:
     /*! @brief Callback handler for handling unauthenticated requests */
     typedef std::function<bool(const std::string&, const std::string&)> UnauthenticatedAccessCallback;
 
+    /*! @brief Opens stream consuming the body of a request, nullptr if the body is to be stored */
+    typedef std::function<std::shared_ptr<UploadStream>(const Request&)> UploadCallback;
+
     /*!
      * @brief Constructor.
      * @param[in] options ConnectorOptions used for Connector initialization.
@@ -97,6 +100,12 @@ public:
      */
     void set_unauthenticated_access_callback(const UnauthenticatedAccessCallback& callback);
 
+    /*!
+     * @brief Setter for UploadCallback opening streams for request bodies.
+     * @param[in] callback UploadCallback opening streams for request bodies.
+     */
+    void set_upload_callback(const UploadCallback& callback);
+
     /*!
      * @brief Setter for Authentication objects in this connector.
      * @param[in] authentications vector of unique pointers to Authentication objects.
@@ -117,6 +126,38 @@ public:
      */
     void handle(const Request& request, Response& response);
 
+    /*!
+     * @brief Non-throwing builder of a deferred response which became ready.
+     *
+     * @param[in] request HTTP Request object the deferred response was set for.
+     * @param[in] deferred Deferred response.
+     * @param[in] response HTTP Response object to be filled.
+     */
+    void complete(const Request& request, DeferredResponse& deferred, Response& response);
+
+    /*!
+     * @brief Non-throwing opener of a stream consuming the body of an authenticated request.
+     *
+     * @param[in] request HTTP Request object without body.
+     * @param[out] response HTTP Response object filled if the upload is refused.
+     * @param[out] upload Upload stream, nullptr if the body is to be stored in the request.
+     * @return false if the upload is refused.
+     */
+    bool open_upload(const Request& request, Response& response, std::shared_ptr<UploadStream>& upload);
+
+    /*!
+     * @brief Non-throwing writer of a piece of body to an upload stream.
+     *
+     * @param[in] request HTTP Request object the stream was opened for.
+     * @param[in] upload Upload stream.
+     * @param[in] data Body data.
+     * @param[in] size Size of the data.
+     * @param[out] response HTTP Response object filled if the upload is refused.
+     * @return false if the upload is refused.
+     */
+    bool write_upload(const Request& request, UploadStream& upload, const char* data, std::size_t size,
+                      Response& response);
+
     /*!
      * @brief Forms request as a string for logging.
      * @param[in] request HTTP Request object.
@@ -181,10 +222,13 @@ public:
 private:
     void try_handle(const Request& request, Response& response);
 
+    void process(const Request& request, Response& response, const std::function<void()>& action);
+
     ConnectorOptions m_options;
     AccessCallback m_access_callback;
     Callback m_callback;
     UnauthenticatedAccessCallback m_public_access_callback;
+    UploadCallback m_upload_callback;
     std::vector<security::authentication::AuthenticationUPtr> m_authentication{};
 };
 
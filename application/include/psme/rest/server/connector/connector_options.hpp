@@ -30,7 +30,10 @@
 
 #include "agent-framework/module/utils/optional_field.hpp"
 #include "json-wrapper/json-wrapper.hpp"
+#include "psme/rest/server/query_options.hpp"
+#include <map>
 #include <string>
+#include <vector>
 
 namespace psme {
 namespace rest {
@@ -77,6 +80,12 @@ public:
     static constexpr const char THREAD_POOL_SIZE[] = "thread-pool-size";
     /*! @brief Property name of flag indicating if debug mode should be enabled */
     static constexpr const char DEBUG_MODE[] = "debug-mode";
+    /*! @brief Property name of maximum number of collection members in a single response */
+    static constexpr const char PAGE_SIZE[] = "page-size";
+    static constexpr const char SOCKET_PATH[] = "socket-path";
+    static constexpr const char BIND_ADDRESSES[] = "bind-addresses";
+    static constexpr const char PEER_ROLES[] = "peer-roles";
+    static constexpr const char AUTHENTICATION_TYPE_PEER_CREDENTIALS[] = "peer-credentials";
 
     /*! @brief Threading mode of connector */
     enum class ThreadMode {
@@ -88,9 +97,13 @@ public:
         NONE = -1,
         BASIC_AUTH,
         REDFISH_SESSION_AUTH,
-        BASIC_AUTH_OR_REDFISH_SESSION_AUTH
+        BASIC_AUTH_OR_REDFISH_SESSION_AUTH,
+        PEER_CREDENTIALS_AUTH
     };
 
+    /*! @brief Role ids of local users, by user name */
+    using PeerRoles = std::map<std::string, std::string>;
+
     /*!
      * @brief Constructor.
      * @param connector_config JSON Object with connector options.
@@ -171,11 +184,35 @@ public:
      */
     bool use_debug() const;
 
+    /*!
+     * @return Maximum number of collection members returned in a single response.
+     */
+    std::size_t get_page_size() const;
+
     /*!
      * Getter for network interface name on which connector listens incoming requests
      * @return Optional network interface name
      */
     const OptionalField<std::string>& get_network_interface_name() const;
+
+    /*!
+     * @brief Get IPv4 and IPv6 addresses the connector listens on.
+     * @return Addresses, "::" listens on all addresses of both families.
+     * Empty if the addresses of the network interface are used.
+     */
+    const std::vector<std::string>& get_bind_addresses() const;
+
+    /*!
+     * @brief Get path of the Unix domain socket of an on-box connector.
+     * @return Socket path, empty if the connector listens on a TCP port with TLS.
+     */
+    const OptionalField<std::string>& get_socket_path() const;
+
+    /*!
+     * @brief Get roles of local users allowed to connect to the Unix domain socket.
+     * @return Role ids by user name.
+     */
+    const PeerRoles& get_peer_roles() const;
 private:
     uint16_t m_port{443};
     std::string m_certs_dir{};
@@ -185,7 +222,11 @@ private:
     ThreadMode m_thread_mode{ThreadMode::SELECT};
     AuthenticationType m_authentication_type{AuthenticationType::BASIC_AUTH};
     bool m_use_debug{false};
+    std::size_t m_page_size{QueryOptions::DEFAULT_PAGE_SIZE};
     OptionalField<std::string> m_network_interface_name{};
+    OptionalField<std::string> m_socket_path{};
+    std::vector<std::string> m_bind_addresses{};
+    PeerRoles m_peer_roles{};
 };
 
 } // namespace server
@@ -21,6 +21,8 @@
 
 #include "connector_options.hpp"
 
+#include <vector>
+
 namespace psme {
 namespace rest {
 namespace server {
@@ -32,6 +34,13 @@ namespace server {
  */
 ConnectorOptions load_server_options(const json::Json& config);
 
+/*!
+ * Local server options loader
+ * @param config JSON configuration
+ * @return Options of the Unix domain socket connector, none if it is not configured
+ */
+std::vector<ConnectorOptions> load_local_server_options(const json::Json& config);
+
 } // namespace server
 } // namespace rest
 } // namespace psme
@@ -31,6 +31,8 @@
 
 #include "psme/rest/server/connector/connector.hpp"
 
+#include <vector>
+
 /*! forward declarations */
 struct MHD_Daemon;
 struct MHD_Connection;
@@ -42,6 +44,8 @@ namespace server {
 /*!
  * @brief HTTP Connector implementation based on
  * <a href="https://www.gnu.org/software/libmicrohttpd">Libmicrohttpd</a>.
+ *
+ * One daemon is run per bind address, all of them dispatching to this connector.
  * */
 class MHDConnector : public Connector {
 public:
@@ -59,7 +63,7 @@ public:
     void stop() override;
 private:
     using MHDDaemonUPtr = std::unique_ptr<MHD_Daemon, void (*)(MHD_Daemon*)>;
-    MHDDaemonUPtr m_daemon;
+    std::vector<MHDDaemonUPtr> m_daemons{};
 
     MHDConnector(const MHDConnector&) = delete;
 
@@ -30,7 +30,10 @@
 
 #include "json-wrapper/json-wrapper.hpp"
 #include "psme/rest/server/connector/connector_options.hpp"
+#include "net/network_interface.hpp"
+#include "net/socket_address.hpp"
 #include <memory>
+#include <vector>
 
 /*! forward declarations */
 struct MHD_OptionItem;
@@ -56,6 +59,29 @@ public:
      * */
     explicit MHDConnectorOptions(const ConnectorOptions& options);
 
+    /*!
+     * @brief Constructor of options for one of several daemons of a connector.
+     * @param[in] options ConnectorOptions of the connector.
+     * @param[in] address Address the daemon listens on.
+     * @param[in] daemon_count Number of daemons sharing the thread pool.
+     * */
+    MHDConnectorOptions(const ConnectorOptions& options, const net::SocketAddress& address, std::size_t daemon_count);
+
+    /*!
+     * @brief Resolve addresses a connector listens on, one daemon is started per address.
+     * @param[in] options ConnectorOptions of the connector.
+     * @return Addresses from bind addresses or the network interface. Empty for
+     * a local socket or when listening on the IPv4 any-address.
+     * */
+    static std::vector<net::SocketAddress> get_listen_addresses(const ConnectorOptions& options);
+
+    /*!
+     * @brief Pick addresses to listen on from the addresses of a network interface.
+     * @param[in] address_list Addresses of the interface.
+     * @return First IPv4 and first IPv6 address, link-local addresses are skipped.
+     * */
+    static std::vector<net::IpAddress> get_interface_addresses(const net::NetworkInterface::AddressList& address_list);
+
     MHDConnectorOptions(const MHDConnectorOptions&) = default;
 
     MHDConnectorOptions& operator=(const MHDConnectorOptions&) = default;
@@ -0,0 +1,61 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+
+namespace psme {
+namespace rest {
+namespace server {
+
+class Response;
+
+/*!
+ * @brief Response which is produced once a condition is met, e.g. for long-polling.
+ *
+ * The connector holds the request back without sending any headers. It either
+ * parks the connection and registers a resume callback with wait(), or blocks
+ * in wait_for() if the connection has a thread of its own. Once ready, the
+ * final response is built by complete().
+ * */
+class DeferredResponse {
+public:
+    /*! @brief Called once when the response becomes ready */
+    using ResumeCallback = std::function<void()>;
+
+    /*! @brief Destructor */
+    virtual ~DeferredResponse();
+
+    /*!
+     * @brief Check if the response may be built.
+     * @return true if the awaited condition is met or timeout elapsed.
+     * */
+    virtual bool is_ready() const = 0;
+
+    /*!
+     * @brief Register callback resuming the parked connection.
+     * @param[in] resume Callback to be called once.
+     * @return false if the response is already ready,
+     * in which case the callback is not registered.
+     * */
+    virtual bool wait(ResumeCallback resume) = 0;
+
+    /*!
+     * @brief Block until the response is ready or timeout elapses.
+     * @param[in] timeout Maximum time to wait.
+     * @return true if the response is ready.
+     * */
+    virtual bool wait_for(std::chrono::milliseconds timeout) = 0;
+
+    /*!
+     * @brief Build the final response.
+     * @param[out] response Response to be filled.
+     * */
+    virtual void complete(Response& response) = 0;
+};
+
+} // namespace server
+} // namespace rest
+} // namespace psme
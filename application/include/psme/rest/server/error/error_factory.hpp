@@ -162,6 +162,17 @@ public:
                                                  const std::string& property_value,
                                                  const std::string& message = {});
 
+    /*!
+     * @brief Create Redfish-defined error for value format of the query parameter.
+     * @param[in] parameter Name of invalid query parameter.
+     * @param[in] parameter_value Invalid value of the query parameter.
+     * @param[in] message Optional extended message.
+     * @return Query parameter value format error object.
+     * */
+    static ServerError create_query_parameter_value_format_error(const std::string& parameter,
+                                                                 const std::string& parameter_value,
+                                                                 const std::string& message = {});
+
     /*!
      * @brief Create Redfish-defined error for value not in list.
      *
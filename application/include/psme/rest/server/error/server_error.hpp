@@ -87,6 +87,9 @@ public:
     /*! @brief Indicates that a property was given the correct value type but the value of that property was not supported. This includes value size/length exceeded. */
     static const constexpr char PROPERTY_VALUE_FORMAT_ERROR[] = "Base.1.18.PropertyValueFormatError";
 
+    /*! @brief Indicates that a query parameter was given the correct value type but the value of that parameter was not supported. */
+    static const constexpr char QUERY_PARAMETER_VALUE_FORMAT_ERROR[] = "Base.1.18.QueryParameterValueFormatError";
+
     /*! @brief Indicates that the action supplied with the `POST` operation is not supported by the resource. */
     static const constexpr char ACTION_NOT_SUPPORTED[] = "Base.1.18.ActionNotSupported";
 
@@ -0,0 +1,95 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "json-wrapper/json-wrapper.hpp"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace psme {
+namespace rest {
+namespace server {
+
+/*!
+ * @brief Parsed OData $filter expression.
+ *
+ * Supported are comparison operators (eq, ne, gt, ge, lt, le), logical operators
+ * (and, or, not) and parentheses. Properties are referenced by name, nested ones
+ * with '/' separator (e.g. Status/Health). Literals are strings in single quotes,
+ * numbers, true, false and null.
+ * */
+class Filter {
+public:
+    /*! @brief Returns value of the property with given name, null if the property is not present */
+    using PropertyGetter = std::function<json::Json(const std::string&)>;
+
+    /*! @brief Property name and value required by an equality predicate */
+    using Equality = std::pair<std::string, json::Json>;
+
+    struct Node;
+
+    /*! @brief Create empty filter, matching all resources */
+    Filter() = default;
+
+    /*!
+     * @brief Parse $filter expression.
+     * @param[in] expression $filter value.
+     * @return Parsed filter.
+     * @throw ServerException if the expression is malformed.
+     * */
+    static Filter parse(const std::string& expression);
+
+    /*!
+     * @brief Check if the filter has no expression.
+     * @return true if the filter matches all resources.
+     * */
+    bool is_empty() const {
+        return !m_root;
+    }
+
+    /*!
+     * @brief Get the expression the filter was parsed from.
+     * @return $filter value.
+     * */
+    const std::string& get_expression() const {
+        return m_expression;
+    }
+
+    /*!
+     * @brief Evaluate the filter against a resource.
+     * @param[in] getter Provides values of the resource properties.
+     * @return true if the resource matches the filter.
+     * */
+    bool evaluate(const PropertyGetter& getter) const;
+
+    /*!
+     * @brief Get names of all properties referenced by the filter.
+     * @return Property names.
+     * */
+    std::vector<std::string> get_properties() const;
+
+    /*!
+     * @brief Get equality predicates which every matching resource has to fulfill.
+     *
+     * These are 'eq' comparisons joined with 'and' at the top level of the expression.
+     * Any of them may be used to narrow down the candidates, e.g. with an index lookup.
+     *
+     * @return Required property values.
+     * */
+    std::vector<Equality> get_required_equalities() const;
+private:
+    Filter(std::shared_ptr<const Node> root, const std::string& expression)
+        : m_root{std::move(root)}, m_expression{expression} {}
+
+    std::shared_ptr<const Node> m_root{};
+    std::string m_expression{};
+};
+
+} // namespace server
+} // namespace rest
+} // namespace psme
@@ -40,8 +40,17 @@ extern const char JSON[];
 extern const char XML[];
 /*! @brief Content-Type header value of "plain/text" */
 extern const char TXT[];
+/*! @brief Content-Type header value of "text/event-stream" */
+extern const char EVENT_STREAM[];
+/*! @brief Content-Type header value of "multipart/form-data" */
+extern const char MULTIPART_FORM_DATA[];
 } // namespace ContentType
 
+namespace ContentLength {
+/*! @brief Content-Length header constant */
+extern const char CONTENT_LENGTH[];
+} // namespace ContentLength
+
 namespace WWWAuthenticate {
 /*! @brief WWW-Authenticate header constant */
 extern const char WWW_AUTHENTICATE[];
@@ -73,6 +82,47 @@ namespace Location {
 extern const char LOCATION[];
 } // namespace Location
 
+namespace ETag {
+/*! @brief ETag header constant */
+extern const char ETAG[];
+/*! @brief If-None-Match header constant */
+extern const char IF_NONE_MATCH[];
+} // namespace ETag
+
+namespace ContentEncoding {
+/*! @brief Content-Encoding header constant */
+extern const char CONTENT_ENCODING[];
+/*! @brief Accept-Encoding header constant */
+extern const char ACCEPT_ENCODING[];
+/*! @brief Vary header constant */
+extern const char VARY[];
+/*! @brief Content coding value of "identity" */
+extern const char IDENTITY[];
+/*! @brief Content coding value of "gzip" */
+extern const char GZIP[];
+/*! @brief Content coding value of "zstd" */
+extern const char ZSTD[];
+} // namespace ContentEncoding
+
+namespace Allow {
+/*! @brief Allow header constant */
+extern const char ALLOW[];
+} // namespace Allow
+
+namespace LastEventId {
+/*! @brief Last-Event-ID header constant, sent by reconnecting SSE clients */
+extern const char LAST_EVENT_ID[];
+} // namespace LastEventId
+
+namespace Prefer {
+/*! @brief Prefer header constant */
+extern const char PREFER[];
+/*! @brief Prefer header value of "wait", the time a client is willing to wait for a response */
+extern const char WAIT[];
+/*! @brief Preference-Applied header constant, names the preferences the response was produced with */
+extern const char PREFERENCE_APPLIED[];
+} // namespace Prefer
+
 } // namespace http_headers
 } // namespace server
 } // namespace rest
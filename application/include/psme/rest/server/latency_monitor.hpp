@@ -0,0 +1,67 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "agent-framework/generic/singleton.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace psme {
+namespace rest {
+namespace server {
+
+/*!
+ * @brief Tracks processing time of recent requests.
+ *
+ * Keeps the last SAMPLE_COUNT samples, percentiles are computed from the
+ * samples recorded within WINDOW, so an old spike does not linger once the
+ * traffic stops.
+ * */
+class LatencyMonitor : public agent_framework::generic::Singleton<LatencyMonitor> {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /*! @brief Number of samples kept */
+    static constexpr std::size_t SAMPLE_COUNT = 512;
+
+    /*! @brief Samples older than this are not used */
+    static constexpr std::chrono::seconds WINDOW{10};
+
+    /*!
+     * @brief Destructor.
+     * */
+    virtual ~LatencyMonitor();
+
+    /*!
+     * @brief Record processing time of a request.
+     * @param[in] latency Processing time.
+     * @param[in] now Time the request finished.
+     * */
+    void record(std::chrono::microseconds latency, Clock::time_point now = Clock::now());
+
+    /*!
+     * @brief Get a percentile of recent processing times.
+     * @param[in] percentile Percentile, 1 to 100.
+     * @param[in] now Current time.
+     * @return Processing time, 0 if no request finished within WINDOW.
+     * */
+    std::chrono::microseconds get_percentile(unsigned percentile, Clock::time_point now = Clock::now()) const;
+
+private:
+    struct Sample {
+        Clock::time_point time{};
+        std::chrono::microseconds latency{};
+    };
+
+    mutable std::mutex m_mutex{};
+    std::vector<Sample> m_samples{};
+    std::size_t m_next{0};
+};
+
+} // namespace server
+} // namespace rest
+} // namespace psme
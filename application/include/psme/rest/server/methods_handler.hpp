@@ -131,6 +131,18 @@ public:
      * @param[out] response HTTP response object
      */
     virtual void put(const Request& request, Response& response) = 0;
+
+    /*!
+     * @brief Open stream consuming the body of an authenticated POST request
+     *
+     * Called before any body data is received. The request is then handled by
+     * post() with the stream attached instead of the body.
+     *
+     * @param[in] request HTTP request object without body
+     * @return Upload stream, nullptr if the body is to be stored in the request
+     * @throw ServerException if the upload is refused
+     */
+    virtual std::shared_ptr<UploadStream> open_upload(const Request& request);
 };
 
 } // namespace server
@@ -0,0 +1,93 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace psme {
+namespace rest {
+namespace server {
+
+/*!
+ * @brief Incremental parser of multipart/form-data bodies (RFC 7578).
+ *
+ * The body may be fed in pieces of any size. Part contents are passed to the
+ * data callback as they arrive, only a possible partial boundary and the
+ * headers of the current part are buffered.
+ * */
+class MultipartParser {
+public:
+    /*! @brief Headers of a part */
+    struct Part {
+        std::string name{};
+        std::string filename{};
+        std::string content_type{};
+    };
+
+    /*! @brief Called when headers of a part are parsed */
+    using PartCallback = std::function<void(const Part&)>;
+
+    /*! @brief Called with contents of the current part, possibly several times */
+    using DataCallback = std::function<void(const char*, std::size_t)>;
+
+    /*! @brief Called when the current part ends */
+    using PartEndCallback = std::function<void()>;
+
+    /*! @brief Maximum size of headers of a part */
+    static constexpr std::size_t MAX_HEADERS_SIZE = 8192;
+
+    /*!
+     * @brief Constructor.
+     * @param[in] content_type Content-Type header of the request.
+     * @throw ServerException if it is not multipart/form-data with a boundary
+     * */
+    explicit MultipartParser(const std::string& content_type);
+
+    /*!
+     * @brief Set callbacks invoked while parsing.
+     * @param[in] on_part Called when headers of a part are parsed.
+     * @param[in] on_data Called with contents of the current part.
+     * @param[in] on_part_end Called when the current part ends.
+     * */
+    void set_callbacks(PartCallback on_part, DataCallback on_data, PartEndCallback on_part_end);
+
+    /*!
+     * @brief Parse the next piece of the body.
+     * @param[in] data Body data.
+     * @param[in] size Size of the data.
+     * @throw ServerException if the body is malformed
+     * */
+    void parse(const char* data, std::size_t size);
+
+    /*!
+     * @brief Check if the closing boundary was parsed.
+     * @return true if the body is complete.
+     * */
+    bool is_complete() const {
+        return State::EPILOGUE == m_state;
+    }
+private:
+    enum class State {
+        PREAMBLE,
+        DELIMITER,
+        HEADERS,
+        BODY,
+        EPILOGUE
+    };
+
+    void parse_headers(const std::string& headers);
+
+    std::string m_delimiter{};
+    std::string m_buffer{};
+    State m_state{State::PREAMBLE};
+    PartCallback m_on_part{};
+    DataCallback m_on_data{};
+    PartEndCallback m_on_part_end{};
+};
+
+} // namespace server
+} // namespace rest
+} // namespace psme
@@ -48,9 +48,11 @@
 #include "psme/rest/server/methods.hpp"
 #include "psme/rest/server/methods_handler.hpp"
 #include "psme/rest/server/mux/matchers.hpp"
+#include "psme/rest/server/query_options.hpp"
 #include "psme/rest/server/request.hpp"
 #include "psme/rest/server/response.hpp"
 
+#include <functional>
 #include <tuple>
 #include <vector>
 
@@ -72,13 +74,20 @@ namespace server {
  * */
 class Multiplexer : public agent_framework::generic::Singleton<Multiplexer> {
 
+    /*! @brief Methods implemented by a handler together with the precomputed Allow header value */
+    using AllowedMethods = std::tuple<std::vector<Method>, std::string>;
+
     using PathHandlerCandidate = std::tuple<mux::SegmentsVec,
                                             MethodsHandler::UPtr,
-                                            std::string>;
+                                            std::string,
+                                            AllowedMethods>;
 
     using PathHandlerCandidates = std::vector<PathHandlerCandidate>;
     using PluginHandler = std::vector<RequestHandler>;
 public:
+    /*! @brief Callback deciding whether the credentials of a request permit it */
+    using AccessCallback = std::function<bool(const Request&, Response&)>;
+
     virtual ~Multiplexer();
 
     /*!
@@ -103,14 +112,37 @@ public:
      * */
     void use_after(RequestHandler plugin);
 
+    /*!
+     * @brief Set the privilege check of the dispatched requests.
+     *
+     * Unlike the connector's check, it also applies to the resources
+     * expanded into a response. All requests are permitted by default.
+     *
+     * @param callback the privilege check
+     * */
+    void set_access_callback(AccessCallback callback);
+
     /*!
      * @brief Registers a handler for a specific HTTP endpoint.
      *
+     * All methods of the handler are considered to be implemented.
+     *
      * @param handler Handler for endpoint.
-     * @param access_type Used protocol
      */
     void register_handler(MethodsHandler::UPtr handler);
 
+    /*!
+     * @brief Registers a handler implementing given HTTP methods for a specific HTTP endpoint.
+     *
+     * The Allow header returned for OPTIONS and 405 responses is computed here once.
+     * HEAD and OPTIONS are added implicitly, HEAD only if GET is implemented.
+     * Requests with other methods are rejected without calling the handler.
+     *
+     * @param handler Handler for endpoint.
+     * @param methods Methods implemented by the handler.
+     */
+    void register_handler(MethodsHandler::UPtr handler, const std::vector<Method>& methods);
+
     /*!
      * @brief Forwards a response and request object to a registered handler.
      *
@@ -122,6 +154,29 @@ public:
      */
     void forward_to_handler(Response& response, Request& request);
 
+    /*!
+     * @brief Let the handler registered for the request URI open a stream consuming the body.
+     *
+     * @param request object containing the HTTP request without body
+     * @return Upload stream, nullptr if there is no such handler, it does not allow the method
+     * or stores the body in the request
+     */
+    std::shared_ptr<UploadStream> open_upload(Request& request) const;
+
+    /*!
+     * @brief Get JSON representation of a resource without issuing an HTTP request.
+     *
+     * Used to expand links in responses ($expand). A GET request carrying the headers
+     * and credentials of the request being answered goes through the plugins,
+     * the privilege check and the allowed methods of the handler registered for the URL.
+     *
+     * @param request request whose response is expanded
+     * @param url URL of the resource
+     * @param query_options query options to be applied to the resource
+     * @return JSON representation of the resource
+     */
+    json::Json get_resource(const Request& request, const std::string& url, const QueryOptions& query_options) const;
+
     /*!
      * @brief Check whether a given string is a correct endpoint URL from this REST API
      *
@@ -158,13 +213,25 @@ public:
      * @return the map containing URL ids. Empty map after path did not match path_template
      */
     Parameters try_get_params(const std::string& path, const std::string& path_template) const;
+
+    /*!
+     * @brief Set maximum number of collection members returned in a single response
+     *
+     * @param page_size the server page size
+     */
+    void set_page_size(std::size_t page_size);
 private:
+    void dispatch(Request& request, Response& response) const;
+
     const PathHandlerCandidate& select_handler(const std::vector<std::string>& segments, const std::string& uri) const;
 
     PathHandlerCandidates m_handler_candidates{};
 
     PluginHandler m_plugin_pre_handlers{};
     PluginHandler m_plugin_post_handlers{};
+    AccessCallback m_access_callback{[](const Request&, Response&) { return true; }};
+
+    std::size_t m_page_size{QueryOptions::DEFAULT_PAGE_SIZE};
 };
 
 } // namespace server
@@ -0,0 +1,197 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "psme/rest/server/filter.hpp"
+#include "psme/rest/server/parameters.hpp"
+
+#include "json-wrapper/json-wrapper.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace psme {
+namespace rest {
+namespace server {
+
+/*!
+ * @brief OData query options ($select, $expand, $filter, $top, $skip) of a GET request.
+ *
+ * Query options are parsed once per request by the multiplexer and applied
+ * when the endpoint serializes its response.
+ * */
+class QueryOptions {
+public:
+    static constexpr char SELECT[] = "$select";
+    static constexpr char EXPAND[] = "$expand";
+    static constexpr char LEVELS[] = "$levels";
+    static constexpr char TOP[] = "$top";
+    static constexpr char SKIP[] = "$skip";
+    static constexpr char SKIP_TOKEN[] = "$skiptoken";
+    static constexpr char FILTER[] = "$filter";
+
+    /*! @brief Maximum value of $levels accepted by the service */
+    static constexpr std::uint32_t MAX_EXPAND_LEVELS = 3;
+
+    /*! @brief Default maximum number of collection members returned in a single response */
+    static constexpr std::size_t DEFAULT_PAGE_SIZE = 64;
+
+    /*! @brief Kind of links to be expanded */
+    enum class ExpandType {
+        NONE,        //!< Nothing is expanded
+        ALL,         //!< '*' - all links
+        SUBORDINATE, //!< '.' - links which are not under Links property
+        LINKS        //!< '~' - links under Links property only
+    };
+
+    /*! @brief Single property of $select, optionally with nested properties (e.g. Status/Health) */
+    struct SelectProperty {
+        std::string name{};
+        std::vector<SelectProperty> nested{};
+    };
+
+    /*!
+     * @brief Parse query options from the request query parameters.
+     * @param[in] query Request query parameters.
+     * @return Parsed query options.
+     * @throw ServerException if any of the supported options is malformed.
+     * */
+    static QueryOptions from_parameters(const Parameters& query);
+
+    /*!
+     * @brief Check if $select was requested.
+     * @return true if response has to be projected.
+     * */
+    bool has_select() const {
+        return !m_select.empty();
+    }
+
+    /*!
+     * @brief Check if a property of the resource is part of the response.
+     *
+     * Renderers skip properties $select would remove, instead of building them.
+     *
+     * @param[in] property Top-level property name.
+     * @return true without $select, or if the property or any of its nested properties is selected.
+     * */
+    bool is_selected(const std::string& property) const;
+
+    /*!
+     * @brief Check if $expand was requested.
+     * @return true if links in the response have to be expanded.
+     * */
+    bool has_expand() const {
+        return ExpandType::NONE != m_expand_type && 0 != m_expand_levels;
+    }
+
+    /*!
+     * @brief Get requested kind of expansion.
+     * @return Expand type.
+     * */
+    ExpandType get_expand_type() const {
+        return m_expand_type;
+    }
+
+    /*!
+     * @brief Get number of levels to be expanded.
+     * @return Expand levels.
+     * */
+    std::uint32_t get_expand_levels() const {
+        return m_expand_levels;
+    }
+
+    /*!
+     * @brief Get options to be used for resources expanded one level below.
+     * @param[in] keep_select Pass $select to the expanded resources (collection members).
+     * @return Query options for the expanded resources.
+     * */
+    QueryOptions get_expanded_options(bool keep_select) const;
+
+    /*!
+     * @brief Check if $filter was requested.
+     * @return true if collection members have to be filtered.
+     * */
+    bool has_filter() const {
+        return !m_filter.is_empty();
+    }
+
+    /*!
+     * @brief Get parsed $filter expression.
+     * @return Filter to be applied on collection members.
+     * */
+    const Filter& get_filter() const {
+        return m_filter;
+    }
+
+    /*!
+     * @brief Set maximum number of collection members returned in a single response.
+     * @param[in] max_page_size Server page size.
+     * */
+    void set_max_page_size(std::size_t max_page_size) {
+        m_max_page_size = max_page_size;
+    }
+
+    /*!
+     * @brief Get number of collection members to be returned in the response.
+     * @return Lower of $top and the server page size.
+     * */
+    std::size_t get_page_size() const;
+
+    /*!
+     * @brief Get number of collection members to be skipped ($skip).
+     * @return Number of members to be skipped.
+     * */
+    std::size_t get_skip() const {
+        return m_skip;
+    }
+
+    /*!
+     * @brief Get id of the first collection member of a continuation page ($skiptoken).
+     * @return Id of the first member to be returned, 0 if not a continuation page.
+     * */
+    std::uint64_t get_skip_token() const {
+        return m_skip_token;
+    }
+
+    /*!
+     * @brief Check if members beyond the current page were requested.
+     * @return true if the next page link should be provided when more members exist.
+     * */
+    bool has_next_page() const;
+
+    /*!
+     * @brief Build Members@odata.nextLink of a collection.
+     * @param[in] url URL of the collection.
+     * @param[in] next_id Id of the first member of the next page.
+     * @return URL of the next page, preserving $top, $select, $expand and $filter.
+     * */
+    std::string get_next_link(const std::string& url, std::uint64_t next_id) const;
+
+    /*!
+     * @brief Remove all properties not requested by $select from the json.
+     *
+     * OData annotations (@odata.*) are always preserved.
+     *
+     * @param[in,out] json Resource representation to be projected.
+     * */
+    void select(json::Json& json) const;
+private:
+    std::vector<SelectProperty> m_select{};
+    ExpandType m_expand_type{ExpandType::NONE};
+    std::uint32_t m_expand_levels{0};
+    std::string m_select_value{};
+    std::string m_expand_value{};
+    Filter m_filter{};
+    bool m_has_top{false};
+    std::size_t m_top{0};
+    std::size_t m_skip{0};
+    std::uint64_t m_skip_token{0};
+    std::size_t m_max_page_size{DEFAULT_PAGE_SIZE};
+};
+
+} // namespace server
+} // namespace rest
+} // namespace psme
@@ -46,7 +46,10 @@
 
 #include "psme/rest/server/methods.hpp"
 #include "psme/rest/server/parameters.hpp"
+#include "psme/rest/server/query_options.hpp"
+#include "psme/rest/server/upload_stream.hpp"
 
+#include <memory>
 #include <unordered_map>
 
 namespace psme {
@@ -155,6 +158,32 @@ public:
      * @return The URL of the request.
      * */
     const std::string& get_url() const;
+
+    /*!
+     * @brief Set OData query options parsed from the request query.
+     * @param query_options Parsed query options.
+     * */
+    void set_query_options(const QueryOptions& query_options);
+
+    /*!
+     * @brief Get OData query options of the request.
+     * @return Query options of the request.
+     * */
+    const QueryOptions& get_query_options() const;
+
+    /*!
+     * @brief Attach the stream the body was consumed by instead of being stored.
+     * @param upload Upload stream opened for the request.
+     * */
+    void set_upload(std::shared_ptr<UploadStream> upload);
+
+    /*!
+     * @brief Get the stream the body was consumed by.
+     * @return Upload stream, nullptr if the body is stored in the request.
+     * */
+    const std::shared_ptr<UploadStream>& get_upload() const {
+        return m_upload;
+    }
 public:
     //  -----  public members  -----
     Parameters params{};
@@ -169,6 +198,8 @@ private:
     std::string m_source{};
     HeaderList m_headers{};
     std::string m_body{};
+    QueryOptions m_query_options{};
+    std::shared_ptr<UploadStream> m_upload{};
 };
 
 } // namespace server
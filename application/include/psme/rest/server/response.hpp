@@ -45,9 +45,12 @@
 #pragma once
 
 #include "psme/rest/server/content_types.hpp"
+#include "psme/rest/server/deferred_response.hpp"
+#include "psme/rest/server/response_stream.hpp"
 #include "psme/rest/server/status.hpp"
 
 #include <map>
+#include <memory>
 #include <sstream>
 
 namespace psme {
@@ -103,6 +106,52 @@ public:
      */
     void set_body(const std::string& body);
 
+    /*!
+     * @brief Set the entire body of the response without copying it.
+     * The body must not change until the response is delivered, which holds
+     * for documents pre-rendered into the StaticResourceStore.
+     * @param body the response body
+     */
+    void set_persistent_body(std::shared_ptr<const std::string> body);
+
+    /*!
+     * @brief Check if the body references persistent memory.
+     * @return true if the body was set with set_persistent_body()
+     */
+    bool is_body_persistent() const {
+        return static_cast<bool>(m_persistent_body);
+    }
+
+    /*!
+     * @brief Send the body from a stream instead of the buffer.
+     * The connection stays open until the stream is closed.
+     * @param stream the stream producing the body
+     */
+    void set_stream(std::shared_ptr<ResponseStream> stream);
+
+    /*!
+     * @brief Get the stream producing the body.
+     * @return the stream, nullptr if the body is buffered
+     */
+    const std::shared_ptr<ResponseStream>& get_stream() const {
+        return m_stream;
+    }
+
+    /*!
+     * @brief Hold the response back until it is produced by a deferred response.
+     * Status, headers and body set so far are discarded by the connector.
+     * @param deferred the deferred response
+     */
+    void set_deferred(std::shared_ptr<DeferredResponse> deferred);
+
+    /*!
+     * @brief Get the deferred response.
+     * @return the deferred response, nullptr if the response is complete
+     */
+    const std::shared_ptr<DeferredResponse>& get_deferred() const {
+        return m_deferred;
+    }
+
     /*!
      * @brief Pipe data to the body of the response.
      * Appends data onto the body of the response.
@@ -132,6 +181,9 @@ private:
     std::uint32_t m_status{};
     HeaderList m_headers{};
     std::string m_body{};
+    std::shared_ptr<const std::string> m_persistent_body{};
+    std::shared_ptr<ResponseStream> m_stream{};
+    std::shared_ptr<DeferredResponse> m_deferred{};
 };
 
 } // namespace server
@@ -0,0 +1,65 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+
+namespace psme {
+namespace rest {
+namespace server {
+
+/*!
+ * @brief Body of a long-lived response which is produced while being sent.
+ *
+ * The connector pulls data with read(). When nothing is pending it either
+ * parks the connection and registers a resume callback with wait(), or blocks
+ * in wait_for() if the connection has a thread of its own.
+ * */
+class ResponseStream {
+public:
+    /*! @brief Called once when data becomes available or the stream is closed */
+    using ResumeCallback = std::function<void()>;
+
+    /*! @brief Destructor */
+    virtual ~ResponseStream();
+
+    /*!
+     * @brief Take pending data.
+     * @param[out] buffer Buffer to be filled.
+     * @param[in] size Size of the buffer.
+     * @return Number of bytes copied, 0 if nothing is pending.
+     * */
+    virtual std::size_t read(char* buffer, std::size_t size) = 0;
+
+    /*!
+     * @brief Check if the stream is closed.
+     * @return true if no more data will be produced.
+     * */
+    virtual bool is_closed() const = 0;
+
+    /*!
+     * @brief Register callback resuming the parked connection.
+     * @param[in] resume Callback to be called once.
+     * @return false if data is already pending or the stream is closed,
+     * in which case the callback is not registered.
+     * */
+    virtual bool wait(ResumeCallback resume) = 0;
+
+    /*!
+     * @brief Block until data is pending, the stream is closed or timeout elapses.
+     * @param[in] timeout Maximum time to wait.
+     * */
+    virtual void wait_for(std::chrono::milliseconds timeout) = 0;
+
+    /*!
+     * @brief Close the stream, e.g. when the client disconnected.
+     * */
+    virtual void close() = 0;
+};
+
+} // namespace server
+} // namespace rest
+} // namespace psme
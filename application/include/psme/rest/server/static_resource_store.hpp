@@ -0,0 +1,134 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "psme/rest/server/request.hpp"
+#include "psme/rest/server/response.hpp"
+
+#include "agent-framework/generic/singleton.hpp"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace psme {
+namespace rest {
+namespace server {
+
+/*!
+ * @brief Immutable document rendered once at startup.
+ *
+ * Keeps the serialized body together with its precompressed variants,
+ * an ETag and Content-Type, so serving it needs no string building.
+ * */
+class StaticResource {
+public:
+    /*! @brief Content coding of the body */
+    enum class Encoding {
+        IDENTITY,
+        GZIP,
+        ZSTD
+    };
+
+    /*!
+     * @brief Render the resource.
+     * @param[in] url URL the resource is served at.
+     * @param[in] content_type Value of Content-Type header.
+     * @param[in] body Serialized document.
+     * */
+    StaticResource(const std::string& url, const std::string& content_type, const std::string& body);
+
+    /*!
+     * @brief Get URL of the resource.
+     * @return Resource URL.
+     * */
+    const std::string& get_url() const {
+        return m_url;
+    }
+
+    /*!
+     * @brief Get Content-Type of the resource.
+     * @return Content-Type header value.
+     * */
+    const std::string& get_content_type() const {
+        return m_content_type;
+    }
+
+    /*!
+     * @brief Get strong entity tag of the resource in given content coding.
+     * @param[in] encoding Content coding.
+     * @return Quoted ETag header value, distinct for each coding.
+     * */
+    const std::string& get_etag(Encoding encoding) const;
+
+    /*!
+     * @brief Get body in given content coding.
+     * @param[in] encoding Content coding.
+     * @return Body, nullptr if the coding is not available (not built in or not smaller than identity).
+     * */
+    std::shared_ptr<const std::string> get_body(Encoding encoding) const;
+
+    /*!
+     * @brief Select content coding of the response.
+     * @param[in] accept_encoding Value of Accept-Encoding request header.
+     * @return Available coding with the highest quality value, zstd preferred over gzip on ties.
+     * */
+    Encoding select_encoding(const std::string& accept_encoding) const;
+
+    /*!
+     * @brief Fill the response with the resource.
+     *
+     * Responds with 304 Not Modified if If-None-Match matches the ETag.
+     *
+     * @param[in] request Request with conditional and Accept-Encoding headers.
+     * @param[out] response Response to be filled.
+     * */
+    void write(const Request& request, Response& response) const;
+private:
+    std::string m_url{};
+    std::string m_content_type{};
+    std::string m_etag{};
+    std::string m_gzip_etag{};
+    std::string m_zstd_etag{};
+    std::shared_ptr<const std::string> m_body{};
+    std::shared_ptr<const std::string> m_gzip_body{};
+    std::shared_ptr<const std::string> m_zstd_body{};
+};
+
+/*!
+ * @brief Store of documents which never change at runtime ($metadata, schemas,
+ * message registries, service root), looked up by URL.
+ *
+ * Resources are added while the endpoints are built, before the server starts.
+ * */
+class StaticResourceStore : public agent_framework::generic::Singleton<StaticResourceStore> {
+public:
+    /*!
+     * @brief Destructor.
+     * */
+    virtual ~StaticResourceStore();
+
+    /*!
+     * @brief Render a document into the store, replacing the one with the same URL.
+     * @param[in] url URL the resource is served at.
+     * @param[in] content_type Value of Content-Type header.
+     * @param[in] body Serialized document.
+     * */
+    void add(const std::string& url, const std::string& content_type, const std::string& body);
+
+    /*!
+     * @brief Find a resource.
+     * @param[in] url Request URL.
+     * @return Resource, nullptr if there is no static resource with given URL.
+     * */
+    std::shared_ptr<const StaticResource> find(const std::string& url) const;
+private:
+    mutable std::mutex m_mutex{};
+    std::unordered_map<std::string, std::shared_ptr<const StaticResource>> m_resources{};
+};
+
+} // namespace server
+} // namespace rest
+} // namespace psme
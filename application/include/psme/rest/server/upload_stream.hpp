@@ -0,0 +1,43 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include <cstddef>
+
+namespace psme {
+namespace rest {
+namespace server {
+
+/*!
+ * @brief Body of a large upload which is consumed while being received.
+ *
+ * The connector opens the stream once the request is authenticated and feeds
+ * it with pieces of the body instead of buffering the body in the request.
+ * When the body is complete, the request is handled as usual with the stream
+ * attached, so the endpoint can finish the upload.
+ * */
+class UploadStream {
+public:
+    /*! @brief Destructor */
+    virtual ~UploadStream();
+
+    /*!
+     * @brief Consume the next piece of the body.
+     * @param[in] data Body data.
+     * @param[in] size Size of the data.
+     * @throw ServerException if the upload is refused
+     * */
+    virtual void write(const char* data, std::size_t size) = 0;
+
+    /*!
+     * @brief Discard the upload, e.g. when the client disconnected.
+     *
+     * Has no effect once the endpoint finished the upload.
+     * */
+    virtual void abort() = 0;
+};
+
+} // namespace server
+} // namespace rest
+} // namespace psme
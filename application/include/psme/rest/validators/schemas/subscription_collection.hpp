@@ -0,0 +1,26 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "agent-framework/validators/procedure_validator.hpp"
+
+namespace psme {
+namespace rest {
+namespace validators {
+namespace schema {
+
+/*! @brief Schema for validating POST requests on event subscription collection. */
+class SubscriptionCollectionPostSchema {
+    class OriginResourceSchema {
+    public:
+        static const jsonrpc::ProcedureValidator& get_procedure();
+    };
+public:
+    static const jsonrpc::ProcedureValidator& get_procedure();
+};
+
+} // namespace schema
+} // namespace validators
+} // namespace rest
+} // namespace psme
@@ -29,6 +29,7 @@
 #include "configuration/configuration_schema.hpp"
 #include "context.hpp"
 #include "database/database.hpp"
+#include "json-wrapper/validator_cache.hpp"
 #include "psme/rest/registries/config/base_configuration.hpp"
 #include "psme/rest/registries/config/registry_configurator.hpp"
 #include "psme/rest/security/session/session_service.hpp"
@@ -108,16 +109,16 @@ void App::load_configuration(const char* config_path) {
 
     const auto& json_config = Configuration::get_instance().to_json();
 
-    nlohmann::json_schema::json_validator validator;
+    json::ValidatorCache::Validator validator{};
     try {
-        validator.set_root_schema(psme::app::DEFAULT_VALIDATOR_JSON);
+        validator = json::ValidatorCache::get_instance().add("configuration", psme::app::DEFAULT_VALIDATOR_JSON);
     }
     catch (const std::exception& e) {
         throw std::runtime_error(std::string("JSON schema incorrect. ") + e.what());
     }
 
     try {
-        validator.validate(json_config);
+        validator->validate(json_config);
     }
     catch (const std::exception& e) {
         throw std::runtime_error(std::string("Incorrect configuration. ") + e.what());
@@ -3,10 +3,14 @@
 
 #include "context.hpp"
 
+#include "configuration/configuration.hpp"
+#include "ipu/backend.hpp"
 #include "ipu/service.hpp"
 
 using namespace psme;
 
 void Context::initialize() {
+    // The service talks to the IPU through the backend from its construction
+    ipu::Backend::configure(configuration::Configuration::get_instance().to_json());
     service = std::make_shared<ipu::Service>();
 }
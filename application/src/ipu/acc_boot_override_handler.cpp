@@ -6,6 +6,8 @@
 #include "agent-framework/module/model/system.hpp"
 #include "agent-framework/module/model/virtual_media.hpp"
 #include "ipu/reserved_memory_json.hpp"
+#include "ipu/virtual_media_stream.hpp"
+#include "json-wrapper/validator_cache.hpp"
 #include "psme/rest/server/error/error_factory.hpp"
 #include "psme/rest/server/error/server_exception.hpp"
 #include <filesystem>
@@ -18,6 +20,12 @@ using namespace agent_framework::module;
 using namespace agent_framework::model;
 using namespace agent_framework::model::enums;
 
+namespace {
+
+constexpr const char OVERRIDE_CONFIG_SCHEMA_NAME[] = "acc-boot-override";
+
+} // namespace
+
 static json::Json OVERRIDE_CONFIG_SCHEMA = R"~(
 {
     "$schema": "http://json-schema.org/draft-07/schema#",
@@ -82,11 +90,8 @@ std::optional<AccBootOverrideHandler::OverrideConfig> AccBootOverrideHandler::re
         return {};
     }
 
-    nlohmann::json_schema::json_validator validator;
-    validator.set_root_schema(::OVERRIDE_CONFIG_SCHEMA);
-
     try {
-        validator.validate(json_config);
+        json::ValidatorCache::get_instance().validate(OVERRIDE_CONFIG_SCHEMA_NAME, json_config);
     }
     catch (const std::exception&) {
         log_error("ipu", "The boot override file " << constants::ACC_BOOT_OVERRIDE_FILEPATH << " does not match the schema.");
@@ -423,13 +428,17 @@ void AccBootOverrideHandler::ensure_iso_symlink_presence() {
     }
 
     std::error_code ec{};
-    std::filesystem::create_symlink(IMAGE_PATH, IMAGE_SYMLINK, ec);
+    std::filesystem::create_symlink(VirtualMediaStream::get_instance()->get_media_path(), IMAGE_SYMLINK, ec);
     if (ec) {
         throw std::runtime_error("The virtual media image symlink creation failed: " + ec.message());
     }
     log_info("ipu", "The virtual media image symlink has been successfully created.");
 }
 
+void AccBootOverrideHandler::register_schema() {
+    json::ValidatorCache::get_instance().add(OVERRIDE_CONFIG_SCHEMA_NAME, ::OVERRIDE_CONFIG_SCHEMA);
+}
+
 void AccBootOverrideHandler::read_initial_state() {
     auto config = read_override_config();
 
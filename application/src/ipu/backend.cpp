@@ -0,0 +1,79 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/backend.hpp"
+#include "ipu/cpchnl_cmd_handler.hpp"
+#include "ipu/firmware_build_getter.hpp"
+#include "ipu/simulator_backend.hpp"
+#include "logger/logger.hpp"
+
+#include <linux/reboot.h>
+#include <sys/reboot.h>
+#include <unistd.h>
+
+#include <mutex>
+
+namespace psme {
+namespace ipu {
+
+namespace {
+
+std::mutex g_backend_mutex{};
+std::unique_ptr<Backend> g_backend{};
+
+} // namespace
+
+Backend::~Backend() = default;
+
+Backend& Backend::get_instance() {
+    std::lock_guard<std::mutex> lock{g_backend_mutex};
+    if (!g_backend) {
+        g_backend = std::make_unique<DeviceBackend>();
+    }
+    return *g_backend;
+}
+
+void Backend::configure(const json::Json& config) {
+    std::unique_ptr<Backend> backend{};
+    if (config.count("backend") && "simulator" == config["backend"].value("type", std::string{"device"})) {
+        log_warning("ipu", "Using the IPU simulator, the device is not accessed.");
+        backend = std::make_unique<SimulatorBackend>(
+            SimulatorBackend::Settings::from_json(config["backend"].value("simulator", json::Json::object())));
+    }
+    else {
+        backend = std::make_unique<DeviceBackend>();
+    }
+
+    std::lock_guard<std::mutex> lock{g_backend_mutex};
+    g_backend = std::move(backend);
+}
+
+std::unique_ptr<CpchnlTransport> DeviceBackend::create_cpchnl_transport() {
+    return CpchnlCmdHandler::create_device_transport();
+}
+
+InventoryVersion DeviceBackend::get_component_info() {
+    return IpuUpdateHandler().get_component_info();
+}
+
+std::string DeviceBackend::run_update(const std::string& package_path) {
+    return IpuUpdateHandler().run_update(package_path);
+}
+
+std::string DeviceBackend::get_firmware_build() {
+    return FirmwareBuildGetter().value();
+}
+
+void DeviceBackend::reset_imc(const agent_framework::model::enums::ResetType& reset_type) {
+    sync();
+    switch (reset_type) {
+    case agent_framework::model::enums::ResetType::ForceRestart:
+        reboot(LINUX_REBOOT_CMD_RESTART);
+        break;
+    default:
+        break;
+    }
+}
+
+} // namespace ipu
+} // namespace psme
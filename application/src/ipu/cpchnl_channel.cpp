@@ -0,0 +1,154 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/cpchnl_channel.hpp"
+#include "logger/logger.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using std::chrono::steady_clock;
+
+namespace psme {
+namespace ipu {
+
+constexpr std::chrono::milliseconds CpchnlChannel::POLL_INTERVAL;
+
+CpchnlTransport::~CpchnlTransport() = default;
+
+CpchnlChannel::CpchnlChannel(std::unique_ptr<CpchnlTransport> transport)
+    : m_transport{std::move(transport)} {
+    m_thread = std::thread(&CpchnlChannel::run, this);
+}
+
+CpchnlChannel::~CpchnlChannel() {
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_stopping = true;
+    }
+    m_queued.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    const auto stopped = std::make_exception_ptr(std::runtime_error("CPChannel stopped."));
+    for (auto& request : m_queue) {
+        request.promise.set_exception(stopped);
+    }
+    for (auto& outstanding : m_outstanding) {
+        outstanding.second.promise.set_exception(stopped);
+    }
+}
+
+std::future<void> CpchnlChannel::submit(const CpchnlCommand& command) {
+    std::future<void> result{};
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        if (m_stopping) {
+            throw std::runtime_error("CPChannel stopped.");
+        }
+        m_queue.push_back(Request{m_next_tag++, command, {}});
+        result = m_queue.back().promise.get_future();
+    }
+    m_queued.notify_all();
+    return result;
+}
+
+void CpchnlChannel::run() {
+    const auto max_outstanding = std::max<std::size_t>(1, m_transport->get_max_outstanding());
+    while (true) {
+        std::vector<Request> sendable{};
+        {
+            std::unique_lock<std::mutex> lock{m_mutex};
+            m_queued.wait(lock, [this] { return m_stopping || !m_queue.empty() || !m_outstanding.empty(); });
+            if (m_stopping) {
+                return;
+            }
+            while (!m_queue.empty() && m_outstanding.size() + sendable.size() < max_outstanding) {
+                sendable.push_back(std::move(m_queue.front()));
+                m_queue.pop_front();
+            }
+        }
+
+        for (auto& request : sendable) {
+            send(request);
+        }
+        if (m_outstanding.empty()) {
+            continue;
+        }
+
+        // Wake up in time for the nearest deadline and for commands queued meanwhile
+        auto wait = POLL_INTERVAL;
+        for (const auto& outstanding : m_outstanding) {
+            const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(outstanding.second.deadline - steady_clock::now());
+            wait = std::min(wait, std::max(left, std::chrono::milliseconds::zero()));
+        }
+        try {
+            const auto completion = m_transport->receive(wait);
+            if (completion) {
+                complete(*completion);
+            }
+        }
+        catch (const std::exception& e) {
+            // Completions of the outstanding commands are lost, retrying until they time out would spin
+            log_error("ipu", "Failed to receive CPChannel completion: " << e.what());
+            fail_outstanding(std::string{"Failed to receive CPChannel completion: "} + e.what());
+        }
+        expire();
+    }
+}
+
+void CpchnlChannel::send(Request& request) {
+    try {
+        log_debug("ipu", "Sending CPChannel command " << request.command.opcode << " with tag " << request.tag);
+        m_transport->send(request.tag, request.command);
+        m_outstanding.emplace(request.tag, Outstanding{std::move(request.promise), steady_clock::now() + request.command.timeout});
+    }
+    catch (const std::exception& e) {
+        log_error("ipu", "Failed to send CPChannel command " << request.command.opcode << ": " << e.what());
+        request.promise.set_exception(std::make_exception_ptr(std::runtime_error(e.what())));
+    }
+}
+
+void CpchnlChannel::complete(const CpchnlTransport::Completion& completion) {
+    const auto it = m_outstanding.find(completion.tag);
+    if (m_outstanding.end() == it) {
+        // The command has timed out already
+        log_warning("ipu", "Dropping late CPChannel completion with tag " << completion.tag);
+        return;
+    }
+    if (completion.error.empty()) {
+        it->second.promise.set_value();
+    }
+    else {
+        log_error("ipu", "CPChannel command with tag " << completion.tag << " failed: " << completion.error);
+        it->second.promise.set_exception(std::make_exception_ptr(std::runtime_error(completion.error)));
+    }
+    m_outstanding.erase(it);
+}
+
+void CpchnlChannel::fail_outstanding(const std::string& error) {
+    const auto failure = std::make_exception_ptr(std::runtime_error(error));
+    for (auto& outstanding : m_outstanding) {
+        outstanding.second.promise.set_exception(failure);
+    }
+    m_outstanding.clear();
+}
+
+void CpchnlChannel::expire() {
+    const auto now = steady_clock::now();
+    for (auto it = m_outstanding.begin(); m_outstanding.end() != it;) {
+        if (it->second.deadline > now) {
+            ++it;
+            continue;
+        }
+        log_error("ipu", "CPChannel command with tag " << it->first << " timed out.");
+        it->second.promise.set_exception(std::make_exception_ptr(std::runtime_error("CPChannel command timed out.")));
+        it = m_outstanding.erase(it);
+    }
+}
+
+} // namespace ipu
+} // namespace psme
@@ -2,7 +2,8 @@
 /* Copyright (C) 2024 Intel Corporation */
 
 #include "ipu/cpchnl_cmd_handler.hpp"
-#include "agent-framework/exceptions/gami_exception.hpp"
+#include "ipu/backend.hpp"
+#include "logger/logger.hpp"
 
 #include <dcqlxx.h>
 #pragma GCC diagnostic push
@@ -45,10 +46,64 @@ public:
     DcqlxxInitializer() = delete;
 };
 
-CpchnlCmdHandler::CpchnlCmdHandler() : m_dcqlxx(DcqlxxInitializer::dcqlxx_init()) {
+/*!
+ * @brief Transport of the commands over DCQL.
+ *
+ * DCQL offers a blocking send and receive only, so a single command is
+ * outstanding at a time and its completion is known once it was sent.
+ */
+class DcqlTransport : public CpchnlTransport {
+public:
+    DcqlTransport() : m_dcqlxx(DcqlxxInitializer::dcqlxx_init()) {}
+
+    std::size_t get_max_outstanding() const override {
+        return 1;
+    }
+
+    void send(Tag tag, const CpchnlCommand& command) override {
+        Completion completion{tag, {}};
+        try {
+            dcqlxx::CpChnlCommand comm;
+            comm.with_opcode(command.opcode)
+                .with_param_0(command.param_0)
+                .with_timeout_ms(static_cast<std::uint32_t>(command.timeout.count()));
+
+            Result res = m_dcqlxx.sendrcv(comm);
+
+            if (IsResultError(res)) {
+                log_error("ipu", "Failed to send command or receive response: " << GetResultDescription(res));
+                completion.error = GetResultDescription(res);
+            }
+        }
+        catch (const std::exception& ex) {
+            log_error("ipu", "Error running DCQL command: " << ex.what());
+            completion.error = ex.what();
+        }
+        m_completion = std::move(completion);
+    }
+
+    std::optional<Completion> receive(std::chrono::milliseconds) override {
+        auto completion = std::move(m_completion);
+        m_completion.reset();
+        return completion;
+    }
+
+private:
+    dcqlxx::Dcqlxx& m_dcqlxx;
+    std::optional<Completion> m_completion{};
+};
+
+std::unique_ptr<CpchnlTransport> CpchnlCmdHandler::create_device_transport() {
+    return std::make_unique<DcqlTransport>();
+}
+
+CpchnlCmdHandler::CpchnlCmdHandler() : CpchnlCmdHandler(Backend::get_instance().create_cpchnl_transport()) {
+}
+
+CpchnlCmdHandler::CpchnlCmdHandler(std::unique_ptr<CpchnlTransport> transport) : m_channel(std::move(transport)) {
 }
 
-void CpchnlCmdHandler::trigger_acc_reset(enums::ResetType reset_type) {
+std::future<void> CpchnlCmdHandler::trigger_acc_reset(enums::ResetType reset_type) {
     uint32_t cphnl_reset_type = 0;
     switch (reset_type) {
     case enums::ResetType::GracefulShutdown:
@@ -62,33 +117,7 @@ void CpchnlCmdHandler::trigger_acc_reset(enums::ResetType reset_type) {
         throw std::runtime_error(std::string("Unsupported reset type: ") + reset_type.to_string());
     }
 
-    try {
-        dcqlxx::CpChnlCommand comm;
-        comm.with_opcode(CPCHNL2_ACC_RESET_REQUEST)
-            .with_param_0(cphnl_reset_type)
-            .with_timeout_ms(1000);
-
-        Result res = m_dcqlxx.sendrcv(comm);
-
-        if (IsResultError(res)) {
-            log_error("ipu", "Failed to send command or receive response: " << GetResultDescription(res));
-            throw agent_framework::exceptions::GamiException(
-                agent_framework::exceptions::ErrorCode::UNKNOWN_ERROR, // need a new error code
-                GetResultDescription(res));                            // not sure if returning this string is a good idea
-        }
-    }
-    catch (const std::runtime_error& ex) {
-        log_error("ipu", "Error running DCQL command: " << ex.what());
-        throw agent_framework::exceptions::GamiException(
-            agent_framework::exceptions::ErrorCode::UNKNOWN_ERROR, // need a new error code
-            ex.what());
-    }
-    catch (const std::exception& ex) {
-        log_error("ipu", "Error running DCQL command: " << ex.what());
-        throw agent_framework::exceptions::GamiException(
-            agent_framework::exceptions::ErrorCode::UNKNOWN_ERROR, // need a new error code
-            ex.what());
-    }
+    return m_channel.submit(CpchnlCommand{CPCHNL2_ACC_RESET_REQUEST, cphnl_reset_type, std::chrono::milliseconds{1000}});
 }
 
 } // namespace ipu
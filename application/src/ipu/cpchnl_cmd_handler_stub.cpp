@@ -2,17 +2,53 @@
 /* Copyright (C) 2024 Intel Corporation */
 
 #include "ipu/cpchnl_cmd_handler.hpp"
+#include "ipu/backend.hpp"
+#include "logger/logger.hpp"
 
 using namespace agent_framework::model;
 
 namespace psme {
 namespace ipu {
 
-CpchnlCmdHandler::CpchnlCmdHandler() {
+namespace {
+
+/*! @brief Transport completing every command at once */
+class StubTransport : public CpchnlTransport {
+public:
+    std::size_t get_max_outstanding() const override {
+        return 1;
+    }
+
+    void send(Tag tag, const CpchnlCommand& command) override {
+        log_debug("ipu", "DCQL stub - command " << command.opcode << " " << command.param_0);
+        m_completion = Completion{tag, {}};
+    }
+
+    std::optional<Completion> receive(std::chrono::milliseconds) override {
+        auto completion = std::move(m_completion);
+        m_completion.reset();
+        return completion;
+    }
+
+private:
+    std::optional<Completion> m_completion{};
+};
+
+} // namespace
+
+std::unique_ptr<CpchnlTransport> CpchnlCmdHandler::create_device_transport() {
+    return std::make_unique<StubTransport>();
+}
+
+CpchnlCmdHandler::CpchnlCmdHandler() : CpchnlCmdHandler(Backend::get_instance().create_cpchnl_transport()) {
+}
+
+CpchnlCmdHandler::CpchnlCmdHandler(std::unique_ptr<CpchnlTransport> transport) : m_channel(std::move(transport)) {
 }
 
-void CpchnlCmdHandler::trigger_acc_reset(enums::ResetType reset_type) {
+std::future<void> CpchnlCmdHandler::trigger_acc_reset(enums::ResetType reset_type) {
     log_debug("ipu", "DCQL stub - trigger_acc_reset " << reset_type);
+    return m_channel.submit(CpchnlCommand{});
 }
 
 } // namespace ipu
@@ -2,20 +2,61 @@
 /* Copyright (C) 2024 Intel Corporation */
 
 #include "ipu/curl_handler.hpp"
+#include "ipu/segmented_download.hpp"
+#include "ipu/transfer_throttle.hpp"
 #include "agent-framework/module/enum/common.hpp"
-#include "ipu/ipu_constants.hpp"
 #include "psme/rest/server/certs/cert_loader.hpp"
+#include <algorithm>
+#include <cctype>
 #include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
 
 using namespace agent_framework::model::enums;
-using namespace psme::ipu::constants;
 
 namespace psme {
 namespace ipu {
 
+constexpr unsigned CurlHandler::RETRY_ATTEMPTS;
+constexpr std::chrono::milliseconds CurlHandler::RETRY_INTERVAL;
+constexpr std::chrono::milliseconds CurlHandler::MAX_RETRY_INTERVAL;
+constexpr std::chrono::seconds CurlHandler::STALL_TIMEOUT;
+constexpr std::uint64_t CurlHandler::MIN_SEGMENT_SIZE;
+
+namespace {
+
+/*! @brief HTTP status of a Range request the server cannot satisfy */
+constexpr long RANGE_NOT_SATISFIABLE = 416;
+
+/*! @brief HTTP status of a response to a satisfied Range request */
+constexpr long PARTIAL_CONTENT = 206;
+
+/*! @brief HTTP status of a response to a conditional request of an unchanged file */
+constexpr long NOT_MODIFIED = 304;
+
+/*!
+ * @brief Get value of a response header line if it has the given name
+ * @return Trimmed value, empty if the line is another header
+ */
+std::string get_header_value(const std::string& line, const std::string& name) {
+    if (line.size() <= name.size() || ':' != line[name.size()] ||
+        !std::equal(name.begin(), name.end(), line.begin(),
+                    [](char a, char b) { return std::tolower(a) == std::tolower(b); })) {
+        return {};
+    }
+    const auto first = line.find_first_not_of(" \t", name.size() + 1);
+    const auto last = line.find_last_not_of(" \t\r\n");
+    if (std::string::npos == first || last < first) {
+        return {};
+    }
+    return line.substr(first, last - first + 1);
+}
+
+} // namespace
+
 CurlHandler::CurlHandler() : m_curl_handle(curl_easy_init(), curl_easy_cleanup),
-                             m_progress(0),
-                             m_curl_file{} {
+                             m_progress(0) {
     if (!m_curl_handle) {
         throw std::runtime_error("Curl initialization failed.");
     }
@@ -23,54 +64,65 @@ CurlHandler::CurlHandler() : m_curl_handle(curl_easy_init(), curl_easy_cleanup),
     try_curl_setopt(CURLOPT_FAILONERROR, 1L);
     try_curl_setopt(CURLOPT_CAINFO, psme::rest::server::CertLoader::CA_BUNDLE_PATH);
     try_curl_setopt(CURLOPT_DEBUGFUNCTION, log_callback);
+    try_curl_setopt(CURLOPT_HEADERDATA, static_cast<void*>(this));
+    try_curl_setopt(CURLOPT_HEADERFUNCTION, header_callback);
+    try_curl_setopt(CURLOPT_LOW_SPEED_LIMIT, 1L);
+    try_curl_setopt(CURLOPT_LOW_SPEED_TIME, static_cast<long>(STALL_TIMEOUT.count()));
 }
 
-CurlHandler::~CurlHandler() {
-    if (std::filesystem::exists(IMAGE_TEMP_PATH)) {
-        std::filesystem::remove(IMAGE_TEMP_PATH);
-    }
-}
+CurlHandler::~CurlHandler() {}
 
 CurlHandler& CurlHandler::set_url(const std::string& url) {
     try_curl_setopt(CURLOPT_URL, url.c_str());
+    m_url = url;
     return *this;
 }
 
 CurlHandler& CurlHandler::set_file_name(const std::string& file_name) {
-    // if the file name starts with /mnt/imc - use "chunk" mode
-    // - download it to /tmp using 500MB chunks and move to /mnt/imc/ as it is much faster
-    m_chunk_mode = (file_name.find("/mnt/imc", 0) == 0);
-
-    FILE* file = fopen((m_chunk_mode ? IMAGE_TEMP_PATH : file_name.c_str()), "wb+");
-    if (!file) {
-        throw std::runtime_error("Cannot open file " + file_name + " for writing.");
-    }
-    m_curl_file.handle.reset(file);
-
-    // Set write_data callback
-    if (m_chunk_mode) {
-        try_curl_setopt(CURLOPT_WRITEDATA, static_cast<void*>(&m_curl_file));
-        try_curl_setopt(CURLOPT_WRITEFUNCTION, write_data_callback);
-    } else {
-        // use default curl write_data() implementation - writing to /tmp this way is fast
-        try_curl_setopt(CURLOPT_WRITEDATA, static_cast<void*>(m_curl_file.handle.get()));
-        try_curl_setopt(CURLOPT_WRITEFUNCTION, nullptr);
-    }
-
+    // Received data is written straight to the destination by a writer thread,
+    // so downloading and writing to flash overlap and no scratch space is needed.
+    // The file is opened once it is known whether the download is resumed.
+    m_file_name = file_name;
     return *this;
 }
 
 CurlHandler& CurlHandler::set_max_file_size(uint64_t file_size) {
     try_curl_setopt(CURLOPT_MAXFILESIZE_LARGE, file_size);
+    m_max_file_size = file_size;
     return *this;
 }
 
 CurlHandler& CurlHandler::set_progress_report() {
     m_progress = 0;
-    try_curl_setopt(CURLOPT_XFERINFODATA, static_cast<void*>(&m_progress));
+    m_progress_report = true;
+    enable_progress();
+    return *this;
+}
+
+CurlHandler& CurlHandler::set_progress_callback(ProgressCallback on_progress) {
+    m_on_progress = std::move(on_progress);
+    enable_progress();
+    return *this;
+}
+
+void CurlHandler::enable_progress() {
+    try_curl_setopt(CURLOPT_XFERINFODATA, static_cast<void*>(this));
     try_curl_setopt(CURLOPT_XFERINFOFUNCTION, progress_callback);
     try_curl_setopt(CURLOPT_NOPROGRESS, 0L);
-    return *this;
+}
+
+void CurlHandler::report_progress(std::uint64_t done, std::uint64_t total) {
+    if (m_on_progress) {
+        m_on_progress(done, total);
+    }
+    if (!m_progress_report || 0 == total) {
+        return;
+    }
+    const size_t progress_now = static_cast<size_t>(done * 100 / total);
+    if (m_progress < progress_now && (0 == (progress_now % 10))) {
+        m_progress = progress_now;
+        log_info("ipu", m_progress << " % of image downloaded.");
+    }
 }
 
 CurlHandler& CurlHandler::set_credentials(const OptionalField<std::string>& username,
@@ -84,118 +136,481 @@ CurlHandler& CurlHandler::set_credentials(const OptionalField<std::string>& user
     return *this;
 }
 
-void CurlHandler::get_file_size() {
-    curl_off_t file_size = 0;
+CurlHandler& CurlHandler::set_protocols(long protocols) {
+    try_curl_setopt(CURLOPT_PROTOCOLS, protocols);
+    return *this;
+}
+
+CurlHandler& CurlHandler::set_retry_policy(unsigned attempts, std::chrono::milliseconds interval) {
+    m_retry_attempts = attempts;
+    m_retry_interval = interval;
+    return *this;
+}
+
+CurlHandler& CurlHandler::set_segments(unsigned segments) {
+    m_segments = std::max(1u, segments);
+    return *this;
+}
+
+CurlHandler& CurlHandler::set_expected_digest(const OptionalField<std::string>& sha256) {
+    if (sha256.has_value()) {
+        m_expected_digest = sha256.value();
+        std::transform(m_expected_digest.begin(), m_expected_digest.end(), m_expected_digest.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        m_digest = std::make_unique<utils::Sha256>();
+        m_digest_size = 0;
+    }
+    return *this;
+}
+
+CurlHandler& CurlHandler::set_image_cache(ImageCache* cache) {
+    m_image_cache = cache;
+    return *this;
+}
+
+void CurlHandler::check_free_space() {
+    curl_off_t file_size = -1;
     CURLcode res = curl_easy_getinfo(m_curl_handle.get(), CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &file_size);
-    if (CURLE_OK != res) {
-        log_debug("ipu", "Failed to get file size: " << curl_easy_strerror(res));
-        throw std::runtime_error("Failed to get file size: " + std::string(curl_easy_strerror(res)));
+    if (CURLE_OK != res || file_size < 0) {
+        log_debug("ipu", "File size is unknown, limited by the maximum file size only.");
+        return;
     }
     log_debug("ipu", "File size: " << file_size);
 
-    m_curl_file.size = file_size;
-    m_curl_file.chunks = file_size / CHUNK_SIZE;
-    m_curl_file.extra_bytes = file_size % CHUNK_SIZE;
+    const auto folder = std::filesystem::path(m_file_name).parent_path();
+    std::filesystem::space_info si = std::filesystem::space(folder);
+    if (si.available < static_cast<uintmax_t>(file_size)) {
+        log_error("ipu", "There is not enough space left on " << folder.string());
+        throw std::runtime_error("There is not enough space left on " + folder.string());
+    }
 }
 
-void CurlHandler::perform_curl_request() {
+CURLcode CurlHandler::perform_curl_request() {
     CURLcode res = curl_easy_perform(m_curl_handle.get());
     if (CURLE_OK != res) {
         log_debug("ipu", "Data transfer failed: " << curl_easy_strerror(res));
-        throw std::runtime_error("Data transfer failed: " + std::string(curl_easy_strerror(res)));
+    }
+    return res;
+}
+
+bool CurlHandler::is_retryable(CURL* handle, CURLcode code) {
+    switch (code) {
+    case CURLE_COULDNT_RESOLVE_HOST:
+    case CURLE_COULDNT_CONNECT:
+    case CURLE_PARTIAL_FILE:
+    case CURLE_OPERATION_TIMEDOUT:
+    case CURLE_SSL_CONNECT_ERROR:
+    case CURLE_GOT_NOTHING:
+    case CURLE_SEND_ERROR:
+    case CURLE_RECV_ERROR:
+    case CURLE_HTTP2:
+    case CURLE_HTTP2_STREAM:
+        return true;
+    case CURLE_HTTP_RETURNED_ERROR: {
+        long status = 0;
+        curl_easy_getinfo(handle, CURLINFO_RESPONSE_CODE, &status);
+        return status >= 500;
+    }
+    default:
+        return false;
     }
 }
 
+bool CurlHandler::is_resumable(const DownloadCheckpoints::Checkpoint& checkpoint) const {
+    if (checkpoint.url != m_url || checkpoint.validator.empty() || 0 == checkpoint.offset) {
+        return false;
+    }
+    // The file was written verbatim before compressed downloads were decoded
+    if (StreamDecoder::Format::NONE != StreamDecoder::detect(m_url, {})) {
+        return false;
+    }
+    std::error_code ec{};
+    const auto size = std::filesystem::file_size(m_file_name, ec);
+    return !ec && size >= checkpoint.offset;
+}
+
+void CurlHandler::save_checkpoint(std::uint64_t offset) {
+    // Called from the writer thread while the transfer sets the validator
+    std::lock_guard<std::mutex> lock{m_checkpoint_mutex};
+    // Without a validator it cannot be verified that the file did not change
+    if (m_checkpoint.validator.empty()) {
+        return;
+    }
+    m_checkpoint.offset = offset;
+    DownloadCheckpoints::get_instance()->put(m_file_name, m_checkpoint);
+}
+
+std::uint64_t CurlHandler::probe_size() {
+    // A request of the first byte tells if the server supports ranges,
+    // and the size and validator of the file
+    try_curl_setopt(CURLOPT_RANGE, "0-0");
+    try_curl_setopt(CURLOPT_WRITEFUNCTION, probe_callback);
+    try_curl_setopt(CURLOPT_WRITEDATA, static_cast<void*>(m_curl_handle.get()));
+    try_curl_setopt(CURLOPT_NOPROGRESS, 1L);
+    m_response_validator.clear();
+    m_response_total_size = 0;
+    const auto code = perform_curl_request();
+    try_curl_setopt(CURLOPT_RANGE, static_cast<const char*>(nullptr));
+    try_curl_setopt(CURLOPT_NOPROGRESS, (m_progress_report || m_on_progress) ? 0L : 1L);
+
+    if (CURLE_OK != code || m_response_validator.empty()) {
+        log_debug("ipu", "Server does not support segmented download of " << m_url);
+        return 0;
+    }
+    // Compressed data can be decoded only in order
+    if (StreamDecoder::Format::NONE != StreamDecoder::detect(m_url, m_response_content_type)) {
+        return 0;
+    }
+    if (m_max_file_size && m_response_total_size > m_max_file_size) {
+        throw std::runtime_error("Data transfer failed: " + std::string(curl_easy_strerror(CURLE_FILESIZE_EXCEEDED)));
+    }
+    return m_response_total_size;
+}
+
+void CurlHandler::run_segmented_request(std::uint64_t size, unsigned segments) {
+    // Segments share the download rate, each one is a copy of this handle
+    const auto rate = TransferThrottle::get_instance()->get_limits().max_download_rate;
+    if (rate) {
+        try_curl_setopt(CURLOPT_MAX_RECV_SPEED_LARGE, static_cast<curl_off_t>(std::max<std::uint64_t>(1, rate / segments)));
+    }
+    SegmentedDownload download{m_curl_handle.get(), m_file_name, size, m_response_validator};
+    download.set_retry_policy(m_retry_attempts, m_retry_interval, MAX_RETRY_INTERVAL);
+    if (m_progress_report) {
+        download.set_progress_report();
+    }
+    download.set_progress_callback(m_on_progress);
+    if (m_digest) {
+        m_digest->reset();
+        download.set_digest(m_digest.get());
+    }
+    download.run(segments);
+    m_digest_size = size;
+}
+
+void CurlHandler::prepare_digest() {
+    if (!m_digest || m_digest_size == m_checkpoint.offset) {
+        return;
+    }
+    m_digest->reset();
+    m_digest_size = 0;
+    if (0 == m_checkpoint.offset) {
+        return;
+    }
+
+    // Data downloaded before a restart of the service is hashed once
+    log_info("ipu", "Computing digest of " << m_checkpoint.offset << " bytes downloaded before.");
+    std::ifstream file{m_file_name, std::ios::binary};
+    std::vector<char> buffer(FileWriter::BUFFER_SIZE);
+    while (m_digest_size < m_checkpoint.offset) {
+        const auto size = static_cast<std::streamsize>(std::min<std::uint64_t>(buffer.size(), m_checkpoint.offset - m_digest_size));
+        if (!file.read(buffer.data(), size)) {
+            throw std::runtime_error("Cannot read file " + m_file_name);
+        }
+        m_digest->update(buffer.data(), static_cast<std::size_t>(size));
+        m_digest_size += static_cast<std::uint64_t>(size);
+    }
+}
+
+void CurlHandler::verify_digest() const {
+    if (!m_digest || m_expected_digest.empty()) {
+        return;
+    }
+    const auto digest = m_digest->hex_digest();
+    if (digest != m_expected_digest) {
+        log_error("ipu", "SHA-256 digest of " << m_file_name << " is " << digest << ", expected " << m_expected_digest);
+        throw std::runtime_error("SHA-256 digest of the downloaded image does not match the expected value.");
+    }
+    log_info("ipu", "SHA-256 digest of " << m_file_name << " verified.");
+}
+
+bool CurlHandler::restore_cached() {
+    log_info("ipu", m_url << " did not change since it was cached.");
+    if (!m_expected_digest.empty() && m_cached.sha256 != m_expected_digest) {
+        log_error("ipu", "SHA-256 digest of cached " << m_url << " is " << m_cached.sha256 << ", expected " << m_expected_digest);
+        throw std::runtime_error("SHA-256 digest of the downloaded image does not match the expected value.");
+    }
+    return m_image_cache->restore(m_cached.sha256, m_file_name);
+}
+
+void CurlHandler::start_transfer() {
+    m_response_started = false;
+    m_response_validator.clear();
+    m_response_content_type.clear();
+    m_decoder.reset();
+    m_write_error.clear();
+    // The checkpoint moves on while data is synced, the transfer starts from here
+    m_resume_offset = m_checkpoint.offset;
+    try_curl_setopt(CURLOPT_WRITEFUNCTION, write_data_callback);
+    try_curl_setopt(CURLOPT_WRITEDATA, static_cast<void*>(this));
+    prepare_digest();
+    FileWriter::DataCallback on_data{};
+    if (m_digest) {
+        on_data = [this](const char* data, std::size_t size) {
+            m_digest->update(data, size);
+            m_digest_size += size;
+        };
+    }
+    m_file_writer = std::make_unique<FileWriter>(m_file_name, m_resume_offset,
+                                                 [this](std::uint64_t offset) { save_checkpoint(offset); },
+                                                 std::move(on_data));
+
+    try_curl_setopt(CURLOPT_RESUME_FROM_LARGE, static_cast<curl_off_t>(m_resume_offset));
+    m_request_headers.reset();
+    if (m_resume_offset > 0) {
+        // The server sends the whole file if it changed since the checkpoint
+        m_request_headers.reset(curl_slist_append(nullptr, ("If-Range: " + m_checkpoint.validator).c_str()));
+        log_info("ipu", "Resuming download of " << m_file_name << " from " << m_resume_offset << " bytes.");
+    }
+    else if (!m_cached.validator.empty()) {
+        // The server sends the file only if it changed since it was cached
+        const auto condition = '"' == m_cached.validator.front() ? "If-None-Match: " : "If-Modified-Since: ";
+        m_request_headers.reset(curl_slist_append(nullptr, (condition + m_cached.validator).c_str()));
+    }
+    try_curl_setopt(CURLOPT_HTTPHEADER, m_request_headers.get());
+}
+
+void CurlHandler::start_decoding() {
+    const auto format = StreamDecoder::detect(m_url, m_response_content_type);
+    m_decoder = StreamDecoder::create(format);
+    if (m_decoder) {
+        log_info("ipu", "Decompressing " << StreamDecoder::to_string(format) << " image to " << m_file_name);
+    }
+}
+
+void CurlHandler::write_decoded(const char* data, std::size_t size) {
+    // CURLOPT_MAXFILESIZE_LARGE limits the compressed size only
+    if (m_max_file_size && m_file_writer->get_size() + size > m_max_file_size) {
+        throw std::runtime_error("Decompressed image is larger than " + std::to_string(m_max_file_size) + " bytes.");
+    }
+    m_file_writer->write(data, size);
+}
+
 void CurlHandler::run_request() {
-    // do the request without getting the body to check the connection
-    // and to get file size without downloading it
-    try_curl_setopt(CURLOPT_NOBODY, 1L);
+    if (m_file_name.empty()) {
+        throw std::runtime_error("Destination file of the download is not set.");
+    }
 
-    // turn on the logging
+    // log the request and response headers
     try_curl_setopt(CURLOPT_VERBOSE, 1L);
 
-    perform_curl_request();
-
-    if (m_chunk_mode) {
-        // get requested file size first - needed for write_data_callback() to work properly
-        get_file_size();
-        std::filesystem::space_info si = std::filesystem::space(IMAGE_TEMP_FOLDER);
-        if (si.available < CHUNK_SIZE) {
-            log_error("ipu", "There is not enough space left on " << IMAGE_TEMP_FOLDER);
-            throw std::runtime_error("There is not enough space left on " + std::string(IMAGE_TEMP_FOLDER));
+    m_cached = ImageCache::Entry{};
+    if (m_image_cache) {
+        // The image is known by its digest, no request is needed
+        if (!m_expected_digest.empty() && m_image_cache->restore(m_expected_digest, m_file_name)) {
+            DownloadCheckpoints::get_instance()->del(m_file_name);
+            const auto size = std::filesystem::file_size(m_file_name);
+            report_progress(size, size);
+            return;
+        }
+        if (!m_image_cache->find(m_url, m_cached)) {
+            m_cached = ImageCache::Entry{};
         }
-        si = std::filesystem::space(IMAGE_FOLDER);
-        if (si.available < static_cast<uintmax_t>(m_curl_file.size)) {
-            log_error("ipu", "There is not enough space left on " << IMAGE_FOLDER);
-            throw std::runtime_error("There is not enough space left on " + std::string(IMAGE_FOLDER));
+        // Hashed while written, so the image is not read again when cached
+        if (!m_digest) {
+            m_digest = std::make_unique<utils::Sha256>();
+            m_digest_size = 0;
+        }
+    }
+
+    // Downloads run in the background, REST requests go first
+    TransferPriority priority{};
+    try_curl_setopt(CURLOPT_MAX_RECV_SPEED_LARGE,
+                    static_cast<curl_off_t>(TransferThrottle::get_instance()->get_limits().max_download_rate));
+
+    auto* checkpoints = DownloadCheckpoints::get_instance();
+    if (!checkpoints->get(m_file_name, m_checkpoint) || !is_resumable(m_checkpoint)) {
+        m_checkpoint = DownloadCheckpoints::Checkpoint{m_url, 0, {}};
+
+        // Progress of segments is not checkpointed, an interrupted download
+        // of a checkpointed file is finished in a single request.
+        // A cached image is revalidated in a single request.
+        if (m_segments > 1 && m_cached.validator.empty()) {
+            const auto size = probe_size();
+            const auto segments = std::min<std::uint64_t>(m_segments, size / MIN_SEGMENT_SIZE);
+            if (segments > 1) {
+                checkpoints->del(m_file_name);
+                run_segmented_request(size, static_cast<unsigned>(segments));
+                verify_digest();
+                if (m_image_cache) {
+                    m_image_cache->store(m_url, m_response_validator, m_digest->hex_digest(), m_file_name);
+                }
+                return;
+            }
         }
     }
 
-    // re-enable request body
-    try_curl_setopt(CURLOPT_NOBODY, 0L);
+    auto interval = m_retry_interval;
+    for (unsigned attempt = 1;; ++attempt) {
+        start_transfer();
+        const auto code = perform_curl_request();
+        long status = 0;
+        curl_easy_getinfo(m_curl_handle.get(), CURLINFO_RESPONSE_CODE, &status);
+        if (CURLE_OK == code && NOT_MODIFIED == status) {
+            m_file_writer->close();
+            m_file_writer.reset();
+            if (restore_cached()) {
+                checkpoints->del(m_file_name);
+                report_progress(m_cached.size, m_cached.size);
+                return;
+            }
+            log_warning("ipu", "Cached image of " << m_url << " is not available, downloading it again.");
+            m_cached = ImageCache::Entry{};
+            continue;
+        }
+        if (CURLE_OK == code) {
+            break;
+        }
+
+        if (!m_write_error.empty()) {
+            m_file_writer.reset();
+            throw std::runtime_error(m_write_error);
+        }
+        // Data received so far is kept and checkpointed
+        m_file_writer->close();
+        m_file_writer.reset();
 
-    // turn off the logging
-    try_curl_setopt(CURLOPT_VERBOSE, 0L);
+        const bool restart = CURLE_RANGE_ERROR == code || (CURLE_HTTP_RETURNED_ERROR == code && RANGE_NOT_SATISFIABLE == status);
+        if (attempt > m_retry_attempts || (!restart && !is_retryable(m_curl_handle.get(), code))) {
+            throw std::runtime_error("Data transfer failed: " + std::string(curl_easy_strerror(code)));
+        }
+        if (restart) {
+            log_warning("ipu", "Download of " << m_file_name << " cannot be resumed, starting again.");
+            checkpoints->del(m_file_name);
+            m_checkpoint = DownloadCheckpoints::Checkpoint{m_url, 0, {}};
+            continue;
+        }
+        if (m_checkpoint.validator.empty()) {
+            m_checkpoint.offset = 0;
+        }
+        log_warning("ipu", "Download of " << m_file_name << " interrupted: " << curl_easy_strerror(code)
+                                          << ", retrying in " << interval.count() << " ms.");
+        std::this_thread::sleep_for(interval);
+        interval = std::min(interval * 2, MAX_RETRY_INTERVAL);
+    }
 
-    // download the file
-    perform_curl_request();
+    if (m_decoder) {
+        m_decoder->finish([this](const char* data, std::size_t size) { write_decoded(data, size); });
+    }
+    m_file_writer->close();
+    log_debug("ipu", m_file_writer->get_size() << " bytes written to " << m_file_name);
+    m_file_writer.reset();
+    checkpoints->del(m_file_name);
+    verify_digest();
+    if (m_image_cache) {
+        m_image_cache->store(m_url, m_response_validator, m_digest->hex_digest(), m_file_name);
+    }
+}
+
+std::unique_ptr<LazyImage> CurlHandler::open_lazy() {
+    if (m_file_name.empty()) {
+        throw std::runtime_error("Destination file of the download is not set.");
+    }
+    // Compressed images cannot be read at an offset
+    const auto size = probe_size();
+    if (0 == size) {
+        throw std::runtime_error("Image cannot be streamed, the server does not support ranges of " + m_url);
+    }
+    log_info("ipu", "Streaming " << size << " bytes of " << m_url << " to " << m_file_name);
+    return std::make_unique<LazyImage>(m_curl_handle.get(), m_file_name, size, m_response_validator);
 }
 
 size_t CurlHandler::progress_callback(void* clientp, curl_off_t dltotal, curl_off_t dlnow,
                                       curl_off_t ultotal, curl_off_t ulnow) {
     (void)ultotal;
     (void)ulnow;
-    if (!dltotal || !clientp) {
+    if (!clientp || dlnow <= 0) {
         return 0;
     }
-    size_t* progress = static_cast<size_t*>(clientp);
-    size_t progress_now = dlnow * 100 / dltotal;
-    if (*progress < progress_now && (0 == (progress_now % 10))) {
-        *progress = progress_now;
-        log_info("ipu", *progress << " % of image downloaded.");
-    }
+    auto* handler = static_cast<CurlHandler*>(clientp);
+    // A resumed transfer counts the data after the resume offset only
+    const auto offset = handler->m_resume_offset;
+    const auto total = dltotal > 0 ? offset + static_cast<std::uint64_t>(dltotal) : 0;
+    handler->report_progress(offset + static_cast<std::uint64_t>(dlnow), total);
     return 0;
 }
 
-size_t CurlHandler::write_data_callback(void* data, size_t size, size_t nmemb, CurlFile* curl_file) {
-    // TODO: experiment with setvbuf() here
-    size_t bytes_written = fwrite(data, size, nmemb, curl_file->handle.get());
-    if (bytes_written != size * nmemb) {
-        log_error("ipu", "Failed to write to the file.");
-        return 0;
-    }
-    curl_file->downloaded += bytes_written;
-
-    // Check if chunk is full or if we're on the last chunk and it's full
-    if (curl_file->downloaded >= CHUNK_SIZE * (curl_file->current_chunk + 1) ||
-        ((curl_file->current_chunk == curl_file->chunks) && (curl_file->downloaded >= static_cast<size_t>(curl_file->size)))) {
-        curl_file->current_chunk++;
-        log_debug("ipu", "Moving chunk " << curl_file->current_chunk << " of the downloaded file to flash.");
-        fflush(curl_file->handle.get());
-        // Append temporary file contents to IMAGE_PATH
-        // `cat` is much faster than all other methods explored (at least on IMC)
-        std::string cmd = "/usr/bin/cat";
-        cmd += " " + std::string(IMAGE_TEMP_PATH) + " >> " + std::string(IMAGE_PATH);
-        int ret = std::system(cmd.c_str());
-        if (ret != 0) {
-            log_error("ipu", "Failed to run " << cmd);
+size_t CurlHandler::write_data_callback(char* data, size_t size, size_t nmemb, void* userdata) {
+    auto* handler = static_cast<CurlHandler*>(userdata);
+    const size_t bytes = size * nmemb;
+    try {
+        if (!handler->m_response_started) {
+            handler->m_response_started = true;
+            // Size of the file is known once the response headers are received,
+            // a compressed image needs at least as much space
+            handler->check_free_space();
+            // Resumed response is for the checkpointed version of the file
+            if (0 == handler->m_resume_offset) {
+                handler->start_decoding();
+                // A Range of the compressed file cannot continue the decompressed one
+                std::lock_guard<std::mutex> lock{handler->m_checkpoint_mutex};
+                handler->m_checkpoint.validator = handler->m_decoder ? std::string{} : handler->m_response_validator;
+            }
         }
-        // reset temporary file to 0
-        rewind(curl_file->handle.get());
-        ret = ftruncate(fileno(curl_file->handle.get()), 0);
-        if (ret != 0) {
-            log_error("ipu", "Failed to truncate input file.");
+        if (handler->m_decoder) {
+            handler->m_decoder->decode(data, bytes, [handler](const char* decoded, std::size_t decoded_size) {
+                handler->write_decoded(decoded, decoded_size);
+            });
         }
+        else {
+            handler->m_file_writer->write(data, bytes);
+        }
+    }
+    catch (const std::exception& e) {
+        handler->m_write_error = e.what();
+        return 0;
     }
+    return bytes;
+}
+
+size_t CurlHandler::probe_callback(char* data, size_t size, size_t nmemb, void* userdata) {
+    (void)data;
+    long status = 0;
+    curl_easy_getinfo(static_cast<CURL*>(userdata), CURLINFO_RESPONSE_CODE, &status);
+    // The whole file is not downloaded if the server ignored the range
+    return PARTIAL_CONTENT == status ? size * nmemb : 0;
+}
 
-    return bytes_written;
+size_t CurlHandler::header_callback(char* data, size_t size, size_t nmemb, void* userdata) {
+    auto* handler = static_cast<CurlHandler*>(userdata);
+    const size_t bytes = size * nmemb;
+    const std::string line{data, bytes};
+    if (0 == line.rfind("HTTP/", 0)) {
+        // Next response, e.g. after a redirect
+        handler->m_response_validator.clear();
+        handler->m_response_content_type.clear();
+        handler->m_response_total_size = 0;
+        return bytes;
+    }
+    // Weak entity tags cannot be used in If-Range
+    const auto etag = get_header_value(line, "ETag");
+    if (!etag.empty() && 0 != etag.rfind("W/", 0)) {
+        handler->m_response_validator = etag;
+    }
+    const auto last_modified = get_header_value(line, "Last-Modified");
+    if (!last_modified.empty() && handler->m_response_validator.empty()) {
+        handler->m_response_validator = last_modified;
+    }
+    const auto content_type = get_header_value(line, "Content-Type");
+    if (!content_type.empty()) {
+        handler->m_response_content_type = content_type;
+    }
+    const auto content_range = get_header_value(line, "Content-Range");
+    const auto separator = content_range.rfind('/');
+    if (std::string::npos != separator && std::isdigit(static_cast<unsigned char>(content_range[separator + 1]))) {
+        handler->m_response_total_size = std::stoull(content_range.substr(separator + 1));
+    }
+    return bytes;
 }
 
 int CurlHandler::log_callback(CURL* handle, curl_infotype type, char* data, size_t size, void* clientp) {
     (void)handle;
-    (void)type;
     (void)clientp;
 
+    // the body of the transfer is not logged
+    if (CURLINFO_TEXT != type && CURLINFO_HEADER_IN != type && CURLINFO_HEADER_OUT != type) {
+        return 0;
+    }
+
     // method of 2 pointers to exclude the "Authorization:" property from logging
 
     std::string_view init_http{data, size};
@@ -0,0 +1,72 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/download_checkpoints.hpp"
+
+#include "json-wrapper/json-wrapper.hpp"
+#include "logger/logger.hpp"
+
+#include <algorithm>
+
+namespace psme {
+namespace ipu {
+
+namespace {
+
+constexpr const char URL[] = "url";
+constexpr const char OFFSET[] = "offset";
+constexpr const char VALIDATOR[] = "validator";
+
+/*! @brief Keys are file names in the database directory */
+database::String make_key(std::string file_name) {
+    std::replace(file_name.begin(), file_name.end(), '/', '_');
+    return database::String{file_name};
+}
+
+} // namespace
+
+DownloadCheckpoints::DownloadCheckpoints(const std::string& database_name)
+    : m_database{database::Database::create(database_name)} {}
+
+DownloadCheckpoints::~DownloadCheckpoints() {
+    m_database->remove();
+}
+
+bool DownloadCheckpoints::get(const std::string& file_name, Checkpoint& checkpoint) const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    database::String value{};
+    if (!m_database->get(make_key(file_name), value)) {
+        return false;
+    }
+    try {
+        const auto json = json::Json::parse(std::string{value});
+        checkpoint.url = json.at(URL).get<std::string>();
+        checkpoint.offset = json.at(OFFSET).get<std::uint64_t>();
+        checkpoint.validator = json.at(VALIDATOR).get<std::string>();
+    }
+    catch (const std::exception& e) {
+        log_warning("ipu", "Invalid download checkpoint of " << file_name << ": " << e.what());
+        return false;
+    }
+    return true;
+}
+
+void DownloadCheckpoints::put(const std::string& file_name, const Checkpoint& checkpoint) {
+    json::Json json(json::Json::value_t::object);
+    json[URL] = checkpoint.url;
+    json[OFFSET] = checkpoint.offset;
+    json[VALIDATOR] = checkpoint.validator;
+
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (!m_database->put(make_key(file_name), database::String{json.dump()})) {
+        log_warning("ipu", "Download checkpoint of " << file_name << " could not be stored.");
+    }
+}
+
+void DownloadCheckpoints::del(const std::string& file_name) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_database->remove(make_key(file_name));
+}
+
+} // namespace ipu
+} // namespace psme
@@ -0,0 +1,54 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/fault_profile.hpp"
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+namespace psme {
+namespace ipu {
+
+namespace {
+
+std::mt19937_64& get_generator() {
+    thread_local std::mt19937_64 generator{std::random_device{}()};
+    return generator;
+}
+
+} // namespace
+
+FaultProfile FaultProfile::from_json(const json::Json& json) {
+    FaultProfile profile{};
+    profile.latency = std::chrono::milliseconds{json.value("latency-ms", std::int64_t{0})};
+    profile.jitter = std::chrono::milliseconds{json.value("jitter-ms", std::int64_t{0})};
+    profile.error_rate = json.value("error-rate", 0.0);
+    return profile;
+}
+
+std::chrono::milliseconds FaultProfile::sample_latency() const {
+    if (jitter <= std::chrono::milliseconds::zero()) {
+        return std::max(latency, std::chrono::milliseconds::zero());
+    }
+    std::uniform_int_distribution<std::int64_t> distribution{(latency - jitter).count(), (latency + jitter).count()};
+    return std::max(std::chrono::milliseconds{distribution(get_generator())}, std::chrono::milliseconds::zero());
+}
+
+bool FaultProfile::sample_error() const {
+    if (error_rate <= 0.0) {
+        return false;
+    }
+    return std::bernoulli_distribution{std::min(error_rate, 1.0)}(get_generator());
+}
+
+void FaultProfile::apply(const std::string& operation) const {
+    std::this_thread::sleep_for(sample_latency());
+    if (sample_error()) {
+        throw std::runtime_error("Simulated failure of " + operation + ".");
+    }
+}
+
+} // namespace ipu
+} // namespace psme
@@ -0,0 +1,173 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/file_watcher.hpp"
+#include "logger/logger.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+using std::chrono::steady_clock;
+
+namespace psme {
+namespace ipu {
+
+constexpr std::chrono::milliseconds FileWatcher::DEBOUNCE;
+constexpr std::chrono::milliseconds FileWatcher::MAX_DEBOUNCE;
+
+namespace {
+
+constexpr std::uint32_t WATCHED_EVENTS = IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO |
+                                         IN_DELETE_SELF | IN_MOVE_SELF;
+
+int to_poll_timeout(steady_clock::duration duration) {
+    const auto timeout = std::chrono::ceil<std::chrono::milliseconds>(duration).count();
+    return static_cast<int>(std::clamp<decltype(timeout)>(timeout, 0, INT_MAX));
+}
+
+} // namespace
+
+FileWatcher::FileWatcher(const std::vector<std::string>& files) {
+    for (const auto& file : files) {
+        const std::filesystem::path path{file};
+        const auto directory = path.has_parent_path() ? path.parent_path().string() : std::string{"."};
+        auto it = std::find_if(m_directories.begin(), m_directories.end(),
+                               [&directory](const Directory& watched) { return watched.path == directory; });
+        if (m_directories.end() == it) {
+            it = m_directories.insert(m_directories.end(), Directory{directory, {}, -1});
+        }
+        it->names.push_back(path.filename().string());
+    }
+
+    m_event_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    m_inotify_fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_inotify_fd < 0) {
+        log_warning("ipu", "Cannot watch files for changes: " << std::strerror(errno));
+        return;
+    }
+    add_watches();
+    for (const auto& directory : m_directories) {
+        if (directory.watch < 0) {
+            log_warning("ipu", "Cannot watch directory " << directory.path << ", its files are polled until it appears.");
+        }
+    }
+}
+
+FileWatcher::~FileWatcher() {
+    if (m_inotify_fd >= 0) {
+        ::close(m_inotify_fd);
+    }
+    if (m_event_fd >= 0) {
+        ::close(m_event_fd);
+    }
+}
+
+void FileWatcher::add_watches() {
+    if (m_inotify_fd < 0) {
+        return;
+    }
+    for (auto& directory : m_directories) {
+        if (directory.watch < 0) {
+            directory.watch = ::inotify_add_watch(m_inotify_fd, directory.path.c_str(), WATCHED_EVENTS);
+            if (directory.watch >= 0) {
+                log_debug("ipu", "Watching directory " << directory.path << " for changes.");
+            }
+        }
+    }
+}
+
+bool FileWatcher::read_events() {
+    bool changed = false;
+    alignas(inotify_event) char buffer[4096];
+    for (;;) {
+        const auto size = ::read(m_inotify_fd, buffer, sizeof(buffer));
+        if (size < 0 && EINTR == errno) {
+            continue;
+        }
+        if (size <= 0) {
+            return changed;
+        }
+        for (ssize_t offset = 0; offset < size;) {
+            const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+            auto directory = std::find_if(m_directories.begin(), m_directories.end(),
+                                          [event](const Directory& watched) { return watched.watch == event->wd; });
+            if (m_directories.end() == directory) {
+                continue;
+            }
+            if (event->mask & IN_IGNORED) {
+                // The directory is gone, it is watched again once it is back
+                directory->watch = -1;
+                changed = true;
+            }
+            else if (event->mask & (IN_DELETE_SELF | IN_MOVE_SELF)) {
+                changed = true;
+            }
+            else if (event->len > 0) {
+                const std::string name{event->name};
+                changed = changed || directory->names.end() != std::find(directory->names.begin(), directory->names.end(), name);
+            }
+        }
+    }
+}
+
+bool FileWatcher::wait(std::chrono::milliseconds timeout) {
+    const auto deadline = steady_clock::now() + timeout;
+    add_watches();
+
+    bool changed = false;
+    steady_clock::time_point first_change{};
+    for (;;) {
+        const auto now = steady_clock::now();
+        // Once a change is seen, further changes are awaited for the debounce period only
+        const auto remaining = changed ? std::min<steady_clock::duration>(DEBOUNCE, first_change + MAX_DEBOUNCE - now)
+                                       : deadline - now;
+        if (remaining <= steady_clock::duration::zero()) {
+            return changed;
+        }
+
+        pollfd fds[2] = {{m_event_fd, POLLIN, 0}, {m_inotify_fd, POLLIN, 0}};
+        const int result = ::poll(fds, 2, to_poll_timeout(remaining));
+        if (result < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            log_error("ipu", "Waiting for file changes failed: " << std::strerror(errno));
+            return changed;
+        }
+        if (fds[0].revents & POLLIN) {
+            return false;
+        }
+        if (0 == result) {
+            return changed;
+        }
+        if ((fds[1].revents & POLLIN) && read_events() && !changed) {
+            changed = true;
+            first_change = steady_clock::now();
+        }
+    }
+}
+
+void FileWatcher::interrupt() {
+    const std::uint64_t value = 1;
+    if (static_cast<ssize_t>(sizeof(value)) != ::write(m_event_fd, &value, sizeof(value))) {
+        log_error("ipu", "Cannot interrupt file watcher: " << std::strerror(errno));
+    }
+}
+
+bool FileWatcher::is_interrupted() const {
+    pollfd fd{m_event_fd, POLLIN, 0};
+    return ::poll(&fd, 1, 0) > 0 && (fd.revents & POLLIN);
+}
+
+} // namespace ipu
+} // namespace psme
@@ -0,0 +1,179 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/file_writer.hpp"
+#include "ipu/transfer_throttle.hpp"
+#include "logger/logger.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <unistd.h>
+
+namespace psme {
+namespace ipu {
+
+constexpr std::size_t FileWriter::BUFFER_SIZE;
+constexpr std::size_t FileWriter::ALIGNMENT;
+constexpr std::uint64_t FileWriter::SYNC_INTERVAL;
+
+FileWriter::FileWriter(const std::string& path, std::uint64_t offset, SyncCallback on_sync, DataCallback on_data)
+    : m_path{path}, m_on_sync{std::move(on_sync)}, m_on_data{std::move(on_data)}, m_fill{allocate_buffer()}, m_drain{allocate_buffer()},
+      m_size{offset}, m_written{offset}, m_synced{offset} {
+    // A new download goes to a new file, the old one may be linked to a cached image
+    if (0 == offset && 0 != ::unlink(path.c_str()) && ENOENT != errno) {
+        throw std::runtime_error("Cannot remove file " + path + ": " + std::strerror(errno));
+    }
+    m_fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (m_fd < 0) {
+        throw std::runtime_error("Cannot open file " + path + " for writing: " + std::strerror(errno));
+    }
+    // Data past the offset may not have been synced, it is written again
+    if (0 != ::ftruncate(m_fd, static_cast<off_t>(offset)) || ::lseek(m_fd, static_cast<off_t>(offset), SEEK_SET) < 0) {
+        const std::string error = std::strerror(errno);
+        ::close(m_fd);
+        throw std::runtime_error("Cannot truncate file " + path + ": " + error);
+    }
+    m_thread = std::thread(&FileWriter::run, this);
+}
+
+FileWriter::~FileWriter() {
+    stop();
+    if (m_fd >= 0) {
+        ::close(m_fd);
+    }
+}
+
+FileWriter::Buffer FileWriter::allocate_buffer() {
+    Buffer buffer{static_cast<char*>(std::aligned_alloc(ALIGNMENT, BUFFER_SIZE)), &std::free};
+    if (!buffer) {
+        throw std::runtime_error("Cannot allocate download buffer.");
+    }
+    return buffer;
+}
+
+void FileWriter::write(const char* data, std::size_t size) {
+    m_size += size;
+    while (size > 0) {
+        const auto piece = std::min(size, BUFFER_SIZE - m_fill_size);
+        std::memcpy(m_fill.get() + m_fill_size, data, piece);
+        m_fill_size += piece;
+        data += piece;
+        size -= piece;
+        if (BUFFER_SIZE == m_fill_size) {
+            std::unique_lock<std::mutex> lock{m_mutex};
+            submit(lock);
+        }
+    }
+}
+
+void FileWriter::close() {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    if (m_fill_size > 0) {
+        submit(lock);
+    }
+    m_cv.wait(lock, [this]() { return !m_pending; });
+    lock.unlock();
+    stop();
+
+    if (m_error.empty() && 0 != ::fdatasync(m_fd)) {
+        m_error = "Cannot sync file " + m_path + ": " + std::strerror(errno);
+    }
+    if (0 != ::close(m_fd) && m_error.empty()) {
+        m_error = "Cannot close file " + m_path + ": " + std::strerror(errno);
+    }
+    m_fd = -1;
+    if (!m_error.empty()) {
+        throw std::runtime_error(m_error);
+    }
+    if (m_on_sync) {
+        m_on_sync(m_written);
+    }
+}
+
+void FileWriter::submit(std::unique_lock<std::mutex>& lock) {
+    m_cv.wait(lock, [this]() { return !m_pending || !m_error.empty(); });
+    if (!m_error.empty()) {
+        throw std::runtime_error(m_error);
+    }
+    std::swap(m_fill, m_drain);
+    m_drain_size = m_fill_size;
+    m_fill_size = 0;
+    m_pending = true;
+    m_cv.notify_all();
+}
+
+void FileWriter::run() {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    while (true) {
+        m_cv.wait(lock, [this]() { return m_pending || !m_running; });
+        if (!m_pending) {
+            return;
+        }
+        // The drain buffer is not touched by the producer while it is pending
+        lock.unlock();
+        std::string error{};
+        try {
+            write_file(m_drain.get(), m_drain_size);
+        }
+        catch (const std::exception& e) {
+            error = e.what();
+        }
+        lock.lock();
+        m_pending = false;
+        if (!error.empty()) {
+            log_error("ipu", error);
+            m_error = error;
+            m_running = false;
+        }
+        m_cv.notify_all();
+    }
+}
+
+void FileWriter::write_file(const char* data, std::size_t size) {
+    TransferThrottle::get_instance()->throttle_write(size);
+    std::size_t offset = 0;
+    while (offset < size) {
+        const auto written = ::write(m_fd, data + offset, size - offset);
+        if (written < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            throw std::runtime_error("Cannot write file " + m_path + ": " + std::strerror(errno));
+        }
+        offset += static_cast<std::size_t>(written);
+    }
+    m_written += size;
+    // The data is still in the cache, so e.g. hashing it costs no extra read
+    if (m_on_data) {
+        m_on_data(data, size);
+    }
+
+    if (m_written - m_synced >= SYNC_INTERVAL) {
+        if (0 != ::fdatasync(m_fd)) {
+            throw std::runtime_error("Cannot sync file " + m_path + ": " + std::strerror(errno));
+        }
+        // Synced pages are not read back, do not let them crowd out the page cache
+        ::posix_fadvise(m_fd, static_cast<off_t>(m_synced), static_cast<off_t>(m_written - m_synced), POSIX_FADV_DONTNEED);
+        m_synced = m_written;
+        if (m_on_sync) {
+            m_on_sync(m_synced);
+        }
+    }
+}
+
+void FileWriter::stop() {
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_running = false;
+    }
+    m_cv.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+} // namespace ipu
+} // namespace psme
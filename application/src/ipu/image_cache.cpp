@@ -0,0 +1,383 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/image_cache.hpp"
+
+#include "json-wrapper/json-wrapper.hpp"
+#include "logger/logger.hpp"
+#include "utils/crypt_utils.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <linux/fs.h>
+#include <set>
+#include <stdexcept>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include <vector>
+
+namespace psme {
+namespace ipu {
+
+namespace {
+
+constexpr const char URL[] = "url";
+constexpr const char VALIDATOR[] = "validator";
+constexpr const char SHA256[] = "sha256";
+constexpr const char SIZE[] = "size";
+constexpr const char MODIFIED[] = "modified";
+constexpr const char LAST_USED[] = "last_used";
+
+constexpr std::size_t DIGEST_LENGTH = 64;
+constexpr std::size_t READ_SIZE = 1024 * 1024;
+
+/*! @brief Keys are file names in the database directory, URLs are hashed */
+database::String make_key(const std::string& url) {
+    utils::Sha256 digest{};
+    digest.update(url.data(), url.size());
+    return database::String{digest.hex_digest()};
+}
+
+/*! @brief Digests name the stored images, anything else is rejected */
+bool is_digest(const std::string& sha256) {
+    return DIGEST_LENGTH == sha256.size() &&
+           std::all_of(sha256.begin(), sha256.end(), [](unsigned char c) { return std::isxdigit(c) && !std::isupper(c); });
+}
+
+std::int64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+std::int64_t get_modified(const std::string& path) {
+    return static_cast<std::int64_t>(std::filesystem::last_write_time(path).time_since_epoch().count());
+}
+
+/*! @brief Try to share the extents of the source, supported by e.g. btrfs and XFS */
+bool clone_file(const std::string& source, const std::string& destination) {
+#ifdef FICLONE
+    const int source_fd = ::open(source.c_str(), O_RDONLY | O_CLOEXEC);
+    if (source_fd < 0) {
+        return false;
+    }
+    const int destination_fd = ::open(destination.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC,
+                                      S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    bool cloned = false;
+    if (destination_fd >= 0) {
+        cloned = 0 == ::ioctl(destination_fd, FICLONE, source_fd);
+        ::close(destination_fd);
+        if (!cloned) {
+            ::unlink(destination.c_str());
+        }
+    }
+    ::close(source_fd);
+    return cloned;
+#else
+    (void)source;
+    (void)destination;
+    return false;
+#endif
+}
+
+/*! @brief Remove a file, so an existing file linked to another one is never written through */
+void unlink_file(const std::string& path) {
+    if (0 != ::unlink(path.c_str()) && ENOENT != errno) {
+        throw std::runtime_error("Cannot remove file " + path + ": " + std::strerror(errno));
+    }
+}
+
+/*!
+ * @brief Place a file at the destination without copying it
+ * @return false if the file systems allow neither a hard link nor a reflink
+ */
+bool link_file(const std::string& source, const std::string& destination) {
+    unlink_file(destination);
+    // Hard links do not cross file systems
+    return 0 == ::link(source.c_str(), destination.c_str()) || clone_file(source, destination);
+}
+
+/*! @brief Place a file at the destination, copying it if it cannot be linked */
+void place_file(const std::string& source, const std::string& destination) {
+    if (!link_file(source, destination)) {
+        log_debug("ipu", "Copying " << source << " to " << destination);
+        std::filesystem::copy_file(source, destination);
+    }
+}
+
+ImageCache::Entry from_json(const json::Json& json) {
+    ImageCache::Entry entry{};
+    entry.url = json.at(URL).get<std::string>();
+    entry.validator = json.at(VALIDATOR).get<std::string>();
+    entry.sha256 = json.at(SHA256).get<std::string>();
+    entry.size = json.at(SIZE).get<std::uint64_t>();
+    entry.modified = json.at(MODIFIED).get<std::int64_t>();
+    entry.last_used = json.at(LAST_USED).get<std::int64_t>();
+    return entry;
+}
+
+json::Json to_json(const ImageCache::Entry& entry) {
+    json::Json json(json::Json::value_t::object);
+    json[URL] = entry.url;
+    json[VALIDATOR] = entry.validator;
+    json[SHA256] = entry.sha256;
+    json[SIZE] = entry.size;
+    json[MODIFIED] = entry.modified;
+    json[LAST_USED] = entry.last_used;
+    return json;
+}
+
+} // namespace
+
+ImageCache::Settings ImageCache::load_settings(const json::Json& config) {
+    Settings settings{};
+    if (!config.count("image-cache")) {
+        return settings;
+    }
+    const auto& section = config["image-cache"];
+    settings.directory = section.value("location", settings.directory);
+    settings.capacity = section.value("capacity", settings.capacity);
+    settings.copy_limit = section.value("copy-limit", settings.copy_limit);
+    return settings;
+}
+
+ImageCache::ImageCache(const std::string& directory, std::uint64_t capacity, std::uint64_t copy_limit,
+                       const std::string& database_name)
+    : m_directory{directory}, m_capacity{capacity}, m_copy_limit{copy_limit},
+      m_database{database::Database::create(database_name)} {}
+
+ImageCache::~ImageCache() {
+    m_database->remove();
+}
+
+bool ImageCache::find(const std::string& url, Entry& entry) const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    database::String value{};
+    if (!m_database->get(make_key(url), value)) {
+        return false;
+    }
+    try {
+        entry = from_json(json::Json::parse(std::string{value}));
+    }
+    catch (const std::exception& e) {
+        log_warning("ipu", "Invalid image cache entry of " << url << ": " << e.what());
+        return false;
+    }
+    std::error_code ec{};
+    return entry.url == url && is_digest(entry.sha256) && std::filesystem::is_regular_file(get_blob(entry.sha256), ec);
+}
+
+bool ImageCache::contains(const std::string& sha256) const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    std::error_code ec{};
+    return is_digest(sha256) && std::filesystem::is_regular_file(get_blob(sha256), ec);
+}
+
+bool ImageCache::restore(const std::string& sha256, const std::string& destination) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (!is_digest(sha256)) {
+        return false;
+    }
+    auto entries = load();
+    const auto it = std::find_if(entries.begin(), entries.end(), [&sha256](const Entry& entry) { return entry.sha256 == sha256; });
+    const auto blob = get_blob(sha256);
+    try {
+        std::error_code ec{};
+        if (entries.end() == it || !std::filesystem::is_regular_file(blob, ec)) {
+            return false;
+        }
+        // An image changed since it was stored is verified before it is used
+        if (std::filesystem::file_size(blob) != it->size || get_modified(blob) != it->modified) {
+            log_warning("ipu", "Cached image " << sha256 << " was modified, verifying its digest.");
+            if (get_digest(blob) != sha256) {
+                log_error("ipu", "Cached image " << sha256 << " is corrupted, removing it.");
+                erase(sha256);
+                return false;
+            }
+            for (auto& entry : entries) {
+                if (entry.sha256 == sha256) {
+                    entry.size = std::filesystem::file_size(blob);
+                    entry.modified = get_modified(blob);
+                }
+            }
+        }
+        place_file(blob, destination);
+    }
+    catch (const std::exception& e) {
+        log_warning("ipu", "Cannot restore cached image " << sha256 << " to " << destination << ": " << e.what());
+        return false;
+    }
+    for (auto& entry : entries) {
+        if (entry.sha256 == sha256) {
+            entry.last_used = now();
+            put_entry(entry);
+        }
+    }
+    log_info("ipu", "Image " << sha256 << " restored from the cache to " << destination);
+    return true;
+}
+
+void ImageCache::store(const std::string& url, const std::string& validator, const std::string& sha256, const std::string& file) {
+    if (0 == m_capacity) {
+        return;
+    }
+    try {
+        const auto size = std::filesystem::file_size(file);
+        if (size > m_capacity) {
+            log_debug("ipu", "Image " << file << " is larger than the image cache.");
+            return;
+        }
+        const auto digest = sha256.empty() ? get_digest(file) : sha256;
+
+        std::lock_guard<std::mutex> lock{m_mutex};
+        const auto blob = get_blob(digest);
+        std::error_code ec{};
+        if (!std::filesystem::is_regular_file(blob, ec)) {
+            std::filesystem::create_directories(m_directory);
+            // Images are stored under their digest once complete. Copying
+            // doubles the writes of a download, so only images up to the
+            // copy limit are copied if they cannot be linked.
+            const auto part = blob + ".part";
+            unlink_file(part);
+            const bool hard_link = 0 == ::link(file.c_str(), part.c_str());
+            if (!hard_link && !clone_file(file, part)) {
+                if (size > m_copy_limit) {
+                    log_debug("ipu", "Image " << file << " cannot be linked into " << m_directory
+                                              << " and is larger than the copy limit, it is not cached.");
+                    return;
+                }
+                log_debug("ipu", "Copying " << file << " to " << part);
+                evict(size);
+                std::filesystem::copy_file(file, part);
+            }
+            evict(size);
+            // A hard link shares the mode of the downloaded file, which is left alone
+            if (!hard_link) {
+                std::filesystem::permissions(part, std::filesystem::perms::owner_read | std::filesystem::perms::group_read |
+                                                       std::filesystem::perms::others_read);
+            }
+            std::filesystem::rename(part, blob);
+        }
+        put_entry(Entry{url, validator, digest, size, get_modified(blob), now()});
+        log_info("ipu", "Image " << file << " stored in the cache as " << digest);
+    }
+    catch (const std::exception& e) {
+        log_warning("ipu", "Cannot store image " << file << " in the cache: " << e.what());
+    }
+}
+
+void ImageCache::remove(const std::string& url) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_database->remove(make_key(url));
+}
+
+std::uint64_t ImageCache::get_size() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return get_used_size();
+}
+
+std::string ImageCache::get_digest(const std::string& path) {
+    std::ifstream file{path, std::ios::binary};
+    if (!file) {
+        throw std::runtime_error("Cannot open file " + path);
+    }
+    utils::Sha256 digest{};
+    std::vector<char> buffer(READ_SIZE);
+    while (file.read(buffer.data(), static_cast<std::streamsize>(buffer.size())) || file.gcount() > 0) {
+        digest.update(buffer.data(), static_cast<std::size_t>(file.gcount()));
+    }
+    if (file.bad()) {
+        throw std::runtime_error("Cannot read file " + path);
+    }
+    return digest.hex_digest();
+}
+
+std::string ImageCache::get_blob(const std::string& sha256) const {
+    return m_directory + "/" + sha256;
+}
+
+std::uint64_t ImageCache::get_used_size() const {
+    std::uint64_t size = 0;
+    std::error_code ec{};
+    for (const auto& file : std::filesystem::directory_iterator(m_directory, ec)) {
+        if (is_digest(file.path().filename().string()) && file.is_regular_file(ec)) {
+            size += file.file_size(ec);
+        }
+    }
+    return size;
+}
+
+std::vector<ImageCache::Entry> ImageCache::load() const {
+    std::vector<Entry> entries{};
+    database::String key{};
+    database::String value{};
+    m_database->start();
+    while (m_database->next(key, value)) {
+        try {
+            entries.push_back(from_json(json::Json::parse(std::string{value})));
+        }
+        catch (const std::exception& e) {
+            log_warning("ipu", "Invalid image cache entry " << std::string{key} << ": " << e.what());
+        }
+    }
+    m_database->end();
+    return entries;
+}
+
+void ImageCache::put_entry(const Entry& entry) {
+    if (!m_database->put(make_key(entry.url), database::String{to_json(entry).dump()})) {
+        log_warning("ipu", "Image cache entry of " << entry.url << " could not be stored.");
+    }
+}
+
+void ImageCache::erase(const std::string& sha256) {
+    for (const auto& entry : load()) {
+        if (entry.sha256 == sha256) {
+            m_database->remove(make_key(entry.url));
+        }
+    }
+    std::error_code ec{};
+    std::filesystem::remove(get_blob(sha256), ec);
+}
+
+void ImageCache::evict(std::uint64_t size) {
+    auto used = get_used_size();
+    if (used + size <= m_capacity) {
+        return;
+    }
+    auto entries = load();
+
+    // Images no URL refers to go first
+    std::set<std::string> referenced{};
+    for (const auto& entry : entries) {
+        referenced.insert(entry.sha256);
+    }
+    std::error_code ec{};
+    for (const auto& file : std::filesystem::directory_iterator(m_directory, ec)) {
+        const auto name = file.path().filename().string();
+        if (is_digest(name) && 0 == referenced.count(name)) {
+            used -= std::min(used, static_cast<std::uint64_t>(file.file_size(ec)));
+            std::filesystem::remove(file.path(), ec);
+        }
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.last_used < b.last_used; });
+    for (const auto& entry : entries) {
+        if (used + size <= m_capacity) {
+            break;
+        }
+        const auto blob = get_blob(entry.sha256);
+        if (std::filesystem::exists(blob, ec)) {
+            log_info("ipu", "Evicting image " << entry.sha256 << " of " << entry.url << " from the cache.");
+            used -= std::min(used, static_cast<std::uint64_t>(std::filesystem::file_size(blob, ec)));
+        }
+        erase(entry.sha256);
+    }
+}
+
+} // namespace ipu
+} // namespace psme
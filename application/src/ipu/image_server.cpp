@@ -0,0 +1,144 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/image_server.hpp"
+#include "logger/logger.hpp"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace psme {
+namespace ipu {
+
+constexpr std::size_t ImageServer::WORKERS;
+
+namespace {
+
+constexpr std::size_t CHUNK_SIZE = 64 * 1024;
+
+/*!
+ * @brief Parse "bytes=first-last", "bytes=first-" or "bytes=-suffix" of a file
+ * @return false if the range is not satisfiable
+ */
+bool parse_range(const std::string& range, std::uint64_t size, std::uint64_t& first, std::uint64_t& end) {
+    if (0 != range.rfind("bytes=", 0)) {
+        return false;
+    }
+    const auto spec = range.substr(6);
+    const auto dash = spec.find('-');
+    if (std::string::npos == dash || std::string::npos != spec.find(',') || "-" == spec) {
+        return false;
+    }
+    try {
+        if (0 == dash) {
+            // The last bytes of the file
+            first = size - std::min<std::uint64_t>(size, std::stoull(spec.substr(1)));
+            end = size;
+        }
+        else {
+            first = std::stoull(spec.substr(0, dash));
+            end = dash + 1 < spec.size() ? std::min<std::uint64_t>(size, std::stoull(spec.substr(dash + 1)) + 1) : size;
+        }
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+    return first < end;
+}
+
+} // namespace
+
+ImageServer::ImageServer(std::filesystem::path directory, std::uint16_t port, const FaultProfile& profile)
+    : m_directory{std::move(directory)}, m_profile{profile},
+      m_server{port, WORKERS, [this](const LoopbackServer::Request& request, LoopbackServer::Connection& connection) {
+                   serve(request, connection);
+               }} {
+    log_info("ipu", "Serving images of " << m_directory.string() << " on " << get_uri(""));
+}
+
+ImageServer::~ImageServer() = default;
+
+std::string ImageServer::get_uri(const std::string& name) const {
+    return m_server.get_uri(name);
+}
+
+void ImageServer::serve(const LoopbackServer::Request& request, LoopbackServer::Connection& connection) {
+    const bool head = "HEAD" == request.method;
+    if (!head && "GET" != request.method) {
+        connection.respond("405 Method Not Allowed");
+        return;
+    }
+
+    try {
+        m_profile.apply("image server request");
+    }
+    catch (const std::exception&) {
+        connection.respond("503 Service Unavailable");
+        return;
+    }
+
+    // Only files directly in the directory are served
+    const auto& target = request.target;
+    auto name = target.substr(std::min(target.size(), target.find_first_not_of('/')));
+    name = name.substr(0, name.find('?'));
+    struct stat status{};
+    const auto path = m_directory / name;
+    if (name.empty() || std::string::npos != name.find('/') || "." == name || ".." == name ||
+        0 != ::stat(path.c_str(), &status) || !S_ISREG(status.st_mode)) {
+        connection.respond("404 Not Found");
+        return;
+    }
+
+    const auto size = static_cast<std::uint64_t>(status.st_size);
+    const auto etag = "\"" + std::to_string(size) + "-" + std::to_string(status.st_mtime) + "\"";
+    if (etag == request.get_header("if-none-match")) {
+        connection.send("HTTP/1.1 304 Not Modified\r\nETag: " + etag + "\r\nConnection: close\r\n\r\n");
+        return;
+    }
+
+    std::uint64_t first = 0;
+    std::uint64_t end = size;
+    std::string response{};
+    const auto range = request.get_header("range");
+    const auto if_range = request.get_header("if-range");
+    if (!range.empty() && (if_range.empty() || etag == if_range)) {
+        if (!parse_range(range, size, first, end)) {
+            connection.send("HTTP/1.1 416 Range Not Satisfiable\r\nContent-Range: bytes */" + std::to_string(size) +
+                            "\r\nContent-Length: 0\r\nConnection: close\r\n\r\n");
+            return;
+        }
+        response = "HTTP/1.1 206 Partial Content\r\nContent-Range: bytes " + std::to_string(first) + "-" +
+                   std::to_string(end - 1) + "/" + std::to_string(size) + "\r\n";
+    }
+    else {
+        response = "HTTP/1.1 200 OK\r\n";
+    }
+    response += "Content-Type: application/octet-stream\r\nAccept-Ranges: bytes\r\nETag: " + etag +
+                "\r\nContent-Length: " + std::to_string(end - first) + "\r\nConnection: close\r\n\r\n";
+    if (!connection.send(response) || head) {
+        return;
+    }
+
+    const int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file < 0) {
+        return;
+    }
+    std::vector<char> chunk(CHUNK_SIZE);
+    while (first < end && m_server.is_running()) {
+        const auto count = ::pread(file, chunk.data(), std::min<std::uint64_t>(chunk.size(), end - first),
+                                   static_cast<off_t>(first));
+        if (count <= 0 || !connection.send(chunk.data(), static_cast<std::size_t>(count))) {
+            break;
+        }
+        first += static_cast<std::uint64_t>(count);
+    }
+    ::close(file);
+}
+
+} // namespace ipu
+} // namespace psme
@@ -3,11 +3,9 @@
 
 #include "ipu/imc_reset_handler.hpp"
 #include "agent-framework/action/task_runner.hpp"
+#include "ipu/backend.hpp"
 #include <chrono>
-#include <linux/reboot.h>
-#include <sys/reboot.h>
 #include <thread>
-#include <unistd.h>
 
 using namespace agent_framework::model;
 
@@ -21,14 +19,7 @@ void ImcResetHandler::run(const enums::ResetType& reset_type) {
 void ImcResetHandler::imc_reset(const enums::ResetType& reset_type) {
     log_info("ipu", "IMC power action requested: " << reset_type.to_string());
     std::this_thread::sleep_for(std::chrono::seconds(2));
-    sync();
-    switch (reset_type) {
-    case enums::ResetType::ForceRestart:
-        reboot(LINUX_REBOOT_CMD_RESTART);
-        break;
-    default:
-        break;
-    }
+    Backend::get_instance().reset_imc(reset_type);
 }
 
 } // namespace ipu
@@ -0,0 +1,190 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/inventory_cache.hpp"
+#include "logger/logger.hpp"
+
+#include <optional>
+
+using std::chrono::steady_clock;
+using std::chrono::system_clock;
+
+namespace psme {
+namespace ipu {
+
+constexpr std::chrono::seconds InventoryCache::DEFAULT_TTL;
+constexpr std::chrono::seconds InventoryCache::RETRY_INTERVAL;
+
+namespace {
+
+constexpr const char KEY[] = "inventory";
+constexpr const char BOARD_ID[] = "board-id";
+constexpr const char BOOT_IMAGE[] = "boot-image";
+constexpr const char IMC[] = "imc";
+constexpr const char IMC_OROM[] = "imc-orom";
+constexpr const char ACC_BIOS[] = "acc-bios";
+constexpr const char RECOVERY_IMC[] = "recovery-imc";
+constexpr const char FIRMWARE_BUILD[] = "firmware-build";
+constexpr const char REFRESHED[] = "refreshed";
+
+void to_json(json::Json& json, const char* name, const OptionalField<std::string>& version) {
+    json[name] = version.has_value() ? json::Json(version.value()) : json::Json();
+}
+
+OptionalField<std::string> from_json(const json::Json& json, const char* name) {
+    if (!json.count(name) || json[name].is_null()) {
+        return {};
+    }
+    return json[name].get<std::string>();
+}
+
+std::int64_t get_time() {
+    return std::chrono::duration_cast<std::chrono::seconds>(system_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+std::chrono::seconds InventoryCache::load_ttl(const json::Json& config) {
+    if (!config.count("inventory")) {
+        return DEFAULT_TTL;
+    }
+    return std::chrono::seconds{config["inventory"].value("refresh-interval-s", DEFAULT_TTL.count())};
+}
+
+InventoryCache::InventoryCache(const std::string& database_name)
+    : m_database{database::Database::create(database_name)} {
+    load();
+}
+
+InventoryCache::~InventoryCache() {
+    stop();
+    m_database->remove();
+}
+
+Inventory InventoryCache::get() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_inventory;
+}
+
+void InventoryCache::start(std::chrono::seconds ttl, Fetcher fetch, Listener on_refresh) {
+    stop();
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_ttl = ttl;
+    m_fetch = std::move(fetch);
+    m_on_refresh = std::move(on_refresh);
+    m_stopping = false;
+    m_thread = std::thread(&InventoryCache::run, this);
+}
+
+void InventoryCache::refresh() {
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_refresh_requested = true;
+    }
+    m_changed.notify_all();
+}
+
+void InventoryCache::stop() {
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_stopping = true;
+    }
+    m_changed.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+void InventoryCache::run() {
+    std::unique_lock<std::mutex> lock{m_mutex};
+
+    // The stored inventory is served meanwhile, but the firmware may have been updated since it was stored
+    std::optional<steady_clock::time_point> next_refresh = steady_clock::now();
+
+    while (!m_stopping) {
+        const auto is_due = [this, &next_refresh] {
+            return m_stopping || m_refresh_requested || (next_refresh && steady_clock::now() >= *next_refresh);
+        };
+        if (next_refresh) {
+            m_changed.wait_until(lock, *next_refresh, is_due);
+        }
+        else {
+            m_changed.wait(lock, is_due);
+        }
+        if (m_stopping) {
+            break;
+        }
+        m_refresh_requested = false;
+
+        lock.unlock();
+        std::optional<Inventory> inventory{};
+        try {
+            log_debug("ipu", "Refreshing firmware inventory.");
+            inventory = m_fetch();
+            inventory->refreshed = get_time();
+        }
+        catch (const std::exception& e) {
+            log_error("ipu", "Failed to refresh firmware inventory: " << e.what());
+        }
+        lock.lock();
+
+        const auto interval = inventory ? m_ttl : std::min(RETRY_INTERVAL, m_ttl > std::chrono::seconds::zero() ? m_ttl : RETRY_INTERVAL);
+        if (interval > std::chrono::seconds::zero()) {
+            next_refresh = steady_clock::now() + interval;
+        }
+        else {
+            next_refresh.reset();
+        }
+        if (inventory) {
+            m_inventory = *inventory;
+            store(m_inventory);
+            log_info("ipu", "Firmware inventory refreshed.");
+            if (m_on_refresh) {
+                lock.unlock();
+                m_on_refresh(*inventory);
+                lock.lock();
+            }
+        }
+    }
+}
+
+void InventoryCache::load() {
+    database::String value{};
+    if (!m_database->get(database::String{KEY}, value)) {
+        return;
+    }
+    try {
+        const auto json = json::Json::parse(std::string{value});
+        m_inventory.versions.board_id_version = from_json(json, BOARD_ID);
+        m_inventory.versions.boot_image_version = from_json(json, BOOT_IMAGE);
+        m_inventory.versions.imc_version = from_json(json, IMC);
+        m_inventory.versions.imc_orom_version = from_json(json, IMC_OROM);
+        m_inventory.versions.acc_bios_version = from_json(json, ACC_BIOS);
+        m_inventory.versions.recovery_imc_version = from_json(json, RECOVERY_IMC);
+        m_inventory.firmware_build = json.at(FIRMWARE_BUILD).get<std::string>();
+        m_inventory.refreshed = json.at(REFRESHED).get<std::int64_t>();
+    }
+    catch (const std::exception& e) {
+        log_warning("ipu", "Invalid stored firmware inventory: " << e.what());
+        m_inventory = {};
+    }
+}
+
+void InventoryCache::store(const Inventory& inventory) {
+    json::Json json(json::Json::value_t::object);
+    to_json(json, BOARD_ID, inventory.versions.board_id_version);
+    to_json(json, BOOT_IMAGE, inventory.versions.boot_image_version);
+    to_json(json, IMC, inventory.versions.imc_version);
+    to_json(json, IMC_OROM, inventory.versions.imc_orom_version);
+    to_json(json, ACC_BIOS, inventory.versions.acc_bios_version);
+    to_json(json, RECOVERY_IMC, inventory.versions.recovery_imc_version);
+    json[FIRMWARE_BUILD] = inventory.firmware_build;
+    json[REFRESHED] = inventory.refreshed;
+
+    if (!m_database->put(database::String{KEY}, database::String{json.dump()})) {
+        log_warning("ipu", "Firmware inventory could not be stored.");
+    }
+}
+
+} // namespace ipu
+} // namespace psme
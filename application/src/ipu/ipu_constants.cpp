@@ -16,37 +16,35 @@ const char* NONE = "None";
 const char* ACTIVE_BOOT_OPTION = "active_boot_option";
 const char* CURRENT_BOOT_OPTION = "current_boot_option";
 const char* DOWNLOADED_IMAGE_NAME = "DownloadedImageName";
-const char* IMAGE_TEMP_FOLDER = "/tmp/";
 const char VIRTUAL_MEDIA_ENTITY_NAME[] = "VirtualMedia";
 const uint64_t MAX_IMAGE_SIZE = 13'760 * 1024 * 1024L; // same size as the acc_ramdisk region in reserved-memory.json
 const uint64_t MAX_PLDM_IMAGE_SIZE = 1'500'000'000;    // /tmp on IMC has 1.8G
-const uint64_t CHUNK_SIZE = 500'000'000;               // Size of chunks to use when downloading the image from HTTP (500MB)
+const unsigned VIRTUAL_MEDIA_DOWNLOAD_SEGMENTS = 4;    // concurrent requests of a large image
+const uint64_t IMAGE_CACHE_CAPACITY = 4'096 * 1024 * 1024L; // least recently used images are evicted above it
+const uint64_t IMAGE_CACHE_COPY_LIMIT = 1'024 * 1024 * 1024L; // larger images are cached only if they can be linked
+const char* NBD_DEVICE = "/dev/nbd0";                       // streamed images are served on it
 
 #ifdef INTEL_IPU
 const char* ACC_BOOT_OVERRIDE_FILEPATH = "/mnt/imc/acc_variable/acc-uefi-boot-config.json";
 const char* ACC_BOOT_OPTION_FILEPATH = "/mnt/imc/acc_variable/acc-boot-option.json";
 const char* RESERVED_MEMORY_DIRECTORY = "/work/cfg/memory/";
 const char* RESERVED_MEMORY_FILEPATH = "/work/cfg/memory/reserved-memory.json";
-const char* IMAGE_FOLDER = "/mnt/imc/";
 const char* IMAGE_PATH = "/mnt/imc/acc-os.iso";
-const char* IMAGE_TEMP_PATH = "/tmp/acc-os.iso.tmp";
 const char* IMAGE_SYMLINK_DIRECTORY = "/mnt/imc/acc/ramdisk/";
 const char* IMAGE_SYMLINK = "/mnt/imc/acc/ramdisk/acc-os-image.bin";
 const char* FIRMWARE_VERSION_FILEPATH = "/etc/issue.net";
 const char* DESTINATION_PLDM_FILEPATH = "/work/image.pldm";
-const char* PLDM_FILE_FOLDER = "/tmp/";
+const char* IMAGE_CACHE_DIRECTORY = "/work/redfish/image-cache";
 #else
 const char* ACC_BOOT_OVERRIDE_FILEPATH = "acc-uefi-boot-config.json";
 const char* ACC_BOOT_OPTION_FILEPATH = "acc-boot-option.json";
 const char* RESERVED_MEMORY_DIRECTORY = "/tmp/";
 const char* RESERVED_MEMORY_FILEPATH = "/tmp/reserved-memory.json";
-const char* IMAGE_FOLDER = "/tmp/";
 const char* IMAGE_PATH = "/tmp/acc-os.iso";
-const char* IMAGE_TEMP_PATH = "/tmp/acc-os.iso.tmp";
 const char* IMAGE_SYMLINK_DIRECTORY = "/tmp/";
 const char* IMAGE_SYMLINK = "/tmp/acc-os-image.bin";
 const char* DESTINATION_PLDM_FILEPATH = "/work/image.pldm";
-const char* PLDM_FILE_FOLDER = "/work/";
+const char* IMAGE_CACHE_DIRECTORY = "/tmp/image-cache";
 #endif
 
 } // namespace constants
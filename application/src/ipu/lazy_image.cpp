@@ -0,0 +1,405 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/lazy_image.hpp"
+#include "ipu/curl_handler.hpp"
+#include "ipu/transfer_throttle.hpp"
+#include "logger/logger.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace psme {
+namespace ipu {
+
+constexpr std::uint64_t LazyImage::BLOCK_SIZE;
+constexpr unsigned LazyImage::READAHEAD_BLOCKS;
+constexpr unsigned LazyImage::FILL_BLOCKS;
+
+namespace {
+
+/*! @brief HTTP status of a response to a satisfied Range request */
+constexpr long PARTIAL_CONTENT = 206;
+
+/*! @brief The block map starts with the digest of the URL, validator and size of the image */
+constexpr std::size_t MAP_HEADER_SIZE = 64;
+
+constexpr char PRESENT_MARK = 1;
+
+void write_all(int fd, const char* data, std::size_t size, std::uint64_t offset, const std::string& file_name) {
+    while (size > 0) {
+        const auto written = ::pwrite(fd, data, size, static_cast<off_t>(offset));
+        if (written < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            throw std::runtime_error("Cannot write file " + file_name + ": " + std::strerror(errno));
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+        offset += static_cast<std::uint64_t>(written);
+    }
+}
+
+void read_all(int fd, char* data, std::size_t size, std::uint64_t offset, const std::string& file_name) {
+    while (size > 0) {
+        const auto count = ::pread(fd, data, size, static_cast<off_t>(offset));
+        if (count < 0 && EINTR == errno) {
+            continue;
+        }
+        if (count <= 0) {
+            throw std::runtime_error("Cannot read file " + file_name + ": " +
+                                     (count < 0 ? std::strerror(errno) : "unexpected end of file"));
+        }
+        data += count;
+        size -= static_cast<std::size_t>(count);
+        offset += static_cast<std::uint64_t>(count);
+    }
+}
+
+} // namespace
+
+LazyImage::LazyImage(CURL* prototype, const std::string& file_name, std::uint64_t size, const std::string& validator)
+    : m_prototype{curl_easy_duphandle(prototype), curl_easy_cleanup}, m_file_name{file_name}, m_size{size}, m_validator{validator},
+      m_blocks((size + BLOCK_SIZE - 1) / BLOCK_SIZE, Block::MISSING) {
+    if (!m_prototype) {
+        throw std::runtime_error("Curl initialization failed.");
+    }
+    m_fd = ::open(file_name.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (m_fd < 0) {
+        throw std::runtime_error("Cannot open file " + file_name + ": " + std::strerror(errno));
+    }
+
+    const char* url = nullptr;
+    curl_easy_getinfo(prototype, CURLINFO_EFFECTIVE_URL, &url);
+    const auto identity = std::string{url ? url : ""} + "\n" + validator + "\n" + std::to_string(size);
+    try {
+        open_map(identity);
+    }
+    catch (...) {
+        ::close(m_fd);
+        if (m_map_fd >= 0) {
+            ::close(m_map_fd);
+        }
+        throw;
+    }
+    // All blocks must come from the same version of the image
+    m_request_headers.reset(curl_slist_append(nullptr, ("If-Range: " + validator).c_str()));
+}
+
+LazyImage::~LazyImage() {
+    stop();
+    if (m_map_fd >= 0) {
+        ::close(m_map_fd);
+    }
+    if (m_fd >= 0) {
+        ::close(m_fd);
+    }
+}
+
+std::string LazyImage::get_map_file(const std::string& file_name) {
+    return file_name + ".blocks";
+}
+
+void LazyImage::open_map(const std::string& identity) {
+    utils::Sha256 digest{};
+    digest.update(identity.data(), identity.size());
+    const auto header = digest.hex_digest();
+
+    const auto map_file = get_map_file(m_file_name);
+    m_map_fd = ::open(map_file.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (m_map_fd < 0) {
+        throw std::runtime_error("Cannot open file " + map_file + ": " + std::strerror(errno));
+    }
+
+    struct stat status{};
+    std::vector<char> map(MAP_HEADER_SIZE + m_blocks.size());
+    if (0 == ::fstat(m_map_fd, &status) && static_cast<std::uint64_t>(status.st_size) == map.size()) {
+        read_all(m_map_fd, map.data(), map.size(), 0, map_file);
+        if (0 == header.compare(0, MAP_HEADER_SIZE, map.data(), MAP_HEADER_SIZE)) {
+            for (std::size_t block = 0; block < m_blocks.size(); ++block) {
+                if (PRESENT_MARK == map[MAP_HEADER_SIZE + block]) {
+                    m_blocks[block] = Block::PRESENT;
+                    ++m_present;
+                }
+            }
+            log_info("ipu", m_present << " of " << m_blocks.size() << " blocks of " << m_file_name << " fetched before.");
+            if (0 != ::ftruncate(m_fd, static_cast<off_t>(m_size))) {
+                throw std::runtime_error("Cannot resize file " + m_file_name + ": " + std::strerror(errno));
+            }
+            return;
+        }
+    }
+
+    // Blocks of another image or version are dropped
+    if (0 != ::ftruncate(m_fd, 0) || 0 != ::ftruncate(m_fd, static_cast<off_t>(m_size)) || 0 != ::ftruncate(m_map_fd, 0)) {
+        throw std::runtime_error("Cannot resize file " + m_file_name + ": " + std::strerror(errno));
+    }
+    std::fill(map.begin(), map.end(), '\0');
+    std::copy(header.begin(), header.end(), map.begin());
+    write_all(m_map_fd, map.data(), map.size(), 0, map_file);
+}
+
+std::uint64_t LazyImage::get_fetched() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return std::min(m_size, m_present * BLOCK_SIZE);
+}
+
+bool LazyImage::is_complete() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_present == m_blocks.size();
+}
+
+std::string LazyImage::get_digest() const {
+    return m_digest.hex_digest();
+}
+
+void LazyImage::read(std::uint64_t offset, char* data, std::size_t size) {
+    if (0 == size) {
+        return;
+    }
+    if (offset > m_size || size > m_size - offset) {
+        throw std::runtime_error("Read past the end of " + m_file_name);
+    }
+    const auto first = offset / BLOCK_SIZE;
+    const auto last = (offset + size - 1) / BLOCK_SIZE;
+
+    // Reads are served one at a time, each fetch reuses the connection
+    std::lock_guard<std::mutex> read_lock{m_read_mutex};
+    for (;;) {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        auto block = first;
+        while (block <= last && Block::PRESENT == m_blocks[block]) {
+            ++block;
+        }
+        if (block > last) {
+            break;
+        }
+        if (m_stopping) {
+            throw std::runtime_error("Streaming of " + m_file_name + " was stopped.");
+        }
+        if (Block::FETCHING == m_blocks[block]) {
+            // Fetched by the background fill
+            m_changed.wait(lock);
+            continue;
+        }
+        const auto count = claim(block, std::min<std::uint64_t>(m_blocks.size(), last + 1 + READAHEAD_BLOCKS));
+        lock.unlock();
+        if (!m_read_handle) {
+            m_read_handle = make_handle(false);
+        }
+        fetch(m_read_handle.get(), false, block, count);
+    }
+    read_all(m_fd, data, size, offset, m_file_name);
+}
+
+void LazyImage::start_fill(CompletionCallback on_complete) {
+    m_on_complete = std::move(on_complete);
+    m_thread = std::thread(&LazyImage::fill, this);
+}
+
+void LazyImage::stop() {
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_stopping = true;
+    }
+    m_changed.notify_all();
+    if (m_thread.joinable() && std::this_thread::get_id() != m_thread.get_id()) {
+        m_thread.join();
+    }
+}
+
+std::uint64_t LazyImage::claim(std::uint64_t first, std::uint64_t limit) {
+    auto block = first;
+    while (block < limit && Block::MISSING == m_blocks[block]) {
+        m_blocks[block++] = Block::FETCHING;
+    }
+    return block - first;
+}
+
+void LazyImage::release(std::uint64_t first, std::uint64_t count, bool fetched) {
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        for (auto block = first; block < first + count; ++block) {
+            m_blocks[block] = fetched ? Block::PRESENT : Block::MISSING;
+        }
+        if (fetched) {
+            m_present += count;
+            // Recorded after the data is synced, a lost record only fetches the blocks again
+            const std::vector<char> marks(count, PRESENT_MARK);
+            try {
+                write_all(m_map_fd, marks.data(), marks.size(), MAP_HEADER_SIZE + first, get_map_file(m_file_name));
+            }
+            catch (const std::exception& e) {
+                log_warning("ipu", e.what());
+            }
+        }
+    }
+    m_changed.notify_all();
+}
+
+void LazyImage::fetch(CURL* handle, bool background, std::uint64_t first, std::uint64_t count) {
+    auto interval = CurlHandler::RETRY_INTERVAL;
+    for (unsigned attempt = 1;; ++attempt) {
+        Transfer transfer{this, handle, background, first * BLOCK_SIZE, std::min(m_size, (first + count) * BLOCK_SIZE), {}};
+        const auto range = std::to_string(transfer.position) + "-" + std::to_string(transfer.end - 1);
+        curl_easy_setopt(handle, CURLOPT_RANGE, range.c_str());
+        curl_easy_setopt(handle, CURLOPT_WRITEDATA, static_cast<void*>(&transfer));
+        const auto code = curl_easy_perform(handle);
+        if (transfer.error.empty() && CURLE_OK == code && transfer.position == transfer.end) {
+            if (0 != ::fdatasync(m_fd)) {
+                release(first, count, false);
+                throw std::runtime_error("Cannot sync file " + m_file_name + ": " + std::strerror(errno));
+            }
+            release(first, count, true);
+            return;
+        }
+
+        const bool retryable = CURLE_OK == code || CurlHandler::is_retryable(handle, code);
+        if (!transfer.error.empty() || !retryable || attempt > CurlHandler::RETRY_ATTEMPTS || m_stopping) {
+            release(first, count, false);
+            throw std::runtime_error(transfer.error.empty() ? "Data transfer failed: " + std::string(curl_easy_strerror(code))
+                                                            : transfer.error);
+        }
+        log_warning("ipu", "Fetching bytes " << range << " of " << m_file_name << " failed: " << curl_easy_strerror(code)
+                                             << ", retrying in " << interval.count() << " ms.");
+        std::unique_lock<std::mutex> lock{m_mutex};
+        m_changed.wait_for(lock, interval, [this] { return m_stopping.load(); });
+        interval = std::min(interval * 2, CurlHandler::MAX_RETRY_INTERVAL);
+    }
+}
+
+void LazyImage::fill() {
+    std::string error{};
+    try {
+        // Fetched at low priority, reads of the image go first
+        TransferPriority priority{};
+        auto handle = make_handle(true);
+        for (;;) {
+            for (std::uint64_t block = 0; block < m_blocks.size();) {
+                std::unique_lock<std::mutex> lock{m_mutex};
+                if (m_stopping) {
+                    throw std::runtime_error("Streaming of " + m_file_name + " was stopped.");
+                }
+                if (Block::MISSING != m_blocks[block]) {
+                    ++block;
+                    continue;
+                }
+                const auto count = claim(block, std::min<std::uint64_t>(m_blocks.size(), block + FILL_BLOCKS));
+                lock.unlock();
+                // Catch up with blocks before the fetched ones, so its data is hashed as it arrives
+                hash_present();
+                fetch(handle.get(), true, block, count);
+                block += count;
+            }
+
+            // Blocks fetched by reads meanwhile may have failed
+            std::unique_lock<std::mutex> lock{m_mutex};
+            m_changed.wait(lock, [this] {
+                return m_stopping || std::none_of(m_blocks.begin(), m_blocks.end(),
+                                                  [](Block block) { return Block::FETCHING == block; });
+            });
+            if (m_present == m_blocks.size()) {
+                break;
+            }
+        }
+        hash_present();
+        ::unlink(get_map_file(m_file_name).c_str());
+        log_info("ipu", "All " << m_blocks.size() << " blocks of " << m_file_name << " fetched.");
+    }
+    catch (const std::exception& e) {
+        error = e.what();
+        log_error("ipu", "Background fill of " << m_file_name << " failed: " << error);
+    }
+    if (m_on_complete) {
+        m_on_complete(error);
+    }
+}
+
+void LazyImage::hash_present() {
+    // Blocks fetched by reads or before a restart are read back once
+    std::vector<char> buffer{};
+    while (m_hashed < m_size) {
+        const auto block = m_hashed / BLOCK_SIZE;
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            if (Block::PRESENT != m_blocks[block]) {
+                return;
+            }
+        }
+        const auto size = static_cast<std::size_t>(std::min(m_size, (block + 1) * BLOCK_SIZE) - m_hashed);
+        buffer.resize(size);
+        read_all(m_fd, buffer.data(), size, m_hashed, m_file_name);
+        m_digest.update(buffer.data(), size);
+        m_hashed += size;
+    }
+}
+
+std::unique_ptr<CURL, void (*)(CURL*)> LazyImage::make_handle(bool background) const {
+    std::unique_ptr<CURL, void (*)(CURL*)> handle{curl_easy_duphandle(m_prototype.get()), curl_easy_cleanup};
+    if (!handle) {
+        throw std::runtime_error("Curl initialization failed.");
+    }
+    curl_easy_setopt(handle.get(), CURLOPT_WRITEFUNCTION, write_callback);
+    curl_easy_setopt(handle.get(), CURLOPT_HEADERFUNCTION, nullptr);
+    curl_easy_setopt(handle.get(), CURLOPT_HEADERDATA, nullptr);
+    curl_easy_setopt(handle.get(), CURLOPT_HTTPHEADER, m_request_headers.get());
+    curl_easy_setopt(handle.get(), CURLOPT_RESUME_FROM_LARGE, curl_off_t{0});
+    curl_easy_setopt(handle.get(), CURLOPT_XFERINFOFUNCTION, abort_callback);
+    curl_easy_setopt(handle.get(), CURLOPT_XFERINFODATA, const_cast<void*>(static_cast<const void*>(this)));
+    curl_easy_setopt(handle.get(), CURLOPT_NOPROGRESS, 0L);
+    curl_easy_setopt(handle.get(), CURLOPT_VERBOSE, 0L);
+    // Only the background fill is limited, a read waits for its blocks
+    const auto rate = background ? TransferThrottle::get_instance()->get_limits().max_download_rate : 0;
+    curl_easy_setopt(handle.get(), CURLOPT_MAX_RECV_SPEED_LARGE, static_cast<curl_off_t>(rate));
+    return handle;
+}
+
+size_t LazyImage::write_callback(char* data, size_t size, size_t nmemb, void* userdata) {
+    auto& transfer = *static_cast<Transfer*>(userdata);
+    const size_t bytes = size * nmemb;
+    auto* image = transfer.image;
+    long status = 0;
+    curl_easy_getinfo(transfer.handle, CURLINFO_RESPONSE_CODE, &status);
+    if (PARTIAL_CONTENT != status) {
+        // The whole image is sent when it changed since it was opened
+        transfer.error = "Image " + image->m_file_name + " changed on the server.";
+        return 0;
+    }
+    if (transfer.position + bytes > transfer.end) {
+        transfer.error = "Server sent more data than requested for " + image->m_file_name;
+        return 0;
+    }
+    try {
+        if (transfer.background) {
+            TransferThrottle::get_instance()->throttle_write(bytes);
+        }
+        write_all(image->m_fd, data, bytes, transfer.position, image->m_file_name);
+    }
+    catch (const std::exception& e) {
+        transfer.error = e.what();
+        return 0;
+    }
+    if (transfer.background && transfer.position == image->m_hashed) {
+        image->m_digest.update(data, bytes);
+        image->m_hashed += bytes;
+    }
+    transfer.position += bytes;
+    return bytes;
+}
+
+int LazyImage::abort_callback(void* clientp, curl_off_t dltotal, curl_off_t dlnow, curl_off_t ultotal, curl_off_t ulnow) {
+    (void)dltotal;
+    (void)dlnow;
+    (void)ultotal;
+    (void)ulnow;
+    return static_cast<LazyImage*>(clientp)->m_stopping ? 1 : 0;
+}
+
+} // namespace ipu
+} // namespace psme
@@ -6,9 +6,9 @@
 #include "agent-framework/module/enum/common.hpp"
 #include "agent-framework/module/enum/compute.hpp"
 #include "agent-framework/module/model/manager.hpp"
-#include "ipu/firmware_build_getter.hpp"
+#include "ipu/inventory_cache.hpp"
 #include "ipu/ipu_constants.hpp"
-#include "ipu/ipu_update_handler.hpp"
+#include "ipu/lazy_image.hpp"
 
 // TODO: fix cyclic dependency
 #include "model/handlers/id_policy.hpp"
@@ -24,6 +24,20 @@ using namespace agent_framework::model::enums;
 using namespace psme::rest::model::handler;
 using agent_framework::module::CommonComponents;
 
+namespace {
+
+void set_inventory(Manager& imc, System& acc, const Inventory& inventory) {
+    imc.set_firmware_version(inventory.firmware_build);
+    imc.set_board_id_version(inventory.versions.board_id_version);
+    imc.set_boot_image_version(inventory.versions.boot_image_version);
+    imc.set_imc_version(inventory.versions.imc_version);
+    imc.set_imc_orom_version(inventory.versions.imc_orom_version);
+    imc.set_recovery_imc_version(inventory.versions.recovery_imc_version);
+    acc.set_bios_version(inventory.versions.acc_bios_version);
+}
+
+} // namespace
+
 void Loader::load() {
     System acc{};
     acc.set_name("ACC");
@@ -52,15 +66,8 @@ void Loader::load() {
     imc.set_status({State::Enabled, Health::OK});
     imc.set_unique_key(imc.get_name());
     imc.make_persistent_uuid();
-    imc.set_firmware_version(FirmwareBuildGetter().value());
-
-    InventoryVersion inventory = IpuUpdateHandler().get_component_info();
-    imc.set_board_id_version(inventory.board_id_version);
-    imc.set_boot_image_version(inventory.boot_image_version);
-    imc.set_imc_version(inventory.imc_version);
-    imc.set_imc_orom_version(inventory.imc_orom_version);
-    imc.set_recovery_imc_version(inventory.recovery_imc_version);
-    acc.set_bios_version(inventory.acc_bios_version);
+    // The last known inventory, it is refreshed in the background
+    set_inventory(imc, acc, InventoryCache::get_instance()->get());
 
     IdPolicy<Component::Manager, NumberingZone::SHARED> manager_id_policy;
     imc.set_id(manager_id_policy.get_id(imc.get_uuid(), ""));
@@ -76,12 +83,19 @@ void Loader::load() {
     media.set_name("VirtualMedia");
     media.set_description("Virtual Media");
     media.set_unique_key(media.get_name());
+    media.set_status({State::Enabled, Health::OK});
     media.make_persistent_uuid();
     OptionalField<std::string> image_name;
     DatabaseEntity<psme::ipu::constants::VIRTUAL_MEDIA_ENTITY_NAME> db(media.get_uuid());
     try {
         image_name = db.get(psme::ipu::constants::DOWNLOADED_IMAGE_NAME);
-        if (std::filesystem::exists(psme::ipu::constants::IMAGE_PATH)) {
+        if (std::filesystem::exists(psme::ipu::LazyImage::get_map_file(psme::ipu::constants::IMAGE_PATH))) {
+            // Fetched blocks are kept, so inserting the same image again resumes streaming
+            log_info("ipu", "Previously streamed virtual media image is incomplete");
+            db.del(psme::ipu::constants::DOWNLOADED_IMAGE_NAME);
+            std::error_code ec{};
+            std::filesystem::remove(psme::ipu::constants::IMAGE_SYMLINK, ec);
+        } else if (std::filesystem::exists(psme::ipu::constants::IMAGE_PATH)) {
             log_debug("ipu", "Detected previously inserted virtual media image: " << image_name);
             media.set_image_name(image_name);
             media.set_inserted(true);
@@ -97,3 +111,9 @@ void Loader::load() {
     media.set_id(media_id_policy.get_id(media.get_uuid(), acc.get_uuid()));
     get_manager<agent_framework::model::VirtualMedia>().add_entry(media);
 }
+
+void Loader::update_inventory(const Inventory& inventory) {
+    auto imc = get_manager<Manager>().get_only_reference();
+    auto acc = get_manager<System>().get_only_reference();
+    set_inventory(imc.get_raw_ref(), acc.get_raw_ref(), inventory);
+}
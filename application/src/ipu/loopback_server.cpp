@@ -0,0 +1,163 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/loopback_server.hpp"
+#include "logger/logger.hpp"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+namespace psme {
+namespace ipu {
+
+namespace {
+
+constexpr std::size_t MAX_HEAD_SIZE = 16 * 1024;
+constexpr std::size_t MAX_BODY_SIZE = 16 * 1024 * 1024;
+
+} // namespace
+
+std::string LoopbackServer::Request::get_header(const std::string& name) const {
+    auto lower = head;
+    std::transform(lower.begin(), lower.end(), lower.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    const auto start = lower.find("\r\n" + name + ":");
+    if (std::string::npos == start) {
+        return {};
+    }
+    auto value = start + name.size() + 3;
+    while (value < head.size() && ' ' == head[value]) {
+        ++value;
+    }
+    return head.substr(value, head.find("\r\n", value) - value);
+}
+
+bool LoopbackServer::Connection::send(const char* data, std::size_t size) {
+    while (0 != size) {
+        const auto sent = ::send(m_socket, data, size, MSG_NOSIGNAL);
+        if (sent <= 0) {
+            return false;
+        }
+        data += sent;
+        size -= static_cast<std::size_t>(sent);
+    }
+    return true;
+}
+
+void LoopbackServer::Connection::respond(const std::string& status) {
+    send("HTTP/1.1 " + status + "\r\nContent-Length: 0\r\nConnection: close\r\n\r\n");
+}
+
+LoopbackServer::LoopbackServer(std::uint16_t port, std::size_t workers, Handler handler)
+    : m_handler{std::move(handler)} {
+    m_socket = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (m_socket < 0) {
+        throw std::runtime_error(std::string("Cannot create loopback server socket: ") + std::strerror(errno));
+    }
+    const int reuse = 1;
+    ::setsockopt(m_socket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(port);
+    socklen_t length = sizeof(address);
+    if (0 != ::bind(m_socket, reinterpret_cast<sockaddr*>(&address), length) ||
+        0 != ::listen(m_socket, 64) ||
+        0 != ::getsockname(m_socket, reinterpret_cast<sockaddr*>(&address), &length)) {
+        const auto error = errno;
+        ::close(m_socket);
+        throw std::runtime_error("Cannot listen on loopback port " + std::to_string(port) + ": " + std::strerror(error));
+    }
+    m_port = ntohs(address.sin_port);
+
+    for (std::size_t i = 0; i < workers; ++i) {
+        m_workers.emplace_back(&LoopbackServer::run, this);
+    }
+}
+
+LoopbackServer::~LoopbackServer() {
+    m_running = false;
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+    ::close(m_socket);
+}
+
+std::string LoopbackServer::get_uri(const std::string& path) const {
+    return "http://127.0.0.1:" + std::to_string(m_port) + "/" + path;
+}
+
+void LoopbackServer::run() {
+    while (m_running) {
+        pollfd fd{m_socket, POLLIN, 0};
+        if (::poll(&fd, 1, 50) <= 0) {
+            continue;
+        }
+        // Another worker may have accepted the connection meanwhile
+        const int connection = ::accept4(m_socket, nullptr, nullptr, SOCK_CLOEXEC);
+        if (connection < 0) {
+            continue;
+        }
+        const timeval timeout{5, 0};
+        ::setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        try {
+            serve(connection);
+        }
+        catch (const std::exception& e) {
+            log_error("ipu", "Loopback server request failed: " << e.what());
+        }
+        ::close(connection);
+    }
+}
+
+void LoopbackServer::serve(int connection) {
+    std::string data{};
+    char buffer[4096];
+    auto head_end = data.find("\r\n\r\n");
+    while (std::string::npos == head_end) {
+        const auto size = ::recv(connection, buffer, sizeof(buffer), 0);
+        if (size <= 0 || data.size() > MAX_HEAD_SIZE) {
+            return;
+        }
+        data.append(buffer, static_cast<std::size_t>(size));
+        head_end = data.find("\r\n\r\n");
+    }
+
+    Request request{};
+    request.head = data.substr(0, head_end + 2);
+    request.body = data.substr(head_end + 4);
+    request.method = request.head.substr(0, request.head.find(' '));
+    const auto target_start = request.method.size() + 1;
+    request.target = request.head.substr(target_start, request.head.find(' ', target_start) - target_start);
+
+    const auto content_length = request.get_header("content-length");
+    const auto body_size = content_length.empty() ? 0 : std::stoull(content_length);
+    if (body_size > MAX_BODY_SIZE) {
+        Connection{connection}.respond("413 Content Too Large");
+        return;
+    }
+    while (request.body.size() < body_size) {
+        const auto size = ::recv(connection, buffer, sizeof(buffer), 0);
+        if (size <= 0) {
+            return;
+        }
+        request.body.append(buffer, static_cast<std::size_t>(size));
+    }
+
+    Connection response{connection};
+    m_handler(request, response);
+}
+
+} // namespace ipu
+} // namespace psme
@@ -0,0 +1,198 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/nbd_export.hpp"
+#include "logger/logger.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <endian.h>
+#include <fcntl.h>
+#include <linux/nbd.h>
+#include <stdexcept>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+namespace psme {
+namespace ipu {
+
+constexpr std::uint64_t NbdExport::BLOCK_SIZE;
+
+namespace {
+
+/*! @brief Magic, type, handle, offset and length of a request */
+constexpr std::size_t REQUEST_SIZE = 28;
+
+/*! @brief Magic, error and handle of a reply */
+constexpr std::size_t REPLY_SIZE = 16;
+
+/*! @brief Command of a request, flags are in the upper bits of the type */
+constexpr std::uint32_t COMMAND_MASK = 0xffff;
+
+std::uint32_t load32(const char* data) {
+    std::uint32_t value{};
+    std::memcpy(&value, data, sizeof(value));
+    return be32toh(value);
+}
+
+std::uint64_t load64(const char* data) {
+    std::uint64_t value{};
+    std::memcpy(&value, data, sizeof(value));
+    return be64toh(value);
+}
+
+void store32(char* data, std::uint32_t value) {
+    value = htobe32(value);
+    std::memcpy(data, &value, sizeof(value));
+}
+
+bool receive_all(int socket, char* data, std::size_t size) {
+    while (size > 0) {
+        const auto count = ::recv(socket, data, size, 0);
+        if (count < 0 && EINTR == errno) {
+            continue;
+        }
+        if (count <= 0) {
+            return false;
+        }
+        data += count;
+        size -= static_cast<std::size_t>(count);
+    }
+    return true;
+}
+
+bool send_all(int socket, const char* data, std::size_t size) {
+    while (size > 0) {
+        const auto count = ::send(socket, data, size, MSG_NOSIGNAL);
+        if (count < 0 && EINTR == errno) {
+            continue;
+        }
+        if (count <= 0) {
+            return false;
+        }
+        data += count;
+        size -= static_cast<std::size_t>(count);
+    }
+    return true;
+}
+
+} // namespace
+
+NbdExport::NbdExport(std::uint64_t size, ReadCallback on_read) : m_size{size}, m_on_read{std::move(on_read)} {}
+
+NbdExport::~NbdExport() {
+    stop();
+}
+
+void NbdExport::start(const std::string& device) {
+    if (0 != ::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, m_sockets)) {
+        throw std::runtime_error("Cannot create socket of " + device + ": " + std::strerror(errno));
+    }
+    m_device = device;
+    m_device_fd = ::open(device.c_str(), O_RDWR | O_CLOEXEC);
+    const auto blocks = (m_size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    if (m_device_fd < 0 || ::ioctl(m_device_fd, NBD_SET_BLKSIZE, static_cast<unsigned long>(BLOCK_SIZE)) < 0 ||
+        ::ioctl(m_device_fd, NBD_SET_SIZE_BLOCKS, static_cast<unsigned long>(blocks)) < 0 ||
+        ::ioctl(m_device_fd, NBD_CLEAR_SOCK) < 0 ||
+        ::ioctl(m_device_fd, NBD_SET_FLAGS, static_cast<unsigned long>(NBD_FLAG_HAS_FLAGS | NBD_FLAG_READ_ONLY)) < 0 ||
+        ::ioctl(m_device_fd, NBD_SET_SOCK, m_sockets[0]) < 0) {
+        const std::string error = std::strerror(errno);
+        stop();
+        throw std::runtime_error("Cannot set up NBD device " + device + ": " + error);
+    }
+
+    m_serve_thread = std::thread(&NbdExport::serve, this, m_sockets[1]);
+    m_device_thread = std::thread([this] {
+        // Runs the device until it is disconnected
+        if (::ioctl(m_device_fd, NBD_DO_IT) < 0) {
+            log_debug("ipu", "NBD device " << m_device << " stopped: " << std::strerror(errno));
+        }
+        ::ioctl(m_device_fd, NBD_CLEAR_QUE);
+        ::ioctl(m_device_fd, NBD_CLEAR_SOCK);
+    });
+    log_info("ipu", "Serving " << m_size << " bytes on " << device);
+}
+
+void NbdExport::stop() {
+    if (m_device_thread.joinable()) {
+        ::ioctl(m_device_fd, NBD_DISCONNECT);
+        m_device_thread.join();
+    }
+    // Ends serving also if the kernel did not send a disconnect request
+    if (m_sockets[0] >= 0) {
+        ::shutdown(m_sockets[0], SHUT_RDWR);
+    }
+    if (m_serve_thread.joinable()) {
+        m_serve_thread.join();
+    }
+    for (auto& socket : m_sockets) {
+        if (socket >= 0) {
+            ::close(socket);
+            socket = -1;
+        }
+    }
+    if (m_device_fd >= 0) {
+        ::close(m_device_fd);
+        m_device_fd = -1;
+        log_info("ipu", "NBD device " << m_device << " detached.");
+    }
+}
+
+void NbdExport::serve(int socket) {
+    std::vector<char> buffer{};
+    char request[REQUEST_SIZE];
+    while (receive_all(socket, request, sizeof(request))) {
+        if (NBD_REQUEST_MAGIC != load32(request)) {
+            log_error("ipu", "Invalid NBD request received.");
+            return;
+        }
+        const auto command = load32(request + 4) & COMMAND_MASK;
+        const auto offset = load64(request + 16);
+        const auto length = load32(request + 24);
+
+        std::uint32_t error = 0;
+        switch (command) {
+        case NBD_CMD_READ:
+            buffer.assign(length, '\0');
+            try {
+                // The last block of the device may extend past the image
+                const auto size = offset < m_size ? std::min<std::uint64_t>(length, m_size - offset) : 0;
+                m_on_read(offset, buffer.data(), static_cast<std::size_t>(size));
+            }
+            catch (const std::exception& e) {
+                log_error("ipu", "Read of " << length << " bytes at " << offset << " failed: " << e.what());
+                error = EIO;
+            }
+            break;
+        case NBD_CMD_WRITE:
+            buffer.resize(length);
+            if (!receive_all(socket, buffer.data(), buffer.size())) {
+                return;
+            }
+            error = EPERM;
+            break;
+        case NBD_CMD_DISC:
+            return;
+        case NBD_CMD_FLUSH:
+            break;
+        default:
+            error = EINVAL;
+            break;
+        }
+
+        char reply[REPLY_SIZE];
+        store32(reply, NBD_REPLY_MAGIC);
+        store32(reply + 4, error);
+        std::memcpy(reply + 8, request + 8, 8);
+        if (!send_all(socket, reply, sizeof(reply)) ||
+            (NBD_CMD_READ == command && 0 == error && !send_all(socket, buffer.data(), buffer.size()))) {
+            return;
+        }
+    }
+}
+
+} // namespace ipu
+} // namespace psme
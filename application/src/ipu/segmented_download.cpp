@@ -0,0 +1,302 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/segmented_download.hpp"
+#include "ipu/curl_handler.hpp"
+#include "ipu/transfer_throttle.hpp"
+#include "logger/logger.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <unistd.h>
+
+namespace psme {
+namespace ipu {
+
+constexpr std::size_t SegmentedDownload::BUFFER_SIZE;
+
+namespace {
+
+/*! @brief Longest wait for transfers when no retry is scheduled */
+constexpr std::chrono::milliseconds IDLE_TIMEOUT{1000};
+
+/*! @brief HTTP status of a response to a satisfied Range request */
+constexpr long PARTIAL_CONTENT = 206;
+
+} // namespace
+
+SegmentedDownload::SegmentedDownload(CURL* prototype, const std::string& file_name, std::uint64_t size,
+                                     const std::string& validator)
+    : m_prototype{prototype}, m_file_name{file_name}, m_size{size}, m_validator{validator} {
+    // The old file may be linked to a cached image, it is not truncated
+    if (0 != ::unlink(file_name.c_str()) && ENOENT != errno) {
+        throw std::runtime_error("Cannot remove file " + file_name + ": " + std::strerror(errno));
+    }
+    m_fd = ::open(file_name.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (m_fd < 0) {
+        throw std::runtime_error("Cannot open file " + file_name + " for writing: " + std::strerror(errno));
+    }
+    // Reserve the whole file at once, running out of space is detected before the transfer
+    const int result = ::posix_fallocate(m_fd, 0, static_cast<off_t>(size));
+    if (ENOSPC == result || (0 != result && 0 != ::ftruncate(m_fd, static_cast<off_t>(size)))) {
+        const std::string error = ENOSPC == result ? "There is not enough space left for " + file_name
+                                                   : "Cannot allocate file " + file_name + ": " + std::strerror(errno);
+        // The destructor does not run, nothing is left behind
+        ::close(m_fd);
+        ::unlink(file_name.c_str());
+        throw std::runtime_error(error);
+    }
+    if (!m_validator.empty()) {
+        // All segments must come from the same version of the file
+        m_request_headers.reset(curl_slist_append(nullptr, ("If-Range: " + m_validator).c_str()));
+    }
+}
+
+SegmentedDownload::~SegmentedDownload() {
+    if (m_fd >= 0) {
+        ::close(m_fd);
+    }
+}
+
+void SegmentedDownload::set_retry_policy(unsigned attempts, std::chrono::milliseconds interval,
+                                         std::chrono::milliseconds max_interval) {
+    m_retry_attempts = attempts;
+    m_retry_interval = interval;
+    m_max_retry_interval = max_interval;
+}
+
+void SegmentedDownload::set_progress_report() {
+    m_progress_report = true;
+}
+
+void SegmentedDownload::set_progress_callback(ProgressCallback on_progress) {
+    m_on_progress = std::move(on_progress);
+}
+
+void SegmentedDownload::set_digest(utils::Sha256* digest) {
+    m_digest = digest;
+}
+
+void SegmentedDownload::run(unsigned segments) {
+    std::unique_ptr<CURLM, CURLMcode (*)(CURLM*)> multi{curl_multi_init(), curl_multi_cleanup};
+    if (!multi) {
+        throw std::runtime_error("Curl initialization failed.");
+    }
+
+    segments = std::max(1u, segments);
+    const std::uint64_t segment_size = (m_size + segments - 1) / segments;
+    m_segments = std::vector<Segment>(segments);
+    for (unsigned i = 0; i < segments; ++i) {
+        auto& segment = m_segments[i];
+        segment.download = this;
+        segment.begin = std::min(m_size, i * segment_size);
+        segment.end = std::min(m_size, segment.begin + segment_size);
+        segment.buffer.reserve(BUFFER_SIZE);
+    }
+    log_info("ipu", "Downloading " << m_file_name << " in " << segments << " segments.");
+
+    try {
+        for (auto& segment : m_segments) {
+            start(multi.get(), segment);
+        }
+        while (std::any_of(m_segments.begin(), m_segments.end(),
+                           [](const Segment& segment) { return segment.begin + segment.written < segment.end; })) {
+            int running = 0;
+            curl_multi_perform(multi.get(), &running);
+
+            int remaining = 0;
+            while (CURLMsg* message = curl_multi_info_read(multi.get(), &remaining)) {
+                if (CURLMSG_DONE != message->msg) {
+                    continue;
+                }
+                void* data = nullptr;
+                curl_easy_getinfo(message->easy_handle, CURLINFO_PRIVATE, &data);
+                const auto result = message->data.result;
+                curl_multi_remove_handle(multi.get(), message->easy_handle);
+                complete(*static_cast<Segment*>(data), result);
+            }
+
+            // Interrupted segments are started again once their backoff elapses
+            const auto now = std::chrono::steady_clock::now();
+            auto timeout = IDLE_TIMEOUT;
+            for (auto& segment : m_segments) {
+                if (segment.active || segment.begin + segment.written >= segment.end) {
+                    continue;
+                }
+                if (segment.next_attempt <= now) {
+                    start(multi.get(), segment);
+                }
+                else {
+                    timeout = std::min(timeout, std::chrono::duration_cast<std::chrono::milliseconds>(
+                                                    segment.next_attempt - now) + std::chrono::milliseconds{1});
+                }
+            }
+            curl_multi_poll(multi.get(), nullptr, 0, static_cast<int>(timeout.count()), nullptr);
+        }
+    }
+    catch (...) {
+        for (auto& segment : m_segments) {
+            if (segment.active) {
+                curl_multi_remove_handle(multi.get(), segment.handle.get());
+            }
+        }
+        throw;
+    }
+
+    if (0 != ::fdatasync(m_fd)) {
+        throw std::runtime_error("Cannot sync file " + m_file_name + ": " + std::strerror(errno));
+    }
+    const int fd = m_fd;
+    m_fd = -1;
+    if (0 != ::close(fd)) {
+        throw std::runtime_error("Cannot close file " + m_file_name + ": " + std::strerror(errno));
+    }
+}
+
+void SegmentedDownload::start(CURLM* multi, Segment& segment) {
+    if (!segment.handle) {
+        segment.handle.reset(curl_easy_duphandle(m_prototype));
+        if (!segment.handle) {
+            throw std::runtime_error("Curl initialization failed.");
+        }
+        CURL* handle = segment.handle.get();
+        curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, write_callback);
+        curl_easy_setopt(handle, CURLOPT_WRITEDATA, static_cast<void*>(&segment));
+        curl_easy_setopt(handle, CURLOPT_HEADERFUNCTION, nullptr);
+        curl_easy_setopt(handle, CURLOPT_HEADERDATA, nullptr);
+        curl_easy_setopt(handle, CURLOPT_HTTPHEADER, m_request_headers.get());
+        curl_easy_setopt(handle, CURLOPT_RESUME_FROM_LARGE, curl_off_t{0});
+        curl_easy_setopt(handle, CURLOPT_NOPROGRESS, 1L);
+        curl_easy_setopt(handle, CURLOPT_VERBOSE, 0L);
+        curl_easy_setopt(handle, CURLOPT_PRIVATE, static_cast<void*>(&segment));
+    }
+    const auto range = std::to_string(segment.begin + segment.written) + "-" + std::to_string(segment.end - 1);
+    curl_easy_setopt(segment.handle.get(), CURLOPT_RANGE, range.c_str());
+    segment.error.clear();
+    if (CURLM_OK != curl_multi_add_handle(multi, segment.handle.get())) {
+        throw std::runtime_error("Cannot start download of segment " + range);
+    }
+    segment.active = true;
+}
+
+void SegmentedDownload::complete(Segment& segment, CURLcode result) {
+    segment.active = false;
+    // Data received before an interruption is kept
+    flush(segment);
+    if (!segment.error.empty()) {
+        throw std::runtime_error(segment.error);
+    }
+    const auto position = segment.begin + segment.written;
+    if (CURLE_OK == result && position == segment.end) {
+        return;
+    }
+    if (CURLE_OK != result && !CurlHandler::is_retryable(segment.handle.get(), result)) {
+        throw std::runtime_error("Data transfer failed: " + std::string(curl_easy_strerror(result)));
+    }
+    if (++segment.failures > m_retry_attempts) {
+        throw std::runtime_error("Data transfer failed: segment at " + std::to_string(position) + " was interrupted " +
+                                 std::to_string(segment.failures) + " times.");
+    }
+    segment.backoff = segment.backoff.count() ? std::min(segment.backoff * 2, m_max_retry_interval) : m_retry_interval;
+    segment.next_attempt = std::chrono::steady_clock::now() + segment.backoff;
+    log_warning("ipu", "Segment of " << m_file_name << " interrupted at " << position << ", retrying in "
+                                     << segment.backoff.count() << " ms.");
+}
+
+void SegmentedDownload::flush(Segment& segment) {
+    // Waiting here holds back all segments, which are received by this thread
+    TransferThrottle::get_instance()->throttle_write(segment.buffer.size());
+    const auto position = segment.begin + segment.written;
+    std::size_t offset = 0;
+    while (offset < segment.buffer.size()) {
+        const auto written = ::pwrite(m_fd, segment.buffer.data() + offset, segment.buffer.size() - offset,
+                                      static_cast<off_t>(segment.begin + segment.written));
+        if (written < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            throw std::runtime_error("Cannot write file " + m_file_name + ": " + std::strerror(errno));
+        }
+        offset += static_cast<std::size_t>(written);
+        segment.written += static_cast<std::uint64_t>(written);
+        m_written += static_cast<std::uint64_t>(written);
+    }
+    hash(position, segment.buffer);
+    segment.buffer.clear();
+    report_progress();
+}
+
+void SegmentedDownload::hash(std::uint64_t position, const std::vector<char>& data) {
+    if (!m_digest) {
+        return;
+    }
+    if (position == m_hashed) {
+        m_digest->update(data.data(), data.size());
+        m_hashed += data.size();
+    }
+    // Segments are ordered, the hashed part continues into the written part of the next ones
+    std::vector<char> buffer{};
+    for (const auto& segment : m_segments) {
+        const auto written = segment.begin + segment.written;
+        while (segment.begin <= m_hashed && m_hashed < written) {
+            buffer.resize(static_cast<std::size_t>(std::min<std::uint64_t>(BUFFER_SIZE, written - m_hashed)));
+            const auto size = ::pread(m_fd, buffer.data(), buffer.size(), static_cast<off_t>(m_hashed));
+            if (size < 0 && EINTR == errno) {
+                continue;
+            }
+            if (size <= 0) {
+                throw std::runtime_error("Cannot read file " + m_file_name + ": " +
+                                         (size < 0 ? std::strerror(errno) : "unexpected end of file"));
+            }
+            m_digest->update(buffer.data(), static_cast<std::size_t>(size));
+            m_hashed += static_cast<std::uint64_t>(size);
+        }
+    }
+}
+
+void SegmentedDownload::report_progress() {
+    if (m_on_progress) {
+        m_on_progress(m_written, m_size);
+    }
+    if (!m_progress_report || !m_size) {
+        return;
+    }
+    const auto progress = m_written * 100 / m_size / 10 * 10;
+    if (m_progress < progress) {
+        m_progress = progress;
+        log_info("ipu", m_progress << " % of image downloaded.");
+    }
+}
+
+size_t SegmentedDownload::write_callback(char* data, size_t size, size_t nmemb, void* userdata) {
+    auto& segment = *static_cast<Segment*>(userdata);
+    const size_t bytes = size * nmemb;
+    long status = 0;
+    curl_easy_getinfo(segment.handle.get(), CURLINFO_RESPONSE_CODE, &status);
+    if (PARTIAL_CONTENT != status) {
+        // The whole file is sent when it changed since the download started
+        segment.error = "File " + segment.download->m_file_name + " changed during download.";
+        return 0;
+    }
+    if (segment.begin + segment.written + segment.buffer.size() + bytes > segment.end) {
+        segment.error = "Server sent more data than requested for " + segment.download->m_file_name;
+        return 0;
+    }
+    try {
+        segment.buffer.insert(segment.buffer.end(), data, data + bytes);
+        if (segment.buffer.size() >= BUFFER_SIZE) {
+            segment.download->flush(segment);
+        }
+    }
+    catch (const std::exception& e) {
+        segment.error = e.what();
+        return 0;
+    }
+    return bytes;
+}
+
+} // namespace ipu
+} // namespace psme
@@ -2,20 +2,59 @@
 /* Copyright (C) 2024 Intel Corporation */
 
 #include "psme/ipu/service.hpp"
+#include "agent-framework/action/task_creator.hpp"
+#include "agent-framework/action/task_runner.hpp"
+#include "agent-framework/module/managers/utils/manager_utils.hpp"
 #include "psme/ipu/acc_boot_override_handler.hpp"
+#include "psme/ipu/backend.hpp"
+#include "psme/ipu/image_cache.hpp"
 #include "psme/ipu/imc_reset_handler.hpp"
+#include "psme/ipu/inventory_cache.hpp"
 #include "psme/ipu/loader.hpp"
+#include "psme/ipu/transfer_throttle.hpp"
+#include "configuration/configuration.hpp"
 #include "psme/ipu/virtual_media_eject_handler.hpp"
 
-using std::chrono::steady_clock;
 using namespace psme::ipu;
 using namespace agent_framework::model;
 using namespace agent_framework::model::enums;
 
+namespace {
+
+void set_acc_reset_result(const std::string& task_uuid, const std::string& message_id, const std::string& message) {
+    auto task = agent_framework::module::get_manager<Task>().get_entry_reference(task_uuid);
+    Task::Messages messages{attribute::Message{
+        message_id,
+        message,
+        Health::OK,
+        "None",
+        attribute::Message::RelatedProperties{},
+        attribute::Message::MessageArgs{}}};
+    task->set_messages(messages);
+    task->set_percent_complete(100);
+    log_info("ipu", message);
+}
+
+} // namespace
+
 Service::Service() {
     Loader loader;
     loader.load();
 
+    const auto& config = configuration::Configuration::get_instance().to_json();
+    TransferThrottle::get_instance()->set_limits(TransferThrottle::load_limits(config));
+    // Created here first, so the downloads use the configured cache
+    const auto cache = ImageCache::load_settings(config);
+    ImageCache::get_instance(cache.directory, cache.capacity, cache.copy_limit);
+    // Device queries are slow, the loader sets the last known inventory
+    InventoryCache::get_instance()->start(InventoryCache::load_ttl(config), [] {
+        Inventory inventory{};
+        inventory.versions = Backend::get_instance().get_component_info();
+        inventory.firmware_build = Backend::get_instance().get_firmware_build();
+        return inventory;
+    }, &Loader::update_inventory);
+
+    AccBootOverrideHandler::register_schema();
     std::lock_guard lock(m_acc_boot_override_mutex);
     AccBootOverrideHandler handler;
     handler.read_initial_state();
@@ -25,12 +64,43 @@ Service::Service() {
 
 Service::~Service() {
     log_info("ipu", "Stopping IPU service update loop...");
-    m_break_loop_condition.notify_one();
+    m_boot_override_watcher.interrupt();
     stop();
+    InventoryCache::get_instance()->stop();
 }
 
-void Service::trigger_acc_reset(const ResetType& reset_type) {
-    m_cpchnl_cmd_handler.trigger_acc_reset(reset_type);
+void Service::trigger_acc_reset(const ResetType& reset_type, std::string& task_uuid) {
+    // The command is queued right away, the task only waits for its completion
+    auto completion = m_cpchnl_cmd_handler.trigger_acc_reset(reset_type).share();
+
+    agent_framework::action::TaskCreator task_creator{};
+    task_creator.prepare_task();
+    task_creator.add_subtask([completion] {
+        completion.get();
+        log_info("ipu", "ACC reset request acknowledged.");
+    });
+
+    agent_framework::model::Task task_resource = task_creator.get_task_resource();
+    auto& task_manager = agent_framework::module::get_manager<agent_framework::model::Task>();
+    task_resource.set_id(static_cast<std::uint64_t>(task_manager.get_entry_count() + 1));
+    task_resource.set_percent_complete(0);
+    task_manager.add_entry(task_resource);
+
+    const auto uuid = task_resource.get_uuid();
+    task_creator.add_completion_callback([uuid] {
+        set_acc_reset_result(uuid, "Base.1.18.Success", "ACC reset completed successfully.");
+    });
+    task_creator.add_exception_callback([uuid](const agent_framework::exceptions::GamiException& exception) {
+        set_acc_reset_result(uuid, "Base.1.18.GeneralError", "ACC reset failed: " + exception.get_message());
+    });
+    task_creator.set_promised_response([]() { return json::Json{}; });
+    task_creator.set_promised_error_thrower([](const agent_framework::exceptions::GamiException& exception) {
+        return agent_framework::exceptions::GamiException(exception.get_error_code(), "ACC reset failed: " + exception.get_message());
+    });
+
+    agent_framework::action::TaskRunner::get_instance().run(task_creator.get_task());
+
+    task_uuid = task_resource.get_uuid();
 }
 
 void Service::trigger_imc_reset(const ResetType& reset_type) {
@@ -41,12 +111,32 @@ void Service::trigger_imc_reset(const ResetType& reset_type) {
 void Service::trigger_ipu_update(const std::string& img,
                                  const OptionalField<std::string>& username,
                                  const OptionalField<std::string>& password,
+                                 const OptionalField<std::string>& image_sha256,
                                  std::string& task_uuid) {
     m_simple_update_handler.try_lock();
-    m_simple_update_handler.update_info(img, username, password);
+    m_simple_update_handler.update_info(img, username, password, image_sha256);
     m_simple_update_handler.invoke_update(task_uuid);
 }
 
+std::string Service::reserve_ipu_update(std::uint64_t& package_size) {
+    m_simple_update_handler.try_lock();
+    try {
+        return m_simple_update_handler.reserve_package(package_size);
+    }
+    catch (...) {
+        m_simple_update_handler.release();
+        throw;
+    }
+}
+
+void Service::trigger_ipu_push_update(std::string& task_uuid) {
+    m_simple_update_handler.invoke_push_update(task_uuid);
+}
+
+void Service::release_ipu_update() {
+    m_simple_update_handler.release();
+}
+
 void Service::set_acc_boot_override(OptionalField<BootOverride> override,
                                     OptionalField<BootOverrideTarget> target) {
 
@@ -58,9 +148,10 @@ void Service::set_acc_boot_override(OptionalField<BootOverride> override,
 void Service::insert_virtual_media(const std::string& img, const TransferMethod& transfer_method,
                                    const OptionalField<std::string>& username,
                                    const OptionalField<std::string>& password,
+                                   const OptionalField<std::string>& image_sha256,
                                    std::string& uuid) {
     m_virtual_media_insert_handler.try_lock();
-    m_virtual_media_insert_handler.update_info(img, transfer_method, username, password);
+    m_virtual_media_insert_handler.update_info(img, transfer_method, username, password, image_sha256);
     m_virtual_media_insert_handler.run(uuid);
 }
 
@@ -71,12 +162,9 @@ void Service::eject_virtual_media() {
 }
 
 void Service::execute() {
-    std::unique_lock loop_lock(m_loop_mutex);
     while (is_running()) {
         log_info("ipu", "Running IPU service update loop");
 
-        auto start_point = steady_clock::now();
-
         try {
             std::lock_guard lock(m_acc_boot_override_mutex);
             AccBootOverrideHandler handler;
@@ -93,8 +181,11 @@ void Service::execute() {
 
         log_info("ipu", "Done running IPU service update loop");
 
-        auto sleep_period = m_interval - (steady_clock::now() - start_point);
-
-        m_break_loop_condition.wait_for(loop_lock, sleep_period);
+        if (m_boot_override_watcher.wait(m_interval)) {
+            log_debug("ipu", "Boot override files changed.");
+        }
+        else if (m_boot_override_watcher.is_interrupted()) {
+            break;
+        }
     }
 }
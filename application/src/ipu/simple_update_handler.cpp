@@ -8,10 +8,12 @@
 #include "psme/rest/server/error/error_factory.hpp"
 #include "psme/rest/server/error/server_exception.hpp"
 
+#include "ipu/backend.hpp"
 #include "ipu/curl_handler.hpp"
+#include "ipu/inventory_cache.hpp"
 #include "ipu/ipu_constants.hpp"
-#include "ipu/ipu_update_handler.hpp"
 #include "ipu/simple_update_handler.hpp"
+#include "ipu/task_progress.hpp"
 
 using namespace psme::rest;
 using namespace psme::ipu::constants;
@@ -21,29 +23,71 @@ using namespace psme::rest::error;
 namespace psme {
 namespace ipu {
 
+namespace {
+
+/*!
+ * @brief PercentComplete of the task once the package is downloaded,
+ * the update library does not report progress of the update itself
+ */
+constexpr std::uint32_t DOWNLOAD_PERCENT = 80;
+
+} // namespace
+
 void SimpleUpdateHandler::download_package() {
     log_notice("ipu", "Starting download from " << m_img << " to " << DESTINATION_PLDM_FILEPATH);
-    std::filesystem::space_info si = std::filesystem::space(PLDM_FILE_FOLDER);
-    if (si.available < MAX_PLDM_IMAGE_SIZE) {
-        throw std::runtime_error("There is not enough space left on " + std::string(PLDM_FILE_FOLDER));
-    }
+    TaskProgress progress{m_task_uuid, 0, DOWNLOAD_PERCENT};
     CurlHandler()
         .set_url(m_img)
         .set_credentials(m_username, m_password)
         .set_file_name(DESTINATION_PLDM_FILEPATH)
         .set_max_file_size(MAX_PLDM_IMAGE_SIZE)
+        .set_expected_digest(m_image_sha256)
+        .set_image_cache(ImageCache::get_instance())
         .set_progress_report()
+        .set_progress_callback([&progress](std::uint64_t done, std::uint64_t total) { progress.update(done, total); })
         .run_request();
 }
 
 void SimpleUpdateHandler::update_ipu() {
-    m_reset_type = IpuUpdateHandler().run_update(DESTINATION_PLDM_FILEPATH);
+    TaskProgress::set_percent(m_task_uuid, DOWNLOAD_PERCENT);
+    m_reset_type = Backend::get_instance().run_update(DESTINATION_PLDM_FILEPATH);
 }
 
 void SimpleUpdateHandler::invoke_update(std::string& uuid) {
+    start_task(uuid, true);
+}
+
+void SimpleUpdateHandler::invoke_push_update(std::string& uuid) {
+    start_task(uuid, false);
+}
+
+std::string SimpleUpdateHandler::reserve_package(std::uint64_t& package_size) {
+    if (package_size > MAX_PLDM_IMAGE_SIZE) {
+        throw ServerException(ErrorFactory::create_payload_too_large_error());
+    }
+    if (0 == package_size) {
+        package_size = MAX_PLDM_IMAGE_SIZE;
+    }
+    const auto folder = std::filesystem::path(DESTINATION_PLDM_FILEPATH).parent_path();
+    std::filesystem::space_info si = std::filesystem::space(folder);
+    if (si.available < package_size) {
+        throw ServerException(ErrorFactory::create_internal_error("There is not enough space left on " + folder.string()));
+    }
+    log_notice("ipu", "Receiving pushed package to " << DESTINATION_PLDM_FILEPATH);
+    return DESTINATION_PLDM_FILEPATH;
+}
+
+void SimpleUpdateHandler::release() {
+    remove_package();
+    m_lock.clear();
+}
+
+void SimpleUpdateHandler::start_task(std::string& uuid, bool download) {
     agent_framework::action::TaskCreator task_creator{};
     task_creator.prepare_task();
-    task_creator.add_subtask(std::bind(&SimpleUpdateHandler::download_package, this));
+    if (download) {
+        task_creator.add_subtask(std::bind(&SimpleUpdateHandler::download_package, this));
+    }
     task_creator.add_subtask(std::bind(&SimpleUpdateHandler::update_ipu, this));
     task_creator.add_subtask(std::bind(&SimpleUpdateHandler::remove_package, this));
 
@@ -52,7 +96,9 @@ void SimpleUpdateHandler::invoke_update(std::string& uuid) {
     auto& task_manager = agent_framework::module::get_manager<agent_framework::model::Task>();
     auto tasks_count = task_manager.get_entry_count();
     task_resource.set_id(static_cast<std::uint64_t>(tasks_count + 1));
+    task_resource.set_percent_complete(0);
     task_manager.add_entry(task_resource);
+    m_task_uuid = task_uuid;
 
     task_creator.add_exception_callback(std::bind(&SimpleUpdateHandler::exception_handler, this, task_uuid, std::placeholders::_1));
     task_creator.add_completion_callback(std::bind(&SimpleUpdateHandler::completion_handler, this, task_uuid));
@@ -84,14 +130,17 @@ void SimpleUpdateHandler::remove_package() {
 
 void SimpleUpdateHandler::update_info(const std::string& img,
                                       const OptionalField<std::string>& username,
-                                      const OptionalField<std::string>& password) {
+                                      const OptionalField<std::string>& password,
+                                      const OptionalField<std::string>& image_sha256) {
     m_img = img;
     m_username = username;
     m_password = password;
+    m_image_sha256 = image_sha256;
 }
 
 void SimpleUpdateHandler::completion_handler(const std::string& task_uuid) {
     m_lock.clear();
+    InventoryCache::get_instance()->refresh();
     log_info("ipu", "The " + m_reset_type + " reset is required to apply the update.");
     auto task = agent_framework::module::get_manager<agent_framework::model::Task>()
                     .get_entry_reference(task_uuid);
@@ -104,6 +153,7 @@ void SimpleUpdateHandler::completion_handler(const std::string& task_uuid) {
 
     messages.add_entry(get_message());
     task->set_messages(messages);
+    task->set_percent_complete(100);
     remove_package();
 }
 
@@ -0,0 +1,49 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/simulated_cpchnl_transport.hpp"
+#include "logger/logger.hpp"
+
+#include <thread>
+
+using std::chrono::steady_clock;
+
+namespace psme {
+namespace ipu {
+
+void SimulatedCpchnlTransport::send(Tag tag, const CpchnlCommand& command) {
+    log_debug("ipu", "Simulated CPChannel command " << command.opcode << " " << command.param_0);
+    const auto simulated = answer(command);
+    if (simulated.has_value()) {
+        m_pending.emplace(tag, Pending{steady_clock::now() + simulated->latency, simulated->error});
+    }
+    else {
+        // Lost, the channel times the command out
+        m_pending.emplace(tag, Pending{steady_clock::time_point::max(), {}});
+    }
+}
+
+std::optional<CpchnlTransport::Completion> SimulatedCpchnlTransport::receive(std::chrono::milliseconds timeout) {
+    const auto deadline = steady_clock::now() + timeout;
+    auto next = m_pending.end();
+    for (auto it = m_pending.begin(); m_pending.end() != it; ++it) {
+        if (m_pending.end() == next || it->second.due < next->second.due) {
+            next = it;
+        }
+    }
+    if (m_pending.end() == next || next->second.due > deadline) {
+        std::this_thread::sleep_until(deadline);
+        return {};
+    }
+    std::this_thread::sleep_until(next->second.due);
+    Completion completion{next->first, next->second.error};
+    m_pending.erase(next);
+    return completion;
+}
+
+std::optional<SimulatedCpchnlTransport::Answer> SimulatedCpchnlTransport::answer(const CpchnlCommand&) {
+    return Answer{m_profile.sample_latency(), m_profile.sample_error() ? "Simulated CPChannel failure." : ""};
+}
+
+} // namespace ipu
+} // namespace psme
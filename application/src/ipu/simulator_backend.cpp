@@ -0,0 +1,92 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/simulator_backend.hpp"
+#include "ipu/simulated_cpchnl_transport.hpp"
+#include "logger/logger.hpp"
+
+namespace psme {
+namespace ipu {
+
+constexpr const char SimulatorBackend::INITIAL_VERSION[];
+
+SimulatorBackend::Settings SimulatorBackend::Settings::from_json(const json::Json& json) {
+    Settings settings{};
+    settings.root = json.value("root", settings.root.string());
+    settings.image_server_port = json.value("image-server-port", settings.image_server_port);
+    settings.cpchnl_max_outstanding = json.value("cpchnl-max-outstanding", settings.cpchnl_max_outstanding);
+    settings.firmware_build = json.value("firmware-build", settings.firmware_build);
+    const auto profile = [&json](const char* name) {
+        return FaultProfile::from_json(json.value(name, json::Json::object()));
+    };
+    settings.cpchnl = profile("cpchnl");
+    settings.inventory = profile("inventory");
+    settings.update = profile("update");
+    settings.image_server = profile("image-server");
+    settings.imc_reset = profile("imc-reset");
+    return settings;
+}
+
+SimulatorBackend::SimulatorBackend(const Settings& settings) : m_settings{settings} {
+    std::filesystem::create_directories(get_images_directory());
+    std::filesystem::create_directories(get_flash_path().parent_path());
+    m_image_server = std::make_unique<ImageServer>(get_images_directory(), m_settings.image_server_port,
+                                                   m_settings.image_server);
+}
+
+std::unique_ptr<CpchnlTransport> SimulatorBackend::create_cpchnl_transport() {
+    return std::make_unique<SimulatedCpchnlTransport>(m_settings.cpchnl, m_settings.cpchnl_max_outstanding);
+}
+
+InventoryVersion SimulatorBackend::get_component_info() {
+    m_settings.inventory.apply("inventory query");
+
+    std::string version{INITIAL_VERSION};
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        // Each update flashes the next version of all components
+        version.replace(version.rfind('.') + 1, std::string::npos, std::to_string(m_updates));
+    }
+    InventoryVersion versions{};
+    versions.board_id_version = "simulator";
+    versions.boot_image_version = version;
+    versions.imc_version = version;
+    versions.imc_orom_version = version;
+    versions.acc_bios_version = version;
+    versions.recovery_imc_version = std::string{INITIAL_VERSION};
+    return versions;
+}
+
+std::string SimulatorBackend::run_update(const std::string& package_path) {
+    log_notice("ipu", "Simulated update from " << package_path);
+    m_settings.update.apply("update");
+
+    std::lock_guard<std::mutex> lock{m_mutex};
+    std::filesystem::copy_file(package_path, get_flash_path(), std::filesystem::copy_options::overwrite_existing);
+    ++m_updates;
+    return std::string{"POR"};
+}
+
+std::string SimulatorBackend::get_firmware_build() {
+    return m_settings.firmware_build;
+}
+
+void SimulatorBackend::reset_imc(const agent_framework::model::enums::ResetType& reset_type) {
+    log_notice("ipu", "Simulated IMC reset " << reset_type.to_string());
+    m_settings.imc_reset.apply("IMC reset");
+}
+
+std::filesystem::path SimulatorBackend::get_images_directory() const {
+    return m_settings.root / "images";
+}
+
+std::filesystem::path SimulatorBackend::get_flash_path() const {
+    return m_settings.root / "flash" / "image.pldm";
+}
+
+std::string SimulatorBackend::get_image_uri(const std::string& name) const {
+    return m_image_server->get_uri(name);
+}
+
+} // namespace ipu
+} // namespace psme
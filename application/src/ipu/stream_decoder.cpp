@@ -0,0 +1,195 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/stream_decoder.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include <zlib.h>
+
+#ifdef ZSTD_ENABLED
+#include <zstd.h>
+#endif
+
+namespace psme {
+namespace ipu {
+
+constexpr std::size_t StreamDecoder::BUFFER_SIZE;
+
+namespace {
+
+bool ends_with(const std::string& text, const std::string& suffix) {
+    return text.size() >= suffix.size() && 0 == text.compare(text.size() - suffix.size(), suffix.size(), suffix);
+}
+
+std::string to_lower(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return text;
+}
+
+std::runtime_error incomplete(StreamDecoder::Format format) {
+    return std::runtime_error(std::string("Compressed ") + StreamDecoder::to_string(format) + " image is incomplete.");
+}
+
+class GzipDecoder : public StreamDecoder {
+public:
+    GzipDecoder() {
+        // Accepts gzip headers only, not raw zlib streams
+        if (Z_OK != inflateInit2(&m_stream, MAX_WBITS + 16)) {
+            throw std::runtime_error("Cannot initialize gzip decoder.");
+        }
+    }
+
+    ~GzipDecoder() override {
+        inflateEnd(&m_stream);
+    }
+
+    GzipDecoder(const GzipDecoder&) = delete;
+    GzipDecoder& operator=(const GzipDecoder&) = delete;
+
+    void decode(const char* data, std::size_t size, const Sink& sink) override {
+        while (size > 0) {
+            const auto piece = std::min<std::size_t>(size, std::numeric_limits<uInt>::max());
+            m_stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+            m_stream.avail_in = static_cast<uInt>(piece);
+            do {
+                if (m_ended && m_stream.avail_in > 0) {
+                    // Next member of a concatenated file
+                    inflateReset(&m_stream);
+                    m_ended = false;
+                }
+                m_stream.next_out = reinterpret_cast<Bytef*>(m_buffer.data());
+                m_stream.avail_out = static_cast<uInt>(m_buffer.size());
+                const auto code = inflate(&m_stream, Z_NO_FLUSH);
+                if (Z_OK != code && Z_STREAM_END != code && Z_BUF_ERROR != code) {
+                    throw std::runtime_error(std::string("Cannot decompress gzip image: ") +
+                                             (m_stream.msg ? m_stream.msg : "corrupted data"));
+                }
+                m_ended = m_ended || Z_STREAM_END == code;
+                const auto decoded = m_buffer.size() - m_stream.avail_out;
+                if (decoded > 0) {
+                    sink(m_buffer.data(), decoded);
+                }
+            } while (m_stream.avail_in > 0 || 0 == m_stream.avail_out);
+            data += piece;
+            size -= piece;
+        }
+    }
+
+    void finish(const Sink&) override {
+        if (!m_ended) {
+            throw incomplete(Format::GZIP);
+        }
+    }
+
+private:
+    z_stream m_stream{};
+    bool m_ended{false};
+    std::vector<char> m_buffer = std::vector<char>(BUFFER_SIZE);
+};
+
+#ifdef ZSTD_ENABLED
+class ZstdDecoder : public StreamDecoder {
+public:
+    ZstdDecoder() {
+        if (!m_context) {
+            throw std::runtime_error("Cannot initialize zstd decoder.");
+        }
+    }
+
+    ~ZstdDecoder() override {
+        ZSTD_freeDCtx(m_context);
+    }
+
+    ZstdDecoder(const ZstdDecoder&) = delete;
+    ZstdDecoder& operator=(const ZstdDecoder&) = delete;
+
+    void decode(const char* data, std::size_t size, const Sink& sink) override {
+        ZSTD_inBuffer input{data, size, 0};
+        ZSTD_outBuffer output{};
+        do {
+            output = ZSTD_outBuffer{m_buffer.data(), m_buffer.size(), 0};
+            const auto code = ZSTD_decompressStream(m_context, &output, &input);
+            if (ZSTD_isError(code)) {
+                throw std::runtime_error(std::string("Cannot decompress zstd image: ") + ZSTD_getErrorName(code));
+            }
+            // 0 once a frame is decoded and flushed
+            m_pending = code;
+            if (output.pos > 0) {
+                sink(m_buffer.data(), output.pos);
+            }
+        } while (input.pos < input.size || output.pos == output.size);
+    }
+
+    void finish(const Sink&) override {
+        if (0 != m_pending) {
+            throw incomplete(Format::ZSTD);
+        }
+    }
+
+private:
+    ZSTD_DCtx* m_context{ZSTD_createDCtx()};
+    std::size_t m_pending{1};
+    std::vector<char> m_buffer = std::vector<char>(BUFFER_SIZE);
+};
+#endif
+
+
+} // namespace
+
+StreamDecoder::~StreamDecoder() {}
+
+StreamDecoder::Format StreamDecoder::detect(const std::string& url, const std::string& content_type) {
+    auto type = to_lower(content_type.substr(0, content_type.find(';')));
+    type.erase(type.find_last_not_of(" \t") + 1);
+    if ("application/gzip" == type || "application/x-gzip" == type) {
+        return Format::GZIP;
+    }
+    if ("application/zstd" == type) {
+        return Format::ZSTD;
+    }
+
+    // Generic types, e.g. application/octet-stream, fall back to the extension
+    const auto path = to_lower(url.substr(0, url.find_first_of("?#")));
+    if (ends_with(path, ".gz")) {
+        return Format::GZIP;
+    }
+    if (ends_with(path, ".zst")) {
+        return Format::ZSTD;
+    }
+    return Format::NONE;
+}
+
+const char* StreamDecoder::to_string(Format format) {
+    switch (format) {
+    case Format::GZIP:
+        return "gzip";
+    case Format::ZSTD:
+        return "zstd";
+    case Format::NONE:
+    default:
+        return "uncompressed";
+    }
+}
+
+std::unique_ptr<StreamDecoder> StreamDecoder::create(Format format) {
+    switch (format) {
+    case Format::NONE:
+        return nullptr;
+    case Format::GZIP:
+        return std::make_unique<GzipDecoder>();
+#ifdef ZSTD_ENABLED
+    case Format::ZSTD:
+        return std::make_unique<ZstdDecoder>();
+#endif
+    default:
+        throw std::runtime_error(std::string("Images compressed with ") + to_string(format) + " are not supported.");
+    }
+}
+
+} // namespace ipu
+} // namespace psme
@@ -0,0 +1,79 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/task_progress.hpp"
+#include "agent-framework/module/managers/utils/manager_utils.hpp"
+#include "agent-framework/module/model/task.hpp"
+#include "logger/logger.hpp"
+
+#include <algorithm>
+
+namespace psme {
+namespace ipu {
+
+constexpr std::chrono::seconds TaskProgress::UPDATE_INTERVAL;
+
+TaskProgress::TaskProgress(const std::string& task_uuid, std::uint32_t first_percent, std::uint32_t last_percent)
+    : m_task_uuid{task_uuid}, m_first_percent{first_percent}, m_last_percent{std::max(first_percent, last_percent)},
+      m_percent{first_percent} {}
+
+void TaskProgress::update(std::uint64_t done, std::uint64_t total) {
+    if (m_task_uuid.empty()) {
+        return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    if (!m_started) {
+        // Resumed data does not count into the transfer rate
+        m_started = true;
+        m_start = now;
+        m_start_bytes = done;
+    }
+    auto percent = m_percent;
+    if (total > 0) {
+        const auto stage = std::min(done, total) * (m_last_percent - m_first_percent) / total;
+        percent = m_first_percent + static_cast<std::uint32_t>(stage);
+    }
+    if (percent > m_percent || (done != m_done && now - m_published >= UPDATE_INTERVAL)) {
+        publish(done, total, percent, now);
+    }
+}
+
+void TaskProgress::publish(std::uint64_t done, std::uint64_t total, std::uint32_t percent,
+                           std::chrono::steady_clock::time_point now) {
+    m_percent = percent;
+    m_done = done;
+    m_published = now;
+
+    OptionalField<std::uint64_t> remaining{};
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_start).count();
+    if (total >= done && done > m_start_bytes && elapsed > 0) {
+        const auto rate = static_cast<double>(done - m_start_bytes) / static_cast<double>(elapsed);
+        remaining = static_cast<std::uint64_t>(static_cast<double>(total - done) / rate / 1000.0);
+    }
+    try {
+        auto task = agent_framework::module::get_manager<agent_framework::model::Task>().get_entry_reference(m_task_uuid);
+        task->set_percent_complete(percent);
+        task->set_transfer_progress(done, total > 0 ? OptionalField<std::uint64_t>{total} : OptionalField<std::uint64_t>{},
+                                    remaining);
+    }
+    catch (const std::exception& e) {
+        log_debug("ipu", "Progress of task " << m_task_uuid << " not published: " << e.what());
+    }
+}
+
+void TaskProgress::set_percent(const std::string& task_uuid, std::uint32_t percent) {
+    if (task_uuid.empty()) {
+        return;
+    }
+    try {
+        auto task = agent_framework::module::get_manager<agent_framework::model::Task>().get_entry_reference(task_uuid);
+        task->set_percent_complete(percent);
+        task->set_transfer_progress({}, {}, {});
+    }
+    catch (const std::exception& e) {
+        log_debug("ipu", "Progress of task " << task_uuid << " not published: " << e.what());
+    }
+}
+
+} // namespace ipu
+} // namespace psme
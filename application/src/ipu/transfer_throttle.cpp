@@ -0,0 +1,178 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/transfer_throttle.hpp"
+#include "logger/logger.hpp"
+#include "psme/rest/server/latency_monitor.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+
+namespace psme {
+namespace ipu {
+
+constexpr std::chrono::milliseconds TokenBucket::BURST;
+constexpr std::chrono::seconds TransferThrottle::ADJUST_INTERVAL;
+constexpr std::uint64_t TransferThrottle::MIN_ADAPTIVE_RATE;
+constexpr int TransferPriority::NICE;
+constexpr int TransferPriority::IO_PRIORITY_LEVEL;
+
+namespace {
+
+// From linux/ioprio.h, which is not exported to all toolchains
+constexpr int IOPRIO_WHO_PROCESS = 1;
+constexpr int IOPRIO_CLASS_BE = 2;
+constexpr int IOPRIO_CLASS_SHIFT = 13;
+
+} // namespace
+
+void TokenBucket::set_rate(std::uint64_t rate, Clock::time_point now) {
+    m_rate = rate;
+    m_ready = now;
+}
+
+TokenBucket::Clock::duration TokenBucket::take(std::uint64_t bytes, Clock::time_point now) {
+    if (0 == m_rate) {
+        return Clock::duration::zero();
+    }
+    m_ready = std::max(m_ready, now - BURST);
+    m_ready += std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(static_cast<double>(bytes) / static_cast<double>(m_rate)));
+    return m_ready > now ? m_ready - now : Clock::duration::zero();
+}
+
+TransferLimits TransferThrottle::load_limits(const json::Json& config) {
+    TransferLimits limits{};
+    if (!config.count("transfer-limits")) {
+        return limits;
+    }
+    const auto& section = config["transfer-limits"];
+    limits.max_download_rate = section.value("max-download-rate", limits.max_download_rate);
+    limits.max_write_rate = section.value("max-write-rate", limits.max_write_rate);
+    limits.adaptive = section.value("adaptive", limits.adaptive);
+    limits.latency_target = std::chrono::milliseconds{section.value("latency-target-ms", limits.latency_target.count())};
+    limits.low_priority = section.value("low-priority", limits.low_priority);
+    return limits;
+}
+
+TransferThrottle::~TransferThrottle() {}
+
+void TransferThrottle::set_limits(const TransferLimits& limits) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_limits = limits;
+    m_bucket.set_rate(limits.max_write_rate, Clock::now());
+    m_adjusted = {};
+    m_written = 0;
+}
+
+TransferLimits TransferThrottle::get_limits() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_limits;
+}
+
+std::uint64_t TransferThrottle::get_write_rate() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_bucket.get_rate();
+}
+
+void TransferThrottle::throttle_write(std::uint64_t bytes) {
+    const auto delay = reserve_write(bytes, Clock::now());
+    if (delay > Clock::duration::zero()) {
+        std::this_thread::sleep_for(delay);
+    }
+}
+
+TransferThrottle::Clock::duration TransferThrottle::reserve_write(std::uint64_t bytes, Clock::time_point now) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    adjust(now);
+    m_written += bytes;
+    return m_bucket.take(bytes, now);
+}
+
+void TransferThrottle::adjust(Clock::time_point now) {
+    if (!m_limits.adaptive) {
+        return;
+    }
+    if (Clock::time_point{} == m_adjusted) {
+        m_adjusted = now;
+        m_written = 0;
+        return;
+    }
+    const auto elapsed = std::chrono::duration<double>(now - m_adjusted);
+    if (elapsed < ADJUST_INTERVAL) {
+        return;
+    }
+    const auto observed = static_cast<std::uint64_t>(static_cast<double>(m_written) / elapsed.count());
+    m_adjusted = now;
+    m_written = 0;
+
+    const auto latency = rest::server::LatencyMonitor::get_instance()->get_percentile(99, now);
+    auto rate = m_bucket.get_rate();
+    if (latency > m_limits.latency_target) {
+        // The first back-off starts from the rate transfers actually reached
+        rate = std::max(MIN_ADAPTIVE_RATE, (rate ? rate : observed) / 2);
+        if (m_limits.max_write_rate) {
+            rate = std::min(rate, m_limits.max_write_rate);
+        }
+    }
+    else if (rate && latency * 2 <= m_limits.latency_target) {
+        rate += rate / 4;
+        if (m_limits.max_write_rate) {
+            rate = std::min(rate, m_limits.max_write_rate);
+        }
+        else if (rate > 2 * observed) {
+            // Transfers are slower than the limit for another reason
+            rate = 0;
+        }
+    }
+    if (rate != m_bucket.get_rate()) {
+        log_debug("ipu", "REST read latency p99 " << latency.count() << " us, transfer write rate set to "
+                                                  << rate << " B/s.");
+        m_bucket.set_rate(rate, now);
+    }
+}
+
+TransferPriority::TransferPriority() {
+    if (!TransferThrottle::get_instance()->get_limits().low_priority) {
+        return;
+    }
+    // With a thread ID, both calls affect the calling thread only
+    m_thread_id = ::syscall(SYS_gettid);
+    const auto who = static_cast<id_t>(m_thread_id);
+
+    errno = 0;
+    m_nice = ::getpriority(PRIO_PROCESS, who);
+    if (0 == errno && m_nice < NICE) {
+        if (0 == ::setpriority(PRIO_PROCESS, who, NICE)) {
+            m_nice_lowered = true;
+        }
+        else {
+            log_debug("ipu", "Cannot lower CPU priority of transfer: " << std::strerror(errno));
+        }
+    }
+
+    m_io_priority = static_cast<int>(::syscall(SYS_ioprio_get, IOPRIO_WHO_PROCESS, m_thread_id));
+    if (m_io_priority >= 0 &&
+        0 != ::syscall(SYS_ioprio_set, IOPRIO_WHO_PROCESS, m_thread_id,
+                       (IOPRIO_CLASS_BE << IOPRIO_CLASS_SHIFT) | IO_PRIORITY_LEVEL)) {
+        log_debug("ipu", "Cannot lower I/O priority of transfer: " << std::strerror(errno));
+        m_io_priority = -1;
+    }
+}
+
+TransferPriority::~TransferPriority() {
+    if (m_nice_lowered) {
+        ::setpriority(PRIO_PROCESS, static_cast<id_t>(m_thread_id), m_nice);
+    }
+    if (m_io_priority >= 0) {
+        ::syscall(SYS_ioprio_set, IOPRIO_WHO_PROCESS, m_thread_id, m_io_priority);
+    }
+}
+
+} // namespace ipu
+} // namespace psme
@@ -6,6 +6,7 @@
 #include "agent-framework/module/managers/utils/manager_utils.hpp"
 #include "agent-framework/module/model/virtual_media.hpp"
 #include "ipu/ipu_constants.hpp"
+#include "ipu/virtual_media_stream.hpp"
 #include "psme/rest/constants/constants.hpp"
 #include "psme/rest/server/error/error_factory.hpp"
 
@@ -27,6 +28,7 @@ void VirtualMediaEjectHandler::remove_image() {
         throw ServerException(ErrorFactory::create_action_not_supported_error(psme::rest::constants::Common::VIRTUAL_MEDIA_EJECT, "The virtual media is not inserted so it cannot be ejected."));
     }
 
+    VirtualMediaStream::get_instance()->eject();
     std::filesystem::remove(psme::ipu::constants::IMAGE_SYMLINK);
     std::filesystem::remove(psme::ipu::constants::IMAGE_PATH);
     log_info("ipu", "The virtual media image has been successfully removed");
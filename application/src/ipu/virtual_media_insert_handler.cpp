@@ -10,7 +10,11 @@
 #include "agent-framework/module/model/virtual_media.hpp"
 #include "ipu/curl_handler.hpp"
 #include "ipu/ipu_constants.hpp"
+#include "ipu/task_progress.hpp"
+#include "ipu/virtual_media_stream.hpp"
 #include "psme/rest/server/error/error_factory.hpp"
+#include <algorithm>
+#include <cctype>
 #include <filesystem>
 #include <system_error>
 
@@ -21,6 +25,13 @@ using namespace agent_framework::database;
 namespace psme {
 namespace ipu {
 
+namespace {
+
+/*! @brief PercentComplete of the task once the image is downloaded */
+constexpr std::uint32_t DOWNLOAD_PERCENT = 95;
+
+} // namespace
+
 void VirtualMediaInsertHandler::run(std::string& uuid) {
     agent_framework::action::TaskCreator task_creator{};
     task_creator.prepare_task();
@@ -35,7 +46,9 @@ void VirtualMediaInsertHandler::run(std::string& uuid) {
     auto& task_manager = agent_framework::module::get_manager<agent_framework::model::Task>();
     auto tasks_count = task_manager.get_entry_count();
     task_resource.set_id(static_cast<uint64_t>(tasks_count + 1));
+    task_resource.set_percent_complete(0);
     task_manager.add_entry(task_resource);
+    m_task_uuid = task_uuid;
 
     task_creator.add_exception_callback(std::bind(&VirtualMediaInsertHandler::exception_callback, this, task_uuid, std::placeholders::_1));
     task_creator.add_completion_callback(std::bind(&VirtualMediaInsertHandler::completion_callback, this, task_uuid));
@@ -66,20 +79,58 @@ void VirtualMediaInsertHandler::eject_previous_media() {
 
     DatabaseEntity<VIRTUAL_MEDIA_ENTITY_NAME> entity(virtual_media->get_uuid());
     entity.del(psme::ipu::constants::DOWNLOADED_IMAGE_NAME);
+    VirtualMediaStream::get_instance()->eject();
     std::filesystem::remove(IMAGE_SYMLINK);
     std::filesystem::remove(IMAGE_PATH);
 }
 
 void VirtualMediaInsertHandler::download_image() {
+    if (agent_framework::model::enums::TransferMethod::Stream == m_transfer_method) {
+        stream_image();
+        return;
+    }
+    // Blocks of an image streamed before a restart are not resumed by a download
+    VirtualMediaStream::get_instance()->eject();
     log_info("ipu", "Starting virtual media image download.");
 
+    TaskProgress progress{m_task_uuid, 0, DOWNLOAD_PERCENT};
     CurlHandler()
         .set_url(m_img)
         .set_credentials(m_username, m_password)
         .set_file_name(IMAGE_PATH)
         .set_max_file_size(MAX_IMAGE_SIZE)
+        .set_segments(VIRTUAL_MEDIA_DOWNLOAD_SEGMENTS)
+        .set_expected_digest(m_image_sha256)
+        .set_image_cache(ImageCache::get_instance())
         .set_progress_report()
+        .set_progress_callback([&progress](std::uint64_t done, std::uint64_t total) { progress.update(done, total); })
         .run_request();
+    TaskProgress::set_percent(m_task_uuid, DOWNLOAD_PERCENT);
+}
+
+void VirtualMediaInsertHandler::stream_image() {
+    auto* cache = ImageCache::get_instance();
+    if (m_image_sha256.has_value()) {
+        std::string sha256 = m_image_sha256.value();
+        std::transform(sha256.begin(), sha256.end(), sha256.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        if (cache->contains(sha256) && cache->restore(sha256, IMAGE_PATH)) {
+            log_info("ipu", "Virtual media image restored from the image cache instead of streaming it.");
+            VirtualMediaStream::get_instance()->eject();
+            TaskProgress::set_percent(m_task_uuid, DOWNLOAD_PERCENT);
+            return;
+        }
+    }
+
+    log_info("ipu", "Starting virtual media image streaming.");
+    auto image = CurlHandler()
+                     .set_url(m_img)
+                     .set_credentials(m_username, m_password)
+                     .set_file_name(IMAGE_PATH)
+                     .set_max_file_size(MAX_IMAGE_SIZE)
+                     .open_lazy();
+    VirtualMediaStream::get_instance()->start(std::move(image), m_img, m_image_sha256.value_or(""));
+    TaskProgress::set_percent(m_task_uuid, DOWNLOAD_PERCENT);
 }
 
 void VirtualMediaInsertHandler::create_symlink() {
@@ -107,7 +158,7 @@ void VirtualMediaInsertHandler::create_symlink() {
     }
 
     std::error_code ec{};
-    std::filesystem::create_symlink(IMAGE_PATH, IMAGE_SYMLINK, ec);
+    std::filesystem::create_symlink(VirtualMediaStream::get_instance()->get_media_path(), IMAGE_SYMLINK, ec);
     if (ec) {
         throw std::runtime_error("Could not create symlink to virtual media image: " + ec.message());
     }
@@ -123,6 +174,9 @@ void VirtualMediaInsertHandler::update_virtual_media() {
     log_info("ipu", "Updating virtual media state.");
     virtual_media->set_image_name(img_filename);
     virtual_media->set_inserted(true);
+    auto status = virtual_media->get_status();
+    status.set_health(agent_framework::model::enums::Health::OK);
+    virtual_media->set_status(status);
 
     DatabaseEntity<VIRTUAL_MEDIA_ENTITY_NAME> entity(virtual_media->get_uuid());
     entity.put(DOWNLOADED_IMAGE_NAME, img_filename);
@@ -130,11 +184,13 @@ void VirtualMediaInsertHandler::update_virtual_media() {
 
 void VirtualMediaInsertHandler::update_info(const std::string& img, const agent_framework::model::enums::TransferMethod& transfer_method,
                                             const OptionalField<std::string>& username,
-                                            const OptionalField<std::string>& password) {
+                                            const OptionalField<std::string>& password,
+                                            const OptionalField<std::string>& image_sha256) {
     m_img = img;
     m_transfer_method = transfer_method;
     m_username = username;
     m_password = password;
+    m_image_sha256 = image_sha256;
 }
 
 void VirtualMediaInsertHandler::completion_callback(const std::string& task_uuid) {
@@ -148,6 +204,7 @@ void VirtualMediaInsertHandler::completion_callback(const std::string& task_uuid
         agent_framework::model::attribute::Message::RelatedProperties{},
         agent_framework::model::attribute::Message::MessageArgs{}}};
     task->set_messages(messages);
+    task->set_percent_complete(100);
     log_info("ipu", "Virtual Media inserted successfully.");
 }
 
@@ -162,6 +219,7 @@ void VirtualMediaInsertHandler::exception_callback(const std::string& task_uuid,
         agent_framework::model::attribute::Message::RelatedProperties{},
         agent_framework::model::attribute::Message::MessageArgs{}}};
     task->set_messages(messages);
+    VirtualMediaStream::get_instance()->eject();
     if (std::filesystem::exists(IMAGE_SYMLINK)) {
         std::filesystem::remove(IMAGE_SYMLINK);
     }
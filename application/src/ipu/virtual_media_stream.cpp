@@ -0,0 +1,176 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/virtual_media_stream.hpp"
+#include "agent-framework/database/database_entity.hpp"
+#include "agent-framework/module/managers/utils/manager_utils.hpp"
+#include "agent-framework/module/model/virtual_media.hpp"
+#include "ipu/image_cache.hpp"
+#include "logger/logger.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <system_error>
+#include <thread>
+
+using namespace agent_framework::database;
+using namespace agent_framework::model;
+using namespace agent_framework::module;
+using namespace psme::ipu::constants;
+
+namespace psme {
+namespace ipu {
+
+VirtualMediaStream::VirtualMediaStream(const std::string& device) : m_device{device} {}
+
+VirtualMediaStream::~VirtualMediaStream() {
+    stop();
+}
+
+void VirtualMediaStream::start(std::unique_ptr<LazyImage> image, const std::string& url, const std::string& sha256) {
+    stop();
+
+    auto* lazy_image = image.get();
+    auto nbd_export = std::make_unique<NbdExport>(image->get_size(), [lazy_image](std::uint64_t offset, char* data, std::size_t size) {
+        lazy_image->read(offset, data, size);
+    });
+    nbd_export->start(m_device);
+
+    std::uint64_t generation{};
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_image = std::move(image);
+        m_export = std::move(nbd_export);
+        m_url = url;
+        m_sha256 = sha256;
+        std::transform(m_sha256.begin(), m_sha256.end(), m_sha256.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        m_complete = false;
+        generation = ++m_generation;
+    }
+    log_info("ipu", "Streaming " << url << " on " << m_device << ".");
+    lazy_image->start_fill([this, generation](const std::string& error) { complete(generation, error); });
+}
+
+void VirtualMediaStream::stop() {
+    std::unique_ptr<LazyImage> image{};
+    std::unique_ptr<NbdExport> nbd_export{};
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        image = std::move(m_image);
+        nbd_export = std::move(m_export);
+        // A fill completing from now on belongs to a stopped image
+        ++m_generation;
+    }
+    if (!image) {
+        return;
+    }
+    // Fails reads in progress, so the device can be detached
+    image->stop();
+    nbd_export.reset();
+    log_info("ipu", "Stopped streaming of the virtual media image.");
+}
+
+void VirtualMediaStream::eject() {
+    stop();
+    std::error_code ec{};
+    std::filesystem::remove(LazyImage::get_map_file(IMAGE_PATH), ec);
+}
+
+bool VirtualMediaStream::is_streaming() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return nullptr != m_export;
+}
+
+std::string VirtualMediaStream::get_media_path() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (m_export && !m_complete) {
+        return m_device;
+    }
+    return IMAGE_PATH;
+}
+
+void VirtualMediaStream::complete(std::uint64_t generation, const std::string& error) {
+    if (!error.empty()) {
+        // Blocks still missing are fetched when they are read
+        log_error("ipu", "Background fetch of the streamed image stopped: " << error);
+        return;
+    }
+
+    std::string url{};
+    std::string sha256{};
+    std::string validator{};
+    std::string digest{};
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        if (generation != m_generation) {
+            return;
+        }
+        url = m_url;
+        sha256 = m_sha256;
+        validator = m_image->get_validator();
+        digest = m_image->get_digest();
+    }
+
+    if (!sha256.empty() && digest != sha256) {
+        log_error("ipu", "SHA-256 digest of streamed " << url << " is " << digest << ", expected " << sha256);
+        reject(generation);
+        return;
+    }
+    try {
+        ImageCache::get_instance()->store(url, validator, digest, IMAGE_PATH);
+    }
+    catch (const std::exception& e) {
+        log_warning("ipu", "Streamed image cannot be cached: " << e.what());
+    }
+
+    // New readers of the image read the file, the device stays attached for its current readers
+    if (std::filesystem::is_symlink(IMAGE_SYMLINK)) {
+        const std::string temporary = std::string{IMAGE_SYMLINK} + ".tmp";
+        std::error_code ec{};
+        std::filesystem::remove(temporary, ec);
+        std::filesystem::create_symlink(IMAGE_PATH, temporary, ec);
+        if (!ec) {
+            std::filesystem::rename(temporary, IMAGE_SYMLINK, ec);
+        }
+        if (ec) {
+            log_error("ipu", "Could not switch the virtual media image symlink to " << IMAGE_PATH << ": " << ec.message());
+        }
+    }
+
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (generation == m_generation) {
+        m_complete = true;
+    }
+    log_info("ipu", "Streamed image " << url << " is complete.");
+}
+
+void VirtualMediaStream::reject(std::uint64_t generation) {
+    // Stopped from another thread, the fill thread calling this cannot release itself
+    std::thread([this, generation] {
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            if (generation != m_generation) {
+                return;
+            }
+        }
+        eject();
+        std::error_code ec{};
+        std::filesystem::remove(IMAGE_SYMLINK, ec);
+        std::filesystem::remove(IMAGE_PATH, ec);
+
+        auto media = get_manager<VirtualMedia>().get_only_reference();
+        media->set_image_name({});
+        media->set_inserted(false);
+        auto status = media->get_status();
+        status.set_health(agent_framework::model::enums::Health::Critical);
+        media->set_status(status);
+        DatabaseEntity<VIRTUAL_MEDIA_ENTITY_NAME> entity(media->get_uuid());
+        entity.del(DOWNLOADED_IMAGE_NAME);
+        log_error("ipu", "Streamed virtual media image was rejected and ejected.");
+    }).detach();
+}
+
+} // namespace ipu
+} // namespace psme
@@ -47,6 +47,7 @@ const char* SESSION_ID = "sessionId";
 const char* ACCOUNT_ID = "accountId";
 const char* ROLE_ID = "roleId";
 const char* VIRTUAL_MEDIA_ID = "virtualMediaId";
+const char* SUBSCRIPTION_ID = "subscriptionId";
 
 const char PATH_SEP = '/';
 const char VARIABLE_BEGIN = '{';
@@ -135,6 +136,7 @@ const char* BOARD_ID = "BoardId";
 namespace Collection {
 const char* ODATA_COUNT = "Members@odata.count";
 const char* MEMBERS = "Members";
+const char* NEXT_LINK = "Members@odata.nextLink";
 } // namespace Collection
 
 namespace Root {
@@ -146,10 +148,24 @@ const char* MANAGERS = "Managers";
 const char* REGISTRIES = "Registries";
 const char* MESSAGE_REGISTRY = "MessageRegistry";
 const char* UPDATE_SERVICE = "UpdateService";
+const char* EVENT_SERVICE = "EventService";
 const char* SERVICE = "Service";
 const char* ACCOUNT_SERVICE = "AccountService";
+const char* PROTOCOL_FEATURES_SUPPORTED = "ProtocolFeaturesSupported";
 } // namespace Root
 
+namespace ProtocolFeatures {
+const char* EXPAND_QUERY = "ExpandQuery";
+const char* EXPAND_ALL = "ExpandAll";
+const char* LEVELS = "Levels";
+const char* LINKS = "Links";
+const char* NO_LINKS = "NoLinks";
+const char* MAX_LEVELS = "MaxLevels";
+const char* SELECT_QUERY = "SelectQuery";
+const char* TOP_SKIP_QUERY = "TopSkipQuery";
+const char* FILTER_QUERY = "FilterQuery";
+} // namespace ProtocolFeatures
+
 namespace Redfish {
 const char* V1 = "v1";
 }
@@ -182,6 +198,10 @@ const char* ALLOWABLE_VALUES = "AllowableValues";
 
 namespace UpdateService {
 const char* HTTP_PUSH_URI = "HttpPushUri";
+const char* MULTIPART_HTTP_PUSH_URI = "MultipartHttpPushUri";
+const char* UPLOAD = "upload";
+const char* UPDATE_PARAMETERS = "UpdateParameters";
+const char* UPDATE_FILE = "UpdateFile";
 const char* HASH_UPDATE_SERVICE_SIMPLE_UPDATE = "#UpdateService.SimpleUpdate";
 const char* UPDATE_SERVICE_SIMPLE_UPDATE = "UpdateService.SimpleUpdate";
 const char* SIMPLE_UPDATE_ACTION_INFO = "SimpleUpdateActionInfo";
@@ -190,6 +210,7 @@ const char* TRANSFER_PROTOCOL = "TransferProtocol";
 const char* TARGETS = "Targets";
 const char* USER_NAME = "Username";
 const char* PASSWORD = "Password";
+const char* IMAGE_SHA256 = "ImageSha256";
 } // namespace UpdateService
 
 namespace TaskService {
@@ -206,12 +227,54 @@ const char* START_TIME = "StartTime";
 const char* END_TIME = "EndTime";
 const char* TASK_STATUS = "TaskStatus";
 const char* MESSAGES = "Messages";
+const char* PERCENT_COMPLETE = "PercentComplete";
+const char* BYTES_TRANSFERRED = "BytesTransferred";
+const char* TOTAL_BYTES = "TotalBytes";
+const char* ESTIMATED_REMAINING_SECONDS = "EstimatedRemainingSeconds";
 } // namespace Task
 
 namespace Monitor {
 const char* TASK_MONITORS = "TaskMonitors";
 } // namespace Monitor
 
+namespace EventService {
+const char* SSE = "SSE";
+const char* SERVER_SENT_EVENT_URI = "ServerSentEventUri";
+const char* SSE_FILTER_PROPERTIES_SUPPORTED = "SSEFilterPropertiesSupported";
+const char* REGISTRY_PREFIXES = "RegistryPrefixes";
+const char* RESOURCE_TYPES = "ResourceTypes";
+const char* EVENT_FORMAT_TYPES = "EventFormatTypes";
+const char* SUBSCRIPTIONS = "Subscriptions";
+const char* DELIVERY_RETRY_ATTEMPTS = "DeliveryRetryAttempts";
+const char* DELIVERY_RETRY_INTERVAL_SECONDS = "DeliveryRetryIntervalSeconds";
+} // namespace EventService
+
+namespace EventDestination {
+const char* DESTINATION = "Destination";
+const char* PROTOCOL = "Protocol";
+const char* CONTEXT = "Context";
+const char* SUBSCRIPTION_TYPE = "SubscriptionType";
+const char* EVENT_FORMAT_TYPE = "EventFormatType";
+const char* REGISTRY_PREFIXES = "RegistryPrefixes";
+const char* RESOURCE_TYPES = "ResourceTypes";
+const char* ORIGIN_RESOURCES = "OriginResources";
+const char* DELIVERED_EVENTS = "DeliveredEvents";
+const char* DROPPED_EVENTS = "DroppedEvents";
+const char* PENDING_EVENTS = "PendingEvents";
+} // namespace EventDestination
+
+namespace Event {
+const char* EVENTS = "Events";
+const char* EVENT_TYPE = "EventType";
+const char* EVENT_ID = "EventId";
+const char* EVENT_TIMESTAMP = "EventTimestamp";
+const char* ORIGIN_OF_CONDITION = "OriginOfCondition";
+const char* ORIGIN_RESOURCE = "OriginResource";
+const char* RESOURCE_TYPE = "ResourceType";
+const char* REGISTRY_PREFIX = "RegistryPrefix";
+const char* MESSAGE_SEVERITY = "MessageSeverity";
+} // namespace Event
+
 namespace MessageRegistryFile {
 const char* LANGUAGES = "Languages";
 const char* REGISTRY = "Registry";
@@ -279,6 +342,7 @@ const char* IMAGE = "Image";
 const char* TRANSFER_METHOD = "TransferMethod";
 const char* USER_NAME = "UserName";
 const char* PASSWORD = "Password";
+const char* IMAGE_SHA256 = "ImageSha256";
 } // namespace VirtualMediaInsert
 
 } // namespace constants
@@ -78,6 +78,13 @@ const std::string Routes::SIMPLE_UPDATE_ACTION_INFO_PATH =
         .append(UpdateService::SIMPLE_UPDATE_ACTION_INFO)
         .build();
 
+// "/redfish/v1/UpdateService/upload"
+const std::string Routes::MULTIPART_PUSH_UPDATE_PATH =
+    PathBuilder(PathParam::BASE_URL)
+        .append(Root::UPDATE_SERVICE)
+        .append(UpdateService::UPLOAD)
+        .build();
+
 // "/redfish/v1/SessionService"
 const std::string Routes::SESSION_SERVICE_PATH =
     PathBuilder(PathParam::BASE_URL)
@@ -134,6 +141,30 @@ const std::string Routes::MONITOR_PATH =
         .append_regex(PathParam::TASK_ID, PathParam::ID_REGEX)
         .build();
 
+// "/redfish/v1/EventService"
+const std::string Routes::EVENT_SERVICE_PATH =
+    PathBuilder(PathParam::BASE_URL)
+        .append(Root::EVENT_SERVICE)
+        .build();
+
+// "/redfish/v1/EventService/SSE"
+const std::string Routes::SSE_PATH =
+    PathBuilder(EVENT_SERVICE_PATH)
+        .append(EventService::SSE)
+        .build();
+
+// "/redfish/v1/EventService/Subscriptions"
+const std::string Routes::SUBSCRIPTION_COLLECTION_PATH =
+    PathBuilder(EVENT_SERVICE_PATH)
+        .append(EventService::SUBSCRIPTIONS)
+        .build();
+
+// "/redfish/v1/EventService/Subscriptions/{subscriptionId:[0-9]+}"
+const std::string Routes::SUBSCRIPTION_PATH =
+    PathBuilder(SUBSCRIPTION_COLLECTION_PATH)
+        .append_regex(PathParam::SUBSCRIPTION_ID, PathParam::ID_REGEX)
+        .build();
+
 // "/redfish/v1/Managers"
 const std::string Routes::MANAGER_COLLECTION_PATH =
     PathBuilder(PathParam::BASE_URL)
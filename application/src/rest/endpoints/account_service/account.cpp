@@ -85,7 +85,7 @@ void Account::get(const server::Request& req, server::Response& res) {
     r[Common::LINKS][constants::Account::ROLE][Common::ODATA_ID] =
         PathBuilder(Routes::ROLES_COLLECTION_PATH).append(Common::ADMINISTRATOR).build();
 
-    set_response(res, r);
+    set_response(req, res, r);
 }
 
 } // namespace endpoint
@@ -25,11 +25,14 @@
 
 #include "psme/rest/endpoints/account_service/account_collection.hpp"
 #include "psme/rest/constants/constants.hpp"
+#include "psme/rest/endpoints/utils.hpp"
 #include "psme/rest/security/account/account_manager.hpp"
 #include "psme/rest/server/error/error_factory.hpp"
 #include "psme/rest/utils/status_helpers.hpp"
 #include <psme/rest/endpoints/endpoint_base.hpp>
 
+#include <algorithm>
+
 using namespace psme::rest;
 using namespace psme::rest::constants;
 using namespace psme::rest::security::account;
@@ -60,16 +63,13 @@ AccountCollection::~AccountCollection() {}
 
 void AccountCollection::get(const server::Request& req, server::Response& res) {
     auto r = make_prototype();
-    uint32_t number_of_accounts = 0;
     r[Common::ODATA_ID] = PathBuilder(req).build();
-    AccountManager::get_instance()->for_each([&r, &req, &number_of_accounts](auto& account) {
-        json::Json link_elem(json::Json::value_t::object);
-        link_elem[Common::ODATA_ID] = PathBuilder(req).append(account.get_id()).build();
-        r[Collection::MEMBERS].push_back(std::move(link_elem));
-        number_of_accounts++;
-    });
-    r[Collection::ODATA_COUNT] = number_of_accounts;
-    set_response(res, r);
+    std::vector<std::uint64_t> ids{};
+    AccountManager::get_instance()->for_each([&ids](auto& account) { ids.push_back(account.get_id()); });
+    std::sort(ids.begin(), ids.end());
+    r[Collection::ODATA_COUNT] = std::uint32_t(ids.size());
+    utils::fill_collection_page(req, r, utils::get_page_ids(req, ids));
+    set_response(req, res, r);
 }
 
 } // namespace endpoint
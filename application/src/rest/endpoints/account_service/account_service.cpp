@@ -74,7 +74,7 @@ void AccountService::get(const server::Request& req, server::Response& res) {
     r[constants::Common::SERVICE_ENABLED] = true;
     r[Common::ODATA_ID] = PathBuilder(req).build();
 
-    set_response(res, r);
+    set_response(req, res, r);
 }
 
 } // namespace endpoint
@@ -68,7 +68,7 @@ void Role::get(const server::Request& req, server::Response& res) {
     r[Common::ID] = req.params[PathParam::ROLE_ID];
     r[constants::Role::ROLE_ID] = role.get_role_id();
     r[constants::Role::IS_PREDEFINED] = role.is_predefined();
-    set_response(res, r);
+    set_response(req, res, r);
 }
 
 } // namespace endpoint
@@ -23,6 +23,7 @@
 
 #include "psme/rest/endpoints/account_service/role_collection.hpp"
 #include "psme/rest/constants/constants.hpp"
+#include "psme/rest/endpoints/utils.hpp"
 #include "psme/rest/security/account/role_manager.hpp"
 #include "psme/rest/server/error/error_factory.hpp"
 #include "psme/rest/utils/status_helpers.hpp"
@@ -59,13 +60,11 @@ RoleCollection::~RoleCollection() {}
 void RoleCollection::get(const server::Request& req, server::Response& res) {
     auto r = make_prototype();
     r[Common::ODATA_ID] = PathBuilder(req).build();
-    RoleManager::get_instance()->for_each([&r, &req](const auto& role) {
-        json::Json link_elem(json::Json::value_t::object);
-        link_elem[Common::ODATA_ID] = PathBuilder(req).append(role.get_id()).build();
-        r[Collection::MEMBERS].push_back(std::move(link_elem));
-    });
-    r[Collection::ODATA_COUNT] = r[Collection::MEMBERS].size();
-    set_response(res, r);
+    std::vector<std::string> names{};
+    RoleManager::get_instance()->for_each([&names](const auto& role) { names.push_back(role.get_id()); });
+    r[Collection::ODATA_COUNT] = names.size();
+    utils::fill_collection_page(req, r, names);
+    set_response(req, res, r);
 }
 
 } // namespace endpoint
@@ -22,14 +22,18 @@
  * */
 
 #include "psme/rest/endpoints/endpoint_base.hpp"
+#include "psme/rest/constants/constants.hpp"
 #include "psme/rest/server/error/error_factory.hpp"
+#include "psme/rest/server/multiplexer.hpp"
 #include "psme/rest/server/mux/matchers.hpp"
+#include "psme/rest/server/static_resource_store.hpp"
 
 #include <chrono>
 #include <locale>
 
 using namespace psme::rest::server;
 using namespace psme::rest::endpoint;
+using namespace psme::rest::constants;
 
 namespace {
 constexpr std::size_t TIME_BUFFER_SIZE = 26;
@@ -48,6 +52,48 @@ std::string get_current_time() {
     return time_buffer;
 }
 
+bool is_link(const json::Json& json) {
+    if (!json.is_object() || 1 != json.size()) {
+        return false;
+    }
+    auto it = json.find(Common::ODATA_ID);
+    return it != json.end() && it->is_string();
+}
+
+void expand_links(const Request& request, json::Json& json, const QueryOptions& options,
+                  QueryOptions::ExpandType type, bool under_links, bool public_only) {
+    if (is_link(json)) {
+        if ((under_links && QueryOptions::ExpandType::SUBORDINATE == type) ||
+            (!under_links && QueryOptions::ExpandType::LINKS == type)) {
+            return;
+        }
+        const auto url = json[Common::ODATA_ID].get<std::string>();
+        const auto* multiplexer = Multiplexer::get_instance();
+        if (!multiplexer->is_correct_endpoint_url(url) ||
+            (public_only && !multiplexer->check_public_access("GET", url))) {
+            return;
+        }
+        try {
+            json = multiplexer->get_resource(request, url, options);
+        }
+        catch (const std::exception& ex) {
+            log_warning("rest", "Cannot expand " << url << ": " << ex.what());
+        }
+        return;
+    }
+    if (json.is_object()) {
+        for (auto it = json.begin(); it != json.end(); ++it) {
+            expand_links(request, it.value(), options, type, under_links || Common::LINKS == it.key(),
+                         public_only);
+        }
+    }
+    else if (json.is_array()) {
+        for (auto& element : json) {
+            expand_links(request, element, options, type, under_links, public_only);
+        }
+    }
+}
+
 } // namespace
 
 void psme::rest::server::http_method_not_allowed(const Request&, Response& response) {
@@ -86,3 +132,38 @@ void EndpointBase::patch(const Request& request, Response& response) {
 void EndpointBase::put(const Request& request, Response& response) {
     http_method_not_allowed(request, response);
 }
+
+void EndpointBase::set_response(const Request& request, Response& response, json::Json json) {
+    const auto& options = request.get_query_options();
+    if (options.has_expand()) {
+        // Anonymous requests to public resources must not reveal protected ones
+        const bool public_only = Multiplexer::get_instance()->check_public_access("GET", request.get_url());
+        if (json.count(Collection::MEMBERS)) {
+            // $select refers to the expanded members, the collection is returned as is
+            expand_links(request, json, options.get_expanded_options(true), options.get_expand_type(), false,
+                         public_only);
+        }
+        else {
+            options.select(json);
+            expand_links(request, json, options.get_expanded_options(false), options.get_expand_type(), false,
+                         public_only);
+        }
+    }
+    else {
+        options.select(json);
+    }
+    set_response(response, json);
+}
+
+bool EndpointBase::set_static_response(const Request& request, Response& response) {
+    const auto& options = request.get_query_options();
+    if (options.has_select() || options.has_expand()) {
+        return false;
+    }
+    const auto resource = server::StaticResourceStore::get_instance()->find(request.get_url());
+    if (!resource) {
+        return false;
+    }
+    resource->write(request, response);
+    return true;
+}
@@ -31,6 +31,15 @@ using namespace psme::rest;
 using namespace psme::rest::endpoint;
 using namespace psme::rest::server;
 
+namespace {
+
+template <typename T>
+void register_endpoint(Multiplexer& mp, const std::string& path) {
+    mp.register_handler(MethodsHandler::UPtr(new T(path)), get_implemented_methods<T>());
+}
+
+} // namespace
+
 EndpointBuilder::~EndpointBuilder() {}
 
 void EndpointBuilder::build_endpoints() {
@@ -40,103 +49,113 @@ void EndpointBuilder::build_endpoints() {
     });
 
     // "/redfish
-    mp.register_handler(Redfish::UPtr(new Redfish(constants::Routes::REDFISH_PATH)));
+    register_endpoint<Redfish>(mp, constants::Routes::REDFISH_PATH);
 
     // "/redfish/v1"
-    mp.register_handler(Root::UPtr(new Root(constants::Routes::ROOT_PATH)));
+    register_endpoint<Root>(mp, constants::Routes::ROOT_PATH);
 
     // "/redfish/v1/odata"
-    mp.register_handler(Root::UPtr(new OdataServiceDocument(constants::Routes::ODATA_SERVICE_DOCUMENT)));
+    register_endpoint<OdataServiceDocument>(mp, constants::Routes::ODATA_SERVICE_DOCUMENT);
 
     // "/redfish/v1/$metadata"
-    mp.register_handler(MetadataRoot::UPtr(new MetadataRoot(constants::Routes::METADATA_ROOT_PATH)));
+    register_endpoint<MetadataRoot>(mp, constants::Routes::METADATA_ROOT_PATH);
 
     // "/redfish/v1/metadata/{metadata_file:*}"
-    mp.register_handler(Metadata::UPtr(new Metadata(constants::Routes::METADATA_PATH)));
+    register_endpoint<Metadata>(mp, constants::Routes::METADATA_PATH);
 
     // "/redfish/v1/UpdateService"
-    mp.register_handler(UpdateService::UPtr(new UpdateService(constants::Routes::UPDATE_SERVICE_PATH)));
+    register_endpoint<UpdateService>(mp, constants::Routes::UPDATE_SERVICE_PATH);
 
     // "/redfish/v1/UpdateService/SimpleUpdateActionInfo"
-    mp.register_handler(
-        SimpleUpdateActionInfo::UPtr(new SimpleUpdateActionInfo(constants::Routes::SIMPLE_UPDATE_ACTION_INFO_PATH)));
+    register_endpoint<SimpleUpdateActionInfo>(mp, constants::Routes::SIMPLE_UPDATE_ACTION_INFO_PATH);
 
     // "/redfish/v1/UpdateService/Actions/SimpleUpdate"
-    mp.register_handler(SimpleUpdate::UPtr(new SimpleUpdate(constants::Routes::SIMPLE_UPDATE_PATH)));
+    register_endpoint<SimpleUpdate>(mp, constants::Routes::SIMPLE_UPDATE_PATH);
+
+    // "/redfish/v1/UpdateService/upload"
+    register_endpoint<MultipartPushUpdate>(mp, constants::Routes::MULTIPART_PUSH_UPDATE_PATH);
 
     // "/redfish/v1/SessionService"
-    mp.register_handler(SessionService::UPtr(new SessionService(constants::Routes::SESSION_SERVICE_PATH)));
+    register_endpoint<SessionService>(mp, constants::Routes::SESSION_SERVICE_PATH);
 
     // "/redfish/v1/SessionService/Sessions"
-    mp.register_handler(SessionCollection::UPtr(new SessionCollection(constants::Routes::SESSION_COLLECTION_PATH)));
+    register_endpoint<SessionCollection>(mp, constants::Routes::SESSION_COLLECTION_PATH);
 
     // "/redfish/v1/SessionService/Sessions/{sessionId:[0-9]+}"
-    mp.register_handler(Session::UPtr(new Session(constants::Routes::SESSION_PATH)));
+    register_endpoint<Session>(mp, constants::Routes::SESSION_PATH);
 
     // "/redfish/v1/Registries"
-    mp.register_handler(MessageRegistryFileCollection::UPtr(
-        new MessageRegistryFileCollection(constants::Routes::MESSAGE_REGISTRY_FILE_COLLECTION_PATH)));
+    register_endpoint<MessageRegistryFileCollection>(mp, constants::Routes::MESSAGE_REGISTRY_FILE_COLLECTION_PATH);
 
     // "/redfish/v1/Registries/{MessageRegistryFileId: [0-9]+}"
-    mp.register_handler(MessageRegistryFile::UPtr(
-        new MessageRegistryFile(constants::Routes::MESSAGE_REGISTRY_FILE_PATH)));
+    register_endpoint<MessageRegistryFile>(mp, constants::Routes::MESSAGE_REGISTRY_FILE_PATH);
 
     // "/redfish/v1/TaskService"
-    mp.register_handler(TaskService::UPtr(new TaskService(constants::Routes::TASK_SERVICE_PATH)));
+    register_endpoint<TaskService>(mp, constants::Routes::TASK_SERVICE_PATH);
 
     // "/redfish/v1/TaskService/Tasks"
-    mp.register_handler(TaskCollection::UPtr(new TaskCollection(constants::Routes::TASK_COLLECTION_PATH)));
+    register_endpoint<TaskCollection>(mp, constants::Routes::TASK_COLLECTION_PATH);
 
     // "/redfish/v1/Task/Service/Tasks/{taskId:[0-9]+}"
-    mp.register_handler(Task::UPtr(new Task(constants::Routes::TASK_PATH)));
+    register_endpoint<Task>(mp, constants::Routes::TASK_PATH);
 
     // "/redfish/v1/Task/Service/Tasks/{taskId:[0-9]+}/Monitor"
-    mp.register_handler(Monitor::UPtr(new Monitor(constants::Routes::MONITOR_PATH)));
+    register_endpoint<Monitor>(mp, constants::Routes::MONITOR_PATH);
+
+    // "/redfish/v1/EventService"
+    register_endpoint<EventService>(mp, constants::Routes::EVENT_SERVICE_PATH);
+
+    // "/redfish/v1/EventService/SSE"
+    register_endpoint<ServerSentEvents>(mp, constants::Routes::SSE_PATH);
+
+    // "/redfish/v1/EventService/Subscriptions"
+    register_endpoint<SubscriptionCollection>(mp, constants::Routes::SUBSCRIPTION_COLLECTION_PATH);
+
+    // "/redfish/v1/EventService/Subscriptions/{subscriptionId:[0-9]+}"
+    register_endpoint<Subscription>(mp, constants::Routes::SUBSCRIPTION_PATH);
 
     // "/redfish/v1/Managers"
-    mp.register_handler(ManagerCollection::UPtr(new ManagerCollection(constants::Routes::MANAGER_COLLECTION_PATH)));
+    register_endpoint<ManagerCollection>(mp, constants::Routes::MANAGER_COLLECTION_PATH);
 
     // "/redfish/v1/Managers/{managerId:[0-9]+}"
-    mp.register_handler(Manager::UPtr(new Manager(constants::Routes::MANAGER_PATH)));
+    register_endpoint<Manager>(mp, constants::Routes::MANAGER_PATH);
 
     // "/redfish/v1/Managers/{managerId:[0-9]+}/Actions/Manager.Reset"
-    mp.register_handler(ManagerReset::UPtr(new ManagerReset(constants::Routes::MANAGER_RESET_PATH)));
+    register_endpoint<ManagerReset>(mp, constants::Routes::MANAGER_RESET_PATH);
 
     // "/redfish/v1/Systems"
-    mp.register_handler(SystemsCollection::UPtr(new SystemsCollection(constants::Routes::SYSTEMS_COLLECTION_PATH)));
+    register_endpoint<SystemsCollection>(mp, constants::Routes::SYSTEMS_COLLECTION_PATH);
 
     // "/redfish/v1/Systems/{systemId:[0-9]+}"
-    mp.register_handler(System::UPtr(new System(constants::Routes::SYSTEM_PATH)));
+    register_endpoint<System>(mp, constants::Routes::SYSTEM_PATH);
 
     // "/redfish/v1/Systems/{systemId:[0-9]+}/Actions/ComputerSystem.Reset"
-    mp.register_handler(SystemReset::UPtr(new SystemReset(constants::Routes::SYSTEM_RESET_PATH)));
+    register_endpoint<SystemReset>(mp, constants::Routes::SYSTEM_RESET_PATH);
 
     // "redfish/v1/Systems/{systemId:[0-9]+}+/VirtualMedia"
-    mp.register_handler(VirtualMediaCollection::UPtr(
-        new VirtualMediaCollection(constants::Routes::VIRTUAL_MEDIA_COLLECTION_PATH)));
+    register_endpoint<VirtualMediaCollection>(mp, constants::Routes::VIRTUAL_MEDIA_COLLECTION_PATH);
 
     // "redfish/v1/Systems/{systemId:[0-9]+}+/VirtualMedia/{virtualMediaId:[0-9]+}"
-    mp.register_handler(VirtualMedia::UPtr(
-        new VirtualMedia(constants::Routes::VIRTUAL_MEDIA_PATH)));
+    register_endpoint<VirtualMedia>(mp, constants::Routes::VIRTUAL_MEDIA_PATH);
 
     // "/redfish/v1/Systems/{systemId:[0-9]+}/VirtualMedia/{virtualMediaId:[0-9]+}/Actions/VirtualMedia.InsertMedia"
-    mp.register_handler(VirtualMediaInsert::UPtr(new VirtualMediaInsert(constants::Routes::VIRTUAL_MEDIA_INSERT_PATH)));
+    register_endpoint<VirtualMediaInsert>(mp, constants::Routes::VIRTUAL_MEDIA_INSERT_PATH);
 
     // "/redfish/v1/Systems/{systemId:[0-9]+}/VirtualMedia/{virtualMediaId:[0-9]+}/Actions/VirtualMedia.EjectMedia"
-    mp.register_handler(VirtualMediaInsert::UPtr(new VirtualMediaEject(constants::Routes::VIRTUAL_MEDIA_EJECT_PATH)));
+    register_endpoint<VirtualMediaEject>(mp, constants::Routes::VIRTUAL_MEDIA_EJECT_PATH);
 
     // "/redfish/v1/AccountService"
-    mp.register_handler(AccountService::UPtr(new AccountService(constants::Routes::ACCOUNT_SERVICE_PATH)));
+    register_endpoint<AccountService>(mp, constants::Routes::ACCOUNT_SERVICE_PATH);
 
     // "/redfish/v1/AccountService/Accounts"
-    mp.register_handler(AccountCollection::UPtr(new AccountCollection(constants::Routes::ACCOUNTS_COLLECTION_PATH)));
+    register_endpoint<AccountCollection>(mp, constants::Routes::ACCOUNTS_COLLECTION_PATH);
 
     // "/redfish/v1/AccountService/Accounts/{accountId}"
-    mp.register_handler(Account::UPtr(new Account(constants::Routes::ACCOUNT_PATH)));
+    register_endpoint<Account>(mp, constants::Routes::ACCOUNT_PATH);
 
     // "/redfish/v1/AccountService/Roles"
-    mp.register_handler(RoleCollection::UPtr(new RoleCollection(constants::Routes::ROLES_COLLECTION_PATH)));
+    register_endpoint<RoleCollection>(mp, constants::Routes::ROLES_COLLECTION_PATH);
 
     // "/redfish/v1/AccountService/Roles/{rolesId}"
-    mp.register_handler(Role::UPtr(new Role(constants::Routes::ROLE_PATH)));
+    register_endpoint<Role>(mp, constants::Routes::ROLE_PATH);
 }
@@ -0,0 +1,70 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/endpoints/event_service/event_service.hpp"
+#include "psme/rest/constants/constants.hpp"
+#include "psme/rest/constants/routes.hpp"
+#include "psme/rest/eventing/event_delivery.hpp"
+#include "psme/rest/server/static_resource_store.hpp"
+
+#include "json-wrapper/json-wrapper.hpp"
+
+using namespace psme::rest;
+using namespace psme::rest::constants;
+
+namespace {
+json::Json make_prototype(const std::string& path) {
+    json::Json r(json::Json::value_t::object);
+
+    r[Common::ODATA_CONTEXT] = "/redfish/v1/$metadata#EventService.EventService";
+    r[Common::ODATA_ID] = path;
+    r[Common::ODATA_TYPE] = "#EventService.v1_10_0.EventService";
+    r[Common::ID] = "EventService";
+    r[Common::NAME] = "Event Service";
+    r[Common::STATUS][Common::STATE] = "Enabled";
+    r[Common::STATUS][Common::HEALTH] = "OK";
+    r[Common::SERVICE_ENABLED] = true;
+
+    r[EventService::SERVER_SENT_EVENT_URI] = Routes::SSE_PATH;
+    r[EventService::SUBSCRIPTIONS][Common::ODATA_ID] = Routes::SUBSCRIPTION_COLLECTION_PATH;
+    r[EventService::DELIVERY_RETRY_ATTEMPTS] = eventing::EventDelivery::RETRY_ATTEMPTS;
+    r[EventService::DELIVERY_RETRY_INTERVAL_SECONDS] = eventing::EventDelivery::RETRY_INTERVAL.count();
+    r[EventService::EVENT_FORMAT_TYPES] = json::Json::array({"Event"});
+    r[EventService::REGISTRY_PREFIXES] = json::Json::array({"ResourceEvent", "TaskEvent"});
+    r[EventService::RESOURCE_TYPES] = json::Json::array({"ComputerSystem", "Manager", "Task", "VirtualMedia"});
+
+    auto& filter = r[EventService::SSE_FILTER_PROPERTIES_SUPPORTED];
+    filter["EventFormatType"] = false;
+    filter["EventType"] = true;
+    filter["MessageId"] = true;
+    filter["MetricReportDefinition"] = false;
+    filter["OriginResource"] = true;
+    filter["RegistryPrefix"] = true;
+    filter["ResourceType"] = true;
+    filter["SubordinateResources"] = false;
+
+    return r;
+}
+} // namespace
+
+namespace psme {
+namespace rest {
+namespace endpoint {
+
+EventService::EventService(const std::string& path) : EndpointBase(path) {
+    server::StaticResourceStore::get_instance()->add(path, server::ContentType::JSON, make_prototype(path).dump());
+}
+
+EventService::~EventService() {}
+
+void EventService::get(const server::Request& req, server::Response& res) {
+    if (set_static_response(req, res)) {
+        return;
+    }
+
+    set_response(req, res, make_prototype(PathBuilder(req).build()));
+}
+
+} // namespace endpoint
+} // namespace rest
+} // namespace psme
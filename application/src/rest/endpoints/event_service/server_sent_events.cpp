@@ -0,0 +1,31 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/endpoints/event_service/server_sent_events.hpp"
+#include "psme/rest/eventing/event_dispatcher.hpp"
+#include "psme/rest/server/http_headers.hpp"
+
+using namespace psme::rest;
+using namespace psme::rest::server;
+
+namespace psme {
+namespace rest {
+namespace endpoint {
+
+ServerSentEvents::ServerSentEvents(const std::string& path) : EndpointBase(path) {}
+
+ServerSentEvents::~ServerSentEvents() {}
+
+void ServerSentEvents::get(const server::Request& req, server::Response& res) {
+    // $filter selects events here, not collection members
+    auto stream = eventing::EventDispatcher::get_instance()->open_stream(
+        req.get_query_options().get_filter(), req.get_header(http_headers::LastEventId::LAST_EVENT_ID));
+
+    res.set_header(http_headers::ContentType::CONTENT_TYPE, http_headers::ContentType::EVENT_STREAM);
+    res.set_status(status_2XX::OK);
+    res.set_stream(std::move(stream));
+}
+
+} // namespace endpoint
+} // namespace rest
+} // namespace psme
@@ -0,0 +1,67 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/endpoints/event_service/subscription.hpp"
+#include "psme/rest/constants/constants.hpp"
+#include "psme/rest/eventing/event_delivery.hpp"
+#include "psme/rest/eventing/subscription_manager.hpp"
+
+using namespace psme::rest;
+using namespace psme::rest::constants;
+
+namespace psme {
+namespace rest {
+namespace endpoint {
+
+json::Json Subscription::make_prototype() {
+    json::Json r(json::Json::value_t::object);
+
+    r[Common::ODATA_CONTEXT] = "/redfish/v1/$metadata#EventDestination.EventDestination";
+    r[Common::ODATA_ID] = json::Json::value_t::null;
+    r[Common::ODATA_TYPE] = "#EventDestination.v1_13_2.EventDestination";
+    r[Common::ID] = json::Json::value_t::null;
+    r[Common::NAME] = json::Json::value_t::null;
+    r[EventDestination::DESTINATION] = json::Json::value_t::null;
+    r[EventDestination::PROTOCOL] = json::Json::value_t::null;
+    r[EventDestination::SUBSCRIPTION_TYPE] = json::Json::value_t::null;
+    r[EventDestination::EVENT_FORMAT_TYPE] = json::Json::value_t::null;
+    r[EventDestination::CONTEXT] = json::Json::value_t::null;
+    r[EventDestination::REGISTRY_PREFIXES] = json::Json::value_t::array;
+    r[EventDestination::RESOURCE_TYPES] = json::Json::value_t::array;
+    r[EventDestination::ORIGIN_RESOURCES] = json::Json::value_t::array;
+    r[Common::OEM][Common::INTEL][Common::ODATA_TYPE] = "#IntelIpuEventDestination.v1_0_0.EventDestination";
+    r[Common::OEM][Common::INTEL][EventDestination::DELIVERED_EVENTS] = 0;
+    r[Common::OEM][Common::INTEL][EventDestination::DROPPED_EVENTS] = 0;
+    r[Common::OEM][Common::INTEL][EventDestination::PENDING_EVENTS] = 0;
+
+    return r;
+}
+
+Subscription::Subscription(const std::string& path) : EndpointBase(path) {}
+
+Subscription::~Subscription() {}
+
+void Subscription::get(const server::Request& req, server::Response& res) {
+    auto r = make_prototype();
+    r[Common::ODATA_ID] = PathBuilder(req).build();
+
+    const auto id = utils::id_to_uint64(req.params[PathParam::SUBSCRIPTION_ID]);
+    eventing::SubscriptionManager::get_instance()->get(id).fill_json(r);
+
+    const auto statistics = eventing::EventDelivery::get_instance()->get_statistics(id);
+    r[Common::OEM][Common::INTEL][EventDestination::DELIVERED_EVENTS] = statistics.delivered;
+    r[Common::OEM][Common::INTEL][EventDestination::DROPPED_EVENTS] = statistics.dropped;
+    r[Common::OEM][Common::INTEL][EventDestination::PENDING_EVENTS] = statistics.pending;
+
+    set_response(req, res, r);
+}
+
+void Subscription::del(const server::Request& req, server::Response& res) {
+    const auto id = utils::id_to_uint64(req.params[PathParam::SUBSCRIPTION_ID]);
+    eventing::SubscriptionManager::get_instance()->del(id);
+    res.set_status(server::status_2XX::NO_CONTENT);
+}
+
+} // namespace endpoint
+} // namespace rest
+} // namespace psme
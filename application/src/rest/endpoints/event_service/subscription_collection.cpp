@@ -0,0 +1,92 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/endpoints/event_service/subscription_collection.hpp"
+#include "psme/rest/endpoints/event_service/subscription.hpp"
+#include "psme/rest/constants/constants.hpp"
+#include "psme/rest/eventing/subscription_manager.hpp"
+#include "psme/rest/validators/json_validator.hpp"
+#include "psme/rest/validators/schemas/subscription_collection.hpp"
+
+using namespace psme::rest;
+using namespace psme::rest::constants;
+using namespace psme::rest::validators;
+
+namespace {
+json::Json make_prototype() {
+    json::Json r(json::Json::value_t::object);
+
+    r[Common::ODATA_CONTEXT] = "/redfish/v1/$metadata#EventDestinationCollection.EventDestinationCollection";
+    r[Common::ODATA_ID] = json::Json::value_t::null;
+    r[Common::ODATA_TYPE] = "#EventDestinationCollection.EventDestinationCollection";
+    r[Common::NAME] = "Event Subscriptions Collection";
+    r[Collection::ODATA_COUNT] = json::Json::value_t::null;
+    r[Collection::MEMBERS] = json::Json::value_t::array;
+
+    return r;
+}
+
+std::vector<std::uint64_t> get_filtered_ids(const server::Filter& filter) {
+    endpoint::utils::validate_filter_properties(filter, {Common::ID, EventDestination::DESTINATION,
+                                                         EventDestination::CONTEXT});
+
+    std::vector<std::uint64_t> ids{};
+    eventing::SubscriptionManager::get_instance()->for_each([&filter, &ids](const eventing::Subscription& subscription) {
+        const auto json = subscription.to_json();
+        const auto matches = filter.evaluate([&json](const std::string& name) -> json::Json {
+            return json.value(name, json::Json{});
+        });
+        if (matches) {
+            ids.push_back(subscription.get_id());
+        }
+    });
+    return ids;
+}
+
+} // namespace
+
+namespace psme {
+namespace rest {
+namespace endpoint {
+
+SubscriptionCollection::SubscriptionCollection(const std::string& path) : EndpointBase(path) {}
+
+SubscriptionCollection::~SubscriptionCollection() {}
+
+void SubscriptionCollection::get(const server::Request& req, server::Response& res) {
+    auto r = ::make_prototype();
+    r[Common::ODATA_ID] = PathBuilder(req).build();
+
+    const auto& options = req.get_query_options();
+    const auto* subscription_manager = eventing::SubscriptionManager::get_instance();
+    if (options.has_filter()) {
+        const auto ids = ::get_filtered_ids(options.get_filter());
+        r[Collection::ODATA_COUNT] = std::uint32_t(ids.size());
+        utils::fill_collection_page(req, r, utils::get_page_ids(req, ids));
+    }
+    else {
+        r[Collection::ODATA_COUNT] = std::uint32_t(subscription_manager->get_count());
+        utils::fill_collection_page(
+            req, r, subscription_manager->get_ids(options.get_skip_token(), options.get_skip(), options.get_page_size() + 1));
+    }
+    set_response(req, res, r);
+}
+
+void SubscriptionCollection::post(const server::Request& req, server::Response& res) {
+    const auto& json = JsonValidator::validate_request_body<schema::SubscriptionCollectionPostSchema>(req);
+
+    const auto id = eventing::SubscriptionManager::get_instance()->add(eventing::Subscription::from_json(json));
+    const auto path = PathBuilder(req).append(id).build();
+
+    auto r = Subscription::make_prototype();
+    r[Common::ODATA_ID] = path;
+    eventing::SubscriptionManager::get_instance()->get(id).fill_json(r);
+
+    utils::set_location_header(req, res, path);
+    res.set_status(server::status_2XX::CREATED);
+    set_response(res, r);
+}
+
+} // namespace endpoint
+} // namespace rest
+} // namespace psme
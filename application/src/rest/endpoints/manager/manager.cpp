@@ -129,13 +129,17 @@ void endpoint::Manager::get(const server::Request& request, server::Response& re
 
     auto r = make_prototype();
     auto manager = psme::rest::model::find<agent_framework::model::Manager>(request.params).get();
+    const auto& options = request.get_query_options();
 
     r[Common::ODATA_ID] = PathBuilder(request).build();
     r[Common::ID] = request.params[PathParam::MANAGER_ID];
     utils::fill_name_and_description(manager, r);
 
     psme::rest::endpoint::status_to_json(manager, r);
-    fill_links(manager, r);
+    // Managed systems are looked up only if the links are selected
+    if (options.is_selected(Common::LINKS)) {
+        fill_links(manager, r);
+    }
 
     if (is_rack_manger(manager) || is_enclosure_manger(manager)) {
         r[constants::Manager::SERVICE_ENTRY_POINT_UUID] =
@@ -157,7 +161,9 @@ void endpoint::Manager::get(const server::Request& request, server::Response& re
     r[constants::Manager::DATE_TIME] = manager.get_date_time();
     r[constants::Manager::DATE_TIME_LOCAL_OFFSET] = manager.get_date_time_local_offset();
 
-    ::fill_manager_actions(request, manager, r);
+    if (options.is_selected(Common::ACTIONS)) {
+        ::fill_manager_actions(request, manager, r);
+    }
 
-    set_response(response, r);
+    set_response(request, response, r);
 }
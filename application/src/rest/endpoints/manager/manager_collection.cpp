@@ -61,11 +61,7 @@ void ManagerCollection::get(const server::Request& request, server::Response& re
 
     json[Collection::ODATA_COUNT] = std::uint32_t(manager_ids.size());
 
-    for (const auto& id : manager_ids) {
-        json::Json link = json::Json();
-        link[Common::ODATA_ID] = PathBuilder(request).append(id).build();
-        json[Collection::MEMBERS].push_back(std::move(link));
-    }
+    endpoint::utils::fill_collection_page(request, json, endpoint::utils::get_page_ids(request, manager_ids));
 
-    set_response(response, json);
+    set_response(request, response, json);
 }
@@ -60,5 +60,5 @@ void MessageRegistry::get(const server::Request& request, server::Response& resp
     // @TODO: Use MessageRegistryManager to obtain registry
     r[constants::Common::ODATA_ID] = request.get_url();
 
-    set_response(response, r);
+    set_response(request, response, r);
 }
@@ -27,6 +27,7 @@
 #include "psme/rest/registries/managers/message_registry_file_manager.hpp"
 #include <psme/rest/server/error/error_factory.hpp>
 #include <psme/rest/server/error/server_exception.hpp>
+#include <psme/rest/server/static_resource_store.hpp>
 
 #include "agent-framework/exceptions/not_found.hpp"
 
@@ -54,60 +55,76 @@ json::Json make_prototype() {
     return r;
 }
 
+json::Json make_file_json(const registries::MessageRegistryFile& file, const std::string& url, const std::string& id) {
+    auto r = make_prototype();
+
+    r[constants::Common::ODATA_ID] = url;
+    r[constants::Common::ID] = id;
+
+    fill_name_and_description(file, r);
+
+    json::Json languages = json::Json::value_t::array;
+    for (const auto& language : file.get_languages()) {
+        languages.push_back(language);
+    }
+    r[constants::MessageRegistryFile::LANGUAGES] = std::move(languages);
+    r[constants::MessageRegistryFile::REGISTRY] = file.get_registry();
+
+    json::Json locations = json::Json::value_t::array;
+    for (const auto& location : file.get_locations()) {
+        json::Json s = json::Json::value_t::object;
+
+        // All properties of file's location are not nullable in metadata, but they are not required, too.
+        // Therefore, if they have no values, they will not be displayed.
+        if (location.get_language().has_value()) {
+            s[constants::MessageRegistryFile::LANGUAGE] = location.get_language();
+        }
+        if (location.get_uri().has_value()) {
+            s[constants::MessageRegistryFile::URI] = location.get_uri();
+        }
+        if (location.get_archive_uri().has_value()) {
+            s[constants::MessageRegistryFile::ARCHIVE_URI] = location.get_archive_uri();
+        }
+        if (location.get_publication_uri().has_value()) {
+            s[constants::MessageRegistryFile::PUBLICATION_URI] = location.get_publication_uri();
+        }
+        if (location.get_archive_file().has_value()) {
+            s[constants::MessageRegistryFile::ARCHIVE_FILE] = location.get_archive_file();
+        }
+        locations.push_back(std::move(s));
+    }
+    r[constants::MessageRegistryFile::LOCATION] = std::move(locations);
+
+    return r;
+}
+
 } // namespace
 
-MessageRegistryFile::MessageRegistryFile(const std::string& path) : EndpointBase(path) {}
+MessageRegistryFile::MessageRegistryFile(const std::string& path) : EndpointBase(path) {
+    // Registry files are loaded before the endpoints are built and never change afterwards
+    for (const auto& file : registries::MessageRegistryFileManager::get_instance()->get_files()) {
+        const auto url = PathBuilder(constants::Routes::MESSAGE_REGISTRY_FILE_COLLECTION_PATH).append(file.get_id()).build();
+        server::StaticResourceStore::get_instance()->add(
+            url, server::ContentType::JSON, make_file_json(file, url, std::to_string(file.get_id())).dump());
+    }
+}
 
 MessageRegistryFile::~MessageRegistryFile() {}
 
 void MessageRegistryFile::get(const server::Request& request, server::Response& response) {
-    auto r = make_prototype();
-
-    r[constants::Common::ODATA_ID] = request.get_url();
-    r[constants::Common::ID] = request.params[constants::PathParam::MESSAGE_REGISTRY_FILE_ID];
+    if (set_static_response(request, response)) {
+        return;
+    }
 
     const auto& file_id = id_to_uint64(request.params[constants::PathParam::MESSAGE_REGISTRY_FILE_ID]);
 
     try {
         const auto& file = registries::MessageRegistryFileManager::get_instance()->get_file_by_id(file_id);
-
-        fill_name_and_description(file, r);
-
-        json::Json languages = json::Json::value_t::array;
-        for (const auto& language : file.get_languages()) {
-            languages.push_back(language);
-        }
-        r[constants::MessageRegistryFile::LANGUAGES] = std::move(languages);
-        r[constants::MessageRegistryFile::REGISTRY] = file.get_registry();
-
-        json::Json locations = json::Json::value_t::array;
-        for (const auto& location : file.get_locations()) {
-            json::Json s = json::Json::value_t::object;
-
-            // All properties of file's location are not nullable in metadata, but they are not required, too.
-            // Therefore, if they have no values, they will not be displayed.
-            if (location.get_language().has_value()) {
-                s[constants::MessageRegistryFile::LANGUAGE] = location.get_language();
-            }
-            if (location.get_uri().has_value()) {
-                s[constants::MessageRegistryFile::URI] = location.get_uri();
-            }
-            if (location.get_archive_uri().has_value()) {
-                s[constants::MessageRegistryFile::ARCHIVE_URI] = location.get_archive_uri();
-            }
-            if (location.get_publication_uri().has_value()) {
-                s[constants::MessageRegistryFile::PUBLICATION_URI] = location.get_publication_uri();
-            }
-            if (location.get_archive_file().has_value()) {
-                s[constants::MessageRegistryFile::ARCHIVE_FILE] = location.get_archive_file();
-            }
-            locations.push_back(std::move(s));
-        }
-        r[constants::MessageRegistryFile::LOCATION] = std::move(locations);
+        set_response(request, response,
+                     make_file_json(file, request.get_url(),
+                                    request.params[constants::PathParam::MESSAGE_REGISTRY_FILE_ID]));
     }
     catch (const std::out_of_range&) {
         throw agent_framework::exceptions::NotFound("Requested message registry file does not exist.");
     }
-
-    set_response(response, r);
 }
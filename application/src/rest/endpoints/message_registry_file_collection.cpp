@@ -23,8 +23,11 @@
 
 #include "psme/rest/endpoints/message_registry_file_collection.hpp"
 #include "psme/rest/constants/constants.hpp"
+#include "psme/rest/endpoints/utils.hpp"
 #include "psme/rest/registries/managers/message_registry_file_manager.hpp"
 
+#include <algorithm>
+
 using namespace psme::rest;
 using namespace psme::rest::endpoint;
 using namespace psme::rest::registries;
@@ -58,11 +61,12 @@ void MessageRegistryFileCollection::get(const server::Request& request, server::
     json[constants::Common::ODATA_ID] = PathBuilder(request).build();
     json[constants::Collection::ODATA_COUNT] = MessageRegistryFileManager::get_instance()->get_count();
 
+    std::vector<std::uint64_t> ids{};
     for (const auto& file : MessageRegistryFileManager::get_instance()->get_files()) {
-        json::Json link_elem(json::Json::value_t::object);
-        link_elem[constants::Common::ODATA_ID] = PathBuilder(request).append(file.get_id()).build();
-        json[constants::Collection::MEMBERS].push_back(std::move(link_elem));
+        ids.push_back(file.get_id());
     }
+    std::sort(ids.begin(), ids.end());
+    endpoint::utils::fill_collection_page(request, json, endpoint::utils::get_page_ids(request, ids));
 
-    set_response(response, json);
+    set_response(request, response, json);
 }
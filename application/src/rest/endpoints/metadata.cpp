@@ -24,6 +24,7 @@
 #include "psme/rest/endpoints/metadata.hpp"
 #include "psme/rest/metadata/metadata_manager.hpp"
 #include "psme/rest/server/content_types.hpp"
+#include "psme/rest/server/static_resource_store.hpp"
 
 #include "configuration/configuration.hpp"
 #include "logger/logger_factory.hpp"
@@ -31,11 +32,26 @@
 using namespace psme::rest;
 using namespace psme::rest::endpoint;
 
-Metadata::Metadata(const std::string& path) : EndpointBase(path) {}
+Metadata::Metadata(const std::string& path) : EndpointBase(path) {
+    using MetadataManager = psme::rest::metadata::MetadataManager;
+    using namespace psme::rest::server;
+
+    for (const auto& file : MetadataManager::get_files()) {
+        const auto url = PathBuilder(constants::PathParam::BASE_URL)
+                             .append(constants::PathParam::METADATA)
+                             .append(file)
+                             .build();
+        StaticResourceStore::get_instance()->add(url, ContentType::XML, MetadataManager::get_xml(file));
+    }
+}
 
 Metadata::~Metadata() {}
 
 void Metadata::get(const server::Request& req, server::Response& res) {
+    if (set_static_response(req, res)) {
+        return;
+    }
+
     using MetadataManager = psme::rest::metadata::MetadataManager;
     using namespace psme::rest::server;
     using namespace constants::Metadata;
@@ -26,6 +26,7 @@
 
 #include "psme/rest/metadata/metadata_manager.hpp"
 #include "psme/rest/server/content_types.hpp"
+#include "psme/rest/server/static_resource_store.hpp"
 
 #include "configuration/configuration.hpp"
 #include "logger/logger_factory.hpp"
@@ -33,11 +34,21 @@
 using namespace psme::rest;
 using namespace psme::rest::endpoint;
 
-MetadataRoot::MetadataRoot(const std::string& path) : EndpointBase(path) {}
+MetadataRoot::MetadataRoot(const std::string& path) : EndpointBase(path) {
+    using MetadataManager = psme::rest::metadata::MetadataManager;
+    using namespace psme::rest::server;
+
+    StaticResourceStore::get_instance()->add(path, ContentType::XML,
+                                             MetadataManager::get_xml(constants::Metadata::METADATA_ROOT_FILE));
+}
 
 MetadataRoot::~MetadataRoot() {}
 
-void MetadataRoot::get(const server::Request&, server::Response& res) {
+void MetadataRoot::get(const server::Request& req, server::Response& res) {
+    if (set_static_response(req, res)) {
+        return;
+    }
+
     using MetadataManager = psme::rest::metadata::MetadataManager;
     using namespace psme::rest::server;
     using namespace constants::Metadata;
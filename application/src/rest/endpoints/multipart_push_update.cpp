@@ -0,0 +1,266 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/endpoints/multipart_push_update.hpp"
+#include "context.hpp"
+#include "psme/rest/endpoints/task_service/monitor_content_builder.hpp"
+#include "psme/rest/endpoints/task_service/task_service_utils.hpp"
+#include "psme/rest/server/error/error_factory.hpp"
+#include "psme/rest/server/http_headers.hpp"
+#include "psme/rest/server/multipart_parser.hpp"
+
+#include "logger/logger_factory.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace psme::rest;
+using namespace psme::rest::constants;
+using namespace psme::rest::error;
+using namespace psme::rest::server;
+
+namespace {
+
+/*! @brief Package data is written to the staging area in pieces of this size */
+constexpr std::size_t WRITE_BUFFER_SIZE = 1024 * 1024;
+
+/*! @brief Maximum size of the UpdateParameters part */
+constexpr std::size_t MAX_PARAMETERS_SIZE = 1024;
+
+std::string get_system_error(const std::string& message) {
+    return message + ": " + std::strerror(errno);
+}
+
+/*!
+ * @brief Multipart body of a push update, the UpdateFile part is written to
+ * the staging area reserved for the update.
+ */
+class PackageUpload : public UploadStream {
+public:
+    PackageUpload(const std::string& content_type, const std::string& path, std::uint64_t max_size)
+        : m_parser{content_type}, m_path{path}, m_max_size{max_size} {
+        m_parser.set_callbacks([this](const MultipartParser::Part& part) { on_part(part); },
+                               [this](const char* data, std::size_t size) { on_data(data, size); },
+                               [this]() { on_part_end(); });
+        m_fd = ::open(m_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+        if (m_fd < 0) {
+            throw ServerException(ErrorFactory::create_internal_error(get_system_error("Cannot create " + m_path)));
+        }
+        m_buffer.reserve(WRITE_BUFFER_SIZE);
+    }
+
+    PackageUpload(const PackageUpload&) = delete;
+    PackageUpload& operator=(const PackageUpload&) = delete;
+
+    ~PackageUpload() override {
+        abort();
+    }
+
+    void write(const char* data, std::size_t size) override {
+        m_parser.parse(data, size);
+    }
+
+    void abort() override {
+        if (m_finished) {
+            return;
+        }
+        m_finished = true;
+        close_file();
+        log_warning("rest", "Push update aborted, " << m_written << " bytes of the package were received.");
+        Context::get_instance()->service->release_ipu_update();
+    }
+
+    /*!
+     * @brief Complete the package and start the update.
+     * @return UUID of the update task.
+     */
+    std::string finish() {
+        if (!m_parser.is_complete()) {
+            throw ServerException(ErrorFactory::create_invalid_payload_error("Multipart body is incomplete."));
+        }
+        if (!m_file_received) {
+            throw ServerException(ErrorFactory::create_property_missing_error(UpdateService::UPDATE_FILE));
+        }
+        validate_parameters();
+        flush();
+        if (0 != ::fdatasync(m_fd)) {
+            throw ServerException(ErrorFactory::create_internal_error(get_system_error("Cannot write " + m_path)));
+        }
+        close_file();
+
+        // From now on the update task owns the staging area
+        std::string task_uuid{};
+        Context::get_instance()->service->trigger_ipu_push_update(task_uuid);
+        m_finished = true;
+        log_info("rest", "Received " << m_written << " bytes of the update package.");
+        return task_uuid;
+    }
+
+private:
+    enum class Target {
+        NONE,
+        PARAMETERS,
+        FILE
+    };
+
+    void on_part(const MultipartParser::Part& part) {
+        if (UpdateService::UPDATE_FILE == part.name) {
+            if (m_file_received) {
+                throw ServerException(ErrorFactory::create_property_duplicated_error(UpdateService::UPDATE_FILE));
+            }
+            m_target = Target::FILE;
+        }
+        else if (UpdateService::UPDATE_PARAMETERS == part.name) {
+            m_target = Target::PARAMETERS;
+            m_parameters.clear();
+        }
+        else {
+            log_debug("rest", "Ignoring part " << part.name << " of the push update.");
+            m_target = Target::NONE;
+        }
+    }
+
+    void on_data(const char* data, std::size_t size) {
+        if (Target::PARAMETERS == m_target) {
+            if (m_parameters.size() + size > MAX_PARAMETERS_SIZE) {
+                throw ServerException(ErrorFactory::create_invalid_payload_error(
+                    std::string{UpdateService::UPDATE_PARAMETERS} + " are too large."));
+            }
+            m_parameters.append(data, size);
+        }
+        else if (Target::FILE == m_target) {
+            if (m_written + size > m_max_size) {
+                throw ServerException(ErrorFactory::create_payload_too_large_error());
+            }
+            m_written += size;
+            while (size > 0) {
+                const auto piece = std::min(size, WRITE_BUFFER_SIZE - m_buffer.size());
+                m_buffer.insert(m_buffer.end(), data, data + piece);
+                data += piece;
+                size -= piece;
+                if (m_buffer.size() == WRITE_BUFFER_SIZE) {
+                    flush();
+                }
+            }
+        }
+    }
+
+    void on_part_end() {
+        if (Target::FILE == m_target) {
+            m_file_received = true;
+        }
+        m_target = Target::NONE;
+    }
+
+    void validate_parameters() const {
+        if (m_parameters.empty()) {
+            return;
+        }
+        json::Json parameters{};
+        try {
+            parameters = json::Json::parse(m_parameters);
+        }
+        catch (const json::Json::parse_error&) {
+            throw ServerException(ErrorFactory::create_malformed_json_error(
+                std::string{UpdateService::UPDATE_PARAMETERS} + " are not valid JSON."));
+        }
+        if (!parameters.is_object()) {
+            throw ServerException(ErrorFactory::create_property_type_error(
+                UpdateService::UPDATE_PARAMETERS, m_parameters, "object"));
+        }
+    }
+
+    void flush() {
+        std::size_t offset = 0;
+        while (offset < m_buffer.size()) {
+            const auto written = ::write(m_fd, m_buffer.data() + offset, m_buffer.size() - offset);
+            if (written < 0) {
+                if (EINTR == errno) {
+                    continue;
+                }
+                throw ServerException(ErrorFactory::create_internal_error(get_system_error("Cannot write " + m_path)));
+            }
+            offset += static_cast<std::size_t>(written);
+        }
+        m_buffer.clear();
+    }
+
+    void close_file() {
+        if (m_fd >= 0) {
+            ::close(m_fd);
+            m_fd = -1;
+        }
+    }
+
+    MultipartParser m_parser;
+    std::string m_path;
+    std::uint64_t m_max_size;
+    int m_fd{-1};
+    std::vector<char> m_buffer{};
+    std::uint64_t m_written{};
+    Target m_target{Target::NONE};
+    std::string m_parameters{};
+    bool m_file_received{false};
+    bool m_finished{false};
+};
+
+std::uint64_t get_content_length(const Request& request) {
+    const auto value = request.get_header(http_headers::ContentLength::CONTENT_LENGTH);
+    if (value.empty()) {
+        return 0;
+    }
+    try {
+        return std::stoull(value);
+    }
+    catch (const std::exception&) {
+        throw ServerException(ErrorFactory::create_invalid_payload_error("Invalid Content-Length."));
+    }
+}
+
+} // namespace
+
+endpoint::MultipartPushUpdate::MultipartPushUpdate(const std::string& path) : EndpointBase(path) {}
+
+endpoint::MultipartPushUpdate::~MultipartPushUpdate() {}
+
+std::shared_ptr<UploadStream> endpoint::MultipartPushUpdate::open_upload(const server::Request& request) {
+    const auto content_type = request.get_header(http_headers::ContentType::CONTENT_TYPE);
+    // Refuse a malformed request before the staging area is reserved
+    MultipartParser{content_type};
+
+    auto package_size = get_content_length(request);
+    const auto& service = Context::get_instance()->service;
+    const auto path = service->reserve_ipu_update(package_size);
+    try {
+        return std::make_shared<PackageUpload>(content_type, path, package_size);
+    }
+    catch (...) {
+        service->release_ipu_update();
+        throw;
+    }
+}
+
+void endpoint::MultipartPushUpdate::post(const server::Request& request, server::Response& response) {
+    const auto upload = std::dynamic_pointer_cast<PackageUpload>(request.get_upload());
+    if (!upload) {
+        throw ServerException(ErrorFactory::create_invalid_payload_error("Update package was not received."));
+    }
+    const auto task_uuid = upload->finish();
+
+    auto response_renderer = [](json::Json /*in_json*/) -> server::Response {
+        Response r{};
+        r.set_status(server::status_2XX::NO_CONTENT);
+        return r;
+    };
+
+    MonitorContentBuilder::get_instance()->add_builder(task_uuid, response_renderer);
+
+    std::string task_monitor_url = utils::get_task_monitor_url(task_uuid);
+    psme::rest::endpoint::utils::set_location_header(request, response, task_monitor_url);
+    response.set_body(psme::rest::endpoint::task_service_utils::call_task_get(task_uuid).get_body());
+    response.set_status(server::status_2XX::ACCEPTED);
+}
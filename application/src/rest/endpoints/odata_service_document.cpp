@@ -37,7 +37,8 @@ static std::vector<std::pair<std::string, std::string>> RESOURCES{
     {Root::MANAGERS, Routes::MANAGER_COLLECTION_PATH},
     {Root::TASKS, Routes::TASK_SERVICE_PATH},
     {Root::REGISTRIES, Routes::MESSAGE_REGISTRY_FILE_COLLECTION_PATH},
-    {Root::UPDATE_SERVICE, Routes::UPDATE_SERVICE_PATH}};
+    {Root::UPDATE_SERVICE, Routes::UPDATE_SERVICE_PATH},
+    {Root::EVENT_SERVICE, Routes::EVENT_SERVICE_PATH}};
 
 json::Json make_prototype() {
     json::Json r = json::Json();
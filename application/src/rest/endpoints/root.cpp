@@ -26,6 +26,7 @@
 
 #include "psme/rest/constants/constants.hpp"
 #include "psme/rest/endpoints/root.hpp"
+#include "psme/rest/server/static_resource_store.hpp"
 
 using namespace psme::rest;
 using namespace psme::rest::constants;
@@ -45,27 +46,48 @@ json::Json make_prototype() {
     r[Root::SESSION_SERVICE][Common::ODATA_ID] = "/redfish/v1/SessionService";
     r[Root::UPDATE_SERVICE][Common::ODATA_ID] = "/redfish/v1/UpdateService";
     r[Root::TASKS][Common::ODATA_ID] = "/redfish/v1/TaskService";
+    r[Root::EVENT_SERVICE][Common::ODATA_ID] = "/redfish/v1/EventService";
     r[Root::REGISTRIES][Common::ODATA_ID] = "/redfish/v1/Registries";
     r[Root::SYSTEMS][Common::ODATA_ID] = "/redfish/v1/Systems";
     r[Root::MANAGERS][Common::ODATA_ID] = "/redfish/v1/Managers";
     r[Root::ACCOUNT_SERVICE][Common::ODATA_ID] = "/redfish/v1/AccountService";
     r[Common::LINKS][SessionService::SESSIONS][Common::ODATA_ID] = "/redfish/v1/SessionService/Sessions";
+
+    auto& expand = r[Root::PROTOCOL_FEATURES_SUPPORTED][ProtocolFeatures::EXPAND_QUERY];
+    expand[ProtocolFeatures::EXPAND_ALL] = true;
+    expand[ProtocolFeatures::LEVELS] = true;
+    expand[ProtocolFeatures::LINKS] = true;
+    expand[ProtocolFeatures::NO_LINKS] = true;
+    expand[ProtocolFeatures::MAX_LEVELS] = server::QueryOptions::MAX_EXPAND_LEVELS;
+    r[Root::PROTOCOL_FEATURES_SUPPORTED][ProtocolFeatures::SELECT_QUERY] = true;
+    r[Root::PROTOCOL_FEATURES_SUPPORTED][ProtocolFeatures::TOP_SKIP_QUERY] = true;
+    r[Root::PROTOCOL_FEATURES_SUPPORTED][ProtocolFeatures::FILTER_QUERY] = true;
     return r;
 }
+
+json::Json make_service_root(const std::string& service_root_name) {
+    auto json = make_prototype();
+
+    json[Common::UUID] = agent_framework::module::ServiceUuid::get_instance()->get_service_uuid();
+    json[Common::NAME] = service_root_name;
+    return json;
+}
 } // namespace
 
 endpoint::Root::Root(const std::string& path) : EndpointBase(path) {
     const auto& config = configuration::Configuration::get_instance().to_json();
     m_service_root_name = config.value("service", json::Json()).get<std::string>();
+
+    server::StaticResourceStore::get_instance()->add(path, server::ContentType::JSON,
+                                                     make_service_root(m_service_root_name).dump());
 }
 
 endpoint::Root::~Root() {}
 
-void endpoint::Root::get(const server::Request&, server::Response& response) {
-    auto json = make_prototype();
-
-    json[Common::UUID] = agent_framework::module::ServiceUuid::get_instance()->get_service_uuid();
-    json[Common::NAME] = m_service_root_name;
+void endpoint::Root::get(const server::Request& request, server::Response& response) {
+    if (set_static_response(request, response)) {
+        return;
+    }
 
-    set_response(response, json);
+    set_response(request, response, make_service_root(m_service_root_name));
 }
@@ -67,7 +67,7 @@ void endpoint::Session::get(const server::Request& request, server::Response& re
     const auto& session = SessionManager::get_instance()->get(id);
 
     session.fill_json(r);
-    set_response(response, r);
+    set_response(request, response, r);
 }
 
 void endpoint::Session::del(const server::Request& request, server::Response& response) {
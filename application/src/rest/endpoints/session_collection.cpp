@@ -58,6 +58,24 @@ json::Json make_prototype() {
     return r;
 }
 
+std::vector<std::uint64_t> get_filtered_ids(const server::Filter& filter) {
+    endpoint::utils::validate_filter_properties(filter, {Common::ID, constants::Session::USER_NAME});
+
+    std::vector<std::uint64_t> ids{};
+    session::SessionManager::get_instance()->for_each([&filter, &ids](const session::Session& session) {
+        const auto matches = filter.evaluate([&session](const std::string& name) -> json::Json {
+            if (Common::ID == name) {
+                return std::to_string(session.get_id());
+            }
+            return session.get_user_name();
+        });
+        if (matches) {
+            ids.push_back(session.get_id());
+        }
+    });
+    return ids;
+}
+
 } // namespace
 
 SessionCollection::SessionCollection(const std::string& path) : EndpointBase(path) {}
@@ -66,16 +84,21 @@ SessionCollection::~SessionCollection() {}
 
 void SessionCollection::get(const server::Request& req, server::Response& res) {
     auto r = ::make_prototype();
-    uint32_t number = 0;
     r[Common::ODATA_ID] = PathBuilder(req).build();
-    session::SessionManager::get_instance()->for_each([&r, &req, &number](const session::Session& session) {
-        json::Json link_elem(json::Json::value_t::object);
-        link_elem[Common::ODATA_ID] = PathBuilder(req).append(session.get_id()).build();
-        r[Collection::MEMBERS].push_back(std::move(link_elem));
-        number++;
-    });
-    r[Collection::ODATA_COUNT] = number;
-    set_response(res, r);
+
+    const auto& options = req.get_query_options();
+    const auto* session_manager = session::SessionManager::get_instance();
+    if (options.has_filter()) {
+        const auto ids = ::get_filtered_ids(options.get_filter());
+        r[Collection::ODATA_COUNT] = std::uint32_t(ids.size());
+        endpoint::utils::fill_collection_page(req, r, endpoint::utils::get_page_ids(req, ids));
+    }
+    else {
+        r[Collection::ODATA_COUNT] = std::uint32_t(session_manager->get_count());
+        endpoint::utils::fill_collection_page(
+            req, r, session_manager->get_ids(options.get_skip_token(), options.get_skip(), options.get_page_size() + 1));
+    }
+    set_response(req, res, r);
 }
 
 void SessionCollection::post(const server::Request& request, server::Response& response) {
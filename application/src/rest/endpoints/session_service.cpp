@@ -82,7 +82,7 @@ void endpoint::SessionService::get(const server::Request& request, server::Respo
 
     r[Common::ODATA_ID] = PathBuilder(request).build();
 
-    set_response(response, r);
+    set_response(request, response, r);
 }
 
 void endpoint::SessionService::patch(const server::Request& request, server::Response& response) {
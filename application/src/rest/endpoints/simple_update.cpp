@@ -55,8 +55,13 @@ void endpoint::SimpleUpdate::post(const server::Request& request, server::Respon
         password = json[constants::UpdateService::PASSWORD];
     }
 
+    OptionalField<std::string> image_sha256{};
+    if (json.contains(constants::UpdateService::IMAGE_SHA256)) {
+        image_sha256 = json[constants::UpdateService::IMAGE_SHA256];
+    }
+
     std::string task_uuid;
-    Context::get_instance()->service->trigger_ipu_update(image_uri, username, password, task_uuid);
+    Context::get_instance()->service->trigger_ipu_update(image_uri, username, password, image_sha256, task_uuid);
 
     auto response_renderer = [](json::Json /*in_json*/) -> server::Response {
         Response r{};
@@ -80,5 +80,5 @@ void endpoint::SimpleUpdateActionInfo::get(const server::Request& request, serve
     // r[ActionInfo::PARAMETERS].push_back(std::move(transfer_protocol));
     // r[ActionInfo::PARAMETERS].push_back(std::move(targets));
 
-    set_response(response, r);
+    set_response(request, response, r);
 }
@@ -134,8 +134,11 @@ void endpoint::System::get(const server::Request& request, server::Response& res
     r[Common::ODATA_ID] = PathBuilder(request).build();
 
     auto system = psme::rest::model::find<agent_framework::model::System>(request.params).get();
+    const auto& options = request.get_query_options();
 
-    make_parent_links(system, r);
+    if (options.is_selected(Common::LINKS)) {
+        make_parent_links(system, r);
+    }
 
     r[constants::Common::ODATA_ID] = PathBuilder(request).build();
     r[constants::Common::ID] = request.params[PathParam::SYSTEM_ID];
@@ -154,35 +157,38 @@ void endpoint::System::get(const server::Request& request, server::Response& res
     r[constants::Common::SKU] = system.get_sku();
     r[constants::Common::ASSET_TAG] = system.get_asset_tag();
     r[constants::System::INDICATOR_LED] = system.get_indicator_led();
-    r[constants::System::BOOT][constants::System::BOOT_SOURCE_OVERRIDE_TARGET] =
-        system.get_boot_override_target();
+    if (options.is_selected(constants::System::BOOT)) {
+        r[constants::System::BOOT][constants::System::BOOT_SOURCE_OVERRIDE_TARGET] =
+            system.get_boot_override_target();
 
-    r[constants::System::BOOT][constants::System::BOOT_SOURCE_OVERRIDE_ENABLED] =
-        system.get_boot_override();
+        r[constants::System::BOOT][constants::System::BOOT_SOURCE_OVERRIDE_ENABLED] =
+            system.get_boot_override();
 
-    r[constants::System::BOOT][constants::System::BOOT_SOURCE_OVERRIDE_MODE] =
-        system.get_boot_override_mode();
+        r[constants::System::BOOT][constants::System::BOOT_SOURCE_OVERRIDE_MODE] =
+            system.get_boot_override_mode();
 
-    for (const auto& allowable : system.get_boot_override_target_supported()) {
-        r[constants::System::BOOT][constants::System::BOOT_SOURCE_OVERRIDE_TARGET_ALLOWABLE_VALUES]
-            .push_back(allowable.to_string());
-    }
+        for (const auto& allowable : system.get_boot_override_target_supported()) {
+            r[constants::System::BOOT][constants::System::BOOT_SOURCE_OVERRIDE_TARGET_ALLOWABLE_VALUES]
+                .push_back(allowable.to_string());
+        }
 
-    for (const auto& allowable : system.get_boot_override_supported()) {
-        r[constants::System::BOOT][constants::System::BOOT_SOURCE_OVERRIDE_ENABLED_ALLOWABLE_VALUES]
-            .push_back(allowable.to_string());
+        for (const auto& allowable : system.get_boot_override_supported()) {
+            r[constants::System::BOOT][constants::System::BOOT_SOURCE_OVERRIDE_ENABLED_ALLOWABLE_VALUES]
+                .push_back(allowable.to_string());
+        }
     }
 
     auto system_type = system.get_system_type();
-    if (system_type == agent_framework::model::enums::SystemType::Physical ||
-        system_type == agent_framework::model::enums::SystemType::DPU) {
+    if ((system_type == agent_framework::model::enums::SystemType::Physical ||
+         system_type == agent_framework::model::enums::SystemType::DPU) &&
+        options.is_selected(Common::ACTIONS)) {
         add_reset_action(request, r);
     }
 
     r[constants::Common::VIRTUAL_MEDIA][Common::ODATA_ID] =
         PathBuilder(request).append(constants::Common::VIRTUAL_MEDIA).build();
 
-    set_response(response, r);
+    set_response(request, response, r);
 }
 
 void endpoint::System::patch(const server::Request& request, server::Response& response) {
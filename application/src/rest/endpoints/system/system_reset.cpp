@@ -24,6 +24,8 @@
 #include "psme/rest/endpoints/system/system_reset.hpp"
 #include "context.hpp"
 #include "psme/rest/constants/constants.hpp"
+#include "psme/rest/endpoints/task_service/monitor_content_builder.hpp"
+#include "psme/rest/endpoints/task_service/task_service_utils.hpp"
 #include "psme/rest/server/error/error_factory.hpp"
 #include "psme/rest/validators/json_validator.hpp"
 #include "psme/rest/validators/schemas/reset.hpp"
@@ -55,7 +57,19 @@ void endpoint::SystemReset::post(const server::Request& request, server::Respons
                     .build()));
     }
 
-    Context::get_instance()->service->trigger_acc_reset(reset_type_enum);
+    std::string task_uuid{};
+    Context::get_instance()->service->trigger_acc_reset(reset_type_enum, task_uuid);
 
-    response.set_status(server::status_2XX::NO_CONTENT);
+    auto response_renderer = [](json::Json /*in_json*/) -> server::Response {
+        Response r{};
+        r.set_status(server::status_2XX::NO_CONTENT);
+        return r;
+    };
+
+    MonitorContentBuilder::get_instance()->add_builder(task_uuid, response_renderer);
+
+    std::string task_monitor_url = utils::get_task_monitor_url(task_uuid);
+    psme::rest::endpoint::utils::set_location_header(request, response, task_monitor_url);
+    response.set_body(psme::rest::endpoint::task_service_utils::call_task_get(task_uuid).get_body());
+    response.set_status(server::status_2XX::ACCEPTED);
 }
@@ -23,6 +23,7 @@
 
 #include "psme/rest/endpoints/system/systems_collection.hpp"
 #include "psme/rest/constants/constants.hpp"
+#include "psme/rest/endpoints/utils.hpp"
 
 using namespace psme::rest::endpoint;
 using namespace psme::rest::constants;
@@ -55,11 +56,7 @@ void SystemsCollection::get(const server::Request& req, server::Response& res) {
 
     json[Collection::ODATA_COUNT] = std::uint32_t(system_ids.size());
 
-    for (const auto& id : system_ids) {
-        json::Json link = json::Json();
-        link[Common::ODATA_ID] = PathBuilder(req).append(id).build();
-        json[Collection::MEMBERS].push_back(std::move(link));
-    }
+    endpoint::utils::fill_collection_page(req, json, endpoint::utils::get_page_ids(req, system_ids));
 
-    set_response(res, json);
+    set_response(req, res, json);
 }
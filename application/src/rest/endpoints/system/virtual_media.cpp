@@ -4,6 +4,7 @@
 #include "psme/rest/endpoints/system/virtual_media.hpp"
 #include "agent-framework/module/common_components.hpp"
 #include "psme/rest/constants/constants.hpp"
+#include "psme/rest/utils/status_helpers.hpp"
 
 using namespace psme::rest;
 
@@ -19,6 +20,8 @@ json::Json make_prototype() {
     r[constants::VirtualMedia::MEDIA_TYPES] = json::Json::value_t::array;
     r[constants::VirtualMedia::IMAGE_NAME] = json::Json::value_t::null;
     r[constants::VirtualMedia::INSERTED] = json::Json::value_t::null;
+    r[constants::Common::STATUS][constants::Common::STATE] = json::Json::value_t::null;
+    r[constants::Common::STATUS][constants::Common::HEALTH] = json::Json::value_t::null;
     r[constants::Common::ACTIONS] = json::Json::value_t::object;
     return r;
 }
@@ -39,6 +42,7 @@ void VirtualMedia::get(const server::Request& request, server::Response& respons
     r[constants::VirtualMedia::MEDIA_TYPES].push_back(media.get_media_type().to_string());
     r[constants::VirtualMedia::IMAGE_NAME] = media.get_image_name();
     r[constants::VirtualMedia::INSERTED] = media.get_inserted();
+    endpoint::status_to_json(media, r, false);
     r[constants::Common::ODATA_ID] = PathBuilder(request).build();
 
     json::Json insert;
@@ -59,7 +63,7 @@ void VirtualMedia::get(const server::Request& request, server::Response& respons
 
         r[constants::Common::ACTIONS][constants::VirtualMedia::HASH_VIRTUAL_MEDIA_EJECT] = std::move(eject);
     }
-    set_response(response, r);
+    set_response(request, response, r);
 }
 
 } // namespace endpoint
@@ -4,6 +4,7 @@
 #include "psme/rest/endpoints/system/virtual_media_collection.hpp"
 #include "agent-framework/module/common_components.hpp"
 #include "psme/rest/constants/constants.hpp"
+#include "psme/rest/endpoints/utils.hpp"
 
 using namespace psme::rest;
 using namespace agent_framework::model;
@@ -40,13 +41,9 @@ void VirtualMediaCollection::get(const server::Request& request, server::Respons
 
     r[constants::Collection::ODATA_COUNT] = std::uint32_t(media_ids.size());
 
-    for (const auto& media_id : media_ids) {
-        json::Json link(json::Json::value_t::object);
-        link[constants::Common::ODATA_ID] = PathBuilder(request).append(media_id).build();
-        r[constants::Collection::MEMBERS].push_back(std::move(link));
-    }
+    utils::fill_collection_page(request, r, utils::get_page_ids(request, media_ids));
 
-    set_response(response, r);
+    set_response(request, response, r);
 }
 
 } // namespace endpoint
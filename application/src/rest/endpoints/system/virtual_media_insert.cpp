@@ -44,9 +44,14 @@ void VirtualMediaInsert::post(const server::Request& request, server::Response&
         password = json[constants::VirtualMediaInsert::PASSWORD];
     }
 
+    OptionalField<std::string> image_sha256{};
+    if (json.contains(constants::VirtualMediaInsert::IMAGE_SHA256)) {
+        image_sha256 = json[constants::VirtualMediaInsert::IMAGE_SHA256];
+    }
+
     std::string task_uuid{};
 
-    Context::get_instance()->service->insert_virtual_media(img, transfer_method_enum, username, password, task_uuid);
+    Context::get_instance()->service->insert_virtual_media(img, transfer_method_enum, username, password, image_sha256, task_uuid);
 
     auto response_renderer = [](json::Json /*in_json*/) -> server::Response {
         Response r{};
@@ -28,19 +28,37 @@
 #include "psme/rest/endpoints/task_service/monitor.hpp"
 #include "psme/rest/endpoints/task_service/monitor_content_builder.hpp"
 #include "psme/rest/endpoints/task_service/task_service_utils.hpp"
+#include "psme/rest/eventing/event_dispatcher.hpp"
 #include "psme/rest/server/error/error_factory.hpp"
+#include "psme/rest/server/http_headers.hpp"
 #include "psme/rest/utils/status_helpers.hpp"
 
 #include "agent-framework/action/task_result_manager.hpp"
 
+#include <regex>
+
 using namespace psme::rest;
 using namespace psme::rest::constants;
 
-endpoint::Monitor::Monitor(const std::string& path) : EndpointBase(path) {}
+constexpr std::chrono::seconds endpoint::Monitor::MAX_WAIT;
 
-endpoint::Monitor::~Monitor() {}
+namespace {
 
-void endpoint::Monitor::get(const server::Request& request, server::Response& response) {
+/*! @brief Get time the client is willing to wait for a change of the task, 0 if not given */
+std::chrono::seconds get_preferred_wait(const server::Request& request) {
+    static const std::regex wait_preference{
+        std::string{"(^|[,;])\\s*"} + server::http_headers::Prefer::WAIT + "\\s*=\\s*\"?([0-9]{1,9})\"?",
+        std::regex::icase};
+
+    const auto prefer = request.get_header(server::http_headers::Prefer::PREFER);
+    std::smatch match{};
+    if (!std::regex_search(prefer, match, wait_preference)) {
+        return std::chrono::seconds{0};
+    }
+    return std::min(std::chrono::seconds{std::stol(match[2].str())}, endpoint::Monitor::MAX_WAIT);
+}
+
+void respond(const server::Request& request, server::Response& response) {
     auto monitored_task = model::find<agent_framework::model::Task>(request.params).get();
 
     // If the task has finished, retrieve its result from the agent, otherwise return 202 Accepted
@@ -60,3 +78,30 @@ void endpoint::Monitor::get(const server::Request& request, server::Response& re
         psme::rest::endpoint::utils::set_location_header(request, response, request.get_url());
     }
 }
+
+} // namespace
+
+endpoint::Monitor::Monitor(const std::string& path) : EndpointBase(path) {}
+
+endpoint::Monitor::~Monitor() {}
+
+void endpoint::Monitor::get(const server::Request& request, server::Response& response) {
+    const auto wait = server::Method::GET == request.get_method() ? get_preferred_wait(request) : std::chrono::seconds{0};
+    if (0 != wait.count()) {
+        const auto uuid = model::find<agent_framework::model::Task>(request.params).get_uuid();
+        auto watch = eventing::EventDispatcher::get_instance()->watch(
+            uuid, wait, [request, wait](server::Response& deferred) {
+                respond(request, deferred);
+                // The client learns the wait it asked for was honored, and for how long at most
+                deferred.set_header(server::http_headers::Prefer::PREFERENCE_APPLIED,
+                                    std::string{server::http_headers::Prefer::WAIT} + "=" + std::to_string(wait.count()));
+            });
+        // Checked once the watch is registered, so that completion in between is not missed
+        if (!model::find<agent_framework::model::Task>(request.params).get().get_end_time().has_value()) {
+            // The connection is held until the task changes or the wait elapses
+            response.set_deferred(std::move(watch));
+            return;
+        }
+    }
+    respond(request, response);
+}
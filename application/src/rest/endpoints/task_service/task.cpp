@@ -69,6 +69,17 @@ void endpoint::Task::get(const server::Request& request, server::Response& respo
     if (s.get_start_time().has_value()) {
         r[constants::Task::START_TIME] = s.get_start_time();
     }
+    if (s.get_percent_complete().has_value()) {
+        r[constants::Task::PERCENT_COMPLETE] = s.get_percent_complete();
+    }
+    // Progress of a data transfer has no standard properties
+    if (s.get_bytes_transferred().has_value()) {
+        json::Json& intel = r[constants::Common::OEM][constants::Common::INTEL];
+        intel[constants::Common::ODATA_TYPE] = "#IntelTask.v1_0_0.Task";
+        intel[constants::Task::BYTES_TRANSFERRED] = s.get_bytes_transferred();
+        intel[constants::Task::TOTAL_BYTES] = s.get_total_bytes();
+        intel[constants::Task::ESTIMATED_REMAINING_SECONDS] = s.get_estimated_remaining_seconds();
+    }
 
     // in metadata, TaskStatus has values from Health enum
     r[constants::Task::TASK_STATUS] = s.get_status().get_health();
@@ -95,7 +106,7 @@ void endpoint::Task::get(const server::Request& request, server::Response& respo
         r[constants::Task::MESSAGES].push_back(p);
     }
 
-    set_response(response, r);
+    set_response(request, response, r);
 }
 
 [[noreturn]] void endpoint::Task::del(const server::Request& request, server::Response&) {
@@ -45,13 +45,37 @@ json::Json make_prototype() {
 
     return r;
 }
+
+using TaskFilterProperties = endpoint::utils::FilterProperties<agent_framework::model::Task>;
+
+const TaskFilterProperties& get_filter_properties() {
+    static const TaskFilterProperties properties = {
+        {Common::ID, {[](const agent_framework::model::Task& task) -> json::Json {
+             return std::to_string(task.get_id());
+         }, false}},
+        {constants::Task::TASK_STATE, {[](const agent_framework::model::Task& task) -> json::Json {
+             return task.get_state();
+         }, true}},
+        {constants::Task::TASK_STATUS, {[](const agent_framework::model::Task& task) -> json::Json {
+             return task.get_status().get_health();
+         }, false}},
+        {constants::Task::START_TIME, {[](const agent_framework::model::Task& task) -> json::Json {
+             return task.get_start_time();
+         }, false}},
+        {constants::Task::END_TIME, {[](const agent_framework::model::Task& task) -> json::Json {
+             return task.get_end_time();
+         }, false}}};
+    return properties;
+}
 } // namespace
 
 namespace psme {
 namespace rest {
 namespace endpoint {
 
-TaskCollection::TaskCollection(const std::string& path) : EndpointBase(path) {}
+TaskCollection::TaskCollection(const std::string& path) : EndpointBase(path) {
+    endpoint::utils::add_filter_indexes(get_manager<agent_framework::model::Task>(), ::get_filter_properties());
+}
 
 TaskCollection::~TaskCollection() {}
 
@@ -59,16 +83,20 @@ void TaskCollection::get(const server::Request& req, server::Response& res) {
     auto json = ::make_prototype();
     json[Common::ODATA_ID] = PathBuilder(req).build();
 
-    const auto& tasks_ids = get_manager<agent_framework::model::Task>().get_ids();
-    json[Collection::ODATA_COUNT] = std::uint32_t(tasks_ids.size());
-
-    for (const auto& id : tasks_ids) {
-        json::Json link = json::Json();
-        link[Common::ODATA_ID] = PathBuilder(req).append(id).build();
-        json[Collection::MEMBERS].push_back(std::move(link));
+    const auto& options = req.get_query_options();
+    auto& task_manager = get_manager<agent_framework::model::Task>();
+    if (options.has_filter()) {
+        const auto ids = endpoint::utils::get_filtered_ids(options.get_filter(), task_manager, ::get_filter_properties());
+        json[Collection::ODATA_COUNT] = std::uint32_t(ids.size());
+        endpoint::utils::fill_collection_page(req, json, endpoint::utils::get_page_ids(req, ids));
+    }
+    else {
+        json[Collection::ODATA_COUNT] = std::uint32_t(task_manager.get_entry_count());
+        endpoint::utils::fill_collection_page(
+            req, json, task_manager.get_ids(options.get_skip_token(), options.get_skip(), options.get_page_size() + 1));
     }
 
-    set_response(res, json);
+    set_response(req, res, json);
 }
 
 } // namespace endpoint
@@ -66,7 +66,7 @@ void TaskService::get(const server::Request& req, server::Response& res) {
     r[Common::ODATA_ID] = PathBuilder(req).build();
     r[psme::rest::constants::TaskService::DATETIME] = agent_framework::utils::make_iso_8601_timestamp();
 
-    set_response(res, r);
+    set_response(req, res, r);
 }
 
 } // namespace endpoint
@@ -46,6 +46,7 @@ json::Json make_prototype() {
     r[Common::STATUS][Common::HEALTH_ROLLUP] = "OK";
 
     r[Common::SERVICE_ENABLED] = true;
+    r[UpdateService::MULTIPART_HTTP_PUSH_URI] = json::Json::value_t::null;
 
     json::Json simple_update(json::Json::value_t::object);
     simple_update[Common::TARGET] = json::Json::value_t::null;
@@ -69,6 +70,8 @@ void endpoint::UpdateService::get(const server::Request& request, server::Respon
         PathBuilder(request).append(Common::ACTIONS).append(constants::UpdateService::UPDATE_SERVICE_SIMPLE_UPDATE).build();
     r[Common::ACTIONS][constants::UpdateService::HASH_UPDATE_SERVICE_SIMPLE_UPDATE][ActionInfo::REDFISH_ACTION_INFO] =
         PathBuilder(request).append(constants::UpdateService::SIMPLE_UPDATE_ACTION_INFO).build();
+    r[constants::UpdateService::MULTIPART_HTTP_PUSH_URI] =
+        PathBuilder(request).append(constants::UpdateService::UPLOAD).build();
 
-    set_response(response, r);
+    set_response(request, response, r);
 }
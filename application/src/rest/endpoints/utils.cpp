@@ -24,6 +24,8 @@
 #include "psme/rest/endpoints/utils.hpp"
 #include "psme/rest/constants/constants.hpp"
 #include "psme/rest/model/find.hpp"
+#include "psme/rest/server/error/error_factory.hpp"
+#include "psme/rest/server/error/server_exception.hpp"
 #include "psme/rest/server/multiplexer.hpp"
 #include "psme/rest/server/parameters.hpp"
 #include "psme/rest/server/utils.hpp"
@@ -32,8 +34,10 @@
 #include "agent-framework/module/model/model_compute.hpp"
 #include "agent-framework/module/model/model_storage.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <iterator>
+#include <numeric>
 #include <regex>
 
 using namespace psme::rest::constants::Common;
@@ -131,6 +135,78 @@ void set_location_header(const server::Request& request, server::Response& respo
     response.set_header(LOCATION, absolute_location_path);
 }
 
+namespace {
+
+/*! @brief Cuts ids fetched for one member more than the page, linking the next page by the id following it */
+void cut_page(const server::Request& req, json::Json& json, std::vector<std::uint64_t>& ids) {
+    const auto& options = req.get_query_options();
+    const auto page_size = options.get_page_size();
+    if (ids.size() > page_size) {
+        if (options.has_next_page()) {
+            json[constants::Collection::NEXT_LINK] = options.get_next_link(PathBuilder(req).build(), ids[page_size]);
+        }
+        ids.resize(page_size);
+    }
+}
+
+/*! @brief With $expand, $select applies to the members, so they are always rendered */
+bool are_members_selected(const server::Request& req) {
+    const auto& options = req.get_query_options();
+    return options.has_expand() || options.is_selected(constants::Collection::MEMBERS);
+}
+
+template <typename T>
+void add_member(const server::Request& req, json::Json& json, const T& id) {
+    json::Json link(json::Json::value_t::object);
+    link[ODATA_ID] = PathBuilder(req).append(id).build();
+    json[constants::Collection::MEMBERS].push_back(std::move(link));
+}
+
+} // namespace
+
+void fill_collection_page(const server::Request& req, json::Json& json, std::vector<std::uint64_t> ids) {
+    if (!are_members_selected(req)) {
+        return;
+    }
+    cut_page(req, json, ids);
+    for (const auto& id : ids) {
+        add_member(req, json, id);
+    }
+}
+
+void fill_collection_page(const server::Request& req, json::Json& json, const std::vector<std::string>& names) {
+    if (!are_members_selected(req)) {
+        return;
+    }
+    std::vector<std::uint64_t> positions(names.size());
+    std::iota(positions.begin(), positions.end(), std::uint64_t{0});
+    auto page = get_page_ids(req, positions);
+    cut_page(req, json, page);
+    for (const auto& position : page) {
+        add_member(req, json, names[position]);
+    }
+}
+
+std::vector<std::uint64_t> get_page_ids(const server::Request& req, const std::vector<std::uint64_t>& ids) {
+    const auto& options = req.get_query_options();
+    auto first = std::lower_bound(ids.cbegin(), ids.cend(), options.get_skip_token());
+    const auto available = static_cast<std::size_t>(std::distance(first, ids.cend()));
+    first += static_cast<std::vector<std::uint64_t>::difference_type>(std::min(options.get_skip(), available));
+
+    const auto count = std::min(options.get_page_size() + 1, static_cast<std::size_t>(std::distance(first, ids.cend())));
+    return {first, first + static_cast<std::vector<std::uint64_t>::difference_type>(count)};
+}
+
+void validate_filter_properties(const server::Filter& filter, const std::vector<std::string>& supported) {
+    for (const auto& property : filter.get_properties()) {
+        if (std::find(supported.cbegin(), supported.cend(), property) == supported.cend()) {
+            throw error::ServerException(error::ErrorFactory::create_query_parameter_value_format_error(
+                server::QueryOptions::FILTER, filter.get_expression(),
+                "Property '" + property + "' is not supported in " + server::QueryOptions::FILTER + "."));
+        }
+    }
+}
+
 } // namespace utils
 } // namespace endpoint
 } // namespace rest
@@ -0,0 +1,38 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/eventing/event.hpp"
+#include "psme/rest/constants/constants.hpp"
+
+using namespace psme::rest;
+using namespace psme::rest::constants;
+
+eventing::Event::Event(std::uint64_t id, json::Json record, const std::string& resource_type) : m_id{id} {
+    const auto event_id = std::to_string(id);
+    record[constants::Event::EVENT_ID] = event_id;
+
+    const auto message_id = record.value(MessageObject::MESSAGE_ID, std::string{});
+    m_properties[constants::Event::EVENT_TYPE] = record.value(constants::Event::EVENT_TYPE, std::string{});
+    m_properties[MessageObject::MESSAGE_ID] = message_id;
+    m_properties[constants::Event::REGISTRY_PREFIX] = message_id.substr(0, message_id.find('.'));
+    m_properties[constants::Event::RESOURCE_TYPE] = resource_type;
+    m_properties[constants::Event::ORIGIN_RESOURCE] = record[constants::Event::ORIGIN_OF_CONDITION].value(Common::ODATA_ID, std::string{});
+
+    json::Json payload(json::Json::value_t::object);
+    payload[Common::ODATA_TYPE] = "#Event.v1_7_0.Event";
+    payload[Common::ID] = event_id;
+    payload[Common::NAME] = "Resource Event";
+    payload[constants::Event::EVENTS] = json::Json::array({record});
+    m_record = std::move(record);
+
+    m_frame = std::make_shared<const std::string>("id: " + event_id + "\ndata: " + payload.dump() + "\n\n");
+}
+
+bool eventing::Event::matches(const server::Filter& filter) const {
+    if (filter.is_empty()) {
+        return true;
+    }
+    return filter.evaluate([this](const std::string& name) {
+        return get_property(name);
+    });
+}
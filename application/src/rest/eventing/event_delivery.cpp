@@ -0,0 +1,284 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/eventing/event_delivery.hpp"
+#include "psme/rest/eventing/subscription_manager.hpp"
+#include "psme/rest/constants/constants.hpp"
+#include "psme/rest/server/certs/cert_loader.hpp"
+
+#include "logger/logger_factory.hpp"
+
+#include <algorithm>
+#include <set>
+
+using namespace psme::rest;
+using namespace psme::rest::eventing;
+
+constexpr std::size_t EventDelivery::MAX_QUEUE_SIZE;
+constexpr std::size_t EventDelivery::MAX_BATCH_SIZE;
+constexpr unsigned EventDelivery::RETRY_ATTEMPTS;
+constexpr std::chrono::seconds EventDelivery::RETRY_INTERVAL;
+constexpr std::chrono::seconds EventDelivery::MAX_RETRY_INTERVAL;
+constexpr std::chrono::seconds EventDelivery::REQUEST_TIMEOUT;
+
+namespace {
+
+/*! @brief Longest sleep of the delivery thread when nothing is scheduled */
+constexpr std::chrono::milliseconds IDLE_TIMEOUT{1000};
+
+/*! @brief Listener responses are not needed */
+size_t discard_response(char*, size_t size, size_t nmemb, void*) {
+    return size * nmemb;
+}
+
+} // namespace
+
+EventDelivery::EventDelivery() {}
+
+EventDelivery::~EventDelivery() {
+    stop();
+}
+
+void EventDelivery::start() {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (m_running) {
+        return;
+    }
+    curl_global_init(CURL_GLOBAL_DEFAULT);
+    m_multi = curl_multi_init();
+    if (!m_multi) {
+        log_error("rest", "Cannot initialize event delivery.");
+        return;
+    }
+    m_headers = curl_slist_append(m_headers, "Content-Type: application/json");
+    // Bodies are small, do not wait for 100-continue
+    m_headers = curl_slist_append(m_headers, "Expect:");
+    m_running = true;
+    m_thread = std::thread(&EventDelivery::run, this);
+    log_info("rest", "Event delivery started.");
+}
+
+void EventDelivery::stop() {
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        if (!m_running) {
+            return;
+        }
+        m_running = false;
+        curl_multi_wakeup(m_multi);
+    }
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    std::lock_guard<std::mutex> lock{m_mutex};
+    for (auto& entry : m_destinations) {
+        release(m_multi, entry.second);
+    }
+    m_destinations.clear();
+    curl_multi_cleanup(m_multi);
+    m_multi = nullptr;
+    curl_slist_free_all(m_headers);
+    m_headers = nullptr;
+    log_info("rest", "Event delivery stopped.");
+}
+
+void EventDelivery::set_retry_policy(unsigned attempts, std::chrono::milliseconds interval) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_retry_attempts = attempts;
+    m_retry_interval = interval;
+}
+
+void EventDelivery::push(const Event& event) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (!m_running) {
+        return;
+    }
+
+    std::set<std::uint64_t> ids{};
+    SubscriptionManager::get_instance()->for_each([this, &event, &ids](const Subscription& subscription) {
+        ids.insert(subscription.get_id());
+        if (!subscription.matches(event)) {
+            return;
+        }
+        auto& destination = m_destinations[subscription.get_id()];
+        destination.id = subscription.get_id();
+        destination.uri = subscription.get_destination();
+        destination.context = subscription.get_context();
+        destination.queue.push_back(event.get_record());
+        if (destination.queue.size() > MAX_QUEUE_SIZE) {
+            destination.queue.pop_front();
+            if (0 == destination.statistics.dropped++) {
+                log_warning("rest", "Event destination " << destination.uri << " does not keep up, dropping events.");
+            }
+        }
+    });
+
+    // Discarded by the delivery thread, which owns the requests
+    for (auto& entry : m_destinations) {
+        if (0 == ids.count(entry.first)) {
+            entry.second.removed = true;
+            entry.second.queue.clear();
+        }
+    }
+
+    curl_multi_wakeup(m_multi);
+}
+
+EventDelivery::Statistics EventDelivery::get_statistics(std::uint64_t subscription_id) const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    const auto it = m_destinations.find(subscription_id);
+    if (m_destinations.end() == it) {
+        return {};
+    }
+    auto statistics = it->second.statistics;
+    statistics.pending = it->second.queue.size() + it->second.batch_size;
+    return statistics;
+}
+
+void EventDelivery::run() {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    while (m_running) {
+        lock.unlock();
+        int running = 0;
+        curl_multi_perform(m_multi, &running);
+
+        int remaining = 0;
+        while (CURLMsg* message = curl_multi_info_read(m_multi, &remaining)) {
+            if (CURLMSG_DONE == message->msg) {
+                lock.lock();
+                complete_request(m_multi, message->easy_handle, message->data.result);
+                lock.unlock();
+            }
+        }
+
+        // New requests are due at once, libcurl shortens the wait accordingly
+        lock.lock();
+        const auto timeout = start_requests(m_multi);
+        lock.unlock();
+        curl_multi_poll(m_multi, nullptr, 0, static_cast<int>(timeout.count()), nullptr);
+        lock.lock();
+    }
+}
+
+std::chrono::milliseconds EventDelivery::start_requests(CURLM* multi) {
+    const auto now = std::chrono::steady_clock::now();
+    auto timeout = IDLE_TIMEOUT;
+    for (auto it = m_destinations.begin(); it != m_destinations.end();) {
+        if (it->second.removed && !it->second.in_flight) {
+            release(multi, it->second);
+            it = m_destinations.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    for (auto& entry : m_destinations) {
+        auto& destination = entry.second;
+        if (destination.removed || destination.in_flight || (destination.body.empty() && destination.queue.empty())) {
+            continue;
+        }
+        if (destination.next_attempt > now) {
+            timeout = std::min(timeout,
+                               std::chrono::duration_cast<std::chrono::milliseconds>(destination.next_attempt - now) +
+                                   std::chrono::milliseconds{1});
+            continue;
+        }
+
+        prepare_batch(destination);
+        if (!destination.handle) {
+            destination.handle = curl_easy_init();
+            if (!destination.handle) {
+                log_error("rest", "Cannot create request for event destination " << destination.uri);
+                continue;
+            }
+        }
+        CURL* handle = destination.handle;
+        curl_easy_setopt(handle, CURLOPT_URL, destination.uri.c_str());
+        curl_easy_setopt(handle, CURLOPT_PROTOCOLS, CURLPROTO_HTTP | CURLPROTO_HTTPS);
+        curl_easy_setopt(handle, CURLOPT_CAINFO, server::CertLoader::CA_BUNDLE_PATH);
+        curl_easy_setopt(handle, CURLOPT_NOSIGNAL, 1L);
+        curl_easy_setopt(handle, CURLOPT_TIMEOUT_MS, static_cast<long>(std::chrono::milliseconds{REQUEST_TIMEOUT}.count()));
+        curl_easy_setopt(handle, CURLOPT_HTTPHEADER, m_headers);
+        curl_easy_setopt(handle, CURLOPT_POSTFIELDS, destination.body.data());
+        curl_easy_setopt(handle, CURLOPT_POSTFIELDSIZE_LARGE, static_cast<curl_off_t>(destination.body.size()));
+        curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, discard_response);
+        curl_easy_setopt(handle, CURLOPT_PRIVATE, static_cast<void*>(&destination));
+        if (CURLM_OK == curl_multi_add_handle(multi, handle)) {
+            destination.in_flight = true;
+        }
+    }
+    return timeout;
+}
+
+void EventDelivery::prepare_batch(Destination& destination) {
+    if (!destination.body.empty()) {
+        // Retry of the previous batch
+        return;
+    }
+    json::Json payload(json::Json::value_t::object);
+    payload[constants::Common::ODATA_TYPE] = "#Event.v1_7_0.Event";
+    payload[constants::Common::NAME] = "Event Array";
+    payload[constants::EventDestination::CONTEXT] = destination.context;
+    payload[constants::Event::EVENTS] = json::Json::array();
+    while (!destination.queue.empty() && destination.batch_size < MAX_BATCH_SIZE) {
+        payload[constants::Common::ID] = destination.queue.front()[constants::Event::EVENT_ID];
+        payload[constants::Event::EVENTS].push_back(std::move(destination.queue.front()));
+        destination.queue.pop_front();
+        ++destination.batch_size;
+    }
+    destination.body = payload.dump();
+}
+
+void EventDelivery::complete_request(CURLM* multi, CURL* handle, CURLcode result) {
+    curl_multi_remove_handle(multi, handle);
+    void* data = nullptr;
+    curl_easy_getinfo(handle, CURLINFO_PRIVATE, &data);
+    auto& destination = *static_cast<Destination*>(data);
+    destination.in_flight = false;
+    if (destination.removed) {
+        return;
+    }
+
+    long status = 0;
+    curl_easy_getinfo(handle, CURLINFO_RESPONSE_CODE, &status);
+    if (CURLE_OK == result && status >= 200 && status < 300) {
+        destination.statistics.delivered += destination.batch_size;
+        destination.failures = 0;
+        destination.backoff = std::chrono::milliseconds{0};
+        destination.next_attempt = {};
+        destination.body.clear();
+        destination.batch_size = 0;
+    }
+    else {
+        const std::string reason = CURLE_OK == result ? "HTTP status " + std::to_string(status) : curl_easy_strerror(result);
+        destination.backoff = destination.backoff.count()
+                                  ? std::min(destination.backoff * 2, std::chrono::milliseconds{MAX_RETRY_INTERVAL})
+                                  : m_retry_interval;
+        destination.next_attempt = std::chrono::steady_clock::now() + destination.backoff;
+        if (++destination.failures > m_retry_attempts) {
+            log_warning("rest", "Dropping " << destination.batch_size << " event(s) for " << destination.uri
+                                            << " after " << destination.failures << " attempts: " << reason);
+            destination.statistics.dropped += destination.batch_size;
+            destination.failures = 0;
+            destination.backoff = std::chrono::milliseconds{0};
+            destination.body.clear();
+            destination.batch_size = 0;
+        }
+        else {
+            log_debug("rest", "Event delivery to " << destination.uri << " failed: " << reason);
+        }
+    }
+}
+
+void EventDelivery::release(CURLM* multi, Destination& destination) {
+    if (destination.handle) {
+        if (destination.in_flight) {
+            curl_multi_remove_handle(multi, destination.handle);
+            destination.in_flight = false;
+        }
+        curl_easy_cleanup(destination.handle);
+        destination.handle = nullptr;
+    }
+}
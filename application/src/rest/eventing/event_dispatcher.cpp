@@ -0,0 +1,379 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/eventing/event_dispatcher.hpp"
+#include "psme/rest/eventing/event_delivery.hpp"
+#include "psme/rest/constants/constants.hpp"
+#include "psme/rest/constants/routes.hpp"
+#include "psme/rest/endpoints/path_builder.hpp"
+#include "psme/rest/endpoints/utils.hpp"
+
+#include "agent-framework/exceptions/exception.hpp"
+#include "agent-framework/module/managers/utils/manager_utils.hpp"
+#include "agent-framework/module/model/task.hpp"
+#include "agent-framework/module/utils/time.hpp"
+#include "logger/logger_factory.hpp"
+
+#include <algorithm>
+#include <set>
+
+using namespace psme::rest;
+using namespace psme::rest::eventing;
+using agent_framework::eventing::EventData;
+using Component = agent_framework::model::enums::Component;
+using Notification = agent_framework::model::enums::Notification;
+using TaskState = agent_framework::model::enums::TaskState;
+
+constexpr std::size_t EventDispatcher::HISTORY_SIZE;
+constexpr std::size_t EventDispatcher::MAX_PENDING_SIZE;
+constexpr std::chrono::seconds EventDispatcher::KEEP_ALIVE_INTERVAL;
+
+namespace {
+
+/*! @brief Redfish message reported in an event record */
+struct Message {
+    const char* event_type;
+    const char* message_id;
+    const char* message;
+    const char* severity;
+};
+
+const Message RESOURCE_CREATED{"ResourceAdded", "ResourceEvent.1.0.ResourceCreated",
+                               "The resource has been created successfully.", "OK"};
+const Message RESOURCE_REMOVED{"ResourceRemoved", "ResourceEvent.1.0.ResourceRemoved",
+                               "The resource has been removed successfully.", "OK"};
+const Message RESOURCE_CHANGED{"ResourceUpdated", "ResourceEvent.1.0.ResourceChanged",
+                               "One or more resource properties have changed.", "OK"};
+const Message TASK_STARTED{"StatusChange", "TaskEvent.1.0.TaskStarted",
+                           "The task with Id '%1' has started.", "OK"};
+const Message TASK_COMPLETED{"StatusChange", "TaskEvent.1.0.TaskCompletedOK",
+                             "The task with Id '%1' has completed.", "OK"};
+const Message TASK_ABORTED{"StatusChange", "TaskEvent.1.0.TaskAborted",
+                           "The task with Id '%1' has been aborted.", "Critical"};
+
+/*! @brief Task state change which is reported with a TaskEvent message */
+const Message* get_task_message(TaskState state) {
+    switch (state) {
+    case TaskState::Running:
+        return &TASK_STARTED;
+    case TaskState::Completed:
+        return &TASK_COMPLETED;
+    case TaskState::Exception:
+    case TaskState::Killed:
+    case TaskState::Interrupted:
+        return &TASK_ABORTED;
+    default:
+        return nullptr;
+    }
+}
+
+/*! @brief Build URL from event data only, as removed objects are no longer in the model */
+std::string get_origin_url(const EventData& data) {
+    switch (data.get_type()) {
+    case Component::Manager:
+        return endpoint::PathBuilder(constants::Routes::MANAGER_COLLECTION_PATH).append(data.get_id()).build();
+    case Component::System:
+        return endpoint::PathBuilder(constants::Routes::SYSTEMS_COLLECTION_PATH).append(data.get_id()).build();
+    case Component::Task:
+        return endpoint::PathBuilder(constants::Routes::TASK_COLLECTION_PATH).append(data.get_id()).build();
+    case Component::VirtualMedia:
+        return endpoint::PathBuilder(endpoint::utils::get_component_url(data.get_parent_type(), data.get_parent_uuid()))
+            .append(constants::Common::VIRTUAL_MEDIA)
+            .append(data.get_id())
+            .build();
+    default:
+        return {};
+    }
+}
+
+std::string get_resource_type(Component type) {
+    switch (type) {
+    case Component::Manager:
+        return "Manager";
+    case Component::System:
+        return "ComputerSystem";
+    case Component::Task:
+        return "Task";
+    case Component::VirtualMedia:
+        return "VirtualMedia";
+    default:
+        return {};
+    }
+}
+
+} // namespace
+
+EventDispatcher::~EventDispatcher() {
+    stop();
+}
+
+void EventDispatcher::start() {
+    {
+        std::lock_guard<std::mutex> lock{m_queue_mutex};
+        if (m_running) {
+            return;
+        }
+        m_running = true;
+        m_queue.clear();
+    }
+    m_subscriber_id = agent_framework::eventing::EventBus::get_instance()->subscribe(
+        [this](const EventData& data) { publish(data); });
+    m_thread = std::thread(&EventDispatcher::run, this);
+    log_info("rest", "Event dispatcher started.");
+}
+
+void EventDispatcher::stop() {
+    {
+        std::lock_guard<std::mutex> lock{m_queue_mutex};
+        if (!m_running) {
+            return;
+        }
+        m_running = false;
+    }
+    agent_framework::eventing::EventBus::get_instance()->unsubscribe(m_subscriber_id);
+    m_queue_condition.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    std::vector<std::weak_ptr<ResourceWatch>> watches{};
+    {
+        std::lock_guard<std::mutex> lock{m_queue_mutex};
+        watches.swap(m_watches);
+    }
+    for (const auto& watched : watches) {
+        if (const auto watch = watched.lock()) {
+            watch->notify();
+        }
+    }
+
+    std::lock_guard<std::mutex> lock{m_streams_mutex};
+    for (const auto& stream : m_streams) {
+        stream->close();
+    }
+    m_streams.clear();
+    log_info("rest", "Event dispatcher stopped.");
+}
+
+std::shared_ptr<EventStream> EventDispatcher::open_stream(const server::Filter& filter,
+                                                          const std::string& last_event_id) {
+    auto stream = std::make_shared<EventStream>(filter, MAX_PENDING_SIZE);
+
+    std::lock_guard<std::mutex> lock{m_streams_mutex};
+    {
+        std::lock_guard<std::mutex> queue_lock{m_queue_mutex};
+        if (!m_running) {
+            stream->close();
+            return stream;
+        }
+    }
+    if (!last_event_id.empty()) {
+        try {
+            const auto last_id = std::stoull(last_event_id);
+            for (const auto& event : m_history) {
+                if (event->get_id() > last_id) {
+                    stream->push(*event);
+                }
+            }
+        }
+        catch (const std::exception&) {
+            log_debug("rest", "Ignoring invalid Last-Event-ID: " << last_event_id);
+        }
+    }
+    m_streams.push_back(stream);
+    return stream;
+}
+
+std::shared_ptr<ResourceWatch> EventDispatcher::watch(const std::string& uuid, std::chrono::milliseconds timeout,
+                                                      ResourceWatch::Renderer renderer) {
+    auto watch = std::make_shared<ResourceWatch>(uuid, std::chrono::steady_clock::now() + timeout, std::move(renderer));
+    bool watched = false;
+    {
+        std::lock_guard<std::mutex> lock{m_queue_mutex};
+        if (m_running) {
+            // The dispatcher thread may need to wake up earlier
+            m_watches.push_back(watch);
+            m_watches_changed = true;
+            watched = true;
+        }
+    }
+    if (watched) {
+        m_queue_condition.notify_one();
+    }
+    else {
+        watch->notify();
+    }
+    return watch;
+}
+
+void EventDispatcher::publish(const EventData& data) {
+    {
+        std::lock_guard<std::mutex> lock{m_queue_mutex};
+        if (!m_running) {
+            return;
+        }
+        m_queue.push_back(data);
+    }
+    m_queue_condition.notify_one();
+}
+
+void EventDispatcher::run() {
+    auto next_keep_alive = std::chrono::steady_clock::now() + KEEP_ALIVE_INTERVAL;
+    std::unique_lock<std::mutex> lock{m_queue_mutex};
+    while (true) {
+        m_queue_condition.wait_until(lock, std::min(next_keep_alive, get_next_deadline()), [this]() {
+            return !m_running || !m_queue.empty() || m_watches_changed;
+        });
+        if (!m_running) {
+            break;
+        }
+        m_watches_changed = false;
+        std::deque<EventData> batch{};
+        batch.swap(m_queue);
+        const auto ready = take_ready_watches(batch);
+        lock.unlock();
+
+        // Watch renderers read the model, which is already updated
+        for (const auto& watch : ready) {
+            watch->notify();
+        }
+
+        for (const auto& data : batch) {
+            try {
+                if (const auto event = make_event(data)) {
+                    deliver(event);
+                }
+            }
+            catch (const std::exception& e) {
+                // Expected e.g. for children removed after their parent
+                log_debug("rest", "Cannot build event for " << data.get_type().to_string()
+                                                            << " " << data.get_uuid() << ": " << e.what());
+            }
+        }
+        if (std::chrono::steady_clock::now() >= next_keep_alive) {
+            keep_alive();
+            next_keep_alive = std::chrono::steady_clock::now() + KEEP_ALIVE_INTERVAL;
+        }
+        lock.lock();
+    }
+}
+
+std::chrono::steady_clock::time_point EventDispatcher::get_next_deadline() {
+    auto deadline = std::chrono::steady_clock::time_point::max();
+    for (const auto& watched : m_watches) {
+        if (const auto watch = watched.lock()) {
+            deadline = std::min(deadline, watch->get_deadline());
+        }
+    }
+    return deadline;
+}
+
+std::vector<std::shared_ptr<ResourceWatch>> EventDispatcher::take_ready_watches(const std::deque<EventData>& batch) {
+    std::set<std::string> changed{};
+    for (const auto& data : batch) {
+        if (Notification::Add != data.get_notification()) {
+            changed.insert(data.get_uuid());
+        }
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    std::vector<std::shared_ptr<ResourceWatch>> ready{};
+    m_watches.erase(std::remove_if(m_watches.begin(), m_watches.end(),
+                                   [&changed, &now, &ready](const std::weak_ptr<ResourceWatch>& watched) {
+                                       const auto watch = watched.lock();
+                                       if (!watch) {
+                                           // Client is gone
+                                           return true;
+                                       }
+                                       if (watch->get_deadline() <= now || changed.count(watch->get_uuid())) {
+                                           ready.push_back(watch);
+                                           return true;
+                                       }
+                                       return false;
+                                   }),
+                    m_watches.end());
+    return ready;
+}
+
+void EventDispatcher::deliver(const std::shared_ptr<const Event>& event) {
+    {
+        // History and streams are updated together, so a new stream gets each event exactly once
+        std::lock_guard<std::mutex> lock{m_streams_mutex};
+        m_history.push_back(event);
+        if (m_history.size() > HISTORY_SIZE) {
+            m_history.pop_front();
+        }
+        m_streams.erase(std::remove_if(m_streams.begin(), m_streams.end(),
+                                       [&event](const std::shared_ptr<EventStream>& stream) {
+                                           return !stream->push(*event);
+                                       }),
+                        m_streams.end());
+    }
+    EventDelivery::get_instance()->push(*event);
+}
+
+void EventDispatcher::keep_alive() {
+    std::lock_guard<std::mutex> lock{m_streams_mutex};
+    m_streams.erase(std::remove_if(m_streams.begin(), m_streams.end(),
+                                   [](const std::shared_ptr<EventStream>& stream) {
+                                       return !stream->push_keep_alive();
+                                   }),
+                    m_streams.end());
+}
+
+std::shared_ptr<const Event> EventDispatcher::make_event(const EventData& data) {
+    const auto resource_type = get_resource_type(data.get_type());
+    if (resource_type.empty()) {
+        return nullptr;
+    }
+
+    const Message* message = &RESOURCE_CHANGED;
+    if (Notification::Add == data.get_notification()) {
+        message = &RESOURCE_CREATED;
+    }
+    else if (Notification::Remove == data.get_notification()) {
+        message = &RESOURCE_REMOVED;
+    }
+
+    json::Json args = json::Json::array();
+    std::string text{message->message};
+    if (Component::Task == data.get_type()) {
+        if (Notification::Remove == data.get_notification()) {
+            m_task_states.erase(data.get_uuid());
+        }
+        else {
+            agent_framework::module::utils::OptionalField<TaskState> state{};
+            try {
+                state = agent_framework::module::get_manager<agent_framework::model::Task>().get_entry(data.get_uuid()).get_state();
+            }
+            catch (const agent_framework::exceptions::GamiException&) {
+                // Already removed, its removal follows
+            }
+            const auto it = m_task_states.find(data.get_uuid());
+            const bool changed = m_task_states.end() == it || (state.has_value() && it->second != state.value());
+            if (state.has_value()) {
+                m_task_states.insert_or_assign(data.get_uuid(), state.value());
+            }
+            const auto* task_message = state.has_value() ? get_task_message(state.value()) : nullptr;
+            if (Notification::Update == data.get_notification() && changed && task_message) {
+                message = task_message;
+                const auto task_id = std::to_string(data.get_id());
+                args.push_back(task_id);
+                text = message->message;
+                text.replace(text.find("%1"), 2, task_id);
+            }
+        }
+    }
+
+    json::Json record(json::Json::value_t::object);
+    record[constants::Event::EVENT_TYPE] = message->event_type;
+    record[constants::Event::EVENT_TIMESTAMP] = agent_framework::utils::make_iso_8601_timestamp();
+    record[constants::MessageObject::SEVERITY] = message->severity;
+    record[constants::Event::MESSAGE_SEVERITY] = message->severity;
+    record[constants::MessageObject::MESSAGE] = text;
+    record[constants::MessageObject::MESSAGE_ID] = message->message_id;
+    record[constants::MessageObject::MESSAGE_ARGS] = std::move(args);
+    record[constants::Event::ORIGIN_OF_CONDITION][constants::Common::ODATA_ID] = get_origin_url(data);
+
+    return std::make_shared<const Event>(m_next_event_id++, std::move(record), resource_type);
+}
@@ -0,0 +1,122 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/eventing/event_stream.hpp"
+
+#include "logger/logger_factory.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace psme::rest::eventing;
+
+namespace {
+
+/*! @brief SSE comment, ignored by clients but detects dead connections */
+const auto KEEP_ALIVE_FRAME = std::make_shared<const std::string>(": keep-alive\n\n");
+
+} // namespace
+
+EventStream::EventStream(const server::Filter& filter, std::size_t max_pending)
+    : m_filter{filter}, m_max_pending{max_pending} {}
+
+EventStream::~EventStream() {}
+
+bool EventStream::push(const Event& event) {
+    if (!event.matches(m_filter)) {
+        return !is_closed();
+    }
+    return enqueue(event.get_frame());
+}
+
+bool EventStream::push_keep_alive() {
+    return enqueue(KEEP_ALIVE_FRAME);
+}
+
+bool EventStream::enqueue(const std::shared_ptr<const std::string>& frame) {
+    ResumeCallback resume{};
+    bool queued = false;
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        if (m_closed) {
+            return false;
+        }
+        if (m_pending + frame->size() > m_max_pending) {
+            log_warning("rest", "Event stream client does not keep up, closing the stream.");
+            m_closed = true;
+            m_frames.clear();
+            m_offset = 0;
+            m_pending = 0;
+        }
+        else {
+            m_frames.push_back(frame);
+            m_pending += frame->size();
+            queued = true;
+        }
+        resume = take_resume();
+    }
+    m_condition.notify_all();
+    if (resume) {
+        resume();
+    }
+    return queued;
+}
+
+std::size_t EventStream::read(char* buffer, std::size_t size) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    std::size_t copied = 0;
+    while (copied < size && !m_frames.empty()) {
+        const auto& frame = *m_frames.front();
+        const auto count = std::min(size - copied, frame.size() - m_offset);
+        std::memcpy(buffer + copied, frame.data() + m_offset, count);
+        copied += count;
+        m_offset += count;
+        if (m_offset == frame.size()) {
+            m_frames.pop_front();
+            m_offset = 0;
+        }
+    }
+    m_pending -= copied;
+    return copied;
+}
+
+bool EventStream::is_closed() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_closed;
+}
+
+bool EventStream::wait(ResumeCallback resume) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (m_closed || 0 != m_pending) {
+        return false;
+    }
+    m_resume = std::move(resume);
+    return true;
+}
+
+void EventStream::wait_for(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    m_condition.wait_for(lock, timeout, [this]() { return m_closed || 0 != m_pending; });
+}
+
+void EventStream::close() {
+    ResumeCallback resume{};
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_closed = true;
+        m_frames.clear();
+        m_offset = 0;
+        m_pending = 0;
+        resume = take_resume();
+    }
+    m_condition.notify_all();
+    if (resume) {
+        resume();
+    }
+}
+
+EventStream::ResumeCallback EventStream::take_resume() {
+    ResumeCallback resume{};
+    std::swap(resume, m_resume);
+    return resume;
+}
@@ -0,0 +1,51 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/eventing/resource_watch.hpp"
+
+using namespace psme::rest::eventing;
+
+ResourceWatch::ResourceWatch(const std::string& uuid, std::chrono::steady_clock::time_point deadline,
+                             Renderer renderer)
+    : m_uuid{uuid}, m_deadline{deadline}, m_renderer{std::move(renderer)} {}
+
+ResourceWatch::~ResourceWatch() {}
+
+void ResourceWatch::notify() {
+    ResumeCallback resume{};
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        if (m_ready) {
+            return;
+        }
+        m_ready = true;
+        std::swap(resume, m_resume);
+    }
+    m_condition.notify_all();
+    if (resume) {
+        resume();
+    }
+}
+
+bool ResourceWatch::is_ready() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_ready;
+}
+
+bool ResourceWatch::wait(ResumeCallback resume) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (m_ready) {
+        return false;
+    }
+    m_resume = std::move(resume);
+    return true;
+}
+
+bool ResourceWatch::wait_for(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    return m_condition.wait_for(lock, timeout, [this]() { return m_ready; });
+}
+
+void ResourceWatch::complete(server::Response& response) {
+    m_renderer(response);
+}
@@ -0,0 +1,79 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/eventing/subscription.hpp"
+#include "psme/rest/constants/constants.hpp"
+
+#include <algorithm>
+
+using namespace psme::rest;
+using namespace psme::rest::constants;
+using namespace psme::rest::eventing;
+
+namespace {
+
+bool is_selected(const std::vector<std::string>& selection, const json::Json& value) {
+    if (selection.empty()) {
+        return true;
+    }
+    return value.is_string() && selection.end() != std::find(selection.begin(), selection.end(), value.get<std::string>());
+}
+
+std::vector<std::string> get_strings(const json::Json& json, const char* name) {
+    std::vector<std::string> values{};
+    if (json.count(name) && json[name].is_array()) {
+        for (const auto& value : json[name]) {
+            values.push_back(value.get<std::string>());
+        }
+    }
+    return values;
+}
+
+} // namespace
+
+bool Subscription::matches(const Event& event) const {
+    return is_selected(m_registry_prefixes, event.get_property(constants::Event::REGISTRY_PREFIX)) &&
+           is_selected(m_resource_types, event.get_property(constants::Event::RESOURCE_TYPE)) &&
+           is_selected(m_origin_resources, event.get_property(constants::Event::ORIGIN_RESOURCE));
+}
+
+json::Json Subscription::to_json() const {
+    json::Json json(json::Json::value_t::object);
+    fill_json(json);
+    return json;
+}
+
+void Subscription::fill_json(json::Json& json) const {
+    json[Common::ID] = std::to_string(m_id);
+    json[Common::NAME] = "Event Subscription " + std::to_string(m_id);
+    json[EventDestination::DESTINATION] = m_destination;
+    json[EventDestination::PROTOCOL] = "Redfish";
+    json[EventDestination::SUBSCRIPTION_TYPE] = "RedfishEvent";
+    json[EventDestination::EVENT_FORMAT_TYPE] = "Event";
+    json[EventDestination::CONTEXT] = m_context;
+    json[EventDestination::REGISTRY_PREFIXES] = m_registry_prefixes;
+    json[EventDestination::RESOURCE_TYPES] = m_resource_types;
+    json[EventDestination::ORIGIN_RESOURCES] = json::Json::array();
+    for (const auto& origin : m_origin_resources) {
+        json::Json link(json::Json::value_t::object);
+        link[Common::ODATA_ID] = origin;
+        json[EventDestination::ORIGIN_RESOURCES].push_back(std::move(link));
+    }
+}
+
+Subscription Subscription::from_json(const json::Json& json) {
+    Subscription subscription{};
+    if (json.count(Common::ID)) {
+        subscription.m_id = std::stoull(json[Common::ID].get<std::string>());
+    }
+    subscription.m_destination = json[EventDestination::DESTINATION].get<std::string>();
+    subscription.m_context = json.value(EventDestination::CONTEXT, std::string{});
+    subscription.m_registry_prefixes = get_strings(json, EventDestination::REGISTRY_PREFIXES);
+    subscription.m_resource_types = get_strings(json, EventDestination::RESOURCE_TYPES);
+    if (json.count(EventDestination::ORIGIN_RESOURCES) && json[EventDestination::ORIGIN_RESOURCES].is_array()) {
+        for (const auto& origin : json[EventDestination::ORIGIN_RESOURCES]) {
+            subscription.m_origin_resources.push_back(origin.value(Common::ODATA_ID, std::string{}));
+        }
+    }
+    return subscription;
+}
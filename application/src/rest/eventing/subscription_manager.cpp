@@ -0,0 +1,97 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/eventing/subscription_manager.hpp"
+
+#include "agent-framework/exceptions/exception.hpp"
+#include "logger/logger_factory.hpp"
+
+#include <algorithm>
+
+using namespace psme::rest::eventing;
+
+constexpr std::size_t SubscriptionManager::MAX_SUBSCRIPTIONS;
+
+SubscriptionManager::SubscriptionManager(const std::string& database_name)
+    : m_database{database::Database::create(database_name)} {}
+
+SubscriptionManager::~SubscriptionManager() {
+    m_database->remove();
+}
+
+void SubscriptionManager::load() {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    database::String key{};
+    database::String value{};
+    m_database->start();
+    while (m_database->next(key, value)) {
+        try {
+            auto subscription = Subscription::from_json(json::Json::parse(std::string{value}));
+            m_id = std::max(m_id, subscription.get_id());
+            m_subscriptions[subscription.get_id()] = std::move(subscription);
+        }
+        catch (const std::exception& e) {
+            log_error("rest", "Cannot read subscription " << std::string{key} << ": " << e.what());
+        }
+    }
+    m_database->end();
+    log_info("rest", m_subscriptions.size() << " event subscription(s) loaded.");
+}
+
+void SubscriptionManager::for_each(const SubscriptionCallback& handle) const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    for (const auto& entry : m_subscriptions) {
+        handle(entry.second);
+    }
+}
+
+std::vector<std::uint64_t> SubscriptionManager::get_ids(std::uint64_t first_id, std::size_t skip, std::size_t count) const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    std::vector<std::uint64_t> ids{};
+    for (auto it = m_subscriptions.lower_bound(first_id); it != m_subscriptions.end() && ids.size() < count; ++it) {
+        if (skip) {
+            --skip;
+            continue;
+        }
+        ids.emplace_back(it->first);
+    }
+    return ids;
+}
+
+std::size_t SubscriptionManager::get_count() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_subscriptions.size();
+}
+
+Subscription SubscriptionManager::get(std::uint64_t subscription_id) const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    auto it = m_subscriptions.find(subscription_id);
+    if (it == m_subscriptions.end()) {
+        throw agent_framework::exceptions::NotFound(std::string{"Subscription (ID: "} + std::to_string(subscription_id) + ") not found.");
+    }
+    return it->second;
+}
+
+std::uint64_t SubscriptionManager::add(Subscription subscription) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (m_subscriptions.size() >= MAX_SUBSCRIPTIONS) {
+        throw agent_framework::exceptions::InvalidValue(
+            "Maximum number of " + std::to_string(MAX_SUBSCRIPTIONS) + " subscriptions exceeded.");
+    }
+    subscription.set_id(++m_id);
+    if (!m_database->put(database::String{std::to_string(m_id)}, database::String{subscription.to_json().dump()})) {
+        log_warning("rest", "Subscription " << m_id << " could not be stored.");
+    }
+    m_subscriptions[m_id] = std::move(subscription);
+    return m_id;
+}
+
+void SubscriptionManager::del(std::uint64_t subscription_id) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    auto it = m_subscriptions.find(subscription_id);
+    if (it == m_subscriptions.end()) {
+        throw agent_framework::exceptions::NotFound(std::string{"Subscription (ID: "} + std::to_string(subscription_id) + ") not found.");
+    }
+    m_subscriptions.erase(it);
+    m_database->remove(database::String{std::to_string(subscription_id)});
+}
@@ -38,3 +38,11 @@ const std::string& MetadataManager::get_xml(const std::string& key) {
     }
     return it->second;
 }
+
+std::vector<std::string> MetadataManager::get_files() {
+    std::vector<std::string> files{};
+    for (const auto& entry : xml_map) {
+        files.push_back(entry.first);
+    }
+    return files;
+}
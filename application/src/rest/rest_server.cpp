@@ -26,6 +26,9 @@
 #include "configuration/configuration.hpp"
 #include "logger/logger_factory.hpp"
 #include "psme/rest/endpoints/endpoint_builder.hpp"
+#include "psme/rest/eventing/event_delivery.hpp"
+#include "psme/rest/eventing/event_dispatcher.hpp"
+#include "psme/rest/eventing/subscription_manager.hpp"
 #include "psme/rest/security/authentication/authentication_factory.hpp"
 #include "psme/rest/server/connector/microhttpd/mhd_connector.hpp"
 #include "psme/rest/server/multiplexer.hpp"
@@ -39,31 +42,53 @@ RestServer::RestServer() {
 
     endpoint::EndpointBuilder endpoint_builder;
     endpoint_builder.build_endpoints();
+    Multiplexer::get_instance()->set_page_size(connector_options.get_page_size());
 
-    m_connector.reset(new MHDConnector(connector_options));
-    m_connector->set_callback([](const Request& req, Response& res) {
-        Multiplexer::get_instance()->forward_to_handler(res,
-                                                        const_cast<Request&>(req));
-    });
-    security::authentication::AuthenticationFactory authenticationFactory{};
-    m_connector->set_authentication(authenticationFactory.create_authentication(connector_options));
-
-    m_connector->set_unauthenticated_access_callback([](const std::string& http_method,
-                                                        const std::string& url) {
-        return Multiplexer::get_instance()->check_public_access(http_method, url);
-    });
+    add_connector(connector_options);
+    for (const auto& local_options : load_local_server_options(config)) {
+        add_connector(local_options);
+    }
 }
 
 RestServer::~RestServer() {}
 
 void RestServer::start() {
     log_info("rest", "Starting REST server ...");
-    m_connector->start();
+    eventing::SubscriptionManager::get_instance()->load();
+    eventing::EventDelivery::get_instance()->start();
+    eventing::EventDispatcher::get_instance()->start();
+    for (auto& connector : m_connectors) {
+        connector->start();
+    }
     log_info("rest", "REST server started.");
 }
 
 void RestServer::stop() {
     log_info("rest", "Stopping REST server ...");
-    m_connector->stop();
+    // Closing event streams resumes parked connections, which the connector requires before stopping
+    eventing::EventDispatcher::get_instance()->stop();
+    eventing::EventDelivery::get_instance()->stop();
+    for (auto& connector : m_connectors) {
+        connector->stop();
+    }
     log_info("rest", "REST server stopped.");
 }
+
+void RestServer::add_connector(const ConnectorOptions& options) {
+    ConnectorUPtr connector{new MHDConnector(options)};
+    connector->set_callback([](const Request& req, Response& res) {
+        Multiplexer::get_instance()->forward_to_handler(res,
+                                                        const_cast<Request&>(req));
+    });
+    connector->set_upload_callback([](const Request& req) {
+        return Multiplexer::get_instance()->open_upload(const_cast<Request&>(req));
+    });
+    security::authentication::AuthenticationFactory authenticationFactory{};
+    connector->set_authentication(authenticationFactory.create_authentication(options));
+
+    connector->set_unauthenticated_access_callback([](const std::string& http_method,
+                                                      const std::string& url) {
+        return Multiplexer::get_instance()->check_public_access(http_method, url);
+    });
+    m_connectors.push_back(std::move(connector));
+}
@@ -25,6 +25,7 @@
 #include "psme/rest/security/authentication/authentication_factory.hpp"
 #include "psme/rest/security/authentication/basic_authentication.hpp"
 #include "psme/rest/security/authentication/client_cert_authentication.hpp"
+#include "psme/rest/security/authentication/peer_credentials_authentication.hpp"
 #include "psme/rest/security/authentication/session_authentication.hpp"
 
 using namespace psme::rest::security::authentication;
@@ -43,9 +44,13 @@ std::vector<AuthenticationUPtr> new_authentication(const ConnectorOptions& conne
                ConnectorOptions::AuthenticationType::BASIC_AUTH_OR_REDFISH_SESSION_AUTH) {
         authentications.emplace_back(new BasicAuthentication());
         authentications.emplace_back(new SessionAuthentication());
+    } else if (connector_options.get_authentication_type() ==
+               ConnectorOptions::AuthenticationType::PEER_CREDENTIALS_AUTH) {
+        authentications.emplace_back(new PeerCredentialsAuthentication(connector_options.get_peer_roles()));
     }
     if (authentications.empty()) {
-        log_warning("rest", "Authentication for HTTPS connector disabled\n");
+        log_warning("rest", "Authentication for " << (connector_options.get_socket_path().has_value() ? "local" : "HTTPS")
+                                                  << " connector disabled\n");
     }
     return authentications;
 }
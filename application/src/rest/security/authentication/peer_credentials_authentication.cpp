@@ -0,0 +1,84 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/security/authentication/peer_credentials_authentication.hpp"
+#include "psme/rest/security/account/role_manager.hpp"
+#include "psme/rest/server/error/error_factory.hpp"
+#include "psme/rest/server/http_headers.hpp"
+#include "logger/logger_factory.hpp"
+
+#include <microhttpd.h>
+
+#include <pwd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+using namespace psme::rest::security::authentication;
+using namespace psme::rest::security::role;
+using namespace psme::rest::server;
+
+PeerCredentialsAuthentication::PeerCredentialsAuthentication(const ConnectorOptions::PeerRoles& peer_roles) {
+    std::vector<char> buffer(1024);
+    for (const auto& peer_role : peer_roles) {
+        passwd entry{};
+        passwd* found = nullptr;
+        if (0 != ::getpwnam_r(peer_role.first.c_str(), &entry, buffer.data(), buffer.size(), &found) || !found) {
+            log_warning("rest", "Ignoring role of unknown local user " << peer_role.first);
+            continue;
+        }
+        m_roles[found->pw_uid] = peer_role.second;
+    }
+}
+
+AuthStatus
+PeerCredentialsAuthentication::perform(MHD_Connection* connection, const std::string&, server::Response& response) {
+    const auto* info = MHD_get_connection_info(connection, MHD_CONNECTION_INFO_CONNECTION_FD);
+    if (!info) {
+        log_error("rest", "Local connection rejected, no connection socket");
+    }
+    else if (is_peer_allowed(info->connect_fd)) {
+        return AuthStatus::SUCCESS;
+    }
+
+    const auto error = error::ErrorFactory::create_insufficient_privilege_error(
+        "Local user is not mapped to a role allowed to log in.");
+    response.set_status(error.get_http_status_code());
+    response.set_header(http_headers::ContentType::CONTENT_TYPE, http_headers::ContentType::JSON);
+    response.set_body(error.as_string());
+    return AuthStatus::FAIL;
+}
+
+bool PeerCredentialsAuthentication::is_peer_allowed(int socket_fd) const {
+    ucred credentials{};
+    auto length = static_cast<socklen_t>(sizeof(credentials));
+    if (0 != ::getsockopt(socket_fd, SOL_SOCKET, SO_PEERCRED, &credentials, &length)) {
+        log_error("rest", "Local connection rejected, cannot get credentials of the peer: " << std::strerror(errno));
+        return false;
+    }
+    if (!role_valid(credentials.uid)) {
+        log_error("rest", "Local connection of uid " << credentials.uid << " (pid " << credentials.pid << ") rejected");
+        return false;
+    }
+    return true;
+}
+
+bool PeerCredentialsAuthentication::role_valid(uid_t uid) const {
+    const auto it = m_roles.find(uid);
+    if (m_roles.end() == it) {
+        return false;
+    }
+    try {
+        const auto& privileges = RoleManager::get_instance()->get(it->second).get_privileges();
+        return privileges.end() != std::find(privileges.begin(), privileges.end(),
+                                             std::string{PrivilegeType(PrivilegeType::Login).to_string()});
+    }
+    catch (const agent_framework::exceptions::NotFound&) {
+        log_error("rest", "Role " << it->second << " of local uid " << uid << " does not exist");
+        return false;
+    }
+}
@@ -53,6 +53,24 @@ void SessionManager::for_each(const SessionCallback& handle) const {
     }
 }
 
+std::vector<std::uint64_t> SessionManager::get_ids(std::uint64_t first_id, std::size_t skip, std::size_t count) const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    std::vector<std::uint64_t> ids{};
+    for (auto it = m_sessions.lower_bound(first_id); it != m_sessions.end() && ids.size() < count; ++it) {
+        if (skip) {
+            --skip;
+            continue;
+        }
+        ids.emplace_back(it->first);
+    }
+    return ids;
+}
+
+std::size_t SessionManager::get_count() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_sessions.size();
+}
+
 void SessionManager::update_next_id(void) {
     std::uint64_t old_id = m_id;
     while (m_sessions.count(++m_id) != 0) {
@@ -26,6 +26,7 @@
 #include "psme/rest/server/error/error_factory.hpp"
 #include "psme/rest/server/error/server_error.hpp"
 #include "psme/rest/server/error/server_exception.hpp"
+#include "psme/rest/server/latency_monitor.hpp"
 #include "psme/rest/server/methods_handler.hpp"
 #include <psme/rest/security/authentication/client_cert_authentication.hpp>
 
@@ -39,7 +40,8 @@ using namespace psme::rest::security::authentication;
 Connector::Connector(const ConnectorOptions& options) : m_options(options),
                                                         m_access_callback{[](const Request&, const Response&) { return true; }},
                                                         m_callback{http_method_not_allowed},
-                                                        m_public_access_callback{[](const std::string&, const std::string&) { return false; }} {}
+                                                        m_public_access_callback{[](const std::string&, const std::string&) { return false; }},
+                                                        m_upload_callback{[](const Request&) { return nullptr; }} {}
 
 Connector::~Connector() {}
 
@@ -55,6 +57,10 @@ void Connector::set_unauthenticated_access_callback(const Connector::Unauthentic
     m_public_access_callback = callback;
 }
 
+void Connector::set_upload_callback(const UploadCallback& callback) {
+    m_upload_callback = callback;
+}
+
 void Connector::set_authentication(std::vector<AuthenticationUPtr> authentications) {
     m_authentication = std::move(authentications);
 }
@@ -84,13 +90,52 @@ Connector::client_cert_authenticate(MHD_Connection* connection, const std::strin
 }
 
 void Connector::handle(const Request& request, Response& response) {
+    const auto started_at = LatencyMonitor::Clock::now();
+    process(request, response, [this, &request, &response]() { try_handle(request, response); });
+    // Reads are the monitoring traffic background transfers must not slow down.
+    // A deferred response is timed until it is parked, not for its wait.
+    if (Method::GET == request.get_method() || Method::HEAD == request.get_method()) {
+        const auto finished_at = LatencyMonitor::Clock::now();
+        LatencyMonitor::get_instance()->record(
+            std::chrono::duration_cast<std::chrono::microseconds>(finished_at - started_at), finished_at);
+    }
+}
+
+void Connector::complete(const Request& request, DeferredResponse& deferred, Response& response) {
+    process(request, response, [&deferred, &response]() { deferred.complete(response); });
+}
+
+bool Connector::open_upload(const Request& request, Response& response, std::shared_ptr<UploadStream>& upload) {
+    bool opened = false;
+    process(request, response, [this, &request, &upload, &opened]() {
+        upload = m_upload_callback(request);
+        opened = true;
+    });
+    return opened;
+}
+
+bool Connector::write_upload(const Request& request, UploadStream& upload, const char* data, std::size_t size,
+                             Response& response) {
+    bool written = false;
+    try {
+        upload.write(data, size);
+        written = true;
+    }
+    catch (...) {
+        // Pieces are not logged one by one, a failure is turned into an error response like a handler's
+        process(request, response, []() { throw; });
+    }
+    return written;
+}
+
+void Connector::process(const Request& request, Response& response, const std::function<void()>& action) {
     std::string request_text;
 
     auto started_at = std::chrono::high_resolution_clock::now();
     try {
         request_text = request_to_string(request);
         log_debug("rest", "\nRequest: " << request_text);
-        try_handle(request, response);
+        action();
     }
     catch (const agent_framework::exceptions::NotFound& ex) {
         log_error("rest", "Not found exception: " << ex.what() << request_text);
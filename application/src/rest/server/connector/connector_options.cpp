@@ -41,13 +41,32 @@ constexpr const char ConnectorOptions::AUTHENTICATION_TYPE_REDFISH_SESSION[];
 constexpr const char ConnectorOptions::AUTHENTICATION_TYPE_BASIC_OR_SESSION[];
 constexpr const char ConnectorOptions::THREAD_POOL_SIZE[];
 constexpr const char ConnectorOptions::DEBUG_MODE[];
+constexpr const char ConnectorOptions::PAGE_SIZE[];
+constexpr const char ConnectorOptions::SOCKET_PATH[];
+constexpr const char ConnectorOptions::BIND_ADDRESSES[];
+constexpr const char ConnectorOptions::PEER_ROLES[];
+constexpr const char ConnectorOptions::AUTHENTICATION_TYPE_PEER_CREDENTIALS[];
 
 ConnectorOptions::ConnectorOptions(const json::Json& config) {
-    const auto& network_interface_name = config[RESTRICTED_TO_INTERFACE];
-    if (!network_interface_name.is_null()) {
-        m_network_interface_name = network_interface_name;
+    // The local server has no network interface
+    if (config.count(RESTRICTED_TO_INTERFACE) && !config[RESTRICTED_TO_INTERFACE].is_null()) {
+        m_network_interface_name = config[RESTRICTED_TO_INTERFACE];
     }
     m_port = config.value(PORT, std::uint16_t{});
+    if (config.count(BIND_ADDRESSES)) {
+        m_bind_addresses = config[BIND_ADDRESSES].get<std::vector<std::string>>();
+    }
+    if (config.count(SOCKET_PATH)) {
+        m_socket_path = config.value(SOCKET_PATH, std::string{});
+        // Local callers are identified by their credentials, TLS is not used
+        m_authentication_type = AuthenticationType::PEER_CREDENTIALS_AUTH;
+    }
+    if (config.count(PEER_ROLES)) {
+        const auto& peer_roles = config[PEER_ROLES];
+        for (auto it = peer_roles.begin(); it != peer_roles.end(); ++it) {
+            m_peer_roles[it.key()] = it.value().get<std::string>();
+        }
+    }
     const auto& thread_mode = config.value(THREAD_MODE, std::string{});
     if (thread_mode == THREAD_MODE_SELECT) {
         m_thread_mode = ThreadMode::SELECT;
@@ -61,6 +80,8 @@ ConnectorOptions::ConnectorOptions(const json::Json& config) {
         m_authentication_type = AuthenticationType::REDFISH_SESSION_AUTH;
     } else if (auth_type == AUTHENTICATION_TYPE_BASIC_OR_SESSION) {
         m_authentication_type = AuthenticationType::BASIC_AUTH_OR_REDFISH_SESSION_AUTH;
+    } else if (auth_type == AUTHENTICATION_TYPE_PEER_CREDENTIALS) {
+        m_authentication_type = AuthenticationType::PEER_CREDENTIALS_AUTH;
     } else if (auth_type == AUTHENTICATION_TYPE_NONE) {
         m_authentication_type = AuthenticationType::NONE;
     }
@@ -71,13 +92,16 @@ ConnectorOptions::ConnectorOptions(const json::Json& config) {
         m_thread_pool_size = config.value(THREAD_POOL_SIZE, std::uint16_t{});
     }
     m_certs_dir = config.value(CERTS_DIR, std::string{});
-    m_is_client_cert_required = true;
-    if (config.count(CLIENT_CERT_REQUIRED)) {
+    m_is_client_cert_required = !m_socket_path.has_value();
+    if (config.count(CLIENT_CERT_REQUIRED) && !m_socket_path.has_value()) {
         m_is_client_cert_required = config.value(CLIENT_CERT_REQUIRED, bool{});
     }
     if (config.count(HOSTNAME)) {
         m_hostname = config.value(HOSTNAME, std::string{});
     }
+    if (config.count(PAGE_SIZE)) {
+        m_page_size = config.value(PAGE_SIZE, std::size_t{});
+    }
 }
 
 const std::string& ConnectorOptions::get_certs_dir() const {
@@ -112,6 +136,22 @@ bool ConnectorOptions::use_debug() const {
     return m_use_debug;
 }
 
+std::size_t ConnectorOptions::get_page_size() const {
+    return m_page_size;
+}
+
 const OptionalField<std::string>& ConnectorOptions::get_network_interface_name() const {
     return m_network_interface_name;
 }
+
+const std::vector<std::string>& ConnectorOptions::get_bind_addresses() const {
+    return m_bind_addresses;
+}
+
+const OptionalField<std::string>& ConnectorOptions::get_socket_path() const {
+    return m_socket_path;
+}
+
+const ConnectorOptions::PeerRoles& ConnectorOptions::get_peer_roles() const {
+    return m_peer_roles;
+}
@@ -19,6 +19,8 @@
 
 #include "psme/rest/server/connector/connector_options_loader.hpp"
 
+#include <stdexcept>
+
 namespace psme {
 namespace rest {
 namespace server {
@@ -28,6 +30,17 @@ ConnectorOptions load_server_options(const json::Json& config) {
     return server_options;
 }
 
+std::vector<ConnectorOptions> load_local_server_options(const json::Json& config) {
+    std::vector<ConnectorOptions> local_server_options{};
+    if (config.count("local-server")) {
+        local_server_options.emplace_back(config["local-server"]);
+        if (!local_server_options.back().get_socket_path().has_value()) {
+            throw std::runtime_error("Local server configuration requires a socket path.");
+        }
+    }
+    return local_server_options;
+}
+
 } // namespace server
 } // namespace rest
 } // namespace psme
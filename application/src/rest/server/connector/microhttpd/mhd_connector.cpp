@@ -28,10 +28,13 @@
 #include "psme/rest/server/http_headers.hpp"
 #include "psme/rest/server/status.hpp"
 #include "psme/rest/server/utils.hpp"
+#include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <sstream>
 
 #include <microhttpd.h>
+#include <unistd.h>
 
 using namespace psme::rest;
 using namespace psme::rest::server;
@@ -42,12 +45,87 @@ namespace {
 
 using MHDResponsePtr = std::unique_ptr<MHD_Response, decltype(&MHD_destroy_response)>;
 
-MHDResponsePtr create_response(Response& response) {
+/*! @brief Size of blocks pulled from response streams */
+constexpr std::size_t STREAM_BLOCK_SIZE = 4096;
+
+/*! @brief How often a blocked stream reader rechecks the stream in thread-per-connection mode */
+constexpr std::chrono::milliseconds STREAM_POLL_INTERVAL{1000};
+
+/*! @brief Request being received or held back by a deferred response */
+struct RequestContext {
+    RequestContext() = default;
+    RequestContext(const RequestContext&) = delete;
+    RequestContext& operator=(const RequestContext&) = delete;
+
+    ~RequestContext() {
+        // Uploads the endpoint did not finish are discarded
+        if (upload) {
+            upload->abort();
+        }
+    }
+
+    Request request{};
+    std::shared_ptr<DeferredResponse> deferred{};
+    std::shared_ptr<UploadStream> upload{};
+    bool authenticated{false};
+};
+
+/*! @brief State of a streamed response, owned by the MHD response */
+struct StreamContext {
+    std::shared_ptr<ResponseStream> stream;
+    MHD_Connection* connection;
+    bool suspendable;
+};
+
+/* microhttpd's MHD_ContentReaderCallback */
+ssize_t read_stream(void* cls, uint64_t /*pos*/, char* buffer, size_t max) {
+    auto* context = static_cast<StreamContext*>(cls);
+    auto& stream = *context->stream;
+    while (true) {
+        const auto size = stream.read(buffer, max);
+        if (0 != size) {
+            return static_cast<ssize_t>(size);
+        }
+        if (stream.is_closed()) {
+            return MHD_CONTENT_READER_END_OF_STREAM;
+        }
+        if (context->suspendable) {
+            // Park the connection instead of occupying a pool thread until data arrives
+            auto* connection = context->connection;
+            MHD_suspend_connection(connection);
+            if (!stream.wait([connection]() { MHD_resume_connection(connection); })) {
+                MHD_resume_connection(connection);
+            }
+            return 0;
+        }
+        stream.wait_for(STREAM_POLL_INTERVAL);
+    }
+}
+
+/* microhttpd's MHD_ContentReaderFreeCallback */
+void free_stream(void* cls) {
+    auto* context = static_cast<StreamContext*>(cls);
+    context->stream->close();
+    delete context;
+}
+
+MHDResponsePtr create_response(MHD_Connection* connection, Response& response, bool suspendable) {
+    if (response.get_stream()) {
+        auto* context = new StreamContext{response.get_stream(), connection, suspendable};
+        MHDResponsePtr streamed{
+            MHD_create_response_from_callback(MHD_SIZE_UNKNOWN, STREAM_BLOCK_SIZE,
+                                              &read_stream, context, &free_stream),
+            &MHD_destroy_response};
+        if (!streamed) {
+            free_stream(context);
+        }
+        return streamed;
+    }
     return MHDResponsePtr{
         MHD_create_response_from_buffer(
             response.get_body_size(),
             const_cast<char*>(response.get_body().c_str()),
-            MHD_RESPMEM_MUST_COPY),
+            response.is_body_persistent() ? MHD_RESPMEM_PERSISTENT : MHD_RESPMEM_MUST_COPY),
         &MHD_destroy_response};
 }
 
@@ -62,8 +140,8 @@ void add_response_headers(MHD_Response* res, const Response& resp) {
     }
 }
 
-MHD_Result send_response(MHD_Connection* con, /*const*/ Response& res) {
-    if (auto r = create_response(res)) {
+MHD_Result send_response(MHD_Connection* con, /*const*/ Response& res, bool suspendable = false) {
+    if (auto r = create_response(con, res, suspendable)) {
         add_response_headers(r.get(), res);
         return MHD_queue_response(con, res.get_status(), r.get());
     }
@@ -80,6 +158,14 @@ MHD_Result add_request_headers(void* cls, enum MHD_ValueKind /*kind*/,
     return MHD_YES;
 }
 
+MHD_Result add_request_query_arguments(void* cls, enum MHD_ValueKind /*kind*/,
+                                       const char* key, const char* value) {
+    Request* request = static_cast<Request*>(cls);
+    request->query.set(key, value ? value : "");
+
+    return MHD_YES;
+}
+
 Method get_request_method(const char* method) {
     try {
         return Method::from_string(method);
@@ -89,6 +175,38 @@ Method get_request_method(const char* method) {
     }
 }
 
+/* microhttpd's MHD_RequestCompletedCallback, also called for requests aborted while being received */
+void request_completed(void* /*cls*/, MHD_Connection* /*connection*/, void** con_cls,
+                       MHD_RequestTerminationCode /*code*/) {
+    delete static_cast<RequestContext*>(*con_cls);
+    *con_cls = nullptr;
+}
+
+/*!
+ * @brief Authenticate the client of the connection.
+ * @return false if the request is rejected, the response is already queued then.
+ */
+bool authenticate_request(MHDConnector& connector, MHD_Connection* connection, const char* method,
+                          const char* url, MHD_Result& result) {
+    if (connector.get_options().is_client_cert_required()) {
+        Response response;
+        if (connector.client_cert_authenticate(connection, url, response) == AuthStatus::FAIL) {
+            result = send_response(connection, response);
+            return false;
+        }
+    }
+    if (!connector.unauthenticated_access_feasible(method, url) &&
+        connector.is_authentication_enabled()) {
+        Response response;
+        auto status = connector.authenticate(connection, url, response);
+        if (status == AuthStatus::FAIL) {
+            result = send_response(connection, response);
+            return false;
+        }
+    }
+    return true;
+}
+
 /* microhttpd's MHD_AccessHandlerCallback */
 MHD_Result access_handler_callback(void* cls, struct MHD_Connection* connection,
                                    const char* url, const char* method, const char* version,
@@ -107,42 +225,75 @@ MHD_Result access_handler_callback(void* cls, struct MHD_Connection* connection,
             return send_response(connection, response);
         }
 
+        auto make_response = [&odata_version, &odata_version_4_0]() {
+            Response response;
+            response.set_header("Cache-Control", "no-cache");
+            response.set_header(odata_version, odata_version_4_0);
+            return response;
+        };
+
         auto* connector = static_cast<MHDConnector*>(cls);
+        const bool suspendable = ConnectorOptions::ThreadMode::SELECT == connector->get_options().get_thread_mode();
 
-        auto deleter = [&con_cls](Request* r) {
+        auto deleter = [&con_cls](RequestContext* r) {
             delete r;
             *con_cls = nullptr;
         };
-        std::unique_ptr<Request, decltype(deleter)> request(static_cast<Request*>(*con_cls), deleter);
-
-        if (!request) {
-            request.reset(new Request());
-            request->set_destination(url);
-            request->set_HTTP_version(version);
-            request->set_method(get_request_method(method));
-            *con_cls = request.release();
+        std::unique_ptr<RequestContext, decltype(deleter)> context(static_cast<RequestContext*>(*con_cls), deleter);
+
+        if (!context) {
+            context.reset(new RequestContext());
+            context->request.set_destination(url);
+            context->request.set_HTTP_version(version);
+            context->request.set_method(get_request_method(method));
+            if (Method::POST == context->request.get_method()) {
+                // Uploads are authenticated before any of the body is accepted
+                MHD_Result result = MHD_NO;
+                if (!authenticate_request(*connector, connection, method, url, result)) {
+                    return result;
+                }
+                context->authenticated = true;
+
+                MHD_get_connection_values(connection, MHD_HEADER_KIND,
+                                          &add_request_headers, &context->request);
+                Response response = make_response();
+                if (!connector->open_upload(context->request, response, context->upload)) {
+                    return send_response(connection, response);
+                }
+                context->request.set_upload(context->upload);
+            }
+            *con_cls = context.release();
             return MHD_YES;
         }
 
+        auto* request = &context->request;
+        if (context->deferred) {
+            // Called again once the parked connection is resumed
+            Response response = make_response();
+            connector->complete(*request, *context->deferred, response);
+            return send_response(connection, response, suspendable);
+        }
+
         if (0 != *upload_data_size) {
-            request->append_body(std::string{upload_data, *upload_data_size});
+            if (context->upload) {
+                Response response = make_response();
+                if (!connector->write_upload(*request, *context->upload, upload_data, *upload_data_size, response)) {
+                    // Rest of the body is not read, the connection is closed after the response
+                    return send_response(connection, response);
+                }
+            }
+            else {
+                request->append_body(std::string{upload_data, *upload_data_size});
+            }
             *upload_data_size = 0;
-            *con_cls = request.release();
+            *con_cls = context.release();
             return MHD_YES;
         }
 
-        if (connector->get_options().is_client_cert_required()) {
-            Response response;
-            if (connector->client_cert_authenticate(connection, url, response) == AuthStatus::FAIL) {
-                return send_response(connection, response);
-            }
-        }
-        if (!connector->unauthenticated_access_feasible(method, url) &&
-            connector->is_authentication_enabled()) {
-            Response response;
-            auto status = connector->authenticate(connection, url, response);
-            if (status == AuthStatus::FAIL) {
-                return send_response(connection, response);
+        if (!context->authenticated) {
+            MHD_Result result = MHD_NO;
+            if (!authenticate_request(*connector, connection, method, url, result)) {
+                return result;
             }
         }
 
@@ -161,15 +312,33 @@ MHD_Result access_handler_callback(void* cls, struct MHD_Connection* connection,
         }
 
         MHD_get_connection_values(connection, MHD_HEADER_KIND,
-                                  &add_request_headers, request.get());
-
-        Response response;
-        response.set_header("Cache-Control", "no-cache");
-        response.set_header(odata_version, odata_version_4_0);
+                                  &add_request_headers, request);
+        MHD_get_connection_values(connection, MHD_GET_ARGUMENT_KIND,
+                                  &add_request_query_arguments, request);
 
+        Response response = make_response();
         connector->handle(*request, response);
 
-        return send_response(connection, response);
+        if (auto deferred = response.get_deferred()) {
+            if (suspendable) {
+                // Park the connection, no headers are sent until the response is ready
+                context->deferred = std::move(deferred);
+                auto& parked = *context->deferred;
+                *con_cls = context.release();
+                MHD_suspend_connection(connection);
+                if (!parked.wait([connection]() { MHD_resume_connection(connection); })) {
+                    MHD_resume_connection(connection);
+                }
+                return MHD_YES;
+            }
+            while (!deferred->wait_for(STREAM_POLL_INTERVAL)) {
+            }
+            Response completed = make_response();
+            connector->complete(*request, *deferred, completed);
+            return send_response(connection, completed);
+        }
+
+        return send_response(connection, response, suspendable);
     }
     catch (...) {
         log_error("rest", "Unexpected exception in access_handler_callback");
@@ -180,39 +349,68 @@ MHD_Result access_handler_callback(void* cls, struct MHD_Connection* connection,
 } // namespace
 
 MHDConnector::MHDConnector(const ConnectorOptions& options)
-    : Connector(options), m_daemon{nullptr, &MHD_stop_daemon} {}
+    : Connector(options) {}
 
 MHDConnector::~MHDConnector() {
     MHDConnector::stop();
 }
 
 void MHDConnector::start() {
-    if (!m_daemon) {
+    if (m_daemons.empty()) {
         const auto port = get_options().get_port();
-        MHDConnectorOptions options(get_options());
-        m_daemon.reset(MHD_start_daemon(options.get_flags(),
-                                        port,
-                                        nullptr, nullptr,
-                                        access_handler_callback, this,
-                                        MHD_OPTION_ARRAY, options.get_options_array(),
-                                        MHD_OPTION_END));
-
-        if (!m_daemon) {
-            std::stringstream str;
-            str << "Cannot start connector on port " << port;
-            if (errno) {
-                str << ": " << strerror(errno);
+        const auto addresses = MHDConnectorOptions::get_listen_addresses(get_options());
+        const auto start_daemon = [this, port](MHDConnectorOptions options) {
+            MHDDaemonUPtr daemon{MHD_start_daemon(options.get_flags(),
+                                                  port,
+                                                  nullptr, nullptr,
+                                                  access_handler_callback, this,
+                                                  MHD_OPTION_NOTIFY_COMPLETED, &request_completed, nullptr,
+                                                  MHD_OPTION_ARRAY, options.get_options_array(),
+                                                  MHD_OPTION_END), &MHD_stop_daemon};
+            if (!daemon) {
+                std::stringstream str;
+                str << "Cannot start connector on port " << port;
+                if (errno) {
+                    str << ": " << strerror(errno);
+                }
+                // Daemons already started are stopped by the caller
+                throw std::runtime_error(str.str());
+            }
+            m_daemons.push_back(std::move(daemon));
+        };
+
+        try {
+            if (addresses.empty()) {
+                start_daemon(MHDConnectorOptions{get_options()});
+            }
+            for (const auto& address : addresses) {
+                start_daemon(MHDConnectorOptions{get_options(), address, addresses.size()});
             }
-            throw std::runtime_error(str.str());
+        }
+        catch (...) {
+            m_daemons.clear();
+            throw;
         }
 
-        log_info("rest", "HTTPS connector started on port: " << port);
+        if (get_options().get_socket_path().has_value()) {
+            log_info("rest", "Local connector started on socket: " << get_options().get_socket_path());
+        }
+        else {
+            log_info("rest", "HTTPS connector started on port: " << port
+                                 << " (" << std::max<std::size_t>(addresses.size(), 1) << " address(es))");
+        }
     }
 }
 
 void MHDConnector::stop() {
-    if (m_daemon) {
-        m_daemon.reset();
-        log_info("rest", "HTTPS connector on port: " << get_options().get_port() << " stopped\n");
+    if (!m_daemons.empty()) {
+        m_daemons.clear();
+        if (get_options().get_socket_path().has_value()) {
+            ::unlink(get_options().get_socket_path().value().c_str());
+            log_info("rest", "Local connector on socket: " << get_options().get_socket_path() << " stopped\n");
+        }
+        else {
+            log_info("rest", "HTTPS connector on port: " << get_options().get_port() << " stopped\n");
+        }
     }
 }
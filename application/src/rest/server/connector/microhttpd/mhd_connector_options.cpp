@@ -32,14 +32,26 @@
 #include "logger/logger_factory.hpp"
 #include "net/network_interface.hpp"
 #include "net/socket_address.hpp"
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
 #include <thread>
 
 using namespace psme::rest::server;
 
 class MHDConnectorOptionsImpl {
 public:
-    MHDConnectorOptionsImpl(const ConnectorOptions& options) {
-        init_flags_and_options(options);
+    MHDConnectorOptionsImpl(const ConnectorOptions& options, const net::SocketAddress* address, std::size_t daemon_count)
+        : m_daemon_count{std::max<std::size_t>(daemon_count, 1)} {
+        init_flags_and_options(options, address);
     }
 
     unsigned int get_flags() const {
@@ -52,15 +64,18 @@ public:
 private:
     unsigned int m_flags{0};
     std::vector<MHD_OptionItem> m_option_array{};
+    std::size_t m_daemon_count;
     net::SocketAddress m_socket_address{};
 
-    void init_flags_and_options(const ConnectorOptions& options) {
+    void init_flags_and_options(const ConnectorOptions& options, const net::SocketAddress* address) {
 
-        init_socket_address(options);
+        init_socket_address(options, address);
 
         init_threading_mode(options);
 
-        init_ssl_options(options);
+        if (!options.get_socket_path().has_value()) {
+            init_ssl_options(options);
+        }
 
         init_debug_options(options);
 
@@ -74,11 +89,14 @@ private:
             m_flags |= MHD_USE_THREAD_PER_CONNECTION;
             break;
         case ConnectorOptions::ThreadMode::SELECT: {
-            m_flags |= MHD_USE_SELECT_INTERNALLY;
+            // Long-lived streamed responses are parked instead of holding a pool thread
+            m_flags |= MHD_USE_SELECT_INTERNALLY | MHD_ALLOW_SUSPEND_RESUME;
             auto thread_pool_size = options.get_thread_pool_size();
             if (0 == thread_pool_size) {
                 thread_pool_size = std::max(std::thread::hardware_concurrency(), 1u);
             }
+            // Daemons of one connector split the pool instead of multiplying it
+            thread_pool_size = static_cast<unsigned>((thread_pool_size + m_daemon_count - 1) / m_daemon_count);
             log_debug("rest", "connector on port " << options.get_port()
                                                    << " thread_pool_size: " << thread_pool_size);
             m_option_array.emplace_back(MHD_OptionItem{
@@ -112,20 +130,60 @@ private:
         }
     }
 
-    void init_socket_address(const ConnectorOptions& options) {
-        const auto& iface_name = options.get_network_interface_name();
-        if (!iface_name.has_value()) {
+    void init_socket_address(const ConnectorOptions& options, const net::SocketAddress* address) {
+        if (options.get_socket_path().has_value()) {
+            init_local_socket(options.get_socket_path());
+            return;
+        }
+        if (!address) {
             log_info("rest", "Starting MHD connector listening on 0.0.0.0");
             return;
         }
-        auto iface = net::NetworkInterface::for_name(iface_name);
-        const auto& ip_address = iface.get_first_address(net::AddressFamily::IPv4);
-        m_socket_address = net::SocketAddress(ip_address, options.get_port());
+        m_socket_address = *address;
+        if (net::AddressFamily::IPv6 == m_socket_address.family()) {
+            // Any-address accepts IPv4 clients as well, other addresses are bound IPv6 only
+            if (m_socket_address.get_host().is_any_address()) {
+                m_flags |= MHD_USE_DUAL_STACK;
+            }
+            else {
+                m_flags |= MHD_USE_IPv6;
+            }
+        }
         m_option_array.emplace_back(MHD_OptionItem{
             MHD_OPTION_SOCK_ADDR, intptr_t(0),
             static_cast<void*>(const_cast<struct sockaddr*>(m_socket_address.addr()))});
-        log_info("rest", "Starting MHD connector listening on " << m_socket_address
-                                                                << " (" << options.get_network_interface_name() << ")");
+        log_info("rest", "Starting MHD connector listening on " << m_socket_address);
+    }
+
+    void init_local_socket(const std::string& path) {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+            throw std::runtime_error("Invalid socket path: " + path);
+        }
+        std::memcpy(address.sun_path, path.c_str(), path.size());
+
+        // Socket file left behind by a previous run
+        ::unlink(path.c_str());
+        const int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (fd < 0) {
+            throw std::runtime_error(std::string{"Cannot create socket: "} + strerror(errno));
+        }
+        // Only the owner and its group may connect, callers are checked by their credentials.
+        // The file is created with these permissions, there is no window in which others may connect.
+        const auto old_mask = ::umask(S_IXUSR | S_IXGRP | S_IRWXO);
+        const bool bound = 0 == ::bind(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+        const int bind_error = errno;
+        ::umask(old_mask);
+        errno = bind_error;
+        if (!bound || 0 != ::listen(fd, SOMAXCONN)) {
+            const std::string reason = strerror(errno);
+            ::close(fd);
+            throw std::runtime_error("Cannot listen on " + path + ": " + reason);
+        }
+        // Closed by MHD when the daemon stops
+        m_option_array.emplace_back(MHD_OptionItem{MHD_OPTION_LISTEN_SOCKET, intptr_t(fd), nullptr});
+        log_info("rest", "Starting MHD connector listening on " << path);
     }
 
     void init_debug_options(const ConnectorOptions& options) {
@@ -135,8 +193,87 @@ private:
     }
 };
 
+namespace {
+
+/*! @brief Link-local addresses need a scope, they are never picked from an interface */
+bool is_link_local(const net::IpAddress& address) {
+    if (net::AddressFamily::IPv6 != address.get_address_family()) {
+        return false;
+    }
+    const auto ipv6 = address.ipv6_address();
+    return IN6_IS_ADDR_LINKLOCAL(&ipv6);
+}
+
+} // namespace
+
+std::vector<net::IpAddress> MHDConnectorOptions::get_interface_addresses(
+    const net::NetworkInterface::AddressList& address_list) {
+    std::vector<net::IpAddress> addresses{};
+    for (const auto family : {net::AddressFamily::IPv4, net::AddressFamily::IPv6}) {
+        for (const auto& entry : address_list) {
+            const auto& address = std::get<net::NetworkInterface::IP_ADDRESS>(entry);
+            if (family == address.get_address_family() && !is_link_local(address)) {
+                addresses.push_back(address);
+                break;
+            }
+        }
+    }
+    return addresses;
+}
+
+std::vector<net::SocketAddress> MHDConnectorOptions::get_listen_addresses(const ConnectorOptions& options) {
+    std::vector<net::IpAddress> addresses{};
+    if (options.get_socket_path().has_value()) {
+        return {};
+    }
+    if (!options.get_bind_addresses().empty()) {
+        for (const auto& bind_address : options.get_bind_addresses()) {
+            addresses.push_back(net::IpAddress::from_string(bind_address));
+        }
+    }
+    else if (options.get_network_interface_name().has_value()) {
+        const auto& iface_name = options.get_network_interface_name().value();
+        addresses = get_interface_addresses(net::NetworkInterface::for_name(iface_name).get_address_list());
+        if (addresses.empty()) {
+            throw std::runtime_error("No address to listen on found on interface " + iface_name);
+        }
+    }
+    else {
+        return {};
+    }
+
+    // Addresses covered by an any-address of their family, or listed twice, would fail with EADDRINUSE.
+    // The IPv6 any-address is dual stack, it covers IPv4 addresses too.
+    const auto covers = [](const net::IpAddress& any, const net::IpAddress& address) {
+        return any.is_any_address() && !(any == address) &&
+               (net::AddressFamily::IPv6 == any.get_address_family() ||
+                any.get_address_family() == address.get_address_family());
+    };
+    std::vector<net::IpAddress> listened{};
+    for (const auto& address : addresses) {
+        const bool covered = std::any_of(addresses.begin(), addresses.end(),
+                                         [&covers, &address](const net::IpAddress& any) { return covers(any, address); });
+        if (covered || listened.end() != std::find(listened.begin(), listened.end(), address)) {
+            log_warning("rest", "Connector on port " << options.get_port() << " already listens on "
+                                                     << address.to_string() << ", the bind address is ignored.");
+            continue;
+        }
+        listened.push_back(address);
+    }
+
+    std::vector<net::SocketAddress> listen_addresses{};
+    for (const auto& address : listened) {
+        listen_addresses.emplace_back(address, options.get_port());
+    }
+    return listen_addresses;
+}
+
 MHDConnectorOptions::MHDConnectorOptions(const ConnectorOptions& options)
-    : m_options_impl(new MHDConnectorOptionsImpl(options)) {}
+    : m_options_impl(new MHDConnectorOptionsImpl(options, nullptr, 1)) {}
+
+MHDConnectorOptions::MHDConnectorOptions(const ConnectorOptions& options, const net::SocketAddress& address,
+                                         std::size_t daemon_count)
+    : m_options_impl(new MHDConnectorOptionsImpl(options, &address, daemon_count)) {}
 
 unsigned int MHDConnectorOptions::get_flags() const {
     return m_options_impl->get_flags();
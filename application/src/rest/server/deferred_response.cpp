@@ -0,0 +1,8 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/server/deferred_response.hpp"
+
+using namespace psme::rest::server;
+
+DeferredResponse::~DeferredResponse() {}
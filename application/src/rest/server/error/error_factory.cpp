@@ -80,6 +80,9 @@ static const constexpr char PROPERTY_VALUE_NOT_IN_LIST_RESOLUTION[] = "Choose a
 static const constexpr char PROPERTY_VALUE_FORMAT_ERROR_MESSAGE[] = "The value %s for the property %s is a different format than the property can accept.";
 static const constexpr char PROPERTY_VALUE_FORMAT_ERROR_RESOLUTION[] = "Correct the value for the property in the request body and resubmit the request if the operation failed.";
 
+static const constexpr char QUERY_PARAMETER_VALUE_FORMAT_ERROR_MESSAGE[] = "The value %s for the parameter %s is of a different format than the parameter can accept.";
+static const constexpr char QUERY_PARAMETER_VALUE_FORMAT_ERROR_RESOLUTION[] = "Correct the value for the query parameter in the request and resubmit the request if the operation failed.";
+
 static const constexpr char SERVICE_TEMPORARILY_UNAVAILABLE_MESSAGE[] = "The service is temporarily unavailable. Retry in %d seconds.";
 static const constexpr char SERVICE_TEMPORARILY_UNAVAILABLE_RESOLUTION[] = "Wait for the indicated retry duration and retry the operation.";
 
@@ -466,6 +469,22 @@ ServerError ErrorFactory::create_value_format_error(const std::string& property,
     return server_error;
 }
 
+ServerError ErrorFactory::create_query_parameter_value_format_error(const std::string& parameter,
+                                                                    const std::string& parameter_value,
+                                                                    const std::string& message) {
+    auto server_error = create_error(BAD_REQUEST, ServerError::QUERY_PARAMETER_VALUE_FORMAT_ERROR,
+                                     ::QUERY_PARAMETER_VALUE_FORMAT_ERROR_MESSAGE, parameter_value.c_str(), parameter.c_str());
+    if (!message.empty()) {
+        server_error.add_extended_message(
+            ::create_message_object(
+                ServerError::QUERY_PARAMETER_VALUE_FORMAT_ERROR,
+                message,
+                Severity::Warning,
+                ::QUERY_PARAMETER_VALUE_FORMAT_ERROR_RESOLUTION));
+    }
+    return server_error;
+}
+
 ServerError ErrorFactory::create_value_not_in_list_error(const std::string& property,
                                                          const std::string& property_value,
                                                          const std::string& message,
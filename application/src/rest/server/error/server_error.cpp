@@ -43,6 +43,7 @@ const constexpr char ServerError::PROPERTY_MISSING[];
 const constexpr char ServerError::PROPERTY_VALUE_TYPE_ERROR[];
 const constexpr char ServerError::PROPERTY_VALUE_NOT_IN_LIST[];
 const constexpr char ServerError::PROPERTY_VALUE_FORMAT_ERROR[];
+const constexpr char ServerError::QUERY_PARAMETER_VALUE_FORMAT_ERROR[];
 const constexpr char ServerError::PROPERTY_DUPLICATE[];
 const constexpr char ServerError::ACTION_NOT_SUPPORTED[];
 
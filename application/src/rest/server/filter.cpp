@@ -0,0 +1,347 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/server/filter.hpp"
+#include "psme/rest/server/error/error_factory.hpp"
+#include "psme/rest/server/error/server_exception.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <regex>
+
+using namespace psme::rest::server;
+using namespace psme::rest::error;
+
+struct Filter::Node {
+    enum class Type {
+        AND,
+        OR,
+        NOT,
+        COMPARISON
+    };
+
+    enum class Operator {
+        EQ,
+        NE,
+        GT,
+        GE,
+        LT,
+        LE
+    };
+
+    Type type{Type::COMPARISON};
+    Operator op{Operator::EQ};
+    std::string property{};
+    json::Json value{};
+    std::shared_ptr<const Node> left{};
+    std::shared_ptr<const Node> right{};
+};
+
+namespace {
+
+constexpr const char FILTER[] = "$filter";
+
+/*! @brief Deepest nesting of parentheses and 'not', the parser recurses once per level */
+constexpr std::size_t MAX_NESTING = 32;
+
+using Node = Filter::Node;
+using NodePtr = std::shared_ptr<const Node>;
+
+const std::vector<std::pair<std::string, Node::Operator>> OPERATORS = {
+    {"eq", Node::Operator::EQ},
+    {"ne", Node::Operator::NE},
+    {"gt", Node::Operator::GT},
+    {"ge", Node::Operator::GE},
+    {"lt", Node::Operator::LT},
+    {"le", Node::Operator::LE}};
+
+NodePtr make_logical(Node::Type type, NodePtr left, NodePtr right) {
+    auto node = std::make_shared<Node>();
+    node->type = type;
+    node->left = std::move(left);
+    node->right = std::move(right);
+    return node;
+}
+
+/*! @brief Recursive descent parser of $filter expressions */
+class Parser {
+public:
+    explicit Parser(const std::string& expression) : m_expression{expression} {
+        tokenize();
+    }
+
+    NodePtr parse() {
+        if (m_tokens.empty()) {
+            error("Empty expression.");
+        }
+        auto root = parse_or();
+        if (m_position != m_tokens.size()) {
+            error("Unexpected '" + m_tokens[m_position].text + "'.");
+        }
+        return root;
+    }
+private:
+    enum class TokenType {
+        LEFT_PARENTHESIS,
+        RIGHT_PARENTHESIS,
+        WORD,
+        LITERAL
+    };
+
+    struct Token {
+        TokenType type{TokenType::WORD};
+        std::string text{};
+        json::Json value{};
+    };
+
+    [[noreturn]] void error(const std::string& message) const {
+        throw ServerException(ErrorFactory::create_query_parameter_value_format_error(FILTER, m_expression, message));
+    }
+
+    void tokenize() {
+        static const std::regex NUMBER{"[-+]?[0-9]+(\\.[0-9]+)?([eE][-+]?[0-9]+)?"};
+        static const std::regex INTEGER{"[-+]?[0-9]{1,18}"};
+
+        std::size_t i = 0;
+        while (i < m_expression.size()) {
+            const char c = m_expression[i];
+            if (std::isspace(static_cast<unsigned char>(c))) {
+                ++i;
+            }
+            else if ('(' == c || ')' == c) {
+                m_tokens.push_back(Token{'(' == c ? TokenType::LEFT_PARENTHESIS : TokenType::RIGHT_PARENTHESIS,
+                                         std::string(1, c), {}});
+                ++i;
+            }
+            else if ('\'' == c) {
+                std::string text{};
+                bool terminated = false;
+                for (++i; i < m_expression.size(); ++i) {
+                    if ('\'' == m_expression[i]) {
+                        // Quote is escaped by doubling it
+                        if (i + 1 < m_expression.size() && '\'' == m_expression[i + 1]) {
+                            text += '\'';
+                            ++i;
+                            continue;
+                        }
+                        terminated = true;
+                        ++i;
+                        break;
+                    }
+                    text += m_expression[i];
+                }
+                if (!terminated) {
+                    error("Unterminated string literal.");
+                }
+                m_tokens.push_back(Token{TokenType::LITERAL, text, text});
+            }
+            else {
+                const auto start = i;
+                while (i < m_expression.size() && !std::isspace(static_cast<unsigned char>(m_expression[i])) &&
+                       '(' != m_expression[i] && ')' != m_expression[i] && '\'' != m_expression[i]) {
+                    ++i;
+                }
+                const auto text = m_expression.substr(start, i - start);
+                if ("true" == text || "false" == text) {
+                    m_tokens.push_back(Token{TokenType::LITERAL, text, "true" == text});
+                }
+                else if ("null" == text) {
+                    m_tokens.push_back(Token{TokenType::LITERAL, text, nullptr});
+                }
+                else if (std::regex_match(text, INTEGER)) {
+                    m_tokens.push_back(Token{TokenType::LITERAL, text, std::stoll(text)});
+                }
+                else if (std::regex_match(text, NUMBER)) {
+                    m_tokens.push_back(Token{TokenType::LITERAL, text, std::stod(text)});
+                }
+                else {
+                    m_tokens.push_back(Token{TokenType::WORD, text, {}});
+                }
+            }
+        }
+    }
+
+    bool accept_word(const char* word) {
+        if (m_position < m_tokens.size() && TokenType::WORD == m_tokens[m_position].type &&
+            word == m_tokens[m_position].text) {
+            ++m_position;
+            return true;
+        }
+        return false;
+    }
+
+    const Token& next(const std::string& expected) {
+        if (m_position >= m_tokens.size()) {
+            error("Unexpected end of expression, expected " + expected + ".");
+        }
+        return m_tokens[m_position++];
+    }
+
+    NodePtr parse_or() {
+        auto left = parse_and();
+        while (accept_word("or")) {
+            left = make_logical(Node::Type::OR, left, parse_and());
+        }
+        return left;
+    }
+
+    NodePtr parse_and() {
+        auto left = parse_not();
+        while (accept_word("and")) {
+            left = make_logical(Node::Type::AND, left, parse_not());
+        }
+        return left;
+    }
+
+    NodePtr parse_not() {
+        if (accept_word("not")) {
+            enter();
+            auto node = make_logical(Node::Type::NOT, parse_not(), nullptr);
+            --m_nesting;
+            return node;
+        }
+        return parse_primary();
+    }
+
+    NodePtr parse_primary() {
+        const auto& token = next("property name or '('");
+        if (TokenType::LEFT_PARENTHESIS == token.type) {
+            enter();
+            auto node = parse_or();
+            if (TokenType::RIGHT_PARENTHESIS != next("')'").type) {
+                error("Expected ')'.");
+            }
+            --m_nesting;
+            return node;
+        }
+        if (TokenType::WORD != token.type || is_keyword(token.text)) {
+            error("Expected property name instead of '" + token.text + "'.");
+        }
+
+        auto node = std::make_shared<Node>();
+        node->property = token.text;
+
+        const auto& op = next("comparison operator");
+        auto it = std::find_if(OPERATORS.begin(), OPERATORS.end(),
+                               [&op](const std::pair<std::string, Node::Operator>& item) {
+                                   return TokenType::WORD == op.type && item.first == op.text;
+                               });
+        if (it == OPERATORS.end()) {
+            error("Unsupported comparison operator '" + op.text + "'.");
+        }
+        node->op = it->second;
+
+        const auto& value = next("literal value");
+        if (TokenType::LITERAL != value.type) {
+            error("Expected literal value instead of '" + value.text + "'.");
+        }
+        node->value = value.value;
+        return node;
+    }
+
+    /*! @brief Client supplied expressions must not exhaust the stack of the request thread */
+    void enter() {
+        if (++m_nesting > MAX_NESTING) {
+            error("Expression is nested deeper than " + std::to_string(MAX_NESTING) + " levels.");
+        }
+    }
+
+    static bool is_keyword(const std::string& word) {
+        return "and" == word || "or" == word || "not" == word ||
+               std::any_of(OPERATORS.begin(), OPERATORS.end(),
+                           [&word](const std::pair<std::string, Node::Operator>& item) {
+                               return item.first == word;
+                           });
+    }
+
+    const std::string& m_expression;
+    std::vector<Token> m_tokens{};
+    std::size_t m_position{0};
+    std::size_t m_nesting{0};
+};
+
+bool compare(const json::Json& actual, Node::Operator op, const json::Json& expected) {
+    const bool numbers = actual.is_number() && expected.is_number();
+    const bool comparable = numbers || actual.type() == expected.type();
+    const bool ordered = numbers || (actual.is_string() && expected.is_string());
+
+    switch (op) {
+    case Node::Operator::EQ:
+        return comparable && actual == expected;
+    case Node::Operator::NE:
+        return !comparable || actual != expected;
+    case Node::Operator::GT:
+        return ordered && expected < actual;
+    case Node::Operator::GE:
+        return ordered && !(actual < expected);
+    case Node::Operator::LT:
+        return ordered && actual < expected;
+    case Node::Operator::LE:
+        return ordered && !(expected < actual);
+    default:
+        return false;
+    }
+}
+
+bool evaluate_node(const Node& node, const Filter::PropertyGetter& getter) {
+    switch (node.type) {
+    case Node::Type::AND:
+        return evaluate_node(*node.left, getter) && evaluate_node(*node.right, getter);
+    case Node::Type::OR:
+        return evaluate_node(*node.left, getter) || evaluate_node(*node.right, getter);
+    case Node::Type::NOT:
+        return !evaluate_node(*node.left, getter);
+    case Node::Type::COMPARISON:
+    default:
+        return compare(getter(node.property), node.op, node.value);
+    }
+}
+
+void collect_properties(const Node& node, std::vector<std::string>& properties) {
+    if (Node::Type::COMPARISON == node.type) {
+        if (std::find(properties.begin(), properties.end(), node.property) == properties.end()) {
+            properties.push_back(node.property);
+        }
+        return;
+    }
+    collect_properties(*node.left, properties);
+    if (node.right) {
+        collect_properties(*node.right, properties);
+    }
+}
+
+void collect_equalities(const Node& node, std::vector<Filter::Equality>& equalities) {
+    if (Node::Type::AND == node.type) {
+        collect_equalities(*node.left, equalities);
+        collect_equalities(*node.right, equalities);
+    }
+    else if (Node::Type::COMPARISON == node.type && Node::Operator::EQ == node.op) {
+        equalities.emplace_back(node.property, node.value);
+    }
+}
+
+} // namespace
+
+Filter Filter::parse(const std::string& expression) {
+    return Filter{Parser{expression}.parse(), expression};
+}
+
+bool Filter::evaluate(const PropertyGetter& getter) const {
+    return !m_root || evaluate_node(*m_root, getter);
+}
+
+std::vector<std::string> Filter::get_properties() const {
+    std::vector<std::string> properties{};
+    if (m_root) {
+        collect_properties(*m_root, properties);
+    }
+    return properties;
+}
+
+std::vector<Filter::Equality> Filter::get_required_equalities() const {
+    std::vector<Equality> equalities{};
+    if (m_root) {
+        collect_equalities(*m_root, equalities);
+    }
+    return equalities;
+}
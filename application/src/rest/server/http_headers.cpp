@@ -39,8 +39,17 @@ const char JSON[] = "application/json";
 const char XML[] = "application/xml";
 /*! @brief Content-Type header value of "plain/text" */
 const char TXT[] = "text/plain";
+/*! @brief Content-Type header value of "text/event-stream" */
+const char EVENT_STREAM[] = "text/event-stream";
+/*! @brief Content-Type header value of "multipart/form-data" */
+const char MULTIPART_FORM_DATA[] = "multipart/form-data";
 } // namespace ContentType
 
+namespace ContentLength {
+/*! @brief Content-Length header constant */
+const char CONTENT_LENGTH[] = "Content-Length";
+} // namespace ContentLength
+
 namespace WWWAuthenticate {
 /*! @brief WWW-Authenticate header constant */
 const char WWW_AUTHENTICATE[] = "WWW-Authenticate";
@@ -72,6 +81,47 @@ namespace Location {
 const char LOCATION[] = "Location";
 } // namespace Location
 
+namespace ETag {
+/*! @brief ETag header constant */
+const char ETAG[] = "ETag";
+/*! @brief If-None-Match header constant */
+const char IF_NONE_MATCH[] = "If-None-Match";
+} // namespace ETag
+
+namespace ContentEncoding {
+/*! @brief Content-Encoding header constant */
+const char CONTENT_ENCODING[] = "Content-Encoding";
+/*! @brief Accept-Encoding header constant */
+const char ACCEPT_ENCODING[] = "Accept-Encoding";
+/*! @brief Vary header constant */
+const char VARY[] = "Vary";
+/*! @brief Content coding value of "identity" */
+const char IDENTITY[] = "identity";
+/*! @brief Content coding value of "gzip" */
+const char GZIP[] = "gzip";
+/*! @brief Content coding value of "zstd" */
+const char ZSTD[] = "zstd";
+} // namespace ContentEncoding
+
+namespace Allow {
+/*! @brief Allow header constant */
+const char ALLOW[] = "Allow";
+} // namespace Allow
+
+namespace LastEventId {
+/*! @brief Last-Event-ID header constant, sent by reconnecting SSE clients */
+const char LAST_EVENT_ID[] = "Last-Event-ID";
+} // namespace LastEventId
+
+namespace Prefer {
+/*! @brief Prefer header constant */
+const char PREFER[] = "Prefer";
+/*! @brief Prefer header value of "wait" */
+const char WAIT[] = "wait";
+/*! @brief Preference-Applied header constant */
+const char PREFERENCE_APPLIED[] = "Preference-Applied";
+} // namespace Prefer
+
 } // namespace http_headers
 } // namespace server
 } // namespace rest
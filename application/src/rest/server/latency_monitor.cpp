@@ -0,0 +1,44 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/server/latency_monitor.hpp"
+
+#include <algorithm>
+
+using namespace psme::rest::server;
+
+constexpr std::size_t LatencyMonitor::SAMPLE_COUNT;
+constexpr std::chrono::seconds LatencyMonitor::WINDOW;
+
+LatencyMonitor::~LatencyMonitor() {}
+
+void LatencyMonitor::record(std::chrono::microseconds latency, Clock::time_point now) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (m_samples.size() < SAMPLE_COUNT) {
+        m_samples.push_back({now, latency});
+        return;
+    }
+    m_samples[m_next] = {now, latency};
+    m_next = (m_next + 1) % SAMPLE_COUNT;
+}
+
+std::chrono::microseconds LatencyMonitor::get_percentile(unsigned percentile, Clock::time_point now) const {
+    std::vector<std::chrono::microseconds> recent{};
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        recent.reserve(m_samples.size());
+        for (const auto& sample : m_samples) {
+            if (sample.time <= now && now - sample.time <= WINDOW) {
+                recent.push_back(sample.latency);
+            }
+        }
+    }
+    if (recent.empty()) {
+        return std::chrono::microseconds{0};
+    }
+    // Nearest-rank percentile
+    const auto rank = (std::clamp(percentile, 1u, 100u) * recent.size() + 99) / 100;
+    const auto nth = recent.begin() + static_cast<std::ptrdiff_t>(rank - 1);
+    std::nth_element(recent.begin(), nth, recent.end());
+    return *nth;
+}
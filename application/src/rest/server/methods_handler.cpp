@@ -53,3 +53,7 @@ MethodsHandler::~MethodsHandler() {}
 const std::string& MethodsHandler::get_path() const {
     return m_path;
 }
+
+std::shared_ptr<UploadStream> MethodsHandler::open_upload(const Request&) {
+    return nullptr;
+}
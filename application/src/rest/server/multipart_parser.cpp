@@ -0,0 +1,202 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/server/multipart_parser.hpp"
+#include "psme/rest/server/error/error_factory.hpp"
+#include "psme/rest/server/error/server_exception.hpp"
+#include "psme/rest/server/http_headers.hpp"
+
+#include <algorithm>
+#include <cctype>
+
+using namespace psme::rest::server;
+using namespace psme::rest::error;
+
+constexpr std::size_t MultipartParser::MAX_HEADERS_SIZE;
+
+namespace {
+
+constexpr char CRLF[] = "\r\n";
+constexpr std::size_t CRLF_SIZE = 2;
+constexpr char HEADERS_END[] = "\r\n\r\n";
+constexpr std::size_t HEADERS_END_SIZE = 4;
+
+/*! @brief RFC 2046 limit of the boundary length */
+constexpr std::size_t MAX_BOUNDARY_SIZE = 70;
+
+std::string to_lower(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) { return std::tolower(c); });
+    return text;
+}
+
+std::string trim(const std::string& text) {
+    const auto first = text.find_first_not_of(" \t");
+    if (std::string::npos == first) {
+        return {};
+    }
+    return text.substr(first, text.find_last_not_of(" \t") - first + 1);
+}
+
+void throw_malformed(const std::string& message) {
+    throw ServerException(ErrorFactory::create_invalid_payload_error("Malformed multipart body: " + message));
+}
+
+/*!
+ * @brief Get parameter of a header value, e.g. boundary of Content-Type.
+ * @return Unquoted parameter value, empty if not present.
+ */
+std::string get_parameter(const std::string& value, const std::string& parameter) {
+    std::size_t start = value.find(';');
+    while (std::string::npos != start) {
+        const auto end = value.find(';', start + 1);
+        const auto item = trim(value.substr(start + 1, end - start - 1));
+        const auto equals = item.find('=');
+        if (std::string::npos != equals && to_lower(trim(item.substr(0, equals))) == parameter) {
+            auto result = trim(item.substr(equals + 1));
+            if (result.size() >= 2 && '"' == result.front() && '"' == result.back()) {
+                result = result.substr(1, result.size() - 2);
+            }
+            return result;
+        }
+        start = end;
+    }
+    return {};
+}
+
+} // namespace
+
+MultipartParser::MultipartParser(const std::string& content_type) {
+    if (to_lower(content_type).find(http_headers::ContentType::MULTIPART_FORM_DATA) != 0) {
+        throw ServerException(ErrorFactory::create_invalid_payload_error(
+            "Content-Type " + std::string{http_headers::ContentType::MULTIPART_FORM_DATA} + " is required."));
+    }
+    const auto boundary = get_parameter(content_type, "boundary");
+    if (boundary.empty() || boundary.size() > MAX_BOUNDARY_SIZE) {
+        throw ServerException(ErrorFactory::create_invalid_payload_error("Invalid multipart boundary."));
+    }
+    m_delimiter = std::string{CRLF} + "--" + boundary;
+    // The first boundary may start the body, the CRLF preceding it is implied
+    m_buffer = CRLF;
+}
+
+void MultipartParser::set_callbacks(PartCallback on_part, DataCallback on_data, PartEndCallback on_part_end) {
+    m_on_part = std::move(on_part);
+    m_on_data = std::move(on_data);
+    m_on_part_end = std::move(on_part_end);
+}
+
+void MultipartParser::parse(const char* data, std::size_t size) {
+    if (State::EPILOGUE == m_state) {
+        return;
+    }
+    m_buffer.append(data, size);
+
+    std::size_t pos = 0;
+    bool pending = true;
+    while (pending) {
+        switch (m_state) {
+        case State::PREAMBLE:
+        case State::BODY: {
+            const auto found = m_buffer.find(m_delimiter, pos);
+            if (std::string::npos == found) {
+                // Tail may be the beginning of a delimiter split between pieces
+                const auto end = std::max(pos, m_buffer.size() - std::min(m_buffer.size(), m_delimiter.size() - 1));
+                if (State::BODY == m_state && end > pos && m_on_data) {
+                    m_on_data(m_buffer.data() + pos, end - pos);
+                }
+                pos = end;
+                pending = false;
+                break;
+            }
+            if (State::BODY == m_state) {
+                if (found > pos && m_on_data) {
+                    m_on_data(m_buffer.data() + pos, found - pos);
+                }
+                if (m_on_part_end) {
+                    m_on_part_end();
+                }
+            }
+            pos = found + m_delimiter.size();
+            m_state = State::DELIMITER;
+        } break;
+        case State::DELIMITER: {
+            // Transport padding may follow the boundary
+            const auto end = m_buffer.find_first_not_of(" \t", pos);
+            if (std::string::npos == end || m_buffer.size() - end < CRLF_SIZE) {
+                pending = false;
+                break;
+            }
+            if (0 == m_buffer.compare(end, 2, "--")) {
+                m_state = State::EPILOGUE;
+                pos = m_buffer.size();
+                pending = false;
+            }
+            else if (0 == m_buffer.compare(end, CRLF_SIZE, CRLF)) {
+                m_state = State::HEADERS;
+                pos = end + CRLF_SIZE;
+            }
+            else {
+                throw_malformed("invalid boundary.");
+            }
+        } break;
+        case State::HEADERS: {
+            std::size_t end = std::string::npos;
+            std::size_t skip = 0;
+            if (m_buffer.size() - pos >= CRLF_SIZE && 0 == m_buffer.compare(pos, CRLF_SIZE, CRLF)) {
+                end = pos;
+                skip = CRLF_SIZE;
+            }
+            else {
+                end = m_buffer.find(HEADERS_END, pos);
+                skip = HEADERS_END_SIZE;
+            }
+            if (std::string::npos == end) {
+                if (m_buffer.size() - pos > MAX_HEADERS_SIZE) {
+                    throw_malformed("part headers are too large.");
+                }
+                pending = false;
+                break;
+            }
+            parse_headers(m_buffer.substr(pos, end - pos));
+            pos = end + skip;
+            m_state = State::BODY;
+        } break;
+        case State::EPILOGUE:
+        default:
+            pos = m_buffer.size();
+            pending = false;
+            break;
+        }
+    }
+    m_buffer.erase(0, pos);
+}
+
+void MultipartParser::parse_headers(const std::string& headers) {
+    Part part{};
+    std::size_t start = 0;
+    while (start < headers.size()) {
+        auto end = headers.find(CRLF, start);
+        if (std::string::npos == end) {
+            end = headers.size();
+        }
+        const auto line = headers.substr(start, end - start);
+        start = end + CRLF_SIZE;
+
+        const auto colon = line.find(':');
+        if (std::string::npos == colon) {
+            throw_malformed("invalid part header.");
+        }
+        const auto name = to_lower(trim(line.substr(0, colon)));
+        const auto value = trim(line.substr(colon + 1));
+        if ("content-disposition" == name) {
+            part.name = get_parameter(value, "name");
+            part.filename = get_parameter(value, "filename");
+        }
+        else if (to_lower(http_headers::ContentType::CONTENT_TYPE) == name) {
+            part.content_type = value;
+        }
+    }
+    if (m_on_part) {
+        m_on_part(part);
+    }
+}
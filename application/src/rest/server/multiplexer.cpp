@@ -44,6 +44,7 @@
 #include "psme/rest/server/multiplexer.hpp"
 #include "psme/rest/constants/routes.hpp"
 #include "psme/rest/server/error/error_factory.hpp"
+#include "psme/rest/server/http_headers.hpp"
 #include "psme/rest/server/mux/matchers.hpp"
 #include "psme/rest/server/status.hpp"
 #include "psme/rest/server/utils.hpp"
@@ -60,11 +61,38 @@ void collect_request_params(Request& req, const mux::SegmentsVec& segments,
     }
 }
 
-void execute_handler(MethodsHandler& h, Request& req, Response& res) {
+/*! @brief Methods every handler supports, in the order they are listed in the Allow header */
+const std::vector<Method> ALL_METHODS{Method::GET, Method::HEAD, Method::POST, Method::PATCH,
+                                      Method::PUT, Method::DELETE, Method::OPTIONS};
+
+bool is_allowed(const std::vector<Method>& methods, Method method) {
+    return std::find(methods.begin(), methods.end(), method) != methods.end();
+}
+
+void method_not_allowed(const Request& req, Response& res, const std::string& allow) {
+    http_method_not_allowed(req, res);
+    res.set_header(http_headers::Allow::ALLOW, allow);
+}
+
+void execute_handler(MethodsHandler& h, const std::vector<Method>& methods, const std::string& allow,
+                     Request& req, Response& res) {
+    if (!is_allowed(methods, req.get_method())) {
+        method_not_allowed(req, res, allow);
+        return;
+    }
+
     switch (req.get_method()) {
     case Method::GET:
         h.get(req, res);
         break;
+    case Method::HEAD:
+        // Connector sends headers and Content-Length of the GET representation without its body
+        h.get(req, res);
+        break;
+    case Method::OPTIONS:
+        res.set_status(status_2XX::OK);
+        res.set_header(http_headers::Allow::ALLOW, allow);
+        break;
     case Method::POST:
         h.post(req, res);
         break;
@@ -77,11 +105,9 @@ void execute_handler(MethodsHandler& h, Request& req, Response& res) {
     case Method::PUT:
         h.put(req, res);
         break;
-    case Method::HEAD:
-    case Method::OPTIONS:
     case Method::UNKNOWN:
     default:
-        http_method_not_allowed(req, res);
+        method_not_allowed(req, res, allow);
     }
 }
 
@@ -96,6 +122,10 @@ void Multiplexer::use_after(RequestHandler plugin) {
 }
 
 void Multiplexer::register_handler(MethodsHandler::UPtr handler) {
+    register_handler(std::move(handler), ALL_METHODS);
+}
+
+void Multiplexer::register_handler(MethodsHandler::UPtr handler, const std::vector<Method>& methods) {
     const auto& path = handler->get_path();
     // Find existing candidate
     for (auto& candidate : m_handler_candidates) {
@@ -105,8 +135,20 @@ void Multiplexer::register_handler(MethodsHandler::UPtr handler) {
         }
     }
 
+    std::vector<Method> allowed{};
+    std::string allow{};
+    for (const auto& method : ALL_METHODS) {
+        const bool implemented = (Method::HEAD == method) ? is_allowed(methods, Method::GET)
+                                                          : (Method::OPTIONS == method || is_allowed(methods, method));
+        if (implemented) {
+            allow += (allow.empty() ? "" : ", ") + std::string(method.to_string());
+            allowed.push_back(method);
+        }
+    }
+
     m_handler_candidates.emplace_back(PathHandlerCandidate(mux::path_to_segments(path),
-                                                           std::move(handler), path));
+                                                           std::move(handler), path,
+                                                           AllowedMethods{allowed, allow}));
 }
 
 const Multiplexer::PathHandlerCandidate& Multiplexer::select_handler(const std::vector<std::string>& segments,
@@ -127,12 +169,30 @@ const Multiplexer::PathHandlerCandidate& Multiplexer::select_handler(const std::
     throw error::ServerException(error::ErrorFactory::create_resource_missing_error(uri, message));
 }
 
+void Multiplexer::set_access_callback(AccessCallback callback) {
+    m_access_callback = std::move(callback);
+}
+
 void Multiplexer::forward_to_handler(Response& response, Request& request) {
+    if (Method::GET == request.get_method() || Method::HEAD == request.get_method()) {
+        auto query_options = QueryOptions::from_parameters(request.query);
+        query_options.set_max_page_size(m_page_size);
+        request.set_query_options(query_options);
+    }
+    dispatch(request, response);
+}
+
+void Multiplexer::dispatch(Request& request, Response& response) const {
 
     for (const auto& handler : m_plugin_pre_handlers) {
         handler(request, response);
     }
 
+    if (!m_access_callback(request, response)) {
+        auto message = "Credentials do not have sufficient privileges for the requested operation.";
+        throw error::ServerException(error::ErrorFactory::create_insufficient_privilege_error(message));
+    }
+
     // Split request path into segments
     const auto& url = request.get_url();
     auto request_segments = mux::split_path(url);
@@ -140,11 +200,53 @@ void Multiplexer::forward_to_handler(Response& response, Request& request) {
     const auto& candidate = select_handler(request_segments, url);
 
     auto& method_handler = *(std::get<1>(candidate));
+    const auto& allowed_methods = std::get<3>(candidate);
 
     // Collect parameters from REST path segments
     collect_request_params(request, std::get<0>(candidate), request_segments);
 
-    execute_handler(method_handler, request, response);
+    execute_handler(method_handler, std::get<0>(allowed_methods), std::get<1>(allowed_methods), request, response);
+
+    for (const auto& handler : m_plugin_post_handlers) {
+        handler(request, response);
+    }
+}
+
+std::shared_ptr<UploadStream> Multiplexer::open_upload(Request& request) const {
+    const auto& url = request.get_url();
+    auto request_segments = mux::split_path(url);
+    auto it = std::find_if(std::begin(m_handler_candidates),
+                           std::end(m_handler_candidates),
+                           [&request_segments](const PathHandlerCandidate& candidate) {
+                               return mux::segments_match(std::get<0>(candidate), request_segments);
+                           });
+    // Errors are reported once the request is handled
+    if (it == std::end(m_handler_candidates) || !is_allowed(std::get<0>(std::get<3>(*it)), request.get_method())) {
+        return nullptr;
+    }
+
+    collect_request_params(request, std::get<0>(*it), request_segments);
+    return std::get<1>(*it)->open_upload(request);
+}
+
+json::Json Multiplexer::get_resource(const Request& request, const std::string& url,
+                                     const QueryOptions& query_options) const {
+    // Same headers and credentials, but neither the body nor the parameters of the expanded request
+    Request expanded{request};
+    expanded.set_method(Method::GET);
+    expanded.set_destination(url);
+    expanded.set_body({});
+    expanded.set_upload(nullptr);
+    expanded.params = {};
+    expanded.query = {};
+    expanded.set_query_options(query_options);
+
+    Response response{};
+    dispatch(expanded, response);
+    if (status_2XX::OK != response.get_status()) {
+        throw std::runtime_error("GET " + url + " returned status " + std::to_string(response.get_status()));
+    }
+    return json::Json::parse(response.get_body());
 }
 
 bool Multiplexer::is_correct_endpoint_url(const std::string& url) const {
@@ -210,6 +312,10 @@ Parameters Multiplexer::try_get_params(const std::string& path, const std::strin
     return params;
 }
 
+void Multiplexer::set_page_size(std::size_t page_size) {
+    m_page_size = page_size;
+}
+
 Multiplexer::~Multiplexer() {}
 
 bool Multiplexer::check_public_access(const std::string& http_method, const std::string& url) const {
@@ -226,7 +332,7 @@ bool Multiplexer::check_public_access(const std::string& http_method, const std:
           endpoint_path == constants::Routes::ODATA_SERVICE_DOCUMENT ||
           endpoint_path == constants::Routes::METADATA_ROOT_PATH ||
           endpoint_path == constants::Routes::METADATA_PATH) &&
-         http_method == "GET")) {
+         (http_method == "GET" || http_method == "HEAD"))) {
         return true;
     }
     return false;
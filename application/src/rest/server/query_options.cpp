@@ -0,0 +1,275 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/server/query_options.hpp"
+#include "psme/rest/server/error/error_factory.hpp"
+#include "psme/rest/server/error/server_exception.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+using namespace psme::rest::server;
+using namespace psme::rest::error;
+
+constexpr char QueryOptions::SELECT[];
+constexpr char QueryOptions::EXPAND[];
+constexpr char QueryOptions::LEVELS[];
+constexpr char QueryOptions::TOP[];
+constexpr char QueryOptions::SKIP[];
+constexpr char QueryOptions::SKIP_TOKEN[];
+constexpr char QueryOptions::FILTER[];
+constexpr std::uint32_t QueryOptions::MAX_EXPAND_LEVELS;
+constexpr std::size_t QueryOptions::DEFAULT_PAGE_SIZE;
+
+namespace {
+
+constexpr const char ODATA_ANNOTATION[] = "@odata.";
+
+std::string trim(const std::string& str) {
+    const auto first = str.find_first_not_of(" \t");
+    if (std::string::npos == first) {
+        return {};
+    }
+    const auto last = str.find_last_not_of(" \t");
+    return str.substr(first, last - first + 1);
+}
+
+std::vector<std::string> split(const std::string& str, char delimiter) {
+    std::vector<std::string> tokens{};
+    std::string::size_type start = 0;
+    std::string::size_type end = 0;
+    while (std::string::npos != (end = str.find(delimiter, start))) {
+        tokens.emplace_back(trim(str.substr(start, end - start)));
+        start = end + 1;
+    }
+    tokens.emplace_back(trim(str.substr(start)));
+    return tokens;
+}
+
+[[noreturn]] void throw_format_error(const std::string& parameter, const std::string& value,
+                                     const std::string& message) {
+    throw ServerException(ErrorFactory::create_query_parameter_value_format_error(parameter, value, message));
+}
+
+void add_select_path(std::vector<QueryOptions::SelectProperty>& properties,
+                     const std::vector<std::string>& path, const std::string& value) {
+    auto* current = &properties;
+    for (const auto& name : path) {
+        if (name.empty()) {
+            throw_format_error(QueryOptions::SELECT, value, "Empty property name in $select.");
+        }
+        auto it = std::find_if(current->begin(), current->end(),
+                               [&name](const QueryOptions::SelectProperty& property) {
+                                   return property.name == name;
+                               });
+        if (it == current->end()) {
+            current->push_back(QueryOptions::SelectProperty{name, {}});
+            it = current->end() - 1;
+        }
+        else if (it->nested.empty()) {
+            // Whole property already selected
+            return;
+        }
+        current = &it->nested;
+    }
+    // Selecting the whole property overrides any of its nested selections
+    current->clear();
+}
+
+std::uint64_t parse_number(const char* parameter, const std::string& value) {
+    constexpr std::size_t MAX_DIGITS = 18;
+    const auto number = trim(value);
+    if (number.empty() || number.size() > MAX_DIGITS ||
+        !std::all_of(number.begin(), number.end(), [](unsigned char c) { return std::isdigit(c); })) {
+        throw_format_error(parameter, value, "Non-negative integer value is expected.");
+    }
+    return std::stoull(number);
+}
+
+std::string encode_query_value(const std::string& value) {
+    static const std::string ALLOWED{"-._~$()*,/=;:@!'"};
+    std::stringstream encoded{};
+    encoded << std::hex << std::uppercase << std::setfill('0');
+    for (const auto c : value) {
+        if (std::isalnum(static_cast<unsigned char>(c)) || ALLOWED.find(c) != std::string::npos) {
+            encoded << c;
+        }
+        else {
+            encoded << '%' << std::setw(2) << static_cast<unsigned>(static_cast<unsigned char>(c));
+        }
+    }
+    return encoded.str();
+}
+
+std::uint32_t parse_levels(const std::string& options, const std::string& value) {
+    if (options.size() < 2 || '(' != options.front() || ')' != options.back()) {
+        throw_format_error(QueryOptions::EXPAND, value, "Expected $levels option in parentheses.");
+    }
+    const auto option = split(options.substr(1, options.size() - 2), '=');
+    if (option.size() != 2 || option[0] != QueryOptions::LEVELS || option[1].empty() || option[1].size() > 2 ||
+        !std::all_of(option[1].begin(), option[1].end(), [](unsigned char c) { return std::isdigit(c); })) {
+        throw_format_error(QueryOptions::EXPAND, value, "Only $levels option with numeric value is supported.");
+    }
+    const auto levels = static_cast<std::uint32_t>(std::stoul(option[1]));
+    if (levels < 1 || levels > QueryOptions::MAX_EXPAND_LEVELS) {
+        throw_format_error(QueryOptions::EXPAND, value,
+                           "Value of $levels must be between 1 and " +
+                               std::to_string(QueryOptions::MAX_EXPAND_LEVELS) + ".");
+    }
+    return levels;
+}
+
+bool is_selected(const std::string& key, const std::vector<QueryOptions::SelectProperty>& properties,
+                 const QueryOptions::SelectProperty** selected) {
+    *selected = nullptr;
+    if (0 == key.compare(0, std::strlen(ODATA_ANNOTATION), ODATA_ANNOTATION)) {
+        return true;
+    }
+    // Property annotations (e.g. Members@odata.count) follow their property
+    const auto name = key.substr(0, key.find('@'));
+    auto it = std::find_if(properties.begin(), properties.end(),
+                           [&name](const QueryOptions::SelectProperty& property) {
+                               return property.name == name;
+                           });
+    if (it == properties.end()) {
+        return false;
+    }
+    if (name.size() == key.size()) {
+        *selected = &(*it);
+    }
+    return true;
+}
+
+void select_properties(json::Json& json, const std::vector<QueryOptions::SelectProperty>& properties) {
+    if (json.is_array()) {
+        for (auto& element : json) {
+            select_properties(element, properties);
+        }
+        return;
+    }
+    if (!json.is_object()) {
+        return;
+    }
+
+    json::Json projected(json::Json::value_t::object);
+    for (auto it = json.begin(); it != json.end(); ++it) {
+        const QueryOptions::SelectProperty* property{nullptr};
+        if (!is_selected(it.key(), properties, &property)) {
+            continue;
+        }
+        if (property && !property->nested.empty()) {
+            select_properties(it.value(), property->nested);
+        }
+        projected[it.key()] = std::move(it.value());
+    }
+    json = std::move(projected);
+}
+
+} // namespace
+
+QueryOptions QueryOptions::from_parameters(const Parameters& query) {
+    QueryOptions options{};
+    for (const auto& parameter : query) {
+        const auto& value = parameter.second;
+        if (SELECT == parameter.first) {
+            for (const auto& item : split(value, ',')) {
+                if ("*" == item) {
+                    options.m_select.clear();
+                    break;
+                }
+                add_select_path(options.m_select, split(item, '/'), value);
+            }
+            options.m_select_value = value;
+        }
+        else if (EXPAND == parameter.first) {
+            const auto expand = trim(value);
+            if (expand.empty()) {
+                throw_format_error(EXPAND, value, "Missing expand type.");
+            }
+            switch (expand.front()) {
+            case '*':
+                options.m_expand_type = ExpandType::ALL;
+                break;
+            case '.':
+                options.m_expand_type = ExpandType::SUBORDINATE;
+                break;
+            case '~':
+                options.m_expand_type = ExpandType::LINKS;
+                break;
+            default:
+                throw_format_error(EXPAND, value, "Supported expand types are '*', '.' and '~'.");
+            }
+            const auto levels = trim(expand.substr(1));
+            options.m_expand_levels = levels.empty() ? 1 : parse_levels(levels, value);
+            options.m_expand_value = value;
+        }
+        else if (TOP == parameter.first) {
+            options.m_has_top = true;
+            options.m_top = static_cast<std::size_t>(parse_number(TOP, value));
+        }
+        else if (SKIP == parameter.first) {
+            options.m_skip = static_cast<std::size_t>(parse_number(SKIP, value));
+        }
+        else if (SKIP_TOKEN == parameter.first) {
+            options.m_skip_token = parse_number(SKIP_TOKEN, value);
+        }
+        else if (FILTER == parameter.first) {
+            options.m_filter = Filter::parse(value);
+        }
+    }
+    return options;
+}
+
+QueryOptions QueryOptions::get_expanded_options(bool keep_select) const {
+    QueryOptions options{};
+    if (has_expand() && m_expand_levels > 1) {
+        options.m_expand_type = m_expand_type;
+        options.m_expand_levels = m_expand_levels - 1;
+    }
+    if (keep_select) {
+        options.m_select = m_select;
+    }
+    options.m_max_page_size = m_max_page_size;
+    return options;
+}
+
+std::size_t QueryOptions::get_page_size() const {
+    return m_has_top ? std::min(m_top, m_max_page_size) : m_max_page_size;
+}
+
+bool QueryOptions::has_next_page() const {
+    return !m_has_top || m_top > m_max_page_size;
+}
+
+std::string QueryOptions::get_next_link(const std::string& url, std::uint64_t next_id) const {
+    std::stringstream link{};
+    link << url << '?' << SKIP_TOKEN << '=' << next_id;
+    if (m_has_top) {
+        link << '&' << TOP << '=' << m_top - get_page_size();
+    }
+    if (!m_select_value.empty()) {
+        link << '&' << SELECT << '=' << encode_query_value(m_select_value);
+    }
+    if (!m_expand_value.empty()) {
+        link << '&' << EXPAND << '=' << encode_query_value(m_expand_value);
+    }
+    if (has_filter()) {
+        link << '&' << FILTER << '=' << encode_query_value(m_filter.get_expression());
+    }
+    return link.str();
+}
+
+bool QueryOptions::is_selected(const std::string& property) const {
+    return !has_select() || std::any_of(m_select.begin(), m_select.end(), [&property](const SelectProperty& selected) {
+               return selected.name == property;
+           });
+}
+
+void QueryOptions::select(json::Json& json) const {
+    if (has_select()) {
+        select_properties(json, m_select);
+    }
+}
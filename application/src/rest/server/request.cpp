@@ -115,3 +115,15 @@ std::string Request::get_header(const std::string& header) const {
 const std::string& Request::get_body() const {
     return m_body;
 }
+
+void Request::set_query_options(const QueryOptions& query_options) {
+    m_query_options = query_options;
+}
+
+const QueryOptions& Request::get_query_options() const {
+    return m_query_options;
+}
+
+void Request::set_upload(std::shared_ptr<UploadStream> upload) {
+    m_upload = std::move(upload);
+}
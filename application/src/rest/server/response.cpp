@@ -58,10 +58,28 @@ void Response::set_status(const std::uint32_t status_code) {
 }
 
 void Response::set_body(const std::string& body) {
+    m_persistent_body.reset();
     m_body = body;
 }
 
+void Response::set_persistent_body(std::shared_ptr<const std::string> body) {
+    m_body.clear();
+    m_persistent_body = std::move(body);
+}
+
+void Response::set_stream(std::shared_ptr<ResponseStream> stream) {
+    m_stream = std::move(stream);
+}
+
+void Response::set_deferred(std::shared_ptr<DeferredResponse> deferred) {
+    m_deferred = std::move(deferred);
+}
+
 Response& Response::operator<<(const std::string& rhs) {
+    if (m_persistent_body) {
+        m_body = *m_persistent_body;
+        m_persistent_body.reset();
+    }
     m_body += rhs;
     return (*this);
 }
@@ -71,11 +89,11 @@ std::uint32_t Response::get_status() {
 }
 
 std::size_t Response::get_body_size() {
-    return m_body.size();
+    return get_body().size();
 }
 
 const std::string& Response::get_body() const {
-    return m_body;
+    return m_persistent_body ? *m_persistent_body : m_body;
 }
 
 const Response::HeaderList& Response::get_headers() const {
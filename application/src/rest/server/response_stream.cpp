@@ -0,0 +1,8 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/server/response_stream.hpp"
+
+using namespace psme::rest::server;
+
+ResponseStream::~ResponseStream() {}
@@ -0,0 +1,254 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/server/static_resource_store.hpp"
+#include "psme/rest/server/http_headers.hpp"
+#include "psme/rest/server/status.hpp"
+
+#include "logger/logger_factory.hpp"
+
+#include <zlib.h>
+#ifdef ZSTD_ENABLED
+#include <zstd.h>
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+using namespace psme::rest::server;
+using namespace psme::rest::server::http_headers;
+
+namespace {
+
+/*! @brief Bodies shorter than this are not worth compressing */
+constexpr std::size_t MIN_COMPRESSED_SIZE = 256;
+
+std::string trim(const std::string& str) {
+    const auto first = str.find_first_not_of(" \t");
+    if (std::string::npos == first) {
+        return {};
+    }
+    const auto last = str.find_last_not_of(" \t");
+    return str.substr(first, last - first + 1);
+}
+
+std::vector<std::string> split(const std::string& str, char delimiter) {
+    std::vector<std::string> tokens{};
+    std::istringstream stream{str};
+    std::string token{};
+    while (std::getline(stream, token, delimiter)) {
+        tokens.emplace_back(trim(token));
+    }
+    return tokens;
+}
+
+std::string make_etag(const std::string& body) {
+    // FNV-1a, stable across restarts so that clients may keep their caches
+    std::uint64_t hash = 14695981039346656037ull;
+    for (const auto c : body) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    std::stringstream etag{};
+    etag << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return etag.str();
+}
+
+std::string quote(const std::string& etag, const std::string& suffix) {
+    return "\"" + etag + suffix + "\"";
+}
+
+std::shared_ptr<const std::string> compress_gzip(const std::string& body) {
+    z_stream stream{};
+    // 16 added to window bits selects gzip wrapper instead of zlib one
+    if (Z_OK != deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, MAX_WBITS + 16, MAX_MEM_LEVEL, Z_DEFAULT_STRATEGY)) {
+        log_warning("rest", "Cannot initialize gzip compression.");
+        return nullptr;
+    }
+    std::string compressed(deflateBound(&stream, static_cast<uLong>(body.size())), '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(body.data()));
+    stream.avail_in = static_cast<uInt>(body.size());
+    stream.next_out = reinterpret_cast<Bytef*>(&compressed[0]);
+    stream.avail_out = static_cast<uInt>(compressed.size());
+    const auto result = deflate(&stream, Z_FINISH);
+    compressed.resize(stream.total_out);
+    deflateEnd(&stream);
+    if (Z_STREAM_END != result) {
+        log_warning("rest", "Cannot compress static resource with gzip.");
+        return nullptr;
+    }
+    return std::make_shared<const std::string>(std::move(compressed));
+}
+
+std::shared_ptr<const std::string> compress_zstd(const std::string& body) {
+#ifdef ZSTD_ENABLED
+    std::string compressed(ZSTD_compressBound(body.size()), '\0');
+    const auto size = ZSTD_compress(&compressed[0], compressed.size(), body.data(), body.size(), ZSTD_maxCLevel());
+    if (ZSTD_isError(size)) {
+        log_warning("rest", "Cannot compress static resource with zstd: " << ZSTD_getErrorName(size));
+        return nullptr;
+    }
+    compressed.resize(size);
+    return std::make_shared<const std::string>(std::move(compressed));
+#else
+    (void) body;
+    return nullptr;
+#endif
+}
+
+std::shared_ptr<const std::string> keep_if_smaller(std::shared_ptr<const std::string> compressed,
+                                                   const std::string& body) {
+    if (compressed && compressed->size() < body.size()) {
+        return compressed;
+    }
+    return nullptr;
+}
+
+} // namespace
+
+StaticResource::StaticResource(const std::string& url, const std::string& content_type, const std::string& body)
+    : m_url{url}, m_content_type{content_type}, m_body{std::make_shared<const std::string>(body)} {
+    const auto etag = make_etag(body);
+    m_etag = quote(etag, "");
+    m_gzip_etag = quote(etag, std::string("-") + ContentEncoding::GZIP);
+    m_zstd_etag = quote(etag, std::string("-") + ContentEncoding::ZSTD);
+
+    if (body.size() >= MIN_COMPRESSED_SIZE) {
+        m_gzip_body = keep_if_smaller(compress_gzip(body), body);
+        m_zstd_body = keep_if_smaller(compress_zstd(body), body);
+    }
+}
+
+const std::string& StaticResource::get_etag(Encoding encoding) const {
+    switch (encoding) {
+    case Encoding::GZIP:
+        return m_gzip_etag;
+    case Encoding::ZSTD:
+        return m_zstd_etag;
+    case Encoding::IDENTITY:
+    default:
+        return m_etag;
+    }
+}
+
+std::shared_ptr<const std::string> StaticResource::get_body(Encoding encoding) const {
+    switch (encoding) {
+    case Encoding::GZIP:
+        return m_gzip_body;
+    case Encoding::ZSTD:
+        return m_zstd_body;
+    case Encoding::IDENTITY:
+    default:
+        return m_body;
+    }
+}
+
+StaticResource::Encoding StaticResource::select_encoding(const std::string& accept_encoding) const {
+    constexpr double NOT_LISTED = -1.0;
+    double identity = NOT_LISTED;
+    double gzip = NOT_LISTED;
+    double zstd = NOT_LISTED;
+    double any = NOT_LISTED;
+
+    for (const auto& item : split(accept_encoding, ',')) {
+        const auto parameters = split(item, ';');
+        if (parameters.empty() || parameters.front().empty()) {
+            continue;
+        }
+        auto coding = parameters.front();
+        std::transform(coding.begin(), coding.end(), coding.begin(), ::tolower);
+
+        double quality = 1.0;
+        for (std::size_t i = 1; i < parameters.size(); ++i) {
+            if (0 == parameters[i].compare(0, 2, "q=")) {
+                try {
+                    quality = std::stod(parameters[i].substr(2));
+                }
+                catch (const std::exception&) {
+                    quality = 0.0;
+                }
+            }
+        }
+
+        if (ContentEncoding::IDENTITY == coding) {
+            identity = quality;
+        }
+        else if (ContentEncoding::GZIP == coding) {
+            gzip = quality;
+        }
+        else if (ContentEncoding::ZSTD == coding) {
+            zstd = quality;
+        }
+        else if ("*" == coding) {
+            any = quality;
+        }
+    }
+
+    const auto resolve = [any](double quality, double unlisted) {
+        if (NOT_LISTED < quality) {
+            return quality;
+        }
+        return NOT_LISTED < any ? any : unlisted;
+    };
+    // Identity is acceptable unless explicitly excluded, compression only when requested
+    auto best = Encoding::IDENTITY;
+    auto best_quality = resolve(identity, 1.0);
+    if (m_gzip_body && resolve(gzip, 0.0) > 0.0 && resolve(gzip, 0.0) >= best_quality) {
+        best = Encoding::GZIP;
+        best_quality = resolve(gzip, 0.0);
+    }
+    if (m_zstd_body && resolve(zstd, 0.0) > 0.0 && resolve(zstd, 0.0) >= best_quality) {
+        best = Encoding::ZSTD;
+    }
+    return best;
+}
+
+void StaticResource::write(const Request& request, Response& response) const {
+    const auto encoding = select_encoding(request.get_header(ContentEncoding::ACCEPT_ENCODING));
+    response.set_header(ETag::ETAG, get_etag(encoding));
+    response.set_header(ContentEncoding::VARY, ContentEncoding::ACCEPT_ENCODING);
+
+    const auto if_none_match = request.get_header(ETag::IF_NONE_MATCH);
+    if (!if_none_match.empty()) {
+        for (auto tag : split(if_none_match, ',')) {
+            // Weak comparison applies to If-None-Match
+            if (0 == tag.compare(0, 2, "W/")) {
+                tag = tag.substr(2);
+            }
+            if ("*" == tag || m_etag == tag || m_gzip_etag == tag || m_zstd_etag == tag) {
+                response.set_status(status_3XX::NOT_MODIFIED);
+                return;
+            }
+        }
+    }
+
+    response.set_header(http_headers::ContentType::CONTENT_TYPE, m_content_type);
+    if (Encoding::GZIP == encoding) {
+        response.set_header(ContentEncoding::CONTENT_ENCODING, ContentEncoding::GZIP);
+    }
+    else if (Encoding::ZSTD == encoding) {
+        response.set_header(ContentEncoding::CONTENT_ENCODING, ContentEncoding::ZSTD);
+    }
+    response.set_persistent_body(get_body(encoding));
+}
+
+StaticResourceStore::~StaticResourceStore() {}
+
+void StaticResourceStore::add(const std::string& url, const std::string& content_type, const std::string& body) {
+    auto resource = std::make_shared<const StaticResource>(url, content_type, body);
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_resources[url] = std::move(resource);
+}
+
+std::shared_ptr<const StaticResource> StaticResourceStore::find(const std::string& url) const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    const auto it = m_resources.find(url);
+    if (m_resources.cend() == it) {
+        return nullptr;
+    }
+    return it->second;
+}
@@ -35,6 +35,7 @@ const jsonrpc::ProcedureValidator& SimpleUpdatePostSchema::get_procedure() {
         constants::UpdateService::IMAGE_URI, VALID_JSON_STRING,
         constants::UpdateService::USER_NAME, VALID_OPTIONAL(VALID_JSON_STRING),
         constants::UpdateService::PASSWORD, VALID_OPTIONAL(VALID_JSON_STRING),
+        constants::UpdateService::IMAGE_SHA256, VALID_OPTIONAL(VALID_REGEX("[0-9a-fA-F]{64}")),
         nullptr};
     return procedure;
 }
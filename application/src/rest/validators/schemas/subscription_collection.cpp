@@ -0,0 +1,31 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/validators/schemas/subscription_collection.hpp"
+#include "psme/rest/constants/constants.hpp"
+
+using namespace psme::rest;
+using namespace psme::rest::validators::schema;
+
+const jsonrpc::ProcedureValidator& SubscriptionCollectionPostSchema::get_procedure() {
+    static jsonrpc::ProcedureValidator procedure{
+        jsonrpc::PARAMS_BY_NAME,
+        constants::EventDestination::DESTINATION, VALID_REGEX("https?://.+"),
+        constants::EventDestination::PROTOCOL, VALID_REGEX("Redfish"),
+        constants::EventDestination::CONTEXT, VALID_OPTIONAL(VALID_JSON_STRING),
+        constants::EventDestination::SUBSCRIPTION_TYPE, VALID_OPTIONAL(VALID_REGEX("RedfishEvent")),
+        constants::EventDestination::EVENT_FORMAT_TYPE, VALID_OPTIONAL(VALID_REGEX("Event")),
+        constants::EventDestination::REGISTRY_PREFIXES, VALID_OPTIONAL(VALID_ARRAY_OF(VALID_JSON_STRING)),
+        constants::EventDestination::RESOURCE_TYPES, VALID_OPTIONAL(VALID_ARRAY_OF(VALID_JSON_STRING)),
+        constants::EventDestination::ORIGIN_RESOURCES, VALID_OPTIONAL(VALID_ARRAY_OF(VALID_ATTRIBUTE(OriginResourceSchema))),
+        nullptr};
+    return procedure;
+}
+
+const jsonrpc::ProcedureValidator& SubscriptionCollectionPostSchema::OriginResourceSchema::get_procedure() {
+    static jsonrpc::ProcedureValidator procedure{
+        jsonrpc::PARAMS_BY_NAME,
+        constants::Common::ODATA_ID, VALID_JSON_STRING,
+        nullptr};
+    return procedure;
+}
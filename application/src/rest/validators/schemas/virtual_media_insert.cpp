@@ -16,6 +16,7 @@ const jsonrpc::ProcedureValidator& VirtualMediaInsertPostSchema::get_procedure()
         constants::VirtualMediaInsert::TRANSFER_METHOD, VALID_ENUM(enums::TransferMethod),
         constants::VirtualMediaInsert::USER_NAME, VALID_OPTIONAL(VALID_JSON_STRING),
         constants::VirtualMediaInsert::PASSWORD, VALID_OPTIONAL(VALID_JSON_STRING),
+        constants::VirtualMediaInsert::IMAGE_SHA256, VALID_OPTIONAL(VALID_REGEX("[0-9a-fA-F]{64}")),
         nullptr};
     return procedure;
 }
@@ -37,6 +37,42 @@ std::string get_service_url(const json::Json& config) {
     return service_url;
 }
 
+void add_all_nic_names(ssdp::SsdpServiceConfig& ssdp_service_config) {
+    for (const auto& nic : net::NetworkInterface::get_interfaces()) {
+        ssdp_service_config.add_nic_name(nic.get_name());
+    }
+}
+
+/*!
+ * @brief Announce the service only on interfaces the server listens on.
+ *
+ * SSDP is IPv4 multicast, interfaces reachable only over IPv6 bind
+ * addresses are not announced.
+ * */
+void add_nic_names(ssdp::SsdpServiceConfig& ssdp_service_config, const json::Json& config) {
+    const auto server_options = psme::rest::server::load_server_options(config);
+    const auto& bind_addresses = server_options.get_bind_addresses();
+    for (const auto& bind_address : bind_addresses) {
+        const auto address = net::IpAddress::from_string(bind_address);
+        if (address.is_any_address()) {
+            add_all_nic_names(ssdp_service_config);
+        }
+        else if (net::AddressFamily::IPv4 == address.get_address_family()) {
+            ssdp_service_config.add_nic_name(net::NetworkInterface::for_address(address).get_name());
+        }
+    }
+    if (!bind_addresses.empty()) {
+        return;
+    }
+
+    const auto& nic_name = config["server"]["restricted-to-interface"];
+    if (!nic_name.is_null()) {
+        ssdp_service_config.add_nic_name(nic_name.get<std::string>());
+    } else {
+        add_all_nic_names(ssdp_service_config);
+    }
+}
+
 } // namespace
 
 namespace ssdp {
@@ -52,15 +88,7 @@ SsdpServiceConfig load_ssdp_config(const json::Json& config, const std::string&
     }
     auto announce_interval = seconds(ssdp_config.value("announce-interval-seconds", uint16_t{}));
     ssdp_service_config.set_announce_interval(announce_interval);
-    const auto& nic_name = config["server"]["restricted-to-interface"];
-    if (!nic_name.is_null()) {
-        ssdp_service_config.add_nic_name(nic_name.get<std::string>());
-    } else {
-        const auto ifaces = net::NetworkInterface::get_interfaces();
-        for (const auto& nic : ifaces) {
-            ssdp_service_config.add_nic_name(nic.get_name());
-        }
-    }
+    add_nic_names(ssdp_service_config, config);
     ssdp_service_config.set_socket_ttl(ssdp_config.value("ttl", std::uint8_t{}));
     ssdp_service_config.set_service_uuid(uuid);
     ssdp_service_config.set_service_urn("urn:dmtf-org:service:redfish-rest:1");
@@ -0,0 +1,165 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/simulated_cpchnl_transport.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace psme::ipu;
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
+namespace {
+
+constexpr std::uint32_t FAILING_OPCODE = 0xdead;
+constexpr std::uint32_t UNANSWERED_OPCODE = 0xbeef;
+
+/*!
+ * @brief Loopback of the channel, answering each command after a delay
+ * given by its first parameter in milliseconds
+ */
+class LoopbackTransport : public SimulatedCpchnlTransport {
+public:
+    /*! @brief Counters shared with the test, the transport is owned by the channel */
+    struct Stats {
+        std::atomic<std::size_t> sent{0};
+        std::atomic<std::size_t> max_outstanding{0};
+    };
+
+    LoopbackTransport(std::size_t max_outstanding, std::shared_ptr<Stats> stats)
+        : SimulatedCpchnlTransport{FaultProfile{}, max_outstanding}, m_stats{std::move(stats)} {}
+
+    void send(Tag tag, const CpchnlCommand& command) override {
+        ++m_stats->sent;
+        SimulatedCpchnlTransport::send(tag, command);
+        m_stats->max_outstanding = std::max(m_stats->max_outstanding.load(), get_outstanding());
+    }
+
+protected:
+    std::optional<Answer> answer(const CpchnlCommand& command) override {
+        if (UNANSWERED_OPCODE == command.opcode) {
+            return {};
+        }
+        return Answer{milliseconds{command.param_0}, FAILING_OPCODE == command.opcode ? "Device is busy" : ""};
+    }
+
+private:
+    std::shared_ptr<Stats> m_stats;
+};
+
+/*! @brief Transport whose completions cannot be received */
+class BrokenTransport : public SimulatedCpchnlTransport {
+public:
+    BrokenTransport() : SimulatedCpchnlTransport{FaultProfile{}, 1} {}
+
+    std::optional<Completion> receive(std::chrono::milliseconds) override {
+        throw std::runtime_error("Device is gone");
+    }
+};
+
+CpchnlCommand command(std::uint32_t opcode, std::uint32_t delay_ms, milliseconds timeout = milliseconds{1000}) {
+    return CpchnlCommand{opcode, delay_ms, timeout};
+}
+
+} // namespace
+
+class CpchnlChannelTest : public ::testing::Test {
+protected:
+    std::unique_ptr<CpchnlChannel> make_channel(std::size_t max_outstanding) {
+        return std::make_unique<CpchnlChannel>(std::make_unique<LoopbackTransport>(max_outstanding, m_stats));
+    }
+
+    std::shared_ptr<LoopbackTransport::Stats> m_stats{std::make_shared<LoopbackTransport::Stats>()};
+};
+
+TEST_F(CpchnlChannelTest, CommandCompletes) {
+    auto channel = make_channel(1);
+    auto completion = channel->submit(command(1, 10));
+    ASSERT_EQ(std::future_status::ready, completion.wait_for(milliseconds{500}));
+    ASSERT_NO_THROW(completion.get());
+    ASSERT_EQ(1, m_stats->sent);
+}
+
+TEST_F(CpchnlChannelTest, FailedCommandThrows) {
+    auto channel = make_channel(1);
+    auto completion = channel->submit(command(FAILING_OPCODE, 0));
+    try {
+        completion.get();
+        FAIL() << "Failed command completed";
+    }
+    catch (const std::runtime_error& e) {
+        ASSERT_STREQ("Device is busy", e.what());
+    }
+}
+
+TEST_F(CpchnlChannelTest, CommandsArePipelined) {
+    auto channel = make_channel(4);
+    const auto start = steady_clock::now();
+    std::vector<std::future<void>> completions{};
+    for (int i = 0; i < 4; ++i) {
+        completions.push_back(channel->submit(command(1, 200)));
+    }
+    for (auto& completion : completions) {
+        ASSERT_NO_THROW(completion.get());
+    }
+    // Sent one by one, the commands would take 800 ms
+    ASSERT_GT(milliseconds{600}, steady_clock::now() - start);
+    ASSERT_EQ(4, m_stats->max_outstanding);
+}
+
+TEST_F(CpchnlChannelTest, OutstandingCommandsAreLimited) {
+    auto channel = make_channel(2);
+    std::vector<std::future<void>> completions{};
+    for (int i = 0; i < 6; ++i) {
+        completions.push_back(channel->submit(command(1, 20)));
+    }
+    for (auto& completion : completions) {
+        ASSERT_NO_THROW(completion.get());
+    }
+    ASSERT_EQ(6, m_stats->sent);
+    ASSERT_EQ(2, m_stats->max_outstanding);
+}
+
+TEST_F(CpchnlChannelTest, CompletionsAreMatchedByTag) {
+    auto channel = make_channel(2);
+    auto slow = channel->submit(command(1, 300));
+    auto fast = channel->submit(command(FAILING_OPCODE, 20));
+    ASSERT_EQ(std::future_status::ready, fast.wait_for(milliseconds{200}));
+    ASSERT_THROW(fast.get(), std::runtime_error);
+    ASSERT_EQ(std::future_status::timeout, slow.wait_for(milliseconds{0}));
+    ASSERT_NO_THROW(slow.get());
+}
+
+TEST_F(CpchnlChannelTest, UnansweredCommandTimesOut) {
+    auto channel = make_channel(1);
+    auto lost = channel->submit(command(UNANSWERED_OPCODE, 0, milliseconds{100}));
+    auto next = channel->submit(command(1, 0));
+    ASSERT_EQ(std::future_status::ready, lost.wait_for(milliseconds{500}));
+    ASSERT_THROW(lost.get(), std::runtime_error);
+    // The channel is free for the next command once the lost one timed out
+    ASSERT_NO_THROW(next.get());
+}
+
+TEST_F(CpchnlChannelTest, StoppingFailsPendingCommands) {
+    auto channel = make_channel(1);
+    auto outstanding = channel->submit(command(UNANSWERED_OPCODE, 0, milliseconds{10000}));
+    auto queued = channel->submit(command(1, 0));
+    channel.reset();
+    ASSERT_THROW(outstanding.get(), std::runtime_error);
+    ASSERT_THROW(queued.get(), std::runtime_error);
+}
+
+TEST_F(CpchnlChannelTest, ReceiveFailureFailsOutstandingCommands) {
+    CpchnlChannel channel{std::make_unique<BrokenTransport>()};
+    auto completion = channel.submit(command(1, 0, milliseconds{5000}));
+    ASSERT_EQ(std::future_status::ready, completion.wait_for(milliseconds{500}));
+    ASSERT_THROW(completion.get(), std::runtime_error);
+}
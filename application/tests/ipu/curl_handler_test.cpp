@@ -0,0 +1,287 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/curl_handler.hpp"
+#include "ipu/download_checkpoints.hpp"
+#include "ipu/image_cache.hpp"
+#include "file_server.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <zlib.h>
+
+using namespace psme::ipu;
+using namespace test;
+
+namespace {
+
+std::string gzip(const std::string& content) {
+    z_stream stream{};
+    deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY);
+    std::string compressed(deflateBound(&stream, static_cast<uLong>(content.size())), '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(content.data()));
+    stream.avail_in = static_cast<uInt>(content.size());
+    stream.next_out = reinterpret_cast<Bytef*>(&compressed[0]);
+    stream.avail_out = static_cast<uInt>(compressed.size());
+    deflate(&stream, Z_FINISH);
+    compressed.resize(stream.total_out);
+    deflateEnd(&stream);
+    return compressed;
+}
+
+std::string get_sha256(const std::string& content) {
+    utils::Sha256 digest{};
+    digest.update(content.data(), content.size());
+    return digest.hex_digest();
+}
+
+void write_file(const std::filesystem::path& path, const std::string& content) {
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+    file << content;
+}
+
+} // namespace
+
+class CurlHandlerTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        s_location = std::filesystem::temp_directory_path() / ("curl_handler_test_" + std::to_string(::getpid()));
+        std::filesystem::create_directories(s_location);
+        database::Database::set_default_location(s_location.string());
+    }
+
+    static void TearDownTestSuite() {
+        std::filesystem::remove_all(s_location);
+    }
+
+    void TearDown() override {
+        DownloadCheckpoints::get_instance()->del(get_file());
+        std::filesystem::remove(get_file());
+        std::filesystem::remove_all(get_cache_directory());
+    }
+
+    static std::string get_file() {
+        return (s_location / "image.iso").string();
+    }
+
+    static std::string get_cache_directory() {
+        return (s_location / "cache").string();
+    }
+
+    static void download(const FileServer& server, unsigned attempts = CurlHandler::RETRY_ATTEMPTS,
+                         unsigned segments = 1, const OptionalField<std::string>& sha256 = {},
+                         ImageCache* cache = nullptr) {
+        CurlHandler()
+            .set_protocols(CURLPROTO_HTTP)
+            .set_retry_policy(attempts, std::chrono::milliseconds{10})
+            .set_segments(segments)
+            .set_expected_digest(sha256)
+            .set_image_cache(cache)
+            .set_url(server.get_uri())
+            .set_file_name(get_file())
+            .run_request();
+    }
+
+    static std::filesystem::path s_location;
+};
+
+std::filesystem::path CurlHandlerTest::s_location{};
+
+TEST_F(CurlHandlerTest, DroppedTransferIsResumed) {
+    const auto content = make_content(3 * 1024 * 1024 + 123);
+    FileServer server{content, {300'000, 1'000'000, content.size()}};
+    download(server);
+
+    ASSERT_EQ(content, read_file(get_file()));
+    const auto ranges = server.get_ranges();
+    ASSERT_EQ(3, ranges.size());
+    ASSERT_EQ("", ranges[0]);
+    ASSERT_EQ("bytes=300000-", ranges[1]);
+    ASSERT_EQ("bytes=1300000-", ranges[2]);
+
+    DownloadCheckpoints::Checkpoint checkpoint{};
+    ASSERT_FALSE(DownloadCheckpoints::get_instance()->get(get_file(), checkpoint));
+}
+
+TEST_F(CurlHandlerTest, DownloadResumesFromCheckpointAfterRestart) {
+    const auto content = make_content(1024 * 1024);
+    FileServer server{content, {content.size()}};
+    // Data past the checkpoint was not synced before the restart
+    write_file(get_file(), content.substr(0, 500'000) + std::string(1000, 'x'));
+    DownloadCheckpoints::get_instance()->put(get_file(), {server.get_uri(), 500'000, ETAG});
+
+    download(server);
+
+    ASSERT_EQ(content, read_file(get_file()));
+    const auto ranges = server.get_ranges();
+    ASSERT_EQ(1, ranges.size());
+    ASSERT_EQ("bytes=500000-", ranges[0]);
+}
+
+TEST_F(CurlHandlerTest, ChangedFileIsDownloadedAgain) {
+    const auto content = make_content(1024 * 1024);
+    FileServer server{content, {content.size()}};
+    write_file(get_file(), std::string(500'000, 'x'));
+    DownloadCheckpoints::get_instance()->put(get_file(), {server.get_uri(), 500'000, "\"v0\""});
+
+    download(server);
+
+    ASSERT_EQ(content, read_file(get_file()));
+    const auto ranges = server.get_ranges();
+    ASSERT_EQ(2, ranges.size());
+    ASSERT_EQ("bytes=500000-", ranges[0]);
+    ASSERT_EQ("", ranges[1]);
+}
+
+TEST_F(CurlHandlerTest, RetriesAreBounded) {
+    const auto content = make_content(1024 * 1024);
+    FileServer server{content, {1000, 0}};
+    ASSERT_THROW(download(server, 2), std::runtime_error);
+    ASSERT_EQ(3, server.get_ranges().size());
+
+    // Progress is kept for a later download of the same file
+    DownloadCheckpoints::Checkpoint checkpoint{};
+    ASSERT_TRUE(DownloadCheckpoints::get_instance()->get(get_file(), checkpoint));
+    ASSERT_EQ(1000, checkpoint.offset);
+    ASSERT_EQ(ETAG, checkpoint.validator);
+}
+
+TEST_F(CurlHandlerTest, SegmentsAreAssembled) {
+    const auto content = make_content(3 * CurlHandler::MIN_SEGMENT_SIZE + 5);
+    FileServer server{content, {content.size()}};
+    download(server, CurlHandler::RETRY_ATTEMPTS, 3);
+
+    ASSERT_EQ(content, read_file(get_file()));
+    auto ranges = server.get_ranges();
+    ASSERT_EQ(4, ranges.size());
+    ASSERT_EQ("bytes=0-0", ranges[0]);
+    std::sort(ranges.begin() + 1, ranges.end());
+    ASSERT_EQ("bytes=0-8388609", ranges[1]);
+    ASSERT_EQ("bytes=16777220-25165828", ranges[2]);
+    ASSERT_EQ("bytes=8388610-16777219", ranges[3]);
+}
+
+TEST_F(CurlHandlerTest, DroppedSegmentIsResumed) {
+    const auto content = make_content(2 * CurlHandler::MIN_SEGMENT_SIZE);
+    FileServer server{content, {content.size(), 1'000'000, content.size()}};
+    download(server, CurlHandler::RETRY_ATTEMPTS, 2);
+
+    ASSERT_EQ(content, read_file(get_file()));
+    const auto ranges = server.get_ranges();
+    ASSERT_EQ(4, ranges.size());
+    const auto begin = std::stoul(ranges[1].substr(ranges[1].find('=') + 1));
+    ASSERT_EQ(begin + 1'000'000, std::stoul(ranges[3].substr(ranges[3].find('=') + 1)));
+}
+
+TEST_F(CurlHandlerTest, DigestOfSegmentsIsVerified) {
+    const auto content = make_content(3 * CurlHandler::MIN_SEGMENT_SIZE + 5);
+    FileServer server{content, {content.size(), 1'000'000, content.size()}};
+    download(server, CurlHandler::RETRY_ATTEMPTS, 3, get_sha256(content));
+
+    ASSERT_EQ(content, read_file(get_file()));
+    // Segmented, with one segment resumed
+    ASSERT_EQ(5, server.get_ranges().size());
+    ASSERT_THROW(download(server, CurlHandler::RETRY_ATTEMPTS, 3, get_sha256(content + "x")), std::runtime_error);
+}
+
+TEST_F(CurlHandlerTest, SingleRequestIfRangesAreNotSupported) {
+    const auto content = make_content(2 * CurlHandler::MIN_SEGMENT_SIZE);
+    FileServer server{content, {content.size()}, false};
+    download(server, CurlHandler::RETRY_ATTEMPTS, 2);
+
+    ASSERT_EQ(content, read_file(get_file()));
+    const auto ranges = server.get_ranges();
+    ASSERT_EQ(2, ranges.size());
+    ASSERT_EQ("bytes=0-0", ranges[0]);
+    ASSERT_EQ("", ranges[1]);
+}
+
+TEST_F(CurlHandlerTest, DigestOfResumedDownloadIsVerified) {
+    const auto content = make_content(3 * 1024 * 1024 + 123);
+    FileServer server{content, {300'000, content.size()}};
+    auto sha256 = get_sha256(content);
+    std::transform(sha256.begin(), sha256.end(), sha256.begin(), ::toupper);
+    download(server, CurlHandler::RETRY_ATTEMPTS, 1, sha256);
+
+    ASSERT_EQ(content, read_file(get_file()));
+    ASSERT_EQ(2, server.get_ranges().size());
+}
+
+TEST_F(CurlHandlerTest, DigestIsVerifiedAfterRestart) {
+    const auto content = make_content(1024 * 1024);
+    FileServer server{content, {content.size()}};
+    write_file(get_file(), content.substr(0, 500'000));
+    DownloadCheckpoints::get_instance()->put(get_file(), {server.get_uri(), 500'000, ETAG});
+
+    download(server, CurlHandler::RETRY_ATTEMPTS, 1, get_sha256(content));
+
+    ASSERT_EQ(content, read_file(get_file()));
+}
+
+TEST_F(CurlHandlerTest, DigestMismatchFailsDownload) {
+    const auto content = make_content(1024 * 1024);
+    FileServer server{content, {content.size()}};
+    ASSERT_THROW(download(server, CurlHandler::RETRY_ATTEMPTS, 1, get_sha256(content + "x")), std::runtime_error);
+}
+
+TEST_F(CurlHandlerTest, CompressedImageIsDecompressed) {
+    const auto content = make_content(3 * 1024 * 1024);
+    const auto compressed = gzip(content);
+    FileServer server{compressed, {1, compressed.size() / 2, compressed.size()}, true, "application/gzip"};
+    download(server, CurlHandler::RETRY_ATTEMPTS, 2);
+
+    ASSERT_EQ(content, read_file(get_file()));
+    // Neither segmented nor resumed
+    const auto ranges = server.get_ranges();
+    ASSERT_EQ(3, ranges.size());
+    ASSERT_EQ("bytes=0-0", ranges[0]);
+    ASSERT_EQ("", ranges[1]);
+    ASSERT_EQ("", ranges[2]);
+    DownloadCheckpoints::Checkpoint checkpoint{};
+    ASSERT_FALSE(DownloadCheckpoints::get_instance()->get(get_file(), checkpoint));
+}
+
+TEST_F(CurlHandlerTest, DecompressedSizeIsLimited) {
+    const auto compressed = gzip(std::string(4 * 1024 * 1024, 'x'));
+    FileServer server{compressed, {compressed.size()}, true, "application/gzip"};
+    ASSERT_THROW(CurlHandler()
+                     .set_protocols(CURLPROTO_HTTP)
+                     .set_url(server.get_uri())
+                     .set_file_name(get_file())
+                     .set_max_file_size(1024 * 1024)
+                     .run_request(),
+                 std::runtime_error);
+}
+
+TEST_F(CurlHandlerTest, CachedImageIsRevalidated) {
+    const auto content = make_content(2 * CurlHandler::MIN_SEGMENT_SIZE);
+    FileServer server{content, {content.size()}};
+    ImageCache cache{get_cache_directory(), 4 * CurlHandler::MIN_SEGMENT_SIZE, constants::IMAGE_CACHE_COPY_LIMIT,
+                     "image-cache-test"};
+    download(server, CurlHandler::RETRY_ATTEMPTS, 2, {}, &cache);
+    ASSERT_EQ(3, server.get_ranges().size());
+
+    download(server, CurlHandler::RETRY_ATTEMPTS, 2, {}, &cache);
+
+    ASSERT_EQ(content, read_file(get_file()));
+    // Not segmented and not sent again
+    ASSERT_EQ(4, server.get_ranges().size());
+    ASSERT_EQ(1, server.get_not_modified());
+    ASSERT_EQ(2, std::filesystem::hard_link_count(get_file()));
+}
+
+TEST_F(CurlHandlerTest, CachedImageIsFoundByDigest) {
+    const auto content = make_content(1024 * 1024);
+    FileServer server{content, {content.size()}};
+    ImageCache cache{get_cache_directory(), 4 * 1024 * 1024, constants::IMAGE_CACHE_COPY_LIMIT, "image-cache-test"};
+    download(server, CurlHandler::RETRY_ATTEMPTS, 1, {}, &cache);
+    std::filesystem::remove(get_file());
+
+    download(server, CurlHandler::RETRY_ATTEMPTS, 1, get_sha256(content), &cache);
+
+    ASSERT_EQ(content, read_file(get_file()));
+    ASSERT_EQ(1, server.get_ranges().size());
+}
@@ -0,0 +1,158 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#pragma once
+
+#include "ipu/loopback_server.hpp"
+
+#include <curl/curl.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace test {
+
+inline const std::string ETAG = "\"v1\"";
+
+/*!
+ * @brief Loopback HTTP server of one file supporting Range, If-Range and If-None-Match.
+ *
+ * Each response sends at most the next number of body bytes from the list
+ * and drops the connection, the last number is used for further responses.
+ * Connections are served one at a time.
+ */
+class FileServer {
+public:
+    FileServer(std::string content, std::vector<std::size_t> limits, bool ranges = true, std::string content_type = {})
+        : m_content{std::move(content)}, m_limits{std::move(limits)}, m_ranges_supported{ranges},
+          m_content_type{std::move(content_type)} {}
+
+    FileServer(const FileServer&) = delete;
+    FileServer& operator=(const FileServer&) = delete;
+
+    std::string get_uri() const {
+        return m_server.get_uri("image.iso");
+    }
+
+    /*! @brief Range headers of the received requests, empty for requests of the whole file */
+    std::vector<std::string> get_ranges() const {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        return m_ranges;
+    }
+
+    /*! @brief Number of requests answered with 304 Not Modified */
+    std::size_t get_not_modified() const {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        return m_not_modified;
+    }
+
+private:
+    void serve(const psme::ipu::LoopbackServer::Request& request, psme::ipu::LoopbackServer::Connection& connection) {
+        const auto range = request.get_header("range");
+        const auto if_range = request.get_header("if-range");
+        std::size_t limit = 0;
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_ranges.push_back(range);
+            limit = m_limits[std::min(m_ranges.size(), m_limits.size()) - 1];
+        }
+
+        std::string response{};
+        if (ETAG == request.get_header("if-none-match")) {
+            {
+                std::lock_guard<std::mutex> lock{m_mutex};
+                ++m_not_modified;
+            }
+            connection.send("HTTP/1.1 304 Not Modified\r\nETag: " + ETAG + "\r\nConnection: close\r\n\r\n");
+            return;
+        }
+
+        std::size_t offset = 0;
+        std::size_t end = m_content.size();
+        if (m_ranges_supported && !range.empty() && (if_range.empty() || ETAG == if_range)) {
+            const auto spec = range.substr(range.find('=') + 1);
+            offset = std::stoul(spec);
+            const auto dash = spec.find('-');
+            if (dash + 1 < spec.size()) {
+                end = std::min(end, std::stoul(spec.substr(dash + 1)) + 1);
+            }
+            response = "HTTP/1.1 206 Partial Content\r\nContent-Range: bytes " + std::to_string(offset) + "-" +
+                       std::to_string(end - 1) + "/" + std::to_string(m_content.size()) + "\r\n";
+        }
+        else {
+            response = "HTTP/1.1 200 OK\r\n";
+        }
+        if (!m_content_type.empty()) {
+            response += "Content-Type: " + m_content_type + "\r\n";
+        }
+        response += "ETag: " + ETAG + "\r\nContent-Length: " + std::to_string(end - offset) +
+                    "\r\nConnection: close\r\n\r\n";
+        response += m_content.substr(offset, std::min(limit, end - offset));
+        connection.send(response);
+    }
+
+    std::string m_content;
+    std::vector<std::size_t> m_limits;
+    bool m_ranges_supported;
+    std::string m_content_type;
+    mutable std::mutex m_mutex{};
+    std::vector<std::string> m_ranges{};
+    std::size_t m_not_modified{0};
+    // Last, so it is stopped before the members its handler uses are destroyed
+    psme::ipu::LoopbackServer m_server{0, 1, [this](const psme::ipu::LoopbackServer::Request& request,
+                                                    psme::ipu::LoopbackServer::Connection& connection) {
+        serve(request, connection);
+    }};
+};
+
+/*! @brief Status and body of a response */
+struct Fetched {
+    long status{0};
+    std::string body{};
+};
+
+/*!
+ * @brief Fetch a URI, status 0 if the transfer failed
+ * @param[in] uri URI
+ * @param[in] range Range to request, e.g. "0-99", empty for the whole resource
+ */
+inline Fetched fetch(const std::string& uri, const std::string& range = {}) {
+    Fetched fetched{};
+    CURL* curl = curl_easy_init();
+    curl_easy_setopt(curl, CURLOPT_URL, uri.c_str());
+    curl_easy_setopt(curl, CURLOPT_PATH_AS_IS, 1L);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, +[](char* data, std::size_t size, std::size_t count, void* body) {
+        static_cast<std::string*>(body)->append(data, size * count);
+        return size * count;
+    });
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &fetched.body);
+    if (!range.empty()) {
+        curl_easy_setopt(curl, CURLOPT_RANGE, range.c_str());
+    }
+    if (CURLE_OK == curl_easy_perform(curl)) {
+        curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &fetched.status);
+    }
+    curl_easy_cleanup(curl);
+    return fetched;
+}
+
+inline std::string make_content(std::size_t size) {
+    std::string content(size, '\0');
+    for (std::size_t i = 0; i < size; ++i) {
+        content[i] = static_cast<char>(i * 31 % 251);
+    }
+    return content;
+}
+
+inline std::string read_file(const std::filesystem::path& path) {
+    std::ifstream file{path, std::ios::binary};
+    return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+} // namespace test
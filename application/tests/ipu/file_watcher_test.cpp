@@ -0,0 +1,98 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/file_watcher.hpp"
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+using namespace psme::ipu;
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
+class FileWatcherTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_location = std::filesystem::temp_directory_path() / ("file_watcher_test_" + std::to_string(::getpid()));
+        std::filesystem::create_directories(m_location);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(m_location);
+    }
+
+    std::string get_file(const std::string& name) const {
+        return (m_location / name).string();
+    }
+
+    static void write_file(const std::string& path, const std::string& content) {
+        std::ofstream file{path, std::ios::trunc};
+        file << content;
+    }
+
+    std::filesystem::path m_location{};
+};
+
+TEST_F(FileWatcherTest, ChangeIsReportedImmediately) {
+    FileWatcher watcher{{get_file("config.json")}};
+    std::thread writer([this] {
+        std::this_thread::sleep_for(milliseconds{20});
+        write_file(get_file("config.json"), "{}");
+    });
+    const auto start = steady_clock::now();
+    ASSERT_TRUE(watcher.wait(milliseconds{10000}));
+    ASSERT_LT(steady_clock::now() - start, milliseconds{2000});
+    writer.join();
+}
+
+TEST_F(FileWatcherTest, ReplacedFileIsReported) {
+    FileWatcher watcher{{get_file("config.json")}};
+    write_file(get_file("config.json.tmp"), "{}");
+    std::filesystem::rename(get_file("config.json.tmp"), get_file("config.json"));
+    ASSERT_TRUE(watcher.wait(milliseconds{1000}));
+}
+
+TEST_F(FileWatcherTest, OtherFilesAreIgnored) {
+    FileWatcher watcher{{get_file("config.json")}};
+    write_file(get_file("other.json"), "{}");
+    ASSERT_FALSE(watcher.wait(milliseconds{200}));
+}
+
+TEST_F(FileWatcherTest, BurstOfChangesIsReportedOnce) {
+    FileWatcher watcher{{get_file("config.json"), get_file("option.json")}};
+    for (int i = 0; i < 5; ++i) {
+        write_file(get_file("config.json"), std::to_string(i));
+        write_file(get_file("option.json"), std::to_string(i));
+    }
+    ASSERT_TRUE(watcher.wait(milliseconds{1000}));
+    ASSERT_FALSE(watcher.wait(milliseconds{200}));
+}
+
+TEST_F(FileWatcherTest, MissingDirectoryIsWatchedOnceCreated) {
+    FileWatcher watcher{{(m_location / "config" / "config.json").string()}};
+    ASSERT_FALSE(watcher.wait(milliseconds{10}));
+    std::filesystem::create_directories(m_location / "config");
+    ASSERT_FALSE(watcher.wait(milliseconds{10}));
+    write_file((m_location / "config" / "config.json").string(), "{}");
+    ASSERT_TRUE(watcher.wait(milliseconds{1000}));
+}
+
+TEST_F(FileWatcherTest, InterruptEndsWait) {
+    FileWatcher watcher{{get_file("config.json")}};
+    std::thread interrupter([&watcher] {
+        std::this_thread::sleep_for(milliseconds{20});
+        watcher.interrupt();
+    });
+    const auto start = steady_clock::now();
+    ASSERT_FALSE(watcher.wait(milliseconds{10000}));
+    ASSERT_LT(steady_clock::now() - start, milliseconds{2000});
+    ASSERT_TRUE(watcher.is_interrupted());
+    ASSERT_FALSE(watcher.wait(milliseconds{10000}));
+    interrupter.join();
+}
@@ -0,0 +1,189 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/image_cache.hpp"
+#include "utils/crypt_utils.hpp"
+
+#include <gtest/gtest.h>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+using namespace psme::ipu;
+
+namespace {
+
+const std::string ETAG = "\"v1\"";
+
+std::string get_sha256(const std::string& content) {
+    utils::Sha256 digest{};
+    digest.update(content.data(), content.size());
+    return digest.hex_digest();
+}
+
+std::string read_file(const std::filesystem::path& path) {
+    std::ifstream file{path, std::ios::binary};
+    return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+void write_file(const std::filesystem::path& path, const std::string& content) {
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+    file << content;
+}
+
+} // namespace
+
+class ImageCacheTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        s_location = std::filesystem::temp_directory_path() / ("image_cache_test_" + std::to_string(::getpid()));
+        std::filesystem::create_directories(s_location);
+        database::Database::set_default_location(s_location.string());
+    }
+
+    static void TearDownTestSuite() {
+        std::filesystem::remove_all(s_location);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(get_cache_directory());
+    }
+
+    static std::string get_cache_directory() {
+        return (s_location / "cache").string();
+    }
+
+    /*! @brief Write a file and store it in the cache */
+    static std::string store(ImageCache& cache, const std::string& url, const std::string& content) {
+        const auto file = (s_location / "image.iso").string();
+        write_file(file, content);
+        cache.store(url, ETAG, {}, file);
+        std::filesystem::remove(file);
+        return get_sha256(content);
+    }
+
+    static std::filesystem::path s_location;
+};
+
+std::filesystem::path ImageCacheTest::s_location{};
+
+TEST_F(ImageCacheTest, SettingsAreReadFromConfiguration) {
+    auto settings = ImageCache::load_settings(json::Json::object());
+    ASSERT_EQ(constants::IMAGE_CACHE_DIRECTORY, settings.directory);
+    ASSERT_EQ(constants::IMAGE_CACHE_CAPACITY, settings.capacity);
+    ASSERT_EQ(constants::IMAGE_CACHE_COPY_LIMIT, settings.copy_limit);
+
+    settings = ImageCache::load_settings(
+        json::Json::parse(R"({"image-cache": {"location": "/data/cache", "capacity": 0, "copy-limit": 1024}})"));
+    ASSERT_EQ("/data/cache", settings.directory);
+    ASSERT_EQ(0, settings.capacity);
+    ASSERT_EQ(1024, settings.copy_limit);
+}
+
+TEST_F(ImageCacheTest, StoredImageIsRestored) {
+    ImageCache cache{get_cache_directory(), 1024 * 1024, constants::IMAGE_CACHE_COPY_LIMIT, "image-cache-test"};
+    const std::string content(1000, 'a');
+    const auto sha256 = store(cache, "https://server/a.iso", content);
+
+    ImageCache::Entry entry{};
+    ASSERT_TRUE(cache.find("https://server/a.iso", entry));
+    ASSERT_EQ(ETAG, entry.validator);
+    ASSERT_EQ(sha256, entry.sha256);
+    ASSERT_EQ(content.size(), entry.size);
+    ASSERT_FALSE(cache.find("https://server/b.iso", entry));
+
+    const auto destination = s_location / "restored.iso";
+    ASSERT_TRUE(cache.restore(sha256, destination.string()));
+    ASSERT_EQ(content, read_file(destination));
+    // Linked, not copied
+    ASSERT_EQ(2, std::filesystem::hard_link_count(destination));
+    std::filesystem::remove(destination);
+
+    ASSERT_FALSE(cache.restore(get_sha256("b"), destination.string()));
+    ASSERT_FALSE(cache.restore("../image.iso", destination.string()));
+}
+
+TEST_F(ImageCacheTest, LinkedImageKeepsItsPermissions) {
+    ImageCache cache{get_cache_directory(), 1024 * 1024, 0, "image-cache-test"};
+    const auto file = s_location / "image.iso";
+    write_file(file, std::string(1000, 'a'));
+    const auto perms = std::filesystem::status(file).permissions();
+    cache.store("https://server/a.iso", ETAG, {}, file.string());
+
+    // Stored as a hard link of the downloaded file, which stays writable
+    ASSERT_EQ(2, std::filesystem::hard_link_count(file));
+    ASSERT_EQ(perms, std::filesystem::status(file).permissions());
+    std::filesystem::remove(file);
+}
+
+TEST_F(ImageCacheTest, ImageOnAnotherFileSystemIsCopiedUpToLimit) {
+    const std::filesystem::path other{"/dev/shm"};
+    struct stat other_stat{};
+    struct stat location_stat{};
+    if (0 != ::stat(other.c_str(), &other_stat) || 0 != ::stat(s_location.c_str(), &location_stat) ||
+        other_stat.st_dev == location_stat.st_dev) {
+        GTEST_SKIP() << "No other file system to cache images on.";
+    }
+    const auto directory = other / ("image_cache_test_" + std::to_string(::getpid()));
+    const std::string content(1000, 'a');
+    {
+        ImageCache cache{directory.string(), 1024 * 1024, content.size() - 1, "image-cache-test"};
+        ASSERT_EQ(get_sha256(content), store(cache, "https://server/a.iso", content));
+        ASSERT_FALSE(cache.contains(get_sha256(content)));
+    }
+    {
+        ImageCache cache{directory.string(), 1024 * 1024, content.size(), "image-cache-test"};
+        const auto sha256 = store(cache, "https://server/a.iso", content);
+        ASSERT_TRUE(cache.contains(sha256));
+        const auto blob = directory / sha256;
+        ASSERT_EQ(content, read_file(blob));
+        ASSERT_EQ(std::filesystem::perms::none,
+                  std::filesystem::status(blob).permissions() & std::filesystem::perms::owner_write);
+    }
+    std::filesystem::remove_all(directory);
+}
+
+TEST_F(ImageCacheTest, SameImageIsStoredOnce) {
+    ImageCache cache{get_cache_directory(), 1024 * 1024, constants::IMAGE_CACHE_COPY_LIMIT, "image-cache-test"};
+    const std::string content(1000, 'a');
+    store(cache, "https://server/a.iso", content);
+    store(cache, "https://mirror/a.iso", content);
+    ASSERT_EQ(content.size(), cache.get_size());
+}
+
+TEST_F(ImageCacheTest, LeastRecentlyUsedImageIsEvicted) {
+    ImageCache cache{get_cache_directory(), 2500, constants::IMAGE_CACHE_COPY_LIMIT, "image-cache-test"};
+    const auto a = store(cache, "https://server/a.iso", std::string(1000, 'a'));
+    const auto b = store(cache, "https://server/b.iso", std::string(1000, 'b'));
+    const auto destination = (s_location / "restored.iso").string();
+    ASSERT_TRUE(cache.restore(a, destination));
+    std::filesystem::remove(destination);
+
+    const auto c = store(cache, "https://server/c.iso", std::string(1000, 'c'));
+
+    ASSERT_TRUE(cache.contains(a));
+    ASSERT_FALSE(cache.contains(b));
+    ASSERT_TRUE(cache.contains(c));
+    ASSERT_EQ(2000, cache.get_size());
+    ImageCache::Entry entry{};
+    ASSERT_FALSE(cache.find("https://server/b.iso", entry));
+
+    // Larger than the whole cache
+    store(cache, "https://server/d.iso", std::string(3000, 'd'));
+    ASSERT_FALSE(cache.find("https://server/d.iso", entry));
+}
+
+TEST_F(ImageCacheTest, ModifiedImageIsVerified) {
+    ImageCache cache{get_cache_directory(), 1024 * 1024, constants::IMAGE_CACHE_COPY_LIMIT, "image-cache-test"};
+    const auto sha256 = store(cache, "https://server/a.iso", std::string(1000, 'a'));
+    const auto blob = std::filesystem::path(get_cache_directory()) / sha256;
+    std::filesystem::permissions(blob, std::filesystem::perms::owner_write, std::filesystem::perm_options::add);
+    write_file(blob, std::string(999, 'x'));
+
+    ASSERT_FALSE(cache.restore(sha256, (s_location / "restored.iso").string()));
+    ASSERT_FALSE(cache.contains(sha256));
+}
@@ -0,0 +1,143 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/inventory_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+using namespace psme::ipu;
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+
+class InventoryCacheTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        s_location = std::filesystem::temp_directory_path() / ("inventory_cache_test_" + std::to_string(::getpid()));
+        std::filesystem::create_directories(s_location);
+        database::Database::set_default_location(s_location.string());
+    }
+
+    static void TearDownTestSuite() {
+        std::filesystem::remove_all(s_location);
+    }
+
+    void TearDown() override {
+        // Entries are stored in files named after the database
+        for (const auto& entry : std::filesystem::directory_iterator{s_location}) {
+            if (0 == entry.path().filename().string().rfind("inventory-test.", 0)) {
+                std::filesystem::remove(entry.path());
+            }
+        }
+    }
+
+    /*! @brief Starts the cache with a fetcher counting its calls */
+    void start(InventoryCache& cache, seconds ttl, bool fail = false) {
+        cache.start(ttl, [this, fail] {
+            ++m_fetched;
+            if (fail) {
+                throw std::runtime_error("Device is busy");
+            }
+            Inventory inventory{};
+            inventory.versions.imc_version = "1.2." + std::to_string(m_fetched.load());
+            inventory.firmware_build = "ci-ts.release.1.2";
+            return inventory;
+        }, [this](const Inventory& inventory) {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_last = inventory;
+            ++m_refreshed;
+            m_condition.notify_all();
+        });
+    }
+
+    bool wait_for_refreshes(unsigned count) {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        return m_condition.wait_for(lock, seconds{5}, [this, count] { return m_refreshed >= count; });
+    }
+
+    static std::filesystem::path s_location;
+    std::atomic<unsigned> m_fetched{0};
+    std::mutex m_mutex{};
+    std::condition_variable m_condition{};
+    unsigned m_refreshed{0};
+    Inventory m_last{};
+};
+
+std::filesystem::path InventoryCacheTest::s_location{};
+
+TEST_F(InventoryCacheTest, InventoryIsQueriedInBackground) {
+    InventoryCache cache{"inventory-test"};
+    ASSERT_EQ(0, cache.get().refreshed);
+    ASSERT_FALSE(cache.get().versions.imc_version.has_value());
+
+    start(cache, seconds{3600});
+    ASSERT_TRUE(wait_for_refreshes(1));
+    ASSERT_EQ("1.2.1", m_last.versions.imc_version.value());
+    ASSERT_EQ("1.2.1", cache.get().versions.imc_version.value());
+    ASSERT_NE(0, cache.get().refreshed);
+    cache.stop();
+}
+
+TEST_F(InventoryCacheTest, StoredInventoryIsServedAfterRestart) {
+    {
+        InventoryCache cache{"inventory-test"};
+        start(cache, seconds{3600});
+        ASSERT_TRUE(wait_for_refreshes(1));
+    }
+
+    InventoryCache cache{"inventory-test"};
+    const auto inventory = cache.get();
+    ASSERT_EQ("1.2.1", inventory.versions.imc_version.value());
+    ASSERT_EQ("ci-ts.release.1.2", inventory.firmware_build);
+    ASSERT_FALSE(inventory.versions.board_id_version.has_value());
+
+    // The firmware may have changed meanwhile, so it is queried again
+    start(cache, seconds{3600});
+    ASSERT_TRUE(wait_for_refreshes(2));
+    ASSERT_EQ("1.2.2", cache.get().versions.imc_version.value());
+    cache.stop();
+}
+
+TEST_F(InventoryCacheTest, RefreshQueriesAgain) {
+    InventoryCache cache{"inventory-test"};
+    start(cache, seconds{3600});
+    ASSERT_TRUE(wait_for_refreshes(1));
+
+    cache.refresh();
+    ASSERT_TRUE(wait_for_refreshes(2));
+    ASSERT_EQ("1.2.2", cache.get().versions.imc_version.value());
+    cache.stop();
+}
+
+TEST_F(InventoryCacheTest, StaleInventoryIsQueriedPeriodically) {
+    InventoryCache cache{"inventory-test"};
+    start(cache, seconds{1});
+    ASSERT_TRUE(wait_for_refreshes(2));
+    cache.stop();
+}
+
+TEST_F(InventoryCacheTest, FailedQueryKeepsLastKnownInventory) {
+    {
+        InventoryCache cache{"inventory-test"};
+        start(cache, seconds{3600});
+        ASSERT_TRUE(wait_for_refreshes(1));
+    }
+
+    InventoryCache cache{"inventory-test"};
+    start(cache, seconds{0}, true);
+    cache.refresh();
+    std::this_thread::sleep_for(milliseconds{100});
+    cache.stop();
+    ASSERT_LE(2, m_fetched);
+    ASSERT_EQ(1, m_refreshed);
+    ASSERT_EQ("1.2.1", cache.get().versions.imc_version.value());
+}
@@ -0,0 +1,121 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/curl_handler.hpp"
+#include "ipu/image_cache.hpp"
+#include "ipu/lazy_image.hpp"
+#include "file_server.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <future>
+#include <string>
+
+using namespace psme::ipu;
+using namespace test;
+
+class LazyImageTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        s_location = std::filesystem::temp_directory_path() / ("lazy_image_test_" + std::to_string(::getpid()));
+        std::filesystem::create_directories(s_location);
+    }
+
+    static void TearDownTestSuite() {
+        std::filesystem::remove_all(s_location);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(get_file());
+        std::filesystem::remove(LazyImage::get_map_file(get_file()));
+    }
+
+    static std::string get_file() {
+        return (s_location / "image.iso").string();
+    }
+
+    static std::unique_ptr<LazyImage> open(const FileServer& server) {
+        return CurlHandler()
+            .set_protocols(CURLPROTO_HTTP)
+            .set_url(server.get_uri())
+            .set_file_name(get_file())
+            .open_lazy();
+    }
+
+    static std::string fill(LazyImage& image) {
+        std::promise<std::string> result{};
+        image.start_fill([&result](const std::string& error) { result.set_value(error); });
+        return result.get_future().get();
+    }
+
+    static std::filesystem::path s_location;
+};
+
+std::filesystem::path LazyImageTest::s_location{};
+
+TEST_F(LazyImageTest, ReadFetchesBlocksOnDemand) {
+    const auto content = make_content(10 * LazyImage::BLOCK_SIZE + 123);
+    FileServer server{content, {content.size()}};
+    auto image = open(server);
+    ASSERT_EQ(content.size(), image->get_size());
+    ASSERT_EQ(0, image->get_fetched());
+
+    const std::uint64_t offset = 5 * LazyImage::BLOCK_SIZE + 10;
+    std::string data(100, '\0');
+    image->read(offset, &data[0], data.size());
+    ASSERT_EQ(content.substr(offset, data.size()), data);
+
+    // The block read and the blocks after it are fetched in one request
+    const auto ranges = server.get_ranges();
+    ASSERT_EQ(2, ranges.size());
+    ASSERT_EQ("bytes=" + std::to_string(5 * LazyImage::BLOCK_SIZE) + "-" +
+                  std::to_string((6 + LazyImage::READAHEAD_BLOCKS) * LazyImage::BLOCK_SIZE - 1),
+              ranges.back());
+    ASSERT_EQ((1 + LazyImage::READAHEAD_BLOCKS) * LazyImage::BLOCK_SIZE, image->get_fetched());
+
+    // Fetched blocks are read from the file
+    image->read(offset + LazyImage::BLOCK_SIZE, &data[0], data.size());
+    ASSERT_EQ(content.substr(offset + LazyImage::BLOCK_SIZE, data.size()), data);
+    ASSERT_EQ(2, server.get_ranges().size());
+    ASSERT_FALSE(image->is_complete());
+}
+
+TEST_F(LazyImageTest, FillCompletesImage) {
+    const auto content = make_content(10 * LazyImage::BLOCK_SIZE + 123);
+    FileServer server{content, {content.size()}};
+    auto image = open(server);
+    std::string data(100, '\0');
+    image->read(3 * LazyImage::BLOCK_SIZE, &data[0], data.size());
+
+    ASSERT_EQ("", fill(*image));
+    ASSERT_TRUE(image->is_complete());
+    ASSERT_EQ(content.size(), image->get_fetched());
+    ASSERT_EQ(content, read_file(get_file()));
+    ASSERT_FALSE(std::filesystem::exists(LazyImage::get_map_file(get_file())));
+    ASSERT_EQ(ImageCache::get_digest(get_file()), image->get_digest());
+}
+
+TEST_F(LazyImageTest, FetchedBlocksAreReused) {
+    const auto content = make_content(10 * LazyImage::BLOCK_SIZE + 123);
+    FileServer server{content, {content.size()}};
+    std::string data(100, '\0');
+    open(server)->read(0, &data[0], data.size());
+
+    auto image = open(server);
+    ASSERT_EQ((1 + LazyImage::READAHEAD_BLOCKS) * LazyImage::BLOCK_SIZE, image->get_fetched());
+    const auto requests = server.get_ranges().size();
+    image->read(LazyImage::BLOCK_SIZE, &data[0], data.size());
+    ASSERT_EQ(requests, server.get_ranges().size());
+    ASSERT_EQ(content.substr(LazyImage::BLOCK_SIZE, data.size()), data);
+
+    // Blocks fetched before are hashed with the ones the fill fetches
+    ASSERT_EQ("", fill(*image));
+    ASSERT_EQ(ImageCache::get_digest(get_file()), image->get_digest());
+}
+
+TEST_F(LazyImageTest, ServerWithoutRangesCannotStream) {
+    const auto content = make_content(LazyImage::BLOCK_SIZE);
+    FileServer server{content, {content.size()}, false};
+    ASSERT_THROW(open(server), std::runtime_error);
+}
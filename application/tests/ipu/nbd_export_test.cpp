@@ -0,0 +1,115 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/nbd_export.hpp"
+
+#include <gtest/gtest.h>
+
+#include <endian.h>
+#include <linux/nbd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using namespace psme::ipu;
+
+/*! @brief Plays the kernel side of the NBD protocol over a socket pair */
+class NbdExportTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_EQ(0, ::socketpair(AF_UNIX, SOCK_STREAM, 0, m_sockets));
+        m_thread = std::thread([this] {
+            m_export.serve(m_sockets[1]);
+            ::close(m_sockets[1]);
+        });
+    }
+
+    void TearDown() override {
+        ::shutdown(m_sockets[0], SHUT_RDWR);
+        m_thread.join();
+        ::close(m_sockets[0]);
+    }
+
+    void send_request(std::uint32_t type, std::uint64_t handle, std::uint64_t offset, std::uint32_t length,
+                      const std::string& data = {}) {
+        nbd_request request{};
+        request.magic = htobe32(NBD_REQUEST_MAGIC);
+        request.type = htobe32(type);
+        std::memcpy(request.handle, &handle, sizeof(handle));
+        request.from = htobe64(offset);
+        request.len = htobe32(length);
+        ASSERT_EQ(28, ::send(m_sockets[0], &request, 28, 0));
+        if (!data.empty()) {
+            ASSERT_EQ(static_cast<ssize_t>(data.size()), ::send(m_sockets[0], data.data(), data.size(), 0));
+        }
+    }
+
+    std::uint32_t receive_reply(std::uint64_t handle, std::string* data = nullptr) {
+        nbd_reply reply{};
+        receive(reinterpret_cast<char*>(&reply), sizeof(reply));
+        EXPECT_EQ(NBD_REPLY_MAGIC, be32toh(reply.magic));
+        EXPECT_EQ(0, std::memcmp(reply.handle, &handle, sizeof(handle)));
+        if (data) {
+            receive(&(*data)[0], data->size());
+        }
+        return be32toh(reply.error);
+    }
+
+    void receive(char* data, std::size_t size) {
+        while (size > 0) {
+            const auto count = ::recv(m_sockets[0], data, size, 0);
+            ASSERT_GT(count, 0);
+            data += count;
+            size -= static_cast<std::size_t>(count);
+        }
+    }
+
+    static constexpr std::uint64_t SIZE = 10000;
+
+    int m_sockets[2]{-1, -1};
+    NbdExport m_export{SIZE, [](std::uint64_t offset, char* data, std::size_t size) {
+        if (offset >= 8192) {
+            throw std::runtime_error("Fetch failed");
+        }
+        for (std::size_t i = 0; i < size; ++i) {
+            data[i] = static_cast<char>((offset + i) % 251);
+        }
+    }};
+    std::thread m_thread{};
+};
+
+TEST_F(NbdExportTest, ReadIsServedByCallback) {
+    send_request(NBD_CMD_READ, 7, 4096, 512);
+    std::string data(512, '\0');
+    ASSERT_EQ(0, receive_reply(7, &data));
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        ASSERT_EQ(static_cast<char>((4096 + i) % 251), data[i]);
+    }
+}
+
+TEST_F(NbdExportTest, FailedReadReturnsError) {
+    send_request(NBD_CMD_READ, 8, 8192, 1024);
+    ASSERT_EQ(EIO, receive_reply(8));
+
+    // The export keeps serving requests
+    send_request(NBD_CMD_READ, 9, 0, 16);
+    std::string data(16, '\0');
+    ASSERT_EQ(0, receive_reply(9, &data));
+}
+
+TEST_F(NbdExportTest, WriteIsRejected) {
+    send_request(NBD_CMD_WRITE, 10, 0, 4, "data");
+    ASSERT_EQ(EPERM, receive_reply(10));
+    send_request(NBD_CMD_FLUSH, 11, 0, 0);
+    ASSERT_EQ(0, receive_reply(11));
+}
+
+TEST_F(NbdExportTest, DisconnectEndsServing) {
+    send_request(NBD_CMD_DISC, 12, 0, 0);
+    char byte{};
+    ASSERT_EQ(0, ::recv(m_sockets[0], &byte, 1, 0));
+}
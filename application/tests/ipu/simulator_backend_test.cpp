@@ -0,0 +1,162 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/simulator_backend.hpp"
+#include "file_server.hpp"
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace psme::ipu;
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
+class SimulatorBackendTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_settings.root = std::filesystem::temp_directory_path() / ("simulator_backend_test_" + std::to_string(::getpid()));
+        m_settings.image_server_port = 0;
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(m_settings.root);
+    }
+
+    SimulatorBackend::Settings m_settings{};
+};
+
+TEST(FaultProfileTest, ErrorRateBoundsFailures) {
+    FaultProfile profile{};
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_NO_THROW(profile.apply("operation"));
+    }
+    profile.error_rate = 1.0;
+    ASSERT_THROW(profile.apply("operation"), std::runtime_error);
+}
+
+TEST(FaultProfileTest, LatencyStaysWithinJitter) {
+    const auto profile = FaultProfile::from_json(json::Json::parse(R"({"latency-ms": 10, "jitter-ms": 20})"));
+    ASSERT_EQ(milliseconds{10}, profile.latency);
+    ASSERT_EQ(0.0, profile.error_rate);
+    bool varies = false;
+    for (int i = 0; i < 200; ++i) {
+        const auto latency = profile.sample_latency();
+        ASSERT_LE(milliseconds{0}, latency);
+        ASSERT_GE(milliseconds{30}, latency);
+        varies = varies || latency != profile.sample_latency();
+    }
+    ASSERT_TRUE(varies);
+}
+
+TEST_F(SimulatorBackendTest, SettingsAreReadFromConfiguration) {
+    const auto settings = SimulatorBackend::Settings::from_json(json::Json::parse(R"({
+        "root": "/tmp/simulator",
+        "cpchnl-max-outstanding": 2,
+        "update": {"latency-ms": 5000, "error-rate": 0.5}
+    })"));
+    ASSERT_EQ("/tmp/simulator", settings.root.string());
+    ASSERT_EQ(8090, settings.image_server_port);
+    ASSERT_EQ(2, settings.cpchnl_max_outstanding);
+    ASSERT_EQ(milliseconds{5000}, settings.update.latency);
+    ASSERT_EQ(0.5, settings.update.error_rate);
+    ASSERT_EQ(milliseconds{0}, settings.cpchnl.latency);
+}
+
+TEST_F(SimulatorBackendTest, UpdateIsFlashedAndReportedByInventory) {
+    SimulatorBackend backend{m_settings};
+    ASSERT_EQ(SimulatorBackend::INITIAL_VERSION, backend.get_component_info().imc_version.value());
+    ASSERT_EQ("simulator", backend.get_firmware_build());
+
+    const auto package = m_settings.root / "image.pldm";
+    std::ofstream{package} << test::make_content(1000);
+    ASSERT_EQ("POR", backend.run_update(package.string()));
+    ASSERT_EQ(test::make_content(1000), test::read_file(backend.get_flash_path()));
+
+    const auto versions = backend.get_component_info();
+    ASSERT_EQ("1.0.0.1", versions.imc_version.value());
+    ASSERT_EQ(SimulatorBackend::INITIAL_VERSION, versions.recovery_imc_version.value());
+}
+
+TEST_F(SimulatorBackendTest, FailedUpdateKeepsVersions) {
+    m_settings.update.error_rate = 1.0;
+    m_settings.inventory.latency = milliseconds{50};
+    SimulatorBackend backend{m_settings};
+
+    const auto package = m_settings.root / "image.pldm";
+    std::ofstream{package} << test::make_content(10);
+    ASSERT_THROW(backend.run_update(package.string()), std::runtime_error);
+    ASSERT_FALSE(std::filesystem::exists(backend.get_flash_path()));
+
+    const auto start = steady_clock::now();
+    ASSERT_EQ(SimulatorBackend::INITIAL_VERSION, backend.get_component_info().imc_version.value());
+    ASSERT_LE(milliseconds{50}, steady_clock::now() - start);
+}
+
+TEST_F(SimulatorBackendTest, ImcResetIsSimulated) {
+    SimulatorBackend backend{m_settings};
+    ASSERT_NO_THROW(backend.reset_imc(agent_framework::model::enums::ResetType::ForceRestart));
+
+    m_settings.imc_reset.error_rate = 1.0;
+    SimulatorBackend failing{m_settings};
+    ASSERT_THROW(failing.reset_imc(agent_framework::model::enums::ResetType::ForceRestart), std::runtime_error);
+}
+
+TEST_F(SimulatorBackendTest, ImagesAreServed) {
+    SimulatorBackend backend{m_settings};
+    const auto content = test::make_content(300000);
+    std::ofstream{backend.get_images_directory() / "image.iso", std::ios::binary} << content;
+
+    auto fetched = test::fetch(backend.get_image_uri("image.iso"));
+    ASSERT_EQ(200, fetched.status);
+    ASSERT_EQ(content, fetched.body);
+
+    fetched = test::fetch(backend.get_image_uri("image.iso"), "100000-100099");
+    ASSERT_EQ(206, fetched.status);
+    ASSERT_EQ(content.substr(100000, 100), fetched.body);
+
+    fetched = test::fetch(backend.get_image_uri("image.iso"), "-100");
+    ASSERT_EQ(206, fetched.status);
+    ASSERT_EQ(content.substr(content.size() - 100), fetched.body);
+    ASSERT_EQ(416, test::fetch(backend.get_image_uri("image.iso"), "-0").status);
+
+    ASSERT_EQ(404, test::fetch(backend.get_image_uri("missing.iso")).status);
+    ASSERT_EQ(404, test::fetch(backend.get_image_uri("../image.pldm")).status);
+}
+
+TEST_F(SimulatorBackendTest, ImageServerFailuresAreSimulated) {
+    m_settings.image_server.error_rate = 1.0;
+    SimulatorBackend backend{m_settings};
+    std::ofstream{backend.get_images_directory() / "image.iso"} << test::make_content(10);
+    ASSERT_EQ(503, test::fetch(backend.get_image_uri("image.iso")).status);
+}
+
+TEST_F(SimulatorBackendTest, CpchnlCommandsArePipelined) {
+    m_settings.cpchnl.latency = milliseconds{200};
+    SimulatorBackend backend{m_settings};
+    CpchnlChannel channel{backend.create_cpchnl_transport()};
+
+    const auto start = steady_clock::now();
+    std::vector<std::future<void>> completions{};
+    for (std::size_t i = 0; i < m_settings.cpchnl_max_outstanding; ++i) {
+        completions.push_back(channel.submit(CpchnlCommand{}));
+    }
+    for (auto& completion : completions) {
+        ASSERT_NO_THROW(completion.get());
+    }
+    ASSERT_GT(milliseconds{500}, steady_clock::now() - start);
+}
+
+TEST_F(SimulatorBackendTest, CpchnlFailuresAreSimulated) {
+    m_settings.cpchnl.error_rate = 1.0;
+    SimulatorBackend backend{m_settings};
+    CpchnlChannel channel{backend.create_cpchnl_transport()};
+    ASSERT_THROW(channel.submit(CpchnlCommand{}).get(), std::runtime_error);
+}
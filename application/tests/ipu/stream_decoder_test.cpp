@@ -0,0 +1,90 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/stream_decoder.hpp"
+
+#include <gtest/gtest.h>
+#include <zlib.h>
+
+#ifdef ZSTD_ENABLED
+#include <zstd.h>
+#endif
+
+using namespace psme::ipu;
+using Format = StreamDecoder::Format;
+
+namespace {
+
+std::string make_content(std::size_t size) {
+    std::string content(size, '\0');
+    for (std::size_t i = 0; i < size; ++i) {
+        content[i] = static_cast<char>(i * 31 % 251);
+    }
+    return content;
+}
+
+std::string gzip(const std::string& content) {
+    z_stream stream{};
+    deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY);
+    std::string compressed(deflateBound(&stream, static_cast<uLong>(content.size())), '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(content.data()));
+    stream.avail_in = static_cast<uInt>(content.size());
+    stream.next_out = reinterpret_cast<Bytef*>(&compressed[0]);
+    stream.avail_out = static_cast<uInt>(compressed.size());
+    deflate(&stream, Z_FINISH);
+    compressed.resize(stream.total_out);
+    deflateEnd(&stream);
+    return compressed;
+}
+
+/*! @brief Decode data passed in pieces of the given size */
+std::string decode(Format format, const std::string& compressed, std::size_t piece) {
+    auto decoder = StreamDecoder::create(format);
+    std::string decoded{};
+    const StreamDecoder::Sink sink = [&decoded](const char* data, std::size_t size) { decoded.append(data, size); };
+    for (std::size_t offset = 0; offset < compressed.size(); offset += piece) {
+        const auto size = std::min(piece, compressed.size() - offset);
+        decoder->decode(compressed.data() + offset, size, sink);
+    }
+    decoder->finish(sink);
+    return decoded;
+}
+
+} // namespace
+
+TEST(StreamDecoderTest, FormatIsDetected) {
+    ASSERT_EQ(Format::GZIP, StreamDecoder::detect("https://host/image.iso", "application/gzip"));
+    ASSERT_EQ(Format::GZIP, StreamDecoder::detect("https://host/image.iso", "Application/X-Gzip; charset=binary"));
+    ASSERT_EQ(Format::ZSTD, StreamDecoder::detect("https://host/image", "application/zstd"));
+    ASSERT_EQ(Format::GZIP, StreamDecoder::detect("https://host/image.iso.GZ?token=1", "application/octet-stream"));
+    ASSERT_EQ(Format::ZSTD, StreamDecoder::detect("https://host/image.iso.zst", ""));
+    ASSERT_EQ(Format::NONE, StreamDecoder::detect("https://host/image.iso?name=a.gz", "application/octet-stream"));
+    ASSERT_EQ(nullptr, StreamDecoder::create(Format::NONE));
+}
+
+TEST(StreamDecoderTest, GzipIsDecodedInPieces) {
+    const auto content = make_content(3 * StreamDecoder::BUFFER_SIZE + 17);
+    const auto compressed = gzip(content);
+    ASSERT_EQ(content, decode(Format::GZIP, compressed, 1000));
+    ASSERT_EQ(content, decode(Format::GZIP, compressed, compressed.size()));
+}
+
+TEST(StreamDecoderTest, ConcatenatedGzipMembersAreDecoded) {
+    ASSERT_EQ("first second", decode(Format::GZIP, gzip("first ") + gzip("second"), 7));
+}
+
+TEST(StreamDecoderTest, InvalidGzipIsRejected) {
+    const auto compressed = gzip(make_content(100'000));
+    ASSERT_THROW(decode(Format::GZIP, compressed.substr(0, compressed.size() / 2), 1000), std::runtime_error);
+    ASSERT_THROW(decode(Format::GZIP, make_content(1000), 1000), std::runtime_error);
+}
+
+#ifdef ZSTD_ENABLED
+TEST(StreamDecoderTest, ZstdIsDecoded) {
+    const auto content = make_content(3 * StreamDecoder::BUFFER_SIZE + 17);
+    std::string compressed(ZSTD_compressBound(content.size()), '\0');
+    compressed.resize(ZSTD_compress(&compressed[0], compressed.size(), content.data(), content.size(), 3));
+    ASSERT_EQ(content, decode(Format::ZSTD, compressed, 1000));
+    ASSERT_THROW(decode(Format::ZSTD, compressed.substr(0, compressed.size() - 1), 1000), std::runtime_error);
+}
+#endif
@@ -0,0 +1,69 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/task_progress.hpp"
+#include "agent-framework/module/managers/utils/manager_utils.hpp"
+#include "agent-framework/module/model/task.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace psme::ipu;
+using agent_framework::model::Task;
+
+class TaskProgressTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Task task{};
+        m_uuid = task.get_uuid();
+        agent_framework::module::get_manager<Task>().add_entry(task);
+    }
+
+    void TearDown() override {
+        agent_framework::module::get_manager<Task>().remove_entry(m_uuid);
+    }
+
+    Task get_task() const {
+        return agent_framework::module::get_manager<Task>().get_entry(m_uuid);
+    }
+
+    std::string m_uuid{};
+};
+
+TEST_F(TaskProgressTest, StageIsMappedToPercentRange) {
+    TaskProgress progress{m_uuid, 20, 70};
+    progress.update(0, 1000);
+    progress.update(500, 1000);
+
+    const auto task = get_task();
+    ASSERT_EQ(45, task.get_percent_complete());
+    ASSERT_EQ(500, task.get_bytes_transferred());
+    ASSERT_EQ(1000, task.get_total_bytes());
+
+    progress.update(1000, 1000);
+    ASSERT_EQ(70, get_task().get_percent_complete());
+}
+
+TEST_F(TaskProgressTest, UpdatesAreRateLimited) {
+    TaskProgress progress{m_uuid, 0, 100};
+    progress.update(10, 100'000);
+    ASSERT_EQ(10, get_task().get_bytes_transferred());
+
+    // Less than one percent more, within the update interval
+    progress.update(900, 100'000);
+    ASSERT_EQ(10, get_task().get_bytes_transferred());
+
+    progress.update(1000, 100'000);
+    ASSERT_EQ(1000, get_task().get_bytes_transferred());
+    ASSERT_EQ(1, get_task().get_percent_complete());
+}
+
+TEST_F(TaskProgressTest, SettingPercentClearsTransfer) {
+    TaskProgress progress{m_uuid, 0, 80};
+    progress.update(100, 100);
+    TaskProgress::set_percent(m_uuid, 80);
+
+    const auto task = get_task();
+    ASSERT_EQ(80, task.get_percent_complete());
+    ASSERT_FALSE(task.get_bytes_transferred().has_value());
+    ASSERT_FALSE(task.get_estimated_remaining_seconds().has_value());
+}
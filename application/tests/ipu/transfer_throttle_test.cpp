@@ -0,0 +1,86 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "ipu/transfer_throttle.hpp"
+#include "psme/rest/server/latency_monitor.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace psme::ipu;
+using namespace std::chrono_literals;
+using psme::rest::server::LatencyMonitor;
+
+namespace {
+
+constexpr std::uint64_t MiB = 1024 * 1024;
+
+void record_latency(std::chrono::milliseconds latency, TransferThrottle::Clock::time_point time) {
+    for (int i = 0; i < 10; ++i) {
+        LatencyMonitor::get_instance()->record(latency, time);
+    }
+}
+
+} // namespace
+
+TEST(TokenBucketTest, RateIsLimited) {
+    TokenBucket bucket{1000};
+    const auto now = TokenBucket::Clock::now();
+    // Credit saved while idle
+    ASSERT_EQ(0ms, bucket.take(100, now));
+    ASSERT_EQ(1s, std::chrono::round<std::chrono::milliseconds>(bucket.take(1000, now)));
+    ASSERT_EQ(1500ms, std::chrono::round<std::chrono::milliseconds>(bucket.take(1000, now + 500ms)));
+
+    bucket.set_rate(0, now);
+    ASSERT_EQ(0ms, bucket.take(1000 * MiB, now));
+}
+
+TEST(TransferThrottleTest, LimitsAreLoaded) {
+    const auto limits = TransferThrottle::load_limits(json::Json::parse(R"({
+        "transfer-limits": {"max-download-rate": 1000, "adaptive": true, "latency-target-ms": 50}
+    })"));
+    ASSERT_EQ(1000, limits.max_download_rate);
+    ASSERT_EQ(0, limits.max_write_rate);
+    ASSERT_TRUE(limits.adaptive);
+    ASSERT_EQ(50ms, limits.latency_target);
+    ASSERT_FALSE(limits.low_priority);
+
+    ASSERT_FALSE(TransferThrottle::load_limits(json::Json::object()).adaptive);
+}
+
+TEST(TransferThrottleTest, AdaptiveRateFollowsLatency) {
+    TransferThrottle throttle{};
+    TransferLimits limits{};
+    limits.max_write_rate = 8 * MiB;
+    limits.adaptive = true;
+    limits.latency_target = 100ms;
+    throttle.set_limits(limits);
+
+    const auto start = TransferThrottle::Clock::now() + 1h;
+    throttle.reserve_write(0, start);
+    record_latency(300ms, start + 500ms);
+    throttle.reserve_write(MiB, start + 1s);
+    ASSERT_EQ(4 * MiB, throttle.get_write_rate());
+
+    // Not changed more often than each ADJUST_INTERVAL
+    throttle.reserve_write(MiB, start + 1500ms);
+    ASSERT_EQ(4 * MiB, throttle.get_write_rate());
+
+    record_latency(10ms, start + 15s);
+    throttle.reserve_write(MiB, start + 16s);
+    ASSERT_EQ(5 * MiB, throttle.get_write_rate());
+}
+
+TEST(TransferThrottleTest, BackOffStartsFromObservedRate) {
+    TransferThrottle throttle{};
+    TransferLimits limits{};
+    limits.adaptive = true;
+    limits.latency_target = 100ms;
+    throttle.set_limits(limits);
+
+    const auto start = TransferThrottle::Clock::now() + 2h;
+    throttle.reserve_write(0, start);
+    ASSERT_EQ(0ms, throttle.reserve_write(10 * MiB, start + 500ms));
+    record_latency(300ms, start + 900ms);
+    throttle.reserve_write(0, start + 1s);
+    ASSERT_EQ(5 * MiB, throttle.get_write_rate());
+}
@@ -0,0 +1,141 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/endpoints/task_service/monitor.hpp"
+#include "psme/rest/endpoints/task_service/monitor_content_builder.hpp"
+#include "psme/rest/eventing/event_dispatcher.hpp"
+#include "psme/rest/constants/constants.hpp"
+#include "psme/rest/constants/routes.hpp"
+#include "psme/rest/server/http_headers.hpp"
+#include "psme/rest/server/status.hpp"
+
+#include "agent-framework/action/task_result_manager.hpp"
+#include "agent-framework/module/managers/utils/manager_utils.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace psme::rest;
+using agent_framework::eventing::EventData;
+using agent_framework::model::Task;
+using Component = agent_framework::model::enums::Component;
+using Notification = agent_framework::model::enums::Notification;
+
+namespace {
+
+constexpr char TASK_UUID[] = "monitored_task";
+
+std::string get_preference_applied(const server::Response& response) {
+    const auto& headers = response.get_headers();
+    const auto it = headers.find(server::http_headers::Prefer::PREFERENCE_APPLIED);
+    return headers.end() == it ? std::string{} : it->second;
+}
+
+} // namespace
+
+class TaskMonitorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Task task{};
+        task.set_uuid(TASK_UUID);
+        task.set_id(1);
+        task.set_state(agent_framework::model::enums::TaskState::Running);
+        agent_framework::module::get_manager<Task>().add_entry(task);
+        endpoint::MonitorContentBuilder::get_instance()->add_builder(TASK_UUID, [](json::Json) {
+            server::Response response{};
+            response.set_status(server::status_2XX::NO_CONTENT);
+            return response;
+        });
+        eventing::EventDispatcher::get_instance()->start();
+    }
+
+    void TearDown() override {
+        eventing::EventDispatcher::get_instance()->stop();
+        agent_framework::module::get_manager<Task>().clear_entries();
+    }
+
+    static server::Request make_request(const std::string& prefer) {
+        server::Request request{};
+        request.set_method(server::Method::GET);
+        request.set_destination("/redfish/v1/TaskService/Tasks/1/Monitor");
+        request.params[constants::PathParam::TASK_ID] = "1";
+        if (!prefer.empty()) {
+            request.set_header(server::http_headers::Prefer::PREFER, prefer);
+        }
+        return request;
+    }
+
+    /*! @brief Complete the task, as the task runner does */
+    static void finish() {
+        agent_framework::action::TaskResultManager::get_instance()->set_result(TASK_UUID, json::Json::object());
+        agent_framework::module::get_manager<Task>().get_entry_reference(TASK_UUID)->set_end_time(
+            std::string{"2024-01-01T00:00:00+00:00"});
+    }
+
+    endpoint::Monitor m_monitor{constants::Routes::MONITOR_PATH};
+};
+
+TEST_F(TaskMonitorTest, FinishedTaskIsNotDeferred) {
+    finish();
+    server::Response response{};
+    m_monitor.get(make_request("wait=10"), response);
+    ASSERT_FALSE(response.get_deferred());
+    ASSERT_EQ(server::status_2XX::NO_CONTENT, response.get_status());
+    ASSERT_EQ("", get_preference_applied(response));
+}
+
+TEST_F(TaskMonitorTest, ChangeOfTaskEndsWait) {
+    server::Response response{};
+    m_monitor.get(make_request("respond-async, wait=10"), response);
+    const auto deferred = response.get_deferred();
+    ASSERT_TRUE(deferred);
+    ASSERT_FALSE(deferred->is_ready());
+
+    finish();
+    eventing::EventDispatcher::get_instance()->publish(
+        EventData{Notification::Update, Component::Task, TASK_UUID, 1, Component::None, ""});
+    // Well before the deadline
+    ASSERT_TRUE(deferred->wait_for(std::chrono::milliseconds{5000}));
+
+    server::Response completed{};
+    deferred->complete(completed);
+    ASSERT_EQ(server::status_2XX::NO_CONTENT, completed.get_status());
+    ASSERT_EQ("wait=10", get_preference_applied(completed));
+}
+
+TEST_F(TaskMonitorTest, ExpiredWaitReturnsRunningTask) {
+    server::Response response{};
+    m_monitor.get(make_request("wait=1"), response);
+    const auto deferred = response.get_deferred();
+    ASSERT_TRUE(deferred);
+    ASSERT_TRUE(deferred->wait_for(std::chrono::milliseconds{3000}));
+
+    server::Response completed{};
+    deferred->complete(completed);
+    ASSERT_EQ(server::status_2XX::ACCEPTED, completed.get_status());
+    ASSERT_EQ("wait=1", get_preference_applied(completed));
+}
+
+TEST_F(TaskMonitorTest, WaitIsCapped) {
+    const auto now = std::chrono::steady_clock::now();
+    server::Response response{};
+    m_monitor.get(make_request("wait=3600"), response);
+    const auto watch = std::dynamic_pointer_cast<eventing::ResourceWatch>(response.get_deferred());
+    ASSERT_TRUE(watch);
+    ASSERT_LE(watch->get_deadline(), std::chrono::steady_clock::now() + endpoint::Monitor::MAX_WAIT);
+    ASSERT_GE(watch->get_deadline(), now + endpoint::Monitor::MAX_WAIT);
+
+    // Stopping the dispatcher releases the parked request
+    eventing::EventDispatcher::get_instance()->stop();
+    ASSERT_TRUE(watch->is_ready());
+    server::Response completed{};
+    watch->complete(completed);
+    ASSERT_EQ("wait=30", get_preference_applied(completed));
+}
+
+TEST_F(TaskMonitorTest, RequestWithoutPreferenceIsNotDeferred) {
+    server::Response response{};
+    m_monitor.get(make_request(""), response);
+    ASSERT_FALSE(response.get_deferred());
+    ASSERT_EQ(server::status_2XX::ACCEPTED, response.get_status());
+    ASSERT_EQ("", get_preference_applied(response));
+}
@@ -0,0 +1,206 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/eventing/event_delivery.hpp"
+#include "psme/rest/eventing/subscription_manager.hpp"
+#include "psme/ipu/loopback_server.hpp"
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+using namespace psme::rest;
+using namespace psme::rest::eventing;
+
+namespace {
+
+/*! @brief Loopback HTTP listener answering each request with the next status */
+class Listener {
+public:
+    explicit Listener(std::vector<int> statuses) : m_statuses{std::move(statuses)} {}
+
+    Listener(const Listener&) = delete;
+    Listener& operator=(const Listener&) = delete;
+
+    std::string get_uri() const {
+        return m_server.get_uri("events");
+    }
+
+    std::vector<json::Json> get_requests() const {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        return m_requests;
+    }
+private:
+    void serve(const psme::ipu::LoopbackServer::Request& request, psme::ipu::LoopbackServer::Connection& connection) {
+        int status = 0;
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_requests.push_back(json::Json::parse(request.body));
+            status = m_statuses[std::min(m_requests.size(), m_statuses.size()) - 1];
+        }
+        connection.respond(std::to_string(status) + " Status");
+    }
+
+    std::vector<int> m_statuses;
+    mutable std::mutex m_mutex{};
+    std::vector<json::Json> m_requests{};
+    // Last, so it is stopped before the members its handler uses are destroyed
+    psme::ipu::LoopbackServer m_server{0, 1, [this](const psme::ipu::LoopbackServer::Request& request,
+                                                    psme::ipu::LoopbackServer::Connection& connection) {
+        serve(request, connection);
+    }};
+};
+
+Event make_event(std::uint64_t id, const std::string& message_id) {
+    json::Json record(json::Json::value_t::object);
+    record["EventType"] = "ResourceAdded";
+    record["MessageId"] = message_id;
+    record["OriginOfCondition"]["@odata.id"] = "/redfish/v1/Systems/1";
+    return Event{id, record, "ComputerSystem"};
+}
+
+Subscription make_subscription(const std::string& destination, const std::string& context) {
+    json::Json json(json::Json::value_t::object);
+    json["Destination"] = destination;
+    json["Protocol"] = "Redfish";
+    json["Context"] = context;
+    json["RegistryPrefixes"] = json::Json::array({"ResourceEvent"});
+    return Subscription::from_json(json);
+}
+
+bool wait_until(const std::function<bool()>& condition) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+    return true;
+}
+
+} // namespace
+
+class EventDeliveryTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        s_location = std::filesystem::temp_directory_path() / ("event_delivery_test_" + std::to_string(::getpid()));
+        std::filesystem::create_directories(s_location);
+        database::Database::set_default_location(s_location.string());
+    }
+
+    static void TearDownTestSuite() {
+        std::filesystem::remove_all(s_location);
+    }
+
+    void TearDown() override {
+        EventDelivery::get_instance()->stop();
+        EventDelivery::get_instance()->set_retry_policy(EventDelivery::RETRY_ATTEMPTS, EventDelivery::RETRY_INTERVAL);
+        for (const auto id : SubscriptionManager::get_instance()->get_ids(0, 0, SubscriptionManager::MAX_SUBSCRIPTIONS)) {
+            SubscriptionManager::get_instance()->del(id);
+        }
+    }
+
+    static std::filesystem::path s_location;
+};
+
+std::filesystem::path EventDeliveryTest::s_location{};
+
+TEST_F(EventDeliveryTest, SubscriptionIsStored) {
+    json::Json stored{};
+    std::uint64_t id{};
+    {
+        SubscriptionManager manager{"stored_subscriptions"};
+        manager.add(make_subscription("https://collector/events", "first"));
+        id = manager.add(make_subscription("https://collector/events", "second"));
+        manager.del(1);
+        stored = manager.get(id).to_json();
+    }
+
+    SubscriptionManager restarted{"stored_subscriptions"};
+    restarted.load();
+    ASSERT_EQ(1, restarted.get_count());
+    ASSERT_EQ(stored, restarted.get(id).to_json());
+    ASSERT_EQ("second", restarted.get(id).get_context());
+    // Ids are not reused after restart
+    ASSERT_EQ(id + 1, restarted.add(make_subscription("https://collector/events", "third")));
+}
+
+TEST_F(EventDeliveryTest, SubscriptionSelectsEvents) {
+    const auto subscription = make_subscription("https://collector/events", "");
+    ASSERT_TRUE(subscription.matches(make_event(1, "ResourceEvent.1.0.ResourceCreated")));
+    ASSERT_FALSE(subscription.matches(make_event(2, "TaskEvent.1.0.TaskStarted")));
+}
+
+TEST_F(EventDeliveryTest, EventsAreBatched) {
+    Listener listener{{204}};
+    const auto id = SubscriptionManager::get_instance()->add(make_subscription(listener.get_uri(), "batched"));
+    auto* delivery = EventDelivery::get_instance();
+    delivery->start();
+
+    constexpr std::size_t COUNT = 100;
+    for (std::size_t i = 1; i <= COUNT; ++i) {
+        delivery->push(make_event(i, "ResourceEvent.1.0.ResourceCreated"));
+        delivery->push(make_event(i, "TaskEvent.1.0.TaskStarted"));
+    }
+    ASSERT_TRUE(wait_until([&]() { return COUNT == delivery->get_statistics(id).delivered; }));
+
+    const auto requests = listener.get_requests();
+    ASSERT_LT(requests.size(), COUNT / 2);
+    std::size_t next_id = 1;
+    for (const auto& request : requests) {
+        ASSERT_EQ("batched", request["Context"]);
+        ASSERT_LE(request["Events"].size(), EventDelivery::MAX_BATCH_SIZE);
+        for (const auto& record : request["Events"]) {
+            ASSERT_EQ(std::to_string(next_id++), record["EventId"]);
+        }
+    }
+    ASSERT_EQ(COUNT + 1, next_id);
+    ASSERT_EQ(0, delivery->get_statistics(id).dropped);
+}
+
+TEST_F(EventDeliveryTest, FailedBatchIsRetried) {
+    Listener listener{{500, 503, 204}};
+    const auto id = SubscriptionManager::get_instance()->add(make_subscription(listener.get_uri(), ""));
+    auto* delivery = EventDelivery::get_instance();
+    delivery->set_retry_policy(3, std::chrono::milliseconds{10});
+    delivery->start();
+
+    delivery->push(make_event(1, "ResourceEvent.1.0.ResourceCreated"));
+    ASSERT_TRUE(wait_until([&]() { return 1 == delivery->get_statistics(id).delivered; }));
+
+    const auto requests = listener.get_requests();
+    ASSERT_EQ(3, requests.size());
+    ASSERT_EQ(requests.front(), requests.back());
+    ASSERT_EQ(0, delivery->get_statistics(id).dropped);
+}
+
+TEST_F(EventDeliveryTest, UndeliverableEventsAreDropped) {
+    Listener listener{{500}};
+    const auto id = SubscriptionManager::get_instance()->add(make_subscription(listener.get_uri(), ""));
+    auto* delivery = EventDelivery::get_instance();
+    delivery->set_retry_policy(1, std::chrono::milliseconds{10});
+    delivery->start();
+
+    constexpr std::size_t COUNT = EventDelivery::MAX_QUEUE_SIZE + EventDelivery::MAX_BATCH_SIZE + 10;
+    for (std::size_t i = 1; i <= COUNT; ++i) {
+        delivery->push(make_event(i, "ResourceEvent.1.0.ResourceCreated"));
+    }
+    // Queue overflow drops the oldest queued events at once
+    auto statistics = delivery->get_statistics(id);
+    ASSERT_LE(10, statistics.dropped);
+    ASSERT_EQ(COUNT, statistics.dropped + statistics.pending);
+
+    // Batch in flight is dropped after the retry
+    ASSERT_TRUE(wait_until([&]() { return delivery->get_statistics(id).dropped >= 10 + EventDelivery::MAX_BATCH_SIZE; }));
+    statistics = delivery->get_statistics(id);
+    ASSERT_EQ(0, statistics.delivered);
+    ASSERT_EQ(COUNT, statistics.dropped + statistics.pending);
+    ASSERT_LE(2, listener.get_requests().size());
+}
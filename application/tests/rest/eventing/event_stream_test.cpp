@@ -0,0 +1,151 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/eventing/event_dispatcher.hpp"
+#include "psme/rest/eventing/event_stream.hpp"
+#include "psme/rest/server/response.hpp"
+#include "psme/rest/server/status.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace psme::rest;
+using namespace psme::rest::eventing;
+using agent_framework::eventing::EventData;
+using Component = agent_framework::model::enums::Component;
+using Notification = agent_framework::model::enums::Notification;
+
+namespace {
+
+Event make_event(std::uint64_t id, const std::string& message_id, const std::string& origin) {
+    json::Json record(json::Json::value_t::object);
+    record["EventType"] = "ResourceAdded";
+    record["MessageId"] = message_id;
+    record["OriginOfCondition"]["@odata.id"] = origin;
+    return Event{id, record, "ComputerSystem"};
+}
+
+std::string read_all(server::ResponseStream& stream) {
+    std::string data{};
+    char buffer[16];
+    while (const auto size = stream.read(buffer, sizeof(buffer))) {
+        data.append(buffer, size);
+    }
+    return data;
+}
+
+std::string wait_and_read(server::ResponseStream& stream) {
+    stream.wait_for(std::chrono::milliseconds{2000});
+    return read_all(stream);
+}
+
+} // namespace
+
+TEST(EventStreamTest, EventIsRenderedAsFrame) {
+    const auto event = make_event(7, "ResourceEvent.1.0.ResourceCreated", "/redfish/v1/Systems/1");
+    const auto& frame = *event.get_frame();
+
+    ASSERT_EQ(0, frame.find("id: 7\ndata: {"));
+    ASSERT_EQ(frame.size() - 2, frame.find("\n\n"));
+    const auto payload = json::Json::parse(frame.substr(frame.find('{')));
+    ASSERT_EQ("7", payload["Events"][0]["EventId"]);
+    ASSERT_EQ("/redfish/v1/Systems/1", payload["Events"][0]["OriginOfCondition"]["@odata.id"]);
+}
+
+TEST(EventStreamTest, FilterSelectsEvents) {
+    const auto created = make_event(1, "ResourceEvent.1.0.ResourceCreated", "/redfish/v1/Systems/1");
+    const auto started = make_event(2, "TaskEvent.1.0.TaskStarted", "/redfish/v1/TaskService/Tasks/1");
+
+    EventStream stream{server::Filter::parse("RegistryPrefix eq 'TaskEvent' or OriginResource eq '/redfish/v1/Systems/2'"),
+                       1024};
+    ASSERT_TRUE(stream.push(created));
+    ASSERT_TRUE(stream.push(started));
+
+    ASSERT_EQ(*started.get_frame(), read_all(stream));
+    ASSERT_TRUE(created.matches(server::Filter::parse("ResourceType eq 'ComputerSystem' and EventType eq 'ResourceAdded'")));
+}
+
+TEST(EventStreamTest, ParkedReaderIsResumed) {
+    EventStream stream{server::Filter{}, 1024};
+    int resumed = 0;
+    ASSERT_TRUE(stream.wait([&resumed]() { ++resumed; }));
+
+    ASSERT_TRUE(stream.push_keep_alive());
+    ASSERT_EQ(1, resumed);
+    // Data is pending, the reader must not park
+    ASSERT_FALSE(stream.wait([&resumed]() { ++resumed; }));
+
+    ASSERT_EQ(": keep-alive\n\n", read_all(stream));
+    ASSERT_TRUE(stream.wait([&resumed]() { ++resumed; }));
+    stream.close();
+    ASSERT_EQ(2, resumed);
+    ASSERT_TRUE(stream.is_closed());
+}
+
+TEST(EventStreamTest, SlowClientIsClosed) {
+    const auto event = make_event(1, "ResourceEvent.1.0.ResourceCreated", "/redfish/v1/Systems/1");
+    EventStream stream{server::Filter{}, event.get_frame()->size() + 1};
+
+    ASSERT_TRUE(stream.push(event));
+    ASSERT_FALSE(stream.push(event));
+    ASSERT_TRUE(stream.is_closed());
+    ASSERT_EQ("", read_all(stream));
+}
+
+TEST(EventStreamTest, DispatcherDeliversModelChanges) {
+    auto* dispatcher = EventDispatcher::get_instance();
+    dispatcher->start();
+    auto stream = dispatcher->open_stream(server::Filter{}, "");
+
+    dispatcher->publish(EventData{Notification::Add, Component::Manager, "manager", 1, Component::None, ""});
+    const auto first = wait_and_read(*stream);
+    ASSERT_NE(std::string::npos, first.find("ResourceEvent.1.0.ResourceCreated"));
+    ASSERT_NE(std::string::npos, first.find("/redfish/v1/Managers/1"));
+
+    const auto first_id = first.substr(4, first.find('\n') - 4);
+    dispatcher->publish(EventData{Notification::Remove, Component::System, "system", 2, Component::None, ""});
+    const auto second = wait_and_read(*stream);
+    ASSERT_NE(std::string::npos, second.find("ResourceEvent.1.0.ResourceRemoved"));
+    ASSERT_NE(std::string::npos, second.find("/redfish/v1/Systems/2"));
+
+    // Reconnecting client gets what it missed
+    auto resumed = dispatcher->open_stream(server::Filter{}, first_id);
+    ASSERT_EQ(second, read_all(*resumed));
+
+    dispatcher->stop();
+    ASSERT_TRUE(stream->is_closed());
+    ASSERT_TRUE(dispatcher->open_stream(server::Filter{}, "")->is_closed());
+}
+
+TEST(EventStreamTest, DispatcherNotifiesWatches) {
+    auto* dispatcher = EventDispatcher::get_instance();
+    dispatcher->start();
+    int rendered = 0;
+    const auto render = [&rendered](server::Response& response) {
+        ++rendered;
+        response.set_status(server::status_2XX::ACCEPTED);
+    };
+
+    auto changed = dispatcher->watch("manager", std::chrono::seconds{30}, render);
+    auto expiring = dispatcher->watch("system", std::chrono::milliseconds{50}, render);
+    auto unchanged = dispatcher->watch("system", std::chrono::seconds{30}, render);
+    int resumed = 0;
+    ASSERT_TRUE(changed->wait([&resumed]() { ++resumed; }));
+
+    dispatcher->publish(EventData{Notification::Update, Component::Manager, "manager", 1, Component::None, ""});
+    ASSERT_TRUE(changed->wait_for(std::chrono::milliseconds{2000}));
+    ASSERT_EQ(1, resumed);
+    // Ready watch must not park the connection
+    ASSERT_FALSE(changed->wait([&resumed]() { ++resumed; }));
+
+    ASSERT_TRUE(expiring->wait_for(std::chrono::milliseconds{2000}));
+    ASSERT_FALSE(unchanged->is_ready());
+
+    server::Response response{};
+    changed->complete(response);
+    ASSERT_EQ(1, rendered);
+    ASSERT_EQ(server::status_2XX::ACCEPTED, response.get_status());
+
+    dispatcher->stop();
+    ASSERT_TRUE(unchanged->is_ready());
+    ASSERT_TRUE(dispatcher->watch("manager", std::chrono::seconds{30}, render)->is_ready());
+}
@@ -0,0 +1,128 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/security/authentication/peer_credentials_authentication.hpp"
+#include "psme/rest/server/connector/microhttpd/mhd_connector_options.hpp"
+
+#include <gtest/gtest.h>
+#include <microhttpd.h>
+
+#include <pwd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+using namespace psme::rest::security::authentication;
+using namespace psme::rest::server;
+
+namespace {
+
+std::string get_user_name() {
+    const auto* entry = ::getpwuid(::getuid());
+    return entry ? entry->pw_name : "";
+}
+
+/*! @brief Listening socket the connector options created for MHD */
+int get_listen_socket(MHDConnectorOptions& options) {
+    for (const auto* item = options.get_options_array(); MHD_OPTION_END != item->option; ++item) {
+        if (MHD_OPTION_LISTEN_SOCKET == item->option) {
+            return static_cast<int>(item->value);
+        }
+    }
+    return -1;
+}
+
+int connect_to(const std::string& path) {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd >= 0 && 0 != ::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address))) {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+} // namespace
+
+class PeerCredentialsAuthenticationTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_path = (std::filesystem::temp_directory_path() / ("redfish_test_" + std::to_string(::getpid()) + ".sock")).string();
+    }
+
+    void TearDown() override {
+        for (const int fd : {m_client, m_peer, m_listen}) {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+        }
+        std::filesystem::remove(m_path);
+    }
+
+    /*! @brief Listen on the local socket of a connector, connect to it and accept the connection */
+    void connect(const json::Json& peer_roles) {
+        auto config = json::Json::parse(R"({"port": 0, "thread-mode": "thread-per-connection"})");
+        config["socket-path"] = m_path;
+        config["peer-roles"] = peer_roles;
+        m_options = std::make_unique<ConnectorOptions>(config);
+        MHDConnectorOptions mhd_options{*m_options};
+        m_listen = get_listen_socket(mhd_options);
+        ASSERT_LE(0, m_listen);
+        m_client = connect_to(m_path);
+        ASSERT_LE(0, m_client);
+        m_peer = ::accept4(m_listen, nullptr, nullptr, SOCK_CLOEXEC);
+        ASSERT_LE(0, m_peer);
+    }
+
+    std::string m_path{};
+    std::unique_ptr<ConnectorOptions> m_options{};
+    int m_listen{-1};
+    int m_client{-1};
+    int m_peer{-1};
+};
+
+TEST_F(PeerCredentialsAuthenticationTest, LocalSocketIsCreatedForOwnerAndGroup) {
+    connect(json::Json::object());
+    ASSERT_EQ(ConnectorOptions::AuthenticationType::PEER_CREDENTIALS_AUTH, m_options->get_authentication_type());
+    struct stat status{};
+    ASSERT_EQ(0, ::stat(m_path.c_str(), &status));
+    ASSERT_TRUE(S_ISSOCK(status.st_mode));
+    ASSERT_EQ(S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP, status.st_mode & (S_IRWXU | S_IRWXG | S_IRWXO));
+}
+
+TEST_F(PeerCredentialsAuthenticationTest, UserWithLoginPrivilegeIsAllowed) {
+    const auto user = get_user_name();
+    ASSERT_FALSE(user.empty());
+    connect(json::Json{{user, "Administrator"}, {"no-such-user-of-redfish-test", "Administrator"}});
+    ASSERT_EQ(2, m_options->get_peer_roles().size());
+    ASSERT_TRUE(PeerCredentialsAuthentication{m_options->get_peer_roles()}.is_peer_allowed(m_peer));
+}
+
+TEST_F(PeerCredentialsAuthenticationTest, UnmappedUserIsRejected) {
+    connect(json::Json{{"no-such-user-of-redfish-test", "Administrator"}});
+    ASSERT_FALSE(PeerCredentialsAuthentication{m_options->get_peer_roles()}.is_peer_allowed(m_peer));
+}
+
+TEST_F(PeerCredentialsAuthenticationTest, UserOfUnknownRoleIsRejected) {
+    connect(json::Json{{get_user_name(), "NoSuchRole"}});
+    ASSERT_FALSE(PeerCredentialsAuthentication{m_options->get_peer_roles()}.is_peer_allowed(m_peer));
+}
+
+TEST_F(PeerCredentialsAuthenticationTest, SocketWithoutPeerIsRejected) {
+    connect(json::Json{{get_user_name(), "Administrator"}});
+    ASSERT_FALSE(PeerCredentialsAuthentication{m_options->get_peer_roles()}.is_peer_allowed(-1));
+}
+
+TEST_F(PeerCredentialsAuthenticationTest, InvalidSocketPathIsRejected) {
+    auto config = json::Json::parse(R"({"port": 0})");
+    config["socket-path"] = std::string(sizeof(sockaddr_un::sun_path), 'a');
+    ASSERT_THROW(MHDConnectorOptions{ConnectorOptions{config}}, std::runtime_error);
+}
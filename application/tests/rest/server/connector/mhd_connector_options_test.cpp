@@ -0,0 +1,80 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/server/connector/microhttpd/mhd_connector_options.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace psme::rest::server;
+
+namespace {
+
+constexpr std::uint16_t PORT = 8443;
+
+std::vector<std::string> get_hosts(const json::Json& bind_addresses) {
+    auto config = json::Json::parse(R"({"port": 8443, "restricted-to-interface": null})");
+    config["bind-addresses"] = bind_addresses;
+    std::vector<std::string> hosts{};
+    for (const auto& address : MHDConnectorOptions::get_listen_addresses(ConnectorOptions{config})) {
+        EXPECT_EQ(PORT, address.get_port());
+        hosts.push_back(address.get_host().to_string());
+    }
+    return hosts;
+}
+
+net::NetworkInterface::AddressTuple make_entry(const std::string& address) {
+    return {net::IpAddress::from_string(address), net::IpAddress{}, net::IpAddress{}};
+}
+
+} // namespace
+
+TEST(MHDConnectorOptionsTest, BindAddressesAreListenedOn) {
+    ASSERT_EQ((std::vector<std::string>{"127.0.0.1", "::1"}), get_hosts(json::Json::array({"127.0.0.1", "::1"})));
+}
+
+TEST(MHDConnectorOptionsTest, DuplicateBindAddressesAreSkipped) {
+    ASSERT_EQ((std::vector<std::string>{"127.0.0.1", "::1"}),
+              get_hosts(json::Json::array({"127.0.0.1", "::1", "127.0.0.1", "::1"})));
+}
+
+TEST(MHDConnectorOptionsTest, AddressesCoveredByAnyAddressAreSkipped) {
+    // The IPv4 any-address covers IPv4 addresses only
+    ASSERT_EQ((std::vector<std::string>{"0.0.0.0", "::1"}), get_hosts(json::Json::array({"127.0.0.1", "0.0.0.0", "::1"})));
+    // The IPv6 any-address is dual stack
+    ASSERT_EQ((std::vector<std::string>{"::"}), get_hosts(json::Json::array({"127.0.0.1", "::", "0.0.0.0", "::1"})));
+}
+
+TEST(MHDConnectorOptionsTest, LocalSocketHasNoListenAddresses) {
+    const auto config = json::Json::parse(R"({"port": 8443, "bind-addresses": ["::"], "socket-path": "/run/redfish.sock"})");
+    ASSERT_TRUE(MHDConnectorOptions::get_listen_addresses(ConnectorOptions{config}).empty());
+}
+
+TEST(MHDConnectorOptionsTest, InterfaceAddressesSkipLinkLocal) {
+    const net::NetworkInterface::AddressList address_list{make_entry("fe80::1"), make_entry("192.168.0.2"),
+                                                          make_entry("2001:db8::2"), make_entry("192.168.0.3")};
+    const auto addresses = MHDConnectorOptions::get_interface_addresses(address_list);
+    ASSERT_EQ(2, addresses.size());
+    ASSERT_EQ("192.168.0.2", addresses[0].to_string());
+    ASSERT_EQ("2001:db8::2", addresses[1].to_string());
+
+    ASSERT_TRUE(MHDConnectorOptions::get_interface_addresses({make_entry("fe80::1")}).empty());
+}
+
+TEST(MHDConnectorOptionsTest, InterfaceIsUsedWithoutBindAddresses) {
+    const auto loopback = net::IpAddress::from_string("127.0.0.1");
+    std::string name{};
+    try {
+        name = net::NetworkInterface::for_address(loopback).get_name();
+    }
+    catch (const std::exception&) {
+        GTEST_SKIP() << "No interface has address " << loopback.to_string();
+    }
+    auto config = json::Json::parse(R"({"port": 8443})");
+    config["restricted-to-interface"] = name;
+    const auto addresses = MHDConnectorOptions::get_listen_addresses(ConnectorOptions{config});
+    ASSERT_FALSE(addresses.empty());
+    ASSERT_EQ(loopback, addresses.front().get_host());
+}
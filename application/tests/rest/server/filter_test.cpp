@@ -0,0 +1,108 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/server/error/server_exception.hpp"
+#include "psme/rest/server/filter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace psme::rest::server;
+using namespace psme::rest::error;
+
+namespace {
+
+const json::Json RESOURCE = {
+    {"Id", "3"},
+    {"Name", "O'Brien"},
+    {"Count", 5},
+    {"Ratio", 0.5},
+    {"Enabled", true},
+    {"Status", {{"Health", "OK"}, {"State", "Enabled"}}}};
+
+bool matches(const std::string& expression) {
+    return Filter::parse(expression).evaluate([](const std::string& name) {
+        const auto pointer = json::Json::json_pointer("/" + name);
+        return RESOURCE.contains(pointer) ? RESOURCE[pointer] : json::Json{};
+    });
+}
+
+} // namespace
+
+TEST(FilterTest, EmptyFilterMatchesAll) {
+    const Filter filter{};
+    ASSERT_TRUE(filter.is_empty());
+    ASSERT_TRUE(filter.evaluate([](const std::string&) { return json::Json{}; }));
+}
+
+TEST(FilterTest, Comparisons) {
+    ASSERT_TRUE(matches("Id eq '3'"));
+    ASSERT_FALSE(matches("Id eq 3"));
+    ASSERT_TRUE(matches("Id ne 3"));
+    ASSERT_TRUE(matches("Name eq 'O''Brien'"));
+    ASSERT_TRUE(matches("Count gt 4 and Count ge 5 and Count lt 6 and Count le 5"));
+    ASSERT_TRUE(matches("Ratio lt 1 and Ratio gt 0.25"));
+    ASSERT_TRUE(matches("Enabled eq true"));
+    ASSERT_TRUE(matches("Status/Health eq 'OK'"));
+    ASSERT_TRUE(matches("Missing eq null"));
+    ASSERT_FALSE(matches("Name gt 1"));
+}
+
+TEST(FilterTest, LogicalOperatorsAndPrecedence) {
+    ASSERT_TRUE(matches("Count eq 1 or Count eq 5"));
+    ASSERT_TRUE(matches("not Count eq 1"));
+    ASSERT_TRUE(matches("Count eq 5 or Count eq 1 and Id eq 'x'"));
+    ASSERT_FALSE(matches("(Count eq 5 or Count eq 1) and Id eq 'x'"));
+    ASSERT_FALSE(matches("not (Enabled eq true)"));
+}
+
+TEST(FilterTest, InvalidExpressions) {
+    ASSERT_THROW(Filter::parse(""), ServerException);
+    ASSERT_THROW(Filter::parse("Id"), ServerException);
+    ASSERT_THROW(Filter::parse("Id eq"), ServerException);
+    ASSERT_THROW(Filter::parse("Id has '1'"), ServerException);
+    ASSERT_THROW(Filter::parse("Id eq Name"), ServerException);
+    ASSERT_THROW(Filter::parse("Id eq 'x"), ServerException);
+    ASSERT_THROW(Filter::parse("(Id eq 'x'"), ServerException);
+    ASSERT_THROW(Filter::parse("Id eq 'x')"), ServerException);
+    ASSERT_THROW(Filter::parse("and eq 1"), ServerException);
+}
+
+TEST(FilterTest, DeeplyNestedExpressionsAreRejected) {
+    const auto nested = [](const std::string& open, std::size_t depth, const std::string& close) {
+        std::string expression{};
+        for (std::size_t i = 0; i < depth; ++i) {
+            expression += open;
+        }
+        expression += "Id eq '1'";
+        for (std::size_t i = 0; i < depth; ++i) {
+            expression += close;
+        }
+        return expression;
+    };
+    ASSERT_NO_THROW(Filter::parse(nested("(", 32, ")")));
+    ASSERT_NO_THROW(Filter::parse(nested("not ", 32, "")));
+    ASSERT_THROW(Filter::parse(nested("(", 33, ")")), ServerException);
+    ASSERT_THROW(Filter::parse(nested("not (", 17, ")")), ServerException);
+
+    try {
+        Filter::parse(nested("(", 100000, ")"));
+        FAIL() << "Nested expression was accepted";
+    }
+    catch (const ServerException& e) {
+        ASSERT_EQ(400, e.get_error().get_http_status_code());
+    }
+}
+
+TEST(FilterTest, PropertiesAndRequiredEqualities) {
+    const auto filter = Filter::parse("TaskState eq 'Running' and (Id eq '1' or Id eq '2') and not Name eq 'x'");
+    ASSERT_EQ((std::vector<std::string>{"TaskState", "Id", "Name"}), filter.get_properties());
+
+    const auto equalities = filter.get_required_equalities();
+    ASSERT_EQ(1u, equalities.size());
+    ASSERT_EQ("TaskState", equalities[0].first);
+    ASSERT_EQ("Running", equalities[0].second);
+
+    ASSERT_TRUE(Filter::parse("Id eq '1' or Id eq '2'").get_required_equalities().empty());
+}
@@ -0,0 +1,44 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/server/latency_monitor.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace psme::rest::server;
+using namespace std::chrono_literals;
+
+TEST(LatencyMonitorTest, NearestRankPercentile) {
+    LatencyMonitor monitor{};
+    const auto now = LatencyMonitor::Clock::now();
+    ASSERT_EQ(0us, monitor.get_percentile(99, now));
+
+    for (int i = 100; i > 0; --i) {
+        monitor.record(std::chrono::milliseconds{i}, now);
+    }
+    ASSERT_EQ(99ms, monitor.get_percentile(99, now));
+    ASSERT_EQ(50ms, monitor.get_percentile(50, now));
+    ASSERT_EQ(100ms, monitor.get_percentile(100, now));
+}
+
+TEST(LatencyMonitorTest, OldSamplesAreIgnored) {
+    LatencyMonitor monitor{};
+    const auto now = LatencyMonitor::Clock::now();
+    monitor.record(500ms, now);
+    monitor.record(10ms, now + LatencyMonitor::WINDOW);
+    ASSERT_EQ(500ms, monitor.get_percentile(99, now + LatencyMonitor::WINDOW));
+    ASSERT_EQ(10ms, monitor.get_percentile(99, now + LatencyMonitor::WINDOW + 1ms));
+    ASSERT_EQ(0us, monitor.get_percentile(99, now + 2 * LatencyMonitor::WINDOW + 1ms));
+}
+
+TEST(LatencyMonitorTest, OnlyLastSamplesAreKept) {
+    LatencyMonitor monitor{};
+    const auto now = LatencyMonitor::Clock::now();
+    for (std::size_t i = 0; i < LatencyMonitor::SAMPLE_COUNT; ++i) {
+        monitor.record(1s, now);
+    }
+    for (std::size_t i = 0; i < LatencyMonitor::SAMPLE_COUNT; ++i) {
+        monitor.record(1ms, now);
+    }
+    ASSERT_EQ(1ms, monitor.get_percentile(100, now));
+}
@@ -0,0 +1,109 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/server/error/server_exception.hpp"
+#include "psme/rest/server/multipart_parser.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace psme::rest::server;
+using namespace psme::rest::error;
+
+namespace {
+
+const std::string CONTENT_TYPE = "multipart/form-data; boundary=\"xYzZY\"";
+
+/*! @brief Parts collected by the parser callbacks */
+struct Collector {
+    std::vector<MultipartParser::Part> parts{};
+    std::vector<std::string> contents{};
+    std::size_t ended{};
+
+    void attach(MultipartParser& parser) {
+        parser.set_callbacks(
+            [this](const MultipartParser::Part& part) {
+                parts.push_back(part);
+                contents.emplace_back();
+            },
+            [this](const char* data, std::size_t size) { contents.back().append(data, size); },
+            [this]() { ++ended; });
+    }
+};
+
+std::string make_body(const std::string& file) {
+    return "preamble is ignored\r\n"
+           "--xYzZY\r\n"
+           "Content-Disposition: form-data; name=\"UpdateParameters\"\r\n"
+           "Content-Type: application/json\r\n"
+           "\r\n"
+           "{\"Targets\":[]}\r\n"
+           "--xYzZY\r\n"
+           "Content-Disposition: form-data; name=\"UpdateFile\"; filename=\"image.pldm\"\r\n"
+           "Content-Type: application/octet-stream\r\n"
+           "\r\n" +
+           file + "\r\n"
+                  "--xYzZY--\r\n"
+                  "epilogue is ignored";
+}
+
+} // namespace
+
+TEST(MultipartParserTest, PartsAreParsed) {
+    // Contents resembling the boundary must not end the part
+    const std::string file = std::string{"\r\n--xYz\0\r\n-", 11} + std::string(1000, 'a') + "\r\n--xYzZ";
+    const auto body = make_body(file);
+
+    MultipartParser parser{CONTENT_TYPE};
+    Collector collector{};
+    collector.attach(parser);
+    parser.parse(body.data(), body.size());
+
+    ASSERT_TRUE(parser.is_complete());
+    ASSERT_EQ(2, collector.parts.size());
+    ASSERT_EQ(2, collector.ended);
+    ASSERT_EQ("UpdateParameters", collector.parts[0].name);
+    ASSERT_EQ("application/json", collector.parts[0].content_type);
+    ASSERT_EQ("{\"Targets\":[]}", collector.contents[0]);
+    ASSERT_EQ("UpdateFile", collector.parts[1].name);
+    ASSERT_EQ("image.pldm", collector.parts[1].filename);
+    ASSERT_EQ(file, collector.contents[1]);
+}
+
+TEST(MultipartParserTest, BodyMayBeSplitAnywhere) {
+    const std::string file(5000, 'b');
+    const auto body = make_body(file);
+
+    for (const std::size_t piece : {std::size_t{1}, std::size_t{3}, std::size_t{7}, std::size_t{64}}) {
+        MultipartParser parser{CONTENT_TYPE};
+        Collector collector{};
+        collector.attach(parser);
+        for (std::size_t pos = 0; pos < body.size(); pos += piece) {
+            parser.parse(body.data() + pos, std::min(piece, body.size() - pos));
+        }
+        ASSERT_TRUE(parser.is_complete());
+        ASSERT_EQ(2, collector.parts.size());
+        ASSERT_EQ(file, collector.contents[1]);
+    }
+}
+
+TEST(MultipartParserTest, IncompleteBody) {
+    const auto body = make_body("data");
+    MultipartParser parser{CONTENT_TYPE};
+    parser.parse(body.data(), body.size() / 2);
+    ASSERT_FALSE(parser.is_complete());
+}
+
+TEST(MultipartParserTest, InvalidInput) {
+    ASSERT_THROW(MultipartParser{"application/json"}, ServerException);
+    ASSERT_THROW(MultipartParser{"multipart/form-data"}, ServerException);
+
+    MultipartParser parser{CONTENT_TYPE};
+    const std::string invalid_boundary = "--xYzZYgarbage\r\n";
+    ASSERT_THROW(parser.parse(invalid_boundary.data(), invalid_boundary.size()), ServerException);
+
+    MultipartParser headers_parser{CONTENT_TYPE};
+    const std::string headers = "--xYzZY\r\nX-Padding: " + std::string(MultipartParser::MAX_HEADERS_SIZE, 'x');
+    ASSERT_THROW(headers_parser.parse(headers.data(), headers.size()), ServerException);
+}
@@ -21,7 +21,10 @@
 
 #include "psme/rest/constants/constants.hpp"
 #include "psme/rest/constants/routes.hpp"
+#include "psme/rest/server/error/server_exception.hpp"
+#include "psme/rest/server/http_headers.hpp"
 #include "psme/rest/server/multiplexer.hpp"
+#include "psme/rest/server/status.hpp"
 
 #include "gtest/gtest.h"
 
@@ -51,6 +54,28 @@ public:
 
 TestEndpoint::~TestEndpoint() {}
 
+class ReadOnlyEndpoint : public TestEndpoint {
+public:
+    explicit ReadOnlyEndpoint(const std::string& path) : TestEndpoint(path) {}
+
+    ~ReadOnlyEndpoint();
+
+    virtual void get(const Request& /* request */, Response& response) override {
+        ++m_get_count;
+        response.set_status(status_2XX::OK);
+        response.set_body("{}");
+    }
+
+    virtual void post(const Request& /* request */, Response& /*  response */) override {
+        ++m_post_count;
+    }
+
+    int m_get_count{0};
+    int m_post_count{0};
+};
+
+ReadOnlyEndpoint::~ReadOnlyEndpoint() {}
+
 class MultiplexerTest : public Test {
 public:
     MultiplexerTest() {
@@ -152,6 +177,74 @@ TEST_F(MultiplexerTest, TestBadUrlTemplate) {
     ASSERT_THROW(m_multiplexer.get_params(path, path_template), std::logic_error);
 }
 
+TEST_F(MultiplexerTest, MethodsAreDispatchedFromRoutingTable) {
+    auto endpoint = new ReadOnlyEndpoint(Routes::MANAGER_COLLECTION_PATH);
+    m_multiplexer.register_handler(MethodsHandler::UPtr(endpoint), {Method::GET});
+
+    const auto forward = [this](Method method, Response& response) {
+        Request request{};
+        request.set_method(method);
+        request.set_destination(Routes::MANAGER_COLLECTION_PATH);
+        m_multiplexer.forward_to_handler(response, request);
+    };
+
+    Response options{};
+    forward(Method::OPTIONS, options);
+    ASSERT_EQ(status_2XX::OK, options.get_status());
+    ASSERT_EQ("GET, HEAD, OPTIONS", options.get_headers().at(http_headers::Allow::ALLOW));
+    ASSERT_EQ(0, endpoint->m_get_count);
+
+    Response head{};
+    forward(Method::HEAD, head);
+    ASSERT_EQ(status_2XX::OK, head.get_status());
+    ASSERT_EQ(2u, head.get_body_size());
+    ASSERT_EQ(1, endpoint->m_get_count);
+
+    // Not implemented methods never reach the handler
+    Response post{};
+    forward(Method::POST, post);
+    ASSERT_EQ(status_4XX::METHOD_NOT_ALLOWED, post.get_status());
+    ASSERT_EQ("GET, HEAD, OPTIONS", post.get_headers().at(http_headers::Allow::ALLOW));
+    ASSERT_EQ(0, endpoint->m_post_count);
+}
+
+TEST_F(MultiplexerTest, AllMethodsAreAllowedByDefault) {
+    Request request{};
+    request.set_method(Method::OPTIONS);
+    request.set_destination(Routes::ROOT_PATH);
+    Response response{};
+    m_multiplexer.forward_to_handler(response, request);
+
+    ASSERT_EQ("GET, HEAD, POST, PATCH, PUT, DELETE, OPTIONS",
+              response.get_headers().at(http_headers::Allow::ALLOW));
+}
+
+TEST_F(MultiplexerTest, ExpandedResourcesAreDispatchedLikeRequests) {
+    auto endpoint = new ReadOnlyEndpoint(Routes::MANAGER_COLLECTION_PATH);
+    m_multiplexer.register_handler(MethodsHandler::UPtr(endpoint), {Method::GET});
+
+    std::vector<std::string> plugin_users{};
+    m_multiplexer.use_before([&plugin_users](const Request& request, Response&) {
+        plugin_users.push_back(request.get_header("X-User"));
+    });
+    m_multiplexer.set_access_callback([](const Request& request, Response&) {
+        return "admin" == request.get_header("X-User");
+    });
+
+    Request request{};
+    request.set_method(Method::GET);
+    request.set_destination(Routes::ROOT_PATH);
+    request.set_header("X-User", "admin");
+    ASSERT_EQ(json::Json::object(), m_multiplexer.get_resource(request, Routes::MANAGER_COLLECTION_PATH, {}));
+    ASSERT_EQ(1, endpoint->m_get_count);
+
+    // The credentials of the expanded request are checked
+    request.set_header("X-User", "operator");
+    ASSERT_THROW(m_multiplexer.get_resource(request, Routes::MANAGER_COLLECTION_PATH, {}), error::ServerException);
+    ASSERT_EQ(1, endpoint->m_get_count);
+    ASSERT_EQ((std::vector<std::string>{"admin", "operator"}), plugin_users);
+}
+
 } // namespace server
 } // namespace rest
 } // namespace psme
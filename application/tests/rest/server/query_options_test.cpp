@@ -0,0 +1,164 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/server/error/server_exception.hpp"
+#include "psme/rest/server/query_options.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace psme::rest::server;
+using namespace psme::rest::error;
+
+namespace {
+
+QueryOptions parse(const std::string& key, const std::string& value) {
+    Parameters query{};
+    query.set(key, value);
+    return QueryOptions::from_parameters(query);
+}
+
+} // namespace
+
+TEST(QueryOptionsTest, NoOptions) {
+    const auto options = QueryOptions::from_parameters(Parameters{});
+    ASSERT_FALSE(options.has_select());
+    ASSERT_FALSE(options.has_expand());
+}
+
+TEST(QueryOptionsTest, ExpandTypes) {
+    ASSERT_EQ(QueryOptions::ExpandType::ALL, parse("$expand", "*").get_expand_type());
+    ASSERT_EQ(QueryOptions::ExpandType::SUBORDINATE, parse("$expand", ".").get_expand_type());
+    ASSERT_EQ(QueryOptions::ExpandType::LINKS, parse("$expand", "~").get_expand_type());
+    ASSERT_EQ(1u, parse("$expand", ".").get_expand_levels());
+}
+
+TEST(QueryOptionsTest, ExpandLevels) {
+    const auto options = parse("$expand", ".($levels=3)");
+    ASSERT_TRUE(options.has_expand());
+    ASSERT_EQ(3u, options.get_expand_levels());
+
+    const auto nested = options.get_expanded_options(false);
+    ASSERT_EQ(QueryOptions::ExpandType::SUBORDINATE, nested.get_expand_type());
+    ASSERT_EQ(2u, nested.get_expand_levels());
+    ASSERT_FALSE(nested.get_expanded_options(false).get_expanded_options(false).has_expand());
+}
+
+TEST(QueryOptionsTest, InvalidExpand) {
+    ASSERT_THROW(parse("$expand", ""), ServerException);
+    ASSERT_THROW(parse("$expand", "x"), ServerException);
+    ASSERT_THROW(parse("$expand", ".($levels=0)"), ServerException);
+    ASSERT_THROW(parse("$expand", ".($levels=4)"), ServerException);
+    ASSERT_THROW(parse("$expand", ".($levels=a)"), ServerException);
+    ASSERT_THROW(parse("$expand", ".($top=1)"), ServerException);
+    ASSERT_THROW(parse("$expand", ".$levels=1"), ServerException);
+}
+
+TEST(QueryOptionsTest, InvalidSelect) {
+    ASSERT_THROW(parse("$select", ""), ServerException);
+    ASSERT_THROW(parse("$select", "Name,,Id"), ServerException);
+    ASSERT_THROW(parse("$select", "Status/"), ServerException);
+}
+
+TEST(QueryOptionsTest, SelectProperties) {
+    const auto options = parse("$select", "Name, Status/Health");
+    ASSERT_TRUE(options.has_select());
+
+    json::Json json = {
+        {"@odata.id", "/redfish/v1/Systems/1"},
+        {"@odata.type", "#ComputerSystem.v1_20_0.ComputerSystem"},
+        {"Id", "1"},
+        {"Name", "System"},
+        {"Status", {{"Health", "OK"}, {"State", "Enabled"}}}};
+    options.select(json);
+
+    const json::Json expected = {
+        {"@odata.id", "/redfish/v1/Systems/1"},
+        {"@odata.type", "#ComputerSystem.v1_20_0.ComputerSystem"},
+        {"Name", "System"},
+        {"Status", {{"Health", "OK"}}}};
+    ASSERT_EQ(expected, json);
+}
+
+TEST(QueryOptionsTest, SelectWholePropertyOverridesNested) {
+    const auto options = parse("$select", "Status/Health,Status");
+
+    json::Json json = {{"Status", {{"Health", "OK"}, {"State", "Enabled"}}}, {"Id", "1"}};
+    options.select(json);
+
+    const json::Json expected = {{"Status", {{"Health", "OK"}, {"State", "Enabled"}}}};
+    ASSERT_EQ(expected, json);
+}
+
+TEST(QueryOptionsTest, SelectKeepsPropertyAnnotations) {
+    const auto options = parse("$select", "Members");
+
+    json::Json json = {
+        {"@odata.id", "/redfish/v1/Systems"},
+        {"Name", "Systems"},
+        {"Members@odata.count", 1},
+        {"Members", {{{"@odata.id", "/redfish/v1/Systems/1"}}}}};
+    options.select(json);
+
+    ASSERT_FALSE(json.contains("Name"));
+    ASSERT_EQ(1, json["Members@odata.count"]);
+    ASSERT_EQ(1u, json["Members"].size());
+}
+
+TEST(QueryOptionsTest, SelectAll) {
+    ASSERT_FALSE(parse("$select", "*").has_select());
+}
+
+TEST(QueryOptionsTest, SelectedPropertiesAreRendered) {
+    const auto options = parse("$select", "Name,Status/Health");
+    ASSERT_TRUE(options.is_selected("Name"));
+    ASSERT_TRUE(options.is_selected("Status"));
+    ASSERT_FALSE(options.is_selected("Links"));
+    ASSERT_FALSE(options.is_selected("Health"));
+
+    ASSERT_TRUE(QueryOptions::from_parameters(Parameters{}).is_selected("Links"));
+}
+
+TEST(QueryOptionsTest, PageSize) {
+    auto options = QueryOptions::from_parameters(Parameters{});
+    ASSERT_EQ(QueryOptions::DEFAULT_PAGE_SIZE, options.get_page_size());
+    ASSERT_TRUE(options.has_next_page());
+
+    options = parse("$top", "5");
+    options.set_max_page_size(10);
+    ASSERT_EQ(5u, options.get_page_size());
+    ASSERT_FALSE(options.has_next_page());
+
+    options.set_max_page_size(2);
+    ASSERT_EQ(2u, options.get_page_size());
+    ASSERT_TRUE(options.has_next_page());
+}
+
+TEST(QueryOptionsTest, SkipAndSkipToken) {
+    ASSERT_EQ(7u, parse("$skip", "7").get_skip());
+    ASSERT_EQ(42u, parse("$skiptoken", "42").get_skip_token());
+    ASSERT_THROW(parse("$skip", "-1"), ServerException);
+    ASSERT_THROW(parse("$top", ""), ServerException);
+    ASSERT_THROW(parse("$top", "1e3"), ServerException);
+}
+
+TEST(QueryOptionsTest, NextLinkPreservesOptions) {
+    Parameters query{};
+    query.set("$top", "10");
+    query.set("$skip", "3");
+    query.set("$select", "Name, Id");
+    auto options = QueryOptions::from_parameters(query);
+    options.set_max_page_size(4);
+
+    ASSERT_EQ("/redfish/v1/TaskService/Tasks?$skiptoken=8&$top=6&$select=Name,%20Id",
+              options.get_next_link("/redfish/v1/TaskService/Tasks", 8));
+}
+
+TEST(QueryOptionsTest, Filter) {
+    ASSERT_FALSE(QueryOptions::from_parameters(Parameters{}).has_filter());
+    ASSERT_THROW(parse("$filter", "TaskState eq"), ServerException);
+
+    const auto options = parse("$filter", "TaskState eq 'Running'");
+    ASSERT_TRUE(options.has_filter());
+    ASSERT_EQ("/redfish/v1/TaskService/Tasks?$skiptoken=2&$filter=TaskState%20eq%20'Running'",
+              options.get_next_link("/redfish/v1/TaskService/Tasks", 2));
+}
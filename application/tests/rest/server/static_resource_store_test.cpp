@@ -0,0 +1,96 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "psme/rest/server/http_headers.hpp"
+#include "psme/rest/server/static_resource_store.hpp"
+
+#include <gtest/gtest.h>
+#include <zlib.h>
+
+using namespace psme::rest::server;
+
+namespace {
+
+const std::string BODY = std::string(1024, 'x') + "{\"Name\": \"Static\"}";
+
+std::string gunzip(const std::string& compressed) {
+    z_stream stream{};
+    inflateInit2(&stream, MAX_WBITS + 16);
+    std::string body(BODY.size() * 2, '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(compressed.data()));
+    stream.avail_in = static_cast<uInt>(compressed.size());
+    stream.next_out = reinterpret_cast<Bytef*>(&body[0]);
+    stream.avail_out = static_cast<uInt>(body.size());
+    inflate(&stream, Z_FINISH);
+    body.resize(stream.total_out);
+    inflateEnd(&stream);
+    return body;
+}
+
+} // namespace
+
+TEST(StaticResourceTest, SelectEncoding) {
+    const StaticResource resource{"/redfish/v1", "application/json", BODY};
+    using Encoding = StaticResource::Encoding;
+
+    ASSERT_EQ(Encoding::IDENTITY, resource.select_encoding(""));
+    ASSERT_EQ(Encoding::GZIP, resource.select_encoding("gzip, deflate"));
+    ASSERT_EQ(Encoding::IDENTITY, resource.select_encoding("gzip;q=0"));
+    ASSERT_EQ(Encoding::IDENTITY, resource.select_encoding("gzip;q=0.5"));
+    ASSERT_EQ(Encoding::GZIP, resource.select_encoding("gzip;q=0.5, identity;q=0.1"));
+    ASSERT_EQ(Encoding::GZIP, resource.select_encoding("*"));
+}
+
+TEST(StaticResourceTest, SmallBodyIsNotCompressed) {
+    const StaticResource resource{"/redfish/v1", "application/json", "{}"};
+    ASSERT_EQ(nullptr, resource.get_body(StaticResource::Encoding::GZIP));
+    ASSERT_EQ(StaticResource::Encoding::IDENTITY, resource.select_encoding("gzip"));
+}
+
+TEST(StaticResourceTest, WriteCompressedBody) {
+    const StaticResource resource{"/redfish/v1", "application/json", BODY};
+    Request request{};
+    request.set_header("Accept-Encoding", "gzip");
+
+    Response response{};
+    resource.write(request, response);
+
+    ASSERT_EQ(status_2XX::OK, response.get_status());
+    ASSERT_TRUE(response.is_body_persistent());
+    ASSERT_EQ("gzip", response.get_headers().at(http_headers::ContentEncoding::CONTENT_ENCODING));
+    ASSERT_EQ("application/json", response.get_headers().at(http_headers::ContentType::CONTENT_TYPE));
+    ASSERT_EQ(resource.get_etag(StaticResource::Encoding::GZIP),
+              response.get_headers().at(http_headers::ETag::ETAG));
+    ASSERT_LT(response.get_body().size(), BODY.size());
+    ASSERT_EQ(BODY, gunzip(response.get_body()));
+}
+
+TEST(StaticResourceTest, NotModified) {
+    const StaticResource resource{"/redfish/v1", "application/json", BODY};
+    const auto& etag = resource.get_etag(StaticResource::Encoding::IDENTITY);
+    ASSERT_NE(etag, resource.get_etag(StaticResource::Encoding::GZIP));
+
+    Request request{};
+    request.set_header("If-None-Match", "\"other\", W/" + etag);
+    Response response{};
+    resource.write(request, response);
+    ASSERT_EQ(status_3XX::NOT_MODIFIED, response.get_status());
+    ASSERT_TRUE(response.get_body().empty());
+
+    request.set_header("If-None-Match", "\"other\"");
+    Response modified{};
+    resource.write(request, modified);
+    ASSERT_EQ(status_2XX::OK, modified.get_status());
+    ASSERT_EQ(BODY, modified.get_body());
+}
+
+TEST(StaticResourceStoreTest, AddAndFind) {
+    auto* store = StaticResourceStore::get_instance();
+    store->add("/redfish/v1/$metadata", "application/xml", "<Edmx/>");
+
+    const auto resource = store->find("/redfish/v1/$metadata");
+    ASSERT_NE(nullptr, resource);
+    ASSERT_EQ("application/xml", resource->get_content_type());
+    ASSERT_EQ("<Edmx/>", *resource->get_body(StaticResource::Encoding::IDENTITY));
+    ASSERT_EQ(nullptr, store->find("/redfish/v1/Systems"));
+}
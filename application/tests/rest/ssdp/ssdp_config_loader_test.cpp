@@ -26,8 +26,12 @@
 
 #include "json-wrapper/json-wrapper.hpp"
 #include "psme/ssdp/ssdp_config_loader.hpp"
+#include "net/net_exception.hpp"
+#include "net/network_interface.hpp"
 #include "gtest/gtest.h"
 
+#include <unordered_set>
+
 namespace {
 
 const std::string service_uuid = "a7f09664-2181-11e6-96be-0ba482e91a3c";
@@ -75,4 +79,30 @@ TEST(LoadSsdpConfigTest, LoadFromDefaultConfiguration) {
     ASSERT_EQ("eth0", *ssdp_config.get_nic_names().cbegin());
 }
 
+TEST(LoadSsdpConfigTest, AnnouncedOnInterfacesOfBindAddresses) {
+    // Interface names depend on the host, the one owning the loopback address is looked up
+    const auto loopback = net::IpAddress::from_string("127.0.0.1");
+    std::string loopback_name{};
+    try {
+        loopback_name = net::NetworkInterface::for_address(loopback).get_name();
+    }
+    catch (const net::NetException&) {
+        GTEST_SKIP() << "No interface has address " << loopback.to_string();
+    }
+
+    auto config = get_default_config();
+    config["server"]["bind-addresses"] = json::Json::array({"127.0.0.1", "::1"});
+    const auto ssdp_config = load_ssdp_config(config, service_uuid);
+    // Bind addresses take precedence over the restricted interface, IPv6 ones are not announced
+    ASSERT_EQ(1, ssdp_config.get_nic_names().size());
+    ASSERT_EQ(loopback_name, *ssdp_config.get_nic_names().cbegin());
+
+    std::unordered_set<std::string> nic_names{};
+    for (const auto& nic : net::NetworkInterface::get_interfaces()) {
+        nic_names.insert(nic.get_name());
+    }
+    config["server"]["bind-addresses"] = json::Json::array({"::"});
+    ASSERT_EQ(nic_names, load_ssdp_config(config, service_uuid).get_nic_names());
+}
+
 } // namespace ssdp
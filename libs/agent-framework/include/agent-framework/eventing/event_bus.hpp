@@ -0,0 +1,83 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+/*!
+ * @file event_bus.hpp
+ * @brief In-process bus of model change events
+ * */
+
+#pragma once
+
+#include "agent-framework/eventing/event_data.hpp"
+#include "agent-framework/generic/singleton.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+
+namespace agent_framework {
+namespace eventing {
+
+/*!
+ * @brief Distributes model change events to in-process subscribers.
+ *
+ * Events are published synchronously, often with a model manager lock held,
+ * so subscribers must only queue the event and return.
+ * */
+class EventBus : public generic::Singleton<EventBus> {
+public:
+    using Subscriber = std::function<void(const EventData&)>;
+    using SubscriberId = std::uint64_t;
+
+    virtual ~EventBus();
+
+    /*!
+     * @brief Add a subscriber
+     * @param[in] subscriber Function called for each published event
+     * @return Id to be used to unsubscribe
+     * */
+    SubscriberId subscribe(Subscriber subscriber);
+
+    /*!
+     * @brief Remove a subscriber
+     * @param[in] id Id returned by subscribe
+     * */
+    void unsubscribe(SubscriberId id);
+
+    /*!
+     * @brief Check if anybody listens, so that publishers may skip building events
+     * @return true if there is at least one subscriber
+     * */
+    bool has_subscribers() const {
+        return 0 != m_subscriber_count;
+    }
+
+    /*!
+     * @brief Pass event to all subscribers
+     * @param[in] event Event to be published
+     * */
+    void publish(const EventData& event);
+private:
+    mutable std::mutex m_mutex{};
+    std::map<SubscriberId, Subscriber> m_subscribers{};
+    SubscriberId m_next_id{1};
+    std::atomic<std::size_t> m_subscriber_count{0};
+};
+
+/*!
+ * @brief Publish a change of a model object if anybody listens
+ * @param[in] notification Kind of change
+ * @param[in] resource Changed object
+ * */
+template <typename T>
+void send_event(model::enums::Notification notification, const T& resource) {
+    auto* bus = EventBus::get_instance();
+    if (bus->has_subscribers()) {
+        bus->publish(EventData::from_resource(notification, resource));
+    }
+}
+
+} // namespace eventing
+} // namespace agent_framework
@@ -0,0 +1,89 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+/*!
+ * @file event_data.hpp
+ * @brief Model change event
+ * */
+
+#pragma once
+
+#include "agent-framework/module/enum/common.hpp"
+
+#include <cstdint>
+#include <string>
+
+namespace agent_framework {
+namespace eventing {
+
+/*!
+ * @brief Describes a single change of a model object.
+ *
+ * Carries everything needed to locate the object in the REST tree,
+ * so that removals can be reported after the object is gone.
+ * */
+class EventData {
+public:
+    using Component = model::enums::Component;
+    using Notification = model::enums::Notification;
+
+    /*!
+     * @brief Constructor
+     * @param[in] notification Kind of change
+     * @param[in] type Component type of the object
+     * @param[in] uuid Object UUID
+     * @param[in] id Object REST id
+     * @param[in] parent_type Component type of the parent
+     * @param[in] parent_uuid Parent UUID
+     * */
+    EventData(Notification notification, Component type, const std::string& uuid, std::uint64_t id,
+              Component parent_type, const std::string& parent_uuid)
+        : m_notification{notification}, m_type{type}, m_uuid{uuid}, m_id{id},
+          m_parent_type{parent_type}, m_parent_uuid{parent_uuid} {}
+
+    /*!
+     * @brief Create event for a model object
+     * @param[in] notification Kind of change
+     * @param[in] resource Changed object
+     * @return Event data
+     * */
+    template <typename T>
+    static EventData from_resource(Notification notification, const T& resource) {
+        return EventData{notification, T::get_component(), resource.get_uuid(), resource.get_id(),
+                         resource.get_parent_type(), resource.get_parent_uuid()};
+    }
+
+    Notification get_notification() const {
+        return m_notification;
+    }
+
+    Component get_type() const {
+        return m_type;
+    }
+
+    const std::string& get_uuid() const {
+        return m_uuid;
+    }
+
+    std::uint64_t get_id() const {
+        return m_id;
+    }
+
+    Component get_parent_type() const {
+        return m_parent_type;
+    }
+
+    const std::string& get_parent_uuid() const {
+        return m_parent_uuid;
+    }
+private:
+    Notification m_notification;
+    Component m_type;
+    std::string m_uuid{};
+    std::uint64_t m_id{};
+    Component m_parent_type;
+    std::string m_parent_uuid{};
+};
+
+} // namespace eventing
+} // namespace agent_framework
@@ -27,6 +27,7 @@
 
 #pragma once
 
+#include <functional>
 #include <mutex>
 #include <type_traits>
 
@@ -38,6 +39,9 @@ namespace generic {
 template <class T, class Mutex>
 class ObjReference {
 public:
+    /*! @brief Function called with the data before the reference releases the lock */
+    using ReleaseHook = std::function<void(const T&)>;
+
     /*! @brief Default constructor */
     ObjReference() = delete;
 
@@ -71,6 +75,17 @@ public:
         m_mutex.lock();
     }
 
+    /*!
+     * @brief Constructor with a hook notified when the reference is released
+     * @param[in] data Data reference
+     * @param[in] mutex Mutex data reference
+     * @param[in] release_hook Function called with the data while the lock is still held
+     */
+    ObjReference(T& data, Mutex& mutex, ReleaseHook release_hook)
+        : m_mutex{mutex}, m_data{data}, m_release_hook{std::move(release_hook)} {
+        m_mutex.lock();
+    }
+
     /*!
      * @brief Get data pointer
      * @return Data pointer
@@ -103,11 +118,15 @@ public:
 
     /*! @brief Default destructor */
     virtual ~ObjReference() final {
+        if (m_release_hook) {
+            m_release_hook(m_data);
+        }
         m_mutex.unlock();
     }
 private:
     Mutex& m_mutex;
     T& m_data;
+    ReleaseHook m_release_hook{};
 };
 
 } // namespace generic
@@ -113,6 +113,11 @@ ENUM(Component, uint32_t,
      TrustedModule, Volume, LogService, LogEntry, BootOption,
      VirtualMedia);
 
+/*!
+ * @brief ENUM Notification describes kind of change of a model object
+ */
+ENUM(Notification, uint32_t, Add, Remove, Update);
+
 /*!
  * @brief ENUM IdentifierType for Identifier attribute durableNameFormat field
  */
@@ -290,7 +295,7 @@ ENUM(MediaType, uint32_t, CD, Floppy, USBStick, DVD);
 /*!
  * @brief ENUM TransferMethod for VirtualMediaInsert class
  */
-ENUM(TransferMethod, uint32_t, Upload);
+ENUM(TransferMethod, uint32_t, Upload, Stream);
 
 } // namespace enums
 } // namespace model
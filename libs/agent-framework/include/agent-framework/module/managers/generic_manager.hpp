@@ -27,6 +27,7 @@
 
 #pragma once
 
+#include "agent-framework/eventing/event_bus.hpp"
 #include "agent-framework/exceptions/exception.hpp"
 #include "agent-framework/generic/obj_reference.hpp"
 #include "agent-framework/module/enum/common.hpp"
@@ -36,8 +37,12 @@
 #include <atomic>
 #include <functional>
 #include <iostream>
+#include <map>
 #include <mutex>
+#include <set>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 /*! Psme namespace */
@@ -61,6 +66,7 @@ public:
     using Reference = generic::ObjReference<T, std::recursive_mutex>;
     using ReferenceVec = std::vector<Reference>;
     using Filter = std::function<bool(const T&)>;
+    using IndexKey = std::function<std::string(const T&)>;
 
     GenericManager() {
     }
@@ -81,7 +87,8 @@ public:
                   "Object with this UUID already exists. UUID = '" + entry.get_uuid() + "'.");
         }
         entry.touch(++m_current_epoch);
-        m_manager_data.push_back(std::move(entry));
+        eventing::send_event(model::enums::Notification::Add, entry);
+        insert_entry(std::move(entry));
     }
 
     template <typename U>
@@ -103,10 +110,21 @@ public:
             } else if (*it != entry) {
                 res = UpdateStatus::Updated;
             }
+            if (UpdateStatus::NoUpdate != res) {
+                eventing::send_event(model::enums::Notification::Update, entry);
+            }
 
-            (*it) = std::move(entry);
+            if (it->get_id() == entry.get_id()) {
+                index_entry(entry);
+                (*it) = std::move(entry);
+            } else {
+                unindex_entry(it->get_uuid());
+                m_manager_data.erase(it);
+                insert_entry(std::move(entry));
+            }
         } else {
-            m_manager_data.push_back(std::move(entry));
+            eventing::send_event(model::enums::Notification::Add, entry);
+            insert_entry(std::move(entry));
             res = UpdateStatus::Added;
         }
         return res;
@@ -157,7 +175,7 @@ public:
                                    return (entry.get_persistent_uuid() == uuid || entry.get_temporary_uuid() == uuid);
                                });
         if (m_manager_data.end() != it) {
-            return Reference(*it, m_mutex);
+            return make_reference(*it);
         }
         THROW(exceptions::InvalidUuid, "model",
               std::string(T::get_component().to_string()) + " [UUID = '" + uuid + "'] not found.");
@@ -169,7 +187,7 @@ public:
             THROW(exceptions::NotFound, "model",
                   std::string("Unexpected number of ") + T::get_component().to_string() + "s. Could not select the only entry.");
         }
-        return Reference(m_manager_data[0], m_mutex);
+        return make_reference(m_manager_data[0]);
     }
 
     using Hook = std::function<void(const T&)>;
@@ -179,6 +197,8 @@ public:
         const auto it = find_entry(uuid);
         if (m_manager_data.cend() != it) {
             pre_delete_hook(*it);
+            eventing::send_event(model::enums::Notification::Remove, *it);
+            unindex_entry(it->get_uuid());
             m_manager_data.erase(it);
         }
     }
@@ -193,7 +213,17 @@ public:
 
     void clear_entries() {
         std::lock_guard<std::recursive_mutex> lock{m_mutex};
+        if (eventing::EventBus::get_instance()->has_subscribers()) {
+            for (const auto& entry : m_manager_data) {
+                eventing::send_event(model::enums::Notification::Remove, entry);
+            }
+        }
         m_manager_data.clear();
+        for (auto& index : m_indexes) {
+            index.second.entries.clear();
+            index.second.keys.clear();
+        }
+        m_dirty_entries.clear();
     }
 
     KeysVec get_keys() const {
@@ -245,6 +275,31 @@ public:
         return ids;
     }
 
+    /*!
+     * @brief get one page of ids of objects governed by a manager
+     *
+     * Entries are kept in ascending id order, so the first id of the page
+     * is located by binary search and pages are stable between requests.
+     *
+     * @param first_id lowest id to be returned
+     * @param skip number of ids (not lower than first_id) to be skipped
+     * @param count maximum number of ids to be returned
+     * @return vector of ids in ascending order
+     */
+    IdsVec get_ids(std::uint64_t first_id, std::size_t skip, std::size_t count) const {
+        std::lock_guard<std::recursive_mutex> lock{m_mutex};
+        auto it = std::lower_bound(m_manager_data.cbegin(), m_manager_data.cend(), first_id,
+                                   [](const T& entry, std::uint64_t id) { return entry.get_id() < id; });
+        const auto available = static_cast<std::size_t>(std::distance(it, m_manager_data.cend()));
+        it += static_cast<typename ManagerDataVec::difference_type>(std::min(skip, available));
+
+        IdsVec ids{};
+        for (; it != m_manager_data.cend() && ids.size() < count; ++it) {
+            ids.emplace_back(it->get_id());
+        }
+        return ids;
+    }
+
     IdsVec get_ids(const std::string& parent_uuid) {
         std::lock_guard<std::recursive_mutex> lock{m_mutex};
         IdsVec ids{};
@@ -256,6 +311,67 @@ public:
         return ids;
     }
 
+    /*!
+     * @brief add a hash index of entries by the key returned by a function
+     *
+     * The index is maintained on every add, update and remove. Entries modified
+     * through references are re-indexed on the next lookup. An index with the
+     * same name is replaced.
+     *
+     * @param name name of the index
+     * @param key function computing the index key of an entry
+     */
+    void add_index(const std::string& name, IndexKey key) {
+        std::lock_guard<std::recursive_mutex> lock{m_mutex};
+        auto& index = m_indexes[name];
+        index = Index{};
+        index.key = std::move(key);
+        for (const auto& entry : m_manager_data) {
+            index.add(entry);
+        }
+    }
+
+    /*!
+     * @brief check if an index exists
+     * @param name name of the index
+     * @return true if the index was added
+     */
+    bool has_index(const std::string& name) const {
+        std::lock_guard<std::recursive_mutex> lock{m_mutex};
+        return m_indexes.cend() != m_indexes.find(name);
+    }
+
+    /*!
+     * @brief get entries with given index key
+     * @param name name of the index
+     * @param key index key
+     * @return copies of the matching entries in ascending id order
+     */
+    ManagerDataVec get_entries_by_index(const std::string& name, const std::string& key) {
+        std::lock_guard<std::recursive_mutex> lock{m_mutex};
+        const auto index = m_indexes.find(name);
+        if (m_indexes.cend() == index) {
+            THROW(exceptions::NotFound, "model",
+                  std::string(T::get_component().to_string()) + " index '" + name + "' not found.");
+        }
+        refresh_indexes();
+
+        ManagerDataVec ret{};
+        const auto matches = index->second.entries.find(key);
+        if (index->second.entries.cend() == matches) {
+            return ret;
+        }
+        for (const auto& id_uuid : matches->second) {
+            const auto range = std::equal_range(m_manager_data.cbegin(), m_manager_data.cend(), id_uuid.first, IdLess{});
+            const auto it = std::find_if(range.first, range.second,
+                                         [&id_uuid](const T& entry) { return entry.get_uuid() == id_uuid.second; });
+            if (range.second != it) {
+                ret.emplace_back(*it);
+            }
+        }
+        return ret;
+    }
+
     bool entry_exists(const std::string& uuid) {
         return m_manager_data.cend() != find_entry(uuid);
     }
@@ -317,6 +433,125 @@ protected:
     ManagerDataVec m_manager_data{};
     std::atomic<std::uint64_t> m_current_epoch{1};
 private:
+    /*!
+     * @brief insert entry keeping entries in ascending id order
+     * @param entry entry to be inserted
+     */
+    void insert_entry(T&& entry) {
+        // Ids are assigned incrementally, so new entries are usually appended
+        const auto position = std::upper_bound(m_manager_data.begin(), m_manager_data.end(), entry.get_id(),
+                                               [](std::uint64_t id, const T& other) { return id < other.get_id(); });
+        index_entry(entry);
+        m_manager_data.insert(position, std::move(entry));
+    }
+
+    /*! @brief id comparator of entries used for binary search */
+    struct IdLess {
+        bool operator()(const T& entry, std::uint64_t id) const {
+            return entry.get_id() < id;
+        }
+
+        bool operator()(std::uint64_t id, const T& entry) const {
+            return id < entry.get_id();
+        }
+    };
+
+    /*!
+     * @brief hash index of entries, keeping (id, uuid) pairs under each key
+     *
+     * Pairs of a key are ordered, so the matches are returned in ascending id order.
+     */
+    struct Index {
+        IndexKey key{};
+        std::unordered_map<std::string, std::set<std::pair<std::uint64_t, std::string>>> entries{};
+        std::unordered_map<std::string, std::pair<std::string, std::uint64_t>> keys{};
+
+        void add(const T& entry) {
+            remove(entry.get_uuid());
+            const auto entry_key = key(entry);
+            entries[entry_key].emplace(entry.get_id(), entry.get_uuid());
+            keys[entry.get_uuid()] = std::make_pair(entry_key, entry.get_id());
+        }
+
+        void remove(const std::string& uuid) {
+            const auto it = keys.find(uuid);
+            if (keys.end() == it) {
+                return;
+            }
+            const auto bucket = entries.find(it->second.first);
+            if (entries.end() != bucket) {
+                bucket->second.erase(std::make_pair(it->second.second, uuid));
+                if (bucket->second.empty()) {
+                    entries.erase(bucket);
+                }
+            }
+            keys.erase(it);
+        }
+    };
+
+    void index_entry(const T& entry) {
+        for (auto& index : m_indexes) {
+            index.second.add(entry);
+        }
+    }
+
+    void unindex_entry(const std::string& uuid) {
+        for (auto& index : m_indexes) {
+            index.second.remove(uuid);
+        }
+    }
+
+    /*!
+     * @brief create a locked reference to an entry
+     *
+     * Entries may be modified through references, so when anybody listens
+     * the entry is compared with its state at the time the reference was
+     * taken and an update event is published if it changed.
+     *
+     * @param entry entry to be referenced
+     * @return reference holding the manager lock
+     */
+    Reference make_reference(T& entry) {
+        mark_dirty(entry);
+        if (!eventing::EventBus::get_instance()->has_subscribers()) {
+            return Reference(entry, m_mutex);
+        }
+        return Reference(entry, m_mutex, [snapshot = entry](const T& modified) {
+            if (snapshot == modified) {
+                return;
+            }
+            try {
+                eventing::send_event(model::enums::Notification::Update, modified);
+            }
+            catch (const std::exception& e) {
+                log_error("model", "Cannot publish update of " << modified.get_uuid() << ": " << e.what());
+            }
+        });
+    }
+
+    void mark_dirty(const T& entry) {
+        if (!m_indexes.empty()) {
+            m_dirty_entries.emplace(entry.get_uuid(), entry.get_id());
+        }
+    }
+
+    /*! @brief re-index entries which might have been modified through references */
+    void refresh_indexes() {
+        for (const auto& uuid_id : m_dirty_entries) {
+            const auto range = std::equal_range(m_manager_data.cbegin(), m_manager_data.cend(), uuid_id.second, IdLess{});
+            const auto it = std::find_if(range.first, range.second,
+                                         [&uuid_id](const T& entry) { return entry.get_uuid() == uuid_id.first; });
+            if (range.second != it) {
+                index_entry(*it);
+            }
+        }
+        m_dirty_entries.clear();
+    }
+
+    std::unordered_map<std::string, Index> m_indexes{};
+    /*! @brief ids of the entries to re-index, by uuid */
+    std::unordered_map<std::string, std::uint64_t> m_dirty_entries{};
+
     typename ManagerDataVec::const_iterator find_entry(const std::string& uuid) const {
         auto it = std::find_if(m_manager_data.cbegin(),
                                m_manager_data.cend(),
@@ -402,6 +637,17 @@ private:
      * */
     template <typename Predicate>
     typename ManagerDataVec::difference_type remove_if(Predicate predicate) {
+        const bool notify = eventing::EventBus::get_instance()->has_subscribers();
+        if (!m_indexes.empty() || notify) {
+            for (const auto& entry : m_manager_data) {
+                if (predicate(entry)) {
+                    unindex_entry(entry.get_uuid());
+                    if (notify) {
+                        eventing::send_event(model::enums::Notification::Remove, entry);
+                    }
+                }
+            }
+        }
         auto last = m_manager_data.end();
         auto first = std::remove_if(m_manager_data.begin(), last, predicate);
         auto count_removed = std::distance(first, last);
@@ -161,11 +161,75 @@ public:
     void set_end_time(const OptionalField<std::string>& end_time) {
         m_end_time = end_time;
     }
+
+    /*!
+     * Get percentage of the task completed
+     *
+     * @return Percent complete, empty if the task does not report progress
+     * */
+    const OptionalField<std::uint32_t>& get_percent_complete() const {
+        return m_percent_complete;
+    }
+
+    /*!
+     * Set percentage of the task completed
+     *
+     * @param[in] percent_complete Percent complete
+     * */
+    void set_percent_complete(const OptionalField<std::uint32_t>& percent_complete) {
+        m_percent_complete = percent_complete;
+    }
+
+    /*!
+     * Get number of bytes transferred by the current stage of the task
+     *
+     * @return Bytes transferred, empty if the stage does not transfer data
+     * */
+    const OptionalField<std::uint64_t>& get_bytes_transferred() const {
+        return m_bytes_transferred;
+    }
+
+    /*!
+     * Get number of bytes the current stage of the task transfers
+     *
+     * @return Total bytes, empty if unknown
+     * */
+    const OptionalField<std::uint64_t>& get_total_bytes() const {
+        return m_total_bytes;
+    }
+
+    /*!
+     * Get estimated time until the current stage of the task completes
+     *
+     * @return Remaining seconds, empty if unknown
+     * */
+    const OptionalField<std::uint64_t>& get_estimated_remaining_seconds() const {
+        return m_estimated_remaining_seconds;
+    }
+
+    /*!
+     * Set progress of a data transfer
+     *
+     * @param[in] bytes_transferred Bytes transferred
+     * @param[in] total_bytes Total bytes of the transfer
+     * @param[in] estimated_remaining_seconds Estimated time until the transfer completes
+     * */
+    void set_transfer_progress(const OptionalField<std::uint64_t>& bytes_transferred,
+                               const OptionalField<std::uint64_t>& total_bytes,
+                               const OptionalField<std::uint64_t>& estimated_remaining_seconds) {
+        m_bytes_transferred = bytes_transferred;
+        m_total_bytes = total_bytes;
+        m_estimated_remaining_seconds = estimated_remaining_seconds;
+    }
 private:
     OptionalField<std::string> m_start_time{};
     OptionalField<std::string> m_end_time{};
     OptionalField<enums::TaskState> m_state{enums::TaskState::New};
     Messages m_messages{};
+    OptionalField<std::uint32_t> m_percent_complete{};
+    OptionalField<std::uint64_t> m_bytes_transferred{};
+    OptionalField<std::uint64_t> m_total_bytes{};
+    OptionalField<std::uint64_t> m_estimated_remaining_seconds{};
 
     static const enums::Component component;
 };
@@ -0,0 +1,34 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+/*!
+ * @file event_bus.cpp
+ * @brief In-process bus of model change events
+ * */
+
+#include "agent-framework/eventing/event_bus.hpp"
+
+using namespace agent_framework::eventing;
+
+EventBus::~EventBus() {}
+
+EventBus::SubscriberId EventBus::subscribe(Subscriber subscriber) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    const auto id = m_next_id++;
+    m_subscribers.emplace(id, std::move(subscriber));
+    m_subscriber_count = m_subscribers.size();
+    return id;
+}
+
+void EventBus::unsubscribe(SubscriberId id) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_subscribers.erase(id);
+    m_subscriber_count = m_subscribers.size();
+}
+
+void EventBus::publish(const EventData& event) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    for (const auto& subscriber : m_subscribers) {
+        subscriber.second(event);
+    }
+}
@@ -330,3 +330,87 @@ TEST(GenericManager, GetOnlySuccess) {
     auto entry_reference = gm.get_only_reference();
     EXPECT_EQ(elem, *entry_reference);
 }
+
+TEST(GenericManager, IDsAreListedInPages) {
+    GenericManager<TestObject> gm;
+    // Entries added out of order are listed in ascending id order
+    for (const std::uint64_t id : {3u, 1u, 5u, 2u, 4u}) {
+        gm.add_entry(TestObject{"0", std::to_string(id), id, 0, "P"});
+    }
+
+    using IdsVec = GenericManager<TestObject>::IdsVec;
+    EXPECT_EQ(gm.get_ids(0, 0, 2), (IdsVec{1, 2}));
+    EXPECT_EQ(gm.get_ids(0, 2, 2), (IdsVec{3, 4}));
+    EXPECT_EQ(gm.get_ids(3, 0, 10), (IdsVec{3, 4, 5}));
+    EXPECT_EQ(gm.get_ids(3, 1, 1), (IdsVec{4}));
+    EXPECT_EQ(gm.get_ids(0, 10, 10), IdsVec{});
+    EXPECT_EQ(gm.get_ids(6, 0, 10), IdsVec{});
+
+    // Removing an entry does not shift continuation pages
+    gm.remove_entry("4");
+    EXPECT_EQ(gm.get_ids(4, 0, 10), (IdsVec{5}));
+}
+
+TEST_F(GenericManagerTest, EntriesAreFoundByIndex) {
+    gm.add_index("data", [](const TestObject& entry) { return entry.get_data().substr(0, 1); });
+    EXPECT_TRUE(gm.has_index("data"));
+    EXPECT_FALSE(gm.has_index("other"));
+    EXPECT_THROW(gm.get_entries_by_index("other", "C"), ::agent_framework::exceptions::NotFound);
+
+    // Matching entries are returned in ascending id order
+    auto entries = gm.get_entries_by_index("data", "C");
+    ASSERT_EQ(entries.size(), 4u);
+    for (unsigned i = 0; i < 4u; ++i) {
+        EXPECT_EQ(entries[i], ::elems[i + 1]);
+    }
+    EXPECT_EQ(gm.get_entries_by_index("data", "G").size(), 4u);
+    EXPECT_TRUE(gm.get_entries_by_index("data", "X").empty());
+
+    // Index follows changes made through references, updates and removals
+    gm.get_entry_reference(::elems[1].get_uuid())->set_data("X1");
+    // Reference released without a change is not reported
+    gm.get_entry_reference(::elems[3].get_uuid())->set_data(::elems[3].get_data());
+    TestObject updated = ::elems[2];
+    updated.set_data("X2");
+    gm.add_or_update_entry(updated);
+    gm.remove_entry(::elems[3].get_uuid());
+    gm.add_entry(TestObject{"1", "1-5", 5, 0, "C5"});
+    entries = gm.get_entries_by_index("data", "C");
+    ASSERT_EQ(entries.size(), 2u);
+    EXPECT_EQ(entries[0].get_uuid(), ::elems[4].get_uuid());
+    EXPECT_EQ(entries[1].get_uuid(), "1-5");
+    EXPECT_EQ(gm.get_entries_by_index("data", "X").size(), 2u);
+
+    gm.remove_by_parent("1");
+    EXPECT_TRUE(gm.get_entries_by_index("data", "C").empty());
+    EXPECT_TRUE(gm.get_entries_by_index("data", "X").empty());
+    EXPECT_EQ(gm.get_entries_by_index("data", "G").size(), 4u);
+
+    gm.clear_entries();
+    EXPECT_TRUE(gm.get_entries_by_index("data", "G").empty());
+}
+
+TEST_F(GenericManagerTest, ChangesArePublished) {
+    std::vector<std::pair<enums::Notification, std::string>> events{};
+    auto* bus = eventing::EventBus::get_instance();
+    const auto id = bus->subscribe([&events](const eventing::EventData& event) {
+        events.emplace_back(event.get_notification(), event.get_uuid());
+    });
+
+    gm.add_entry(TestObject{"1", "1-5", 5, 0, "C5"});
+    gm.get_entry_reference(::elems[1].get_uuid())->set_data("X1");
+    TestObject updated = ::elems[2];
+    updated.set_data("X2");
+    gm.add_or_update_entry(updated);
+    // Identical entry is not reported
+    gm.add_or_update_entry(::elems[3]);
+    gm.remove_entry(::elems[4].get_uuid());
+    bus->unsubscribe(id);
+    gm.remove_entry(::elems[0].get_uuid());
+
+    ASSERT_EQ(events.size(), 4u);
+    EXPECT_EQ(events[0], std::make_pair(enums::Notification(enums::Notification::Add), std::string("1-5")));
+    EXPECT_EQ(events[1], std::make_pair(enums::Notification(enums::Notification::Update), ::elems[1].get_uuid()));
+    EXPECT_EQ(events[2], std::make_pair(enums::Notification(enums::Notification::Update), ::elems[2].get_uuid()));
+    EXPECT_EQ(events[3], std::make_pair(enums::Notification(enums::Notification::Remove), ::elems[4].get_uuid()));
+}
@@ -13,6 +13,30 @@ static json::Json DEFAULT_VALIDATOR_JSON = R"~(
     "$schema": "http://json-schema.org/draft-07/schema#",
     "title": "Intel IPU Redfish Service Configuration",
     "type": "object",
+    "definitions": {
+        "fault-profile": {
+            "type": "object",
+            "description": "Latency and error distribution of a simulated operation",
+            "properties": {
+                "latency-ms": {
+                    "type": "integer",
+                    "description": "Mean latency in milliseconds",
+                    "minimum": 0
+                },
+                "jitter-ms": {
+                    "type": "integer",
+                    "description": "Largest deviation of the uniformly distributed latency from its mean in milliseconds",
+                    "minimum": 0
+                },
+                "error-rate": {
+                    "type": "number",
+                    "description": "Probability of an operation failing",
+                    "minimum": 0,
+                    "maximum": 1
+                }
+            }
+        }
+    },
     "properties": {
         "service": {
             "type": "string",
@@ -24,6 +48,14 @@ static json::Json DEFAULT_VALIDATOR_JSON = R"~(
                 "restricted-to-interface": {
                     "type": ["string", "null"]
                 },
+                "bind-addresses": {
+                    "type": "array",
+                    "description": "IPv4 and IPv6 addresses to listen on, takes precedence over restricted-to-interface",
+                    "items": {
+                        "type": "string"
+                    },
+                    "minItems": 1
+                },
                 "certs-directory": {
                     "type": "string",
                     "description": "Path to directory containing certificates"
@@ -52,10 +84,44 @@ static json::Json DEFAULT_VALIDATOR_JSON = R"~(
                     "type": "string",
                     "description": "Authentication type",
                     "enum": ["none", "basic", "session", "basic-or-session"]
+                },
+                "page-size": {
+                    "type": "integer",
+                    "description": "Maximum number of collection members returned in a single response",
+                    "minimum": 1
                 }
             },
             "required": ["restricted-to-interface", "certs-directory", "port", "thread-mode", "client-cert-required", "authentication-type"]
         },
+        "local-server": {
+            "type": "object",
+            "description": "Plain HTTP connector for on-box clients on a Unix domain socket",
+            "properties": {
+                "socket-path": {
+                    "type": "string",
+                    "description": "Path of the Unix domain socket",
+                    "minLength": 1
+                },
+                "thread-mode": {
+                    "type": "string",
+                    "description": "Thread mode",
+                    "enum": ["select", "thread-per-connection"]
+                },
+                "thread-pool-size": {
+                    "type": "integer",
+                    "description": "Thread pool size used by connector in SELECT thread-mode.",
+                    "minimum": 1
+                },
+                "peer-roles": {
+                    "type": "object",
+                    "description": "Redfish roles of the local users allowed to connect",
+                    "additionalProperties": {
+                        "type": "string"
+                    }
+                }
+            },
+            "required": ["socket-path"]
+        },
         "authentication": {
             "type": "object",
             "properties": {
@@ -116,6 +182,102 @@ static json::Json DEFAULT_VALIDATOR_JSON = R"~(
             },
             "required": ["location"]
         },
+        "transfer-limits": {
+            "type": "object",
+            "properties": {
+                "max-download-rate": {
+                    "type": "integer",
+                    "description": "Largest download rate of images in bytes per second, 0 if unlimited",
+                    "minimum": 0
+                },
+                "max-write-rate": {
+                    "type": "integer",
+                    "description": "Largest rate of writing downloaded images in bytes per second, 0 if unlimited",
+                    "minimum": 0
+                },
+                "adaptive": {
+                    "type": "boolean",
+                    "description": "Whether downloads slow down while REST requests are slow"
+                },
+                "latency-target-ms": {
+                    "type": "integer",
+                    "description": "99th percentile of REST read latency above which downloads slow down",
+                    "minimum": 1
+                },
+                "low-priority": {
+                    "type": "boolean",
+                    "description": "Whether downloads run at lower CPU and I/O priority"
+                }
+            }
+        },
+        "image-cache": {
+            "type": "object",
+            "properties": {
+                "location": {
+                    "type": "string",
+                    "description": "Directory downloaded images are cached in, on the file system they are downloaded to"
+                },
+                "capacity": {
+                    "type": "integer",
+                    "description": "Largest total size of the cached images in bytes, 0 disables the cache",
+                    "minimum": 0
+                },
+                "copy-limit": {
+                    "type": "integer",
+                    "description": "Largest image in bytes copied into the cache if it cannot be linked, 0 disables copying",
+                    "minimum": 0
+                }
+            }
+        },
+        "inventory": {
+            "type": "object",
+            "properties": {
+                "refresh-interval-s": {
+                    "type": "integer",
+                    "description": "Age in seconds above which the firmware inventory is queried again, 0 to query it only at startup and after updates",
+                    "minimum": 0
+                }
+            }
+        },
+        "backend": {
+            "type": "object",
+            "properties": {
+                "type": {
+                    "type": "string",
+                    "description": "Backend performing the operations, the IPU device or a simulator of it",
+                    "enum": ["device", "simulator"]
+                },
+                "simulator": {
+                    "type": "object",
+                    "properties": {
+                        "root": {
+                            "type": "string",
+                            "description": "Directory of the flash target and the served images, preferably on tmpfs"
+                        },
+                        "image-server-port": {
+                            "type": "integer",
+                            "description": "Loopback port the images are served on, 0 for any free port",
+                            "minimum": 0,
+                            "maximum": 65535
+                        },
+                        "cpchnl-max-outstanding": {
+                            "type": "integer",
+                            "description": "Number of CPChannel commands outstanding at once",
+                            "minimum": 1
+                        },
+                        "firmware-build": {
+                            "type": "string",
+                            "description": "Reported build of the IMC firmware"
+                        },
+                        "cpchnl": {"$ref": "#/definitions/fault-profile"},
+                        "inventory": {"$ref": "#/definitions/fault-profile"},
+                        "update": {"$ref": "#/definitions/fault-profile"},
+                        "image-server": {"$ref": "#/definitions/fault-profile"},
+                        "imc-reset": {"$ref": "#/definitions/fault-profile"}
+                    }
+                }
+            }
+        },
         "loggers": {
             "type": "array",
             "items": {
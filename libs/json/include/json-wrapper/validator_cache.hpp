@@ -0,0 +1,91 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+/*!
+ * @file validator_cache.hpp
+ */
+
+#pragma once
+
+#include "json-wrapper/json-wrapper.hpp"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+
+namespace json {
+
+/*!
+ * @brief Process-wide registry of compiled JSON schema validators.
+ *
+ * Compiling a schema costs much more than validating a document with it, so
+ * each schema is compiled once, when it is added under its name, and documents
+ * are validated by that name. Compiled validators are not modified by
+ * validation, so documents may be validated from several threads at once.
+ */
+class ValidatorCache {
+public:
+    /*! @brief Compiled validator of a schema */
+    using Validator = std::shared_ptr<const nlohmann::json_schema::json_validator>;
+
+    /*!
+     * @brief Get the cache of the process
+     * @return Cache instance
+     */
+    static ValidatorCache& get_instance();
+
+    ValidatorCache() = default;
+    ValidatorCache(const ValidatorCache&) = delete;
+    ValidatorCache& operator=(const ValidatorCache&) = delete;
+
+    /*!
+     * @brief Compile a schema and keep its validator under a name, replacing a previous one
+     * @param[in] name Name identifying the schema
+     * @param[in] schema Schema to compile
+     * @return Compiled validator
+     * @throw std::exception if the schema is invalid
+     */
+    Validator add(const std::string& name, const Json& schema);
+
+    /*!
+     * @brief Get validator of a schema
+     * @param[in] name Name the schema was added under
+     * @return Compiled validator
+     * @throw std::out_of_range if no schema was added under the name
+     */
+    Validator get(const std::string& name) const;
+
+    /*!
+     * @brief Validate a document
+     * @param[in] name Name the schema was added under
+     * @param[in] document Document to validate
+     * @throw std::exception if there is no such schema or the document does not match it
+     */
+    void validate(const std::string& name, const Json& document) const;
+
+    /*!
+     * @brief Drop validator of a schema
+     * @param[in] name Name the schema was added under
+     */
+    void remove(const std::string& name);
+
+    /*!
+     * @brief Drop all validators
+     */
+    void clear();
+
+    /*!
+     * @brief Get number of schemas compiled so far
+     * @return Number of compilations
+     */
+    std::uint64_t get_compilations() const;
+
+private:
+    mutable std::shared_mutex m_mutex{};
+    std::map<std::string, Validator> m_validators{};
+    std::uint64_t m_compilations{0};
+};
+
+}
@@ -0,0 +1,54 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "json-wrapper/validator_cache.hpp"
+
+#include <mutex>
+#include <stdexcept>
+
+using namespace json;
+
+ValidatorCache& ValidatorCache::get_instance() {
+    static ValidatorCache cache{};
+    return cache;
+}
+
+ValidatorCache::Validator ValidatorCache::add(const std::string& name, const Json& schema) {
+    // Compiled without the lock, validation goes on meanwhile
+    auto compiled = std::make_shared<nlohmann::json_schema::json_validator>();
+    compiled->set_root_schema(schema);
+
+    std::unique_lock<std::shared_mutex> lock{m_mutex};
+    m_validators[name] = compiled;
+    ++m_compilations;
+    return compiled;
+}
+
+ValidatorCache::Validator ValidatorCache::get(const std::string& name) const {
+    std::shared_lock<std::shared_mutex> lock{m_mutex};
+    const auto it = m_validators.find(name);
+    if (m_validators.end() == it) {
+        throw std::out_of_range("JSON schema " + name + " is not registered.");
+    }
+    return it->second;
+}
+
+void ValidatorCache::validate(const std::string& name, const Json& document) const {
+    // The validator is kept alive by the pointer also if it is removed meanwhile
+    get(name)->validate(document);
+}
+
+void ValidatorCache::remove(const std::string& name) {
+    std::unique_lock<std::shared_mutex> lock{m_mutex};
+    m_validators.erase(name);
+}
+
+void ValidatorCache::clear() {
+    std::unique_lock<std::shared_mutex> lock{m_mutex};
+    m_validators.clear();
+}
+
+std::uint64_t ValidatorCache::get_compilations() const {
+    std::shared_lock<std::shared_mutex> lock{m_mutex};
+    return m_compilations;
+}
@@ -0,0 +1,97 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/* Copyright (C) 2024 Intel Corporation */
+
+#include "json-wrapper/validator_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace json;
+
+namespace {
+
+const Json SCHEMA = R"~(
+{
+    "$schema": "http://json-schema.org/draft-07/schema#",
+    "type": "object",
+    "definitions": {
+        "port": {"type": "integer", "minimum": 1, "maximum": 65535}
+    },
+    "properties": {
+        "BootType": {"type": "string", "enum": ["LocalIscsiBoot", "DramBoot", "Pxe", "Http", "Other"]},
+        "State": {"type": "string", "enum": ["ContinuousOverride", "OneTimeOverride"]},
+        "VPortId": {"type": "integer"},
+        "Ports": {"type": "array", "items": {"$ref": "#/definitions/port"}},
+        "Error": {"type": "string"}
+    },
+    "required": ["BootType", "State", "VPortId", "Error"]
+})~"_json;
+
+const Json DOCUMENT = R"~(
+{
+    "BootType": "DramBoot",
+    "State": "ContinuousOverride",
+    "VPortId": 0,
+    "Ports": [8080, 8443],
+    "Error": ""
+})~"_json;
+
+} // namespace
+
+TEST(ValidatorCacheTest, SchemaIsCompiledOnce) {
+    ValidatorCache cache{};
+    const auto validator = cache.add("schema", SCHEMA);
+    for (int i = 0; i < 10; ++i) {
+        cache.validate("schema", DOCUMENT);
+    }
+    ASSERT_EQ(1, cache.get_compilations());
+    ASSERT_EQ(validator, cache.get("schema"));
+}
+
+TEST(ValidatorCacheTest, AddedSchemaReplacesPreviousOne) {
+    ValidatorCache cache{};
+    const auto validator = cache.add("schema", SCHEMA);
+    const auto replaced = cache.add("schema", SCHEMA);
+    ASSERT_EQ(2, cache.get_compilations());
+    ASSERT_NE(validator, replaced);
+    ASSERT_EQ(replaced, cache.get("schema"));
+}
+
+TEST(ValidatorCacheTest, SchemasAreKeptByName) {
+    ValidatorCache cache{};
+    ASSERT_NE(cache.add("first", SCHEMA), cache.add("second", SCHEMA));
+    ASSERT_EQ(2, cache.get_compilations());
+}
+
+TEST(ValidatorCacheTest, UnknownSchemaIsRejected) {
+    ValidatorCache cache{};
+    ASSERT_THROW(cache.validate("schema", DOCUMENT), std::out_of_range);
+
+    cache.add("schema", SCHEMA);
+    cache.remove("schema");
+    ASSERT_THROW(cache.get("schema"), std::out_of_range);
+
+    cache.add("schema", SCHEMA);
+    cache.clear();
+    ASSERT_THROW(cache.get("schema"), std::out_of_range);
+}
+
+TEST(ValidatorCacheTest, DocumentsAreValidatedConcurrently) {
+    ValidatorCache cache{};
+    cache.add("schema", SCHEMA);
+    std::vector<std::thread> threads{};
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&cache] {
+            for (int j = 0; j < 50; ++j) {
+                cache.validate("schema", DOCUMENT);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(1, cache.get_compilations());
+}
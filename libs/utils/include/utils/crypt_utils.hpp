@@ -21,10 +21,51 @@
 
 #pragma once
 
+#include <cstddef>
+#include <memory>
 #include <string>
 
 namespace utils {
 
+/*!
+ * @brief Incremental SHA-256 digest of data passed in pieces.
+ * */
+class Sha256 {
+public:
+    /*!
+     * @brief Size of the digest in Bytes.
+     * */
+    static constexpr std::size_t DIGEST_SIZE = 32;
+
+    Sha256();
+    ~Sha256();
+
+    Sha256(const Sha256&) = delete;
+    Sha256& operator=(const Sha256&) = delete;
+
+    /*!
+     * @brief Adds next piece of data to the digest.
+     * @param data pointer to the data.
+     * @param size size of the data in Bytes.
+     * */
+    void update(const void* data, std::size_t size);
+
+    /*!
+     * @brief Starts a new digest, data added so far is discarded.
+     * */
+    void reset();
+
+    /*!
+     * @brief Gets digest of the data added so far.
+     * @return lowercase hexadecimal digest.
+     * */
+    std::string hex_digest() const;
+
+private:
+    struct Handle;
+    std::unique_ptr<Handle> m_handle;
+};
+
 /*!
  * @brief Generates key/hash with PBKDF2 key derivation function (SHA512 based).
  * @param password string with the plain text password to be hashed.
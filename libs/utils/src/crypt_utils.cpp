@@ -61,6 +61,50 @@ size_t get_salt_size() {
     return KDF_SALT_SIZE;
 }
 
+struct Sha256::Handle {
+    gcry_md_hd_t md{nullptr};
+};
+
+constexpr std::size_t Sha256::DIGEST_SIZE;
+
+Sha256::Sha256() : m_handle{std::make_unique<Handle>()} {
+    gcry_error_t error = gcry_md_open(&m_handle->md, GCRY_MD_SHA256, 0);
+    if (error) {
+        throw std::runtime_error("Error on hashing (SHA256): " + std::string(gcry_strerror(error)));
+    }
+}
+
+Sha256::~Sha256() {
+    gcry_md_close(m_handle->md);
+}
+
+void Sha256::update(const void* data, std::size_t size) {
+    gcry_md_write(m_handle->md, data, size);
+}
+
+void Sha256::reset() {
+    gcry_md_reset(m_handle->md);
+}
+
+std::string Sha256::hex_digest() const {
+    static constexpr const char HEX_DIGITS[] = "0123456789abcdef";
+    // Reading the digest finalizes it, so it is read from a copy
+    gcry_md_hd_t copy{nullptr};
+    gcry_error_t error = gcry_md_copy(&copy, m_handle->md);
+    if (error) {
+        throw std::runtime_error("Error on hashing (SHA256): " + std::string(gcry_strerror(error)));
+    }
+    const auto* digest = gcry_md_read(copy, GCRY_MD_SHA256);
+    std::string hex{};
+    hex.reserve(2 * DIGEST_SIZE);
+    for (std::size_t index = 0; index < DIGEST_SIZE; index++) {
+        hex.push_back(HEX_DIGITS[digest[index] >> 4]);
+        hex.push_back(HEX_DIGITS[digest[index] & 0x0f]);
+    }
+    gcry_md_close(copy);
+    return hex;
+}
+
 std::string generate_salt() {
     char salt[KDF_SALT_SIZE + 1]{0};
     gcry_create_nonce(salt, KDF_SALT_SIZE);